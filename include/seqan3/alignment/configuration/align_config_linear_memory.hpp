@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::linear_memory configuration.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes the begin positions and the alignment in linear memory.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * In order to compute the \ref seqan3::align_cfg::output_begin_position "begin positions" or the
+ * \ref seqan3::align_cfg::output_alignment "alignment", the alignment algorithm stores a trace matrix with one cell
+ * per pair of letters. For long sequences, e.g. two sequences of 1 Mbp, this matrix does not fit into memory.
+ * With this configuration, the alignment is instead computed with the divide-and-conquer algorithm of Myers and
+ * Miller (Hirschberg's algorithm for affine gap costs), which only stores a constant number of score columns. The
+ * optimal score is the same, but the runtime roughly doubles. If seqan3::align_cfg::parallel is configured, the
+ * halves of the divide-and-conquer are computed with up to the given number of threads.
+ *
+ * The linear memory algorithm is only used for sequence pairs whose full trace matrix would need more than
+ * #memory_limit bytes; all other sequence pairs are computed as usual. By default, the linear memory algorithm is
+ * always used.
+ *
+ * This configuration can only be used for global alignments with or without free end gaps (see
+ * seqan3::align_cfg::method_global). It cannot be combined with seqan3::align_cfg::band_fixed_size and
+ * seqan3::align_cfg::vectorised. The \ref seqan3::align_cfg::edit_scheme "edit distance" is computed with the
+ * general affine algorithm, if the begin positions or the alignment are requested.
+ *
+ * \note For more information, please refer to the original article:
+ *       MYERS, Eugene W.; MILLER, Webb. Optimal alignments in linear space.
+ *       Bioinformatics, 1988, 4. Jg., Nr. 1, S. 11-17.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_linear_memory_example.cpp
+ */
+class linear_memory : private pipeable_config_element
+{
+public:
+    //!\brief The maximal size of the trace matrix in bytes that is computed in full [default: 0].
+    size_t memory_limit{0u};
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr linear_memory() noexcept = default; //!< Defaulted
+    constexpr linear_memory(linear_memory const &) noexcept = default; //!< Defaulted
+    constexpr linear_memory(linear_memory &&) noexcept = default; //!< Defaulted
+    constexpr linear_memory & operator=(linear_memory const &) noexcept = default; //!< Defaulted
+    constexpr linear_memory & operator=(linear_memory &&) noexcept = default; //!< Defaulted
+    ~linear_memory() noexcept = default; //!< Defaulted
+
+    /*!\brief Initialises the memory limit.
+     *
+     * \param memory_limit \copybrief memory_limit
+     */
+    constexpr linear_memory(size_t const memory_limit) noexcept :
+        memory_limit{memory_limit}
+    {}
+    //!\}
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::linear_memory};
+};
+
+} // namespace seqan3::align_cfg
@@ -6,7 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 /*!\file
- * \brief Provides global and local alignment configurations.
+ * \brief Provides global, local and extension alignment configurations.
  * \author Joshua Kim <joshua.kim AT fu-berlin.de>
  * \author Rene Rahn <rene.rahn AT fu-berlin.de>
  * \author Jörg Winkler <j.winkler AT fu-berlin.de>
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <limits>
+
 #include <seqan3/alignment/configuration/detail.hpp>
 #include <seqan3/core/configuration/pipeable_config_element.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
@@ -166,4 +169,72 @@ public:
     static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::global};
 };
 
+/*!\brief A strong type representing the x_drop of the seqan3::align_cfg::method_extension.
+ * \ingroup alignment_configuration
+ */
+struct x_drop : public seqan3::detail::strong_type<int32_t, x_drop>
+{
+    //!\brief The type of the strong type base class.
+    using base_t = seqan3::detail::strong_type<int32_t, x_drop>;
+    using base_t::base_t; // Import the base class constructors
+};
+
+/*!\brief Sets the extension alignment method with an X-drop.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The extension alignment extends a seed to the right, i.e. the alignment begins with the first letters of both
+ * sequences and ends anywhere in the alignment matrix. To extend a seed to the left, the reversed prefixes of the
+ * sequences can be passed. The alignment matrix is computed anti-diagonal by anti-diagonal. A cell whose score is more
+ * than #x_drop below the best score found so far is dropped, and only the cells that can be reached from the remaining
+ * cells are computed in the next anti-diagonal. The computation stops as soon as every cell of two consecutive
+ * anti-diagonals was dropped; a single dropped anti-diagonal can still be crossed with a diagonal step. The computed
+ * cells thus form a band that adapts to the alignment. By default no cell is dropped and the best cell of the full
+ * alignment matrix is found.
+ *
+ * The begin positions of the alignment are always `(0, 0)` and the end positions are the cell with the best score.
+ * If several cells have the best score, the first one of the first anti-diagonal is chosen. This method can be
+ * combined with seqan3::align_cfg::vectorised, which computes the cells of each anti-diagonal with simd operations.
+ * It cannot be combined with seqan3::align_cfg::band_fixed_size and seqan3::align_cfg::min_score.
+ *
+ * \note For more information, please refer to the original article:
+ *       ZHANG, Zheng, et al. A greedy algorithm for aligning DNA sequences.
+ *       Journal of Computational biology, 2000, 7. Jg., Nr. 1-2, S. 203-214.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_method_extension.cpp
+ *
+ * \remark For a complete overview, take a look at \ref alignment_pairwise.
+ */
+class method_extension : private pipeable_config_element
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    method_extension() = default; //!< Defaulted.
+    method_extension(method_extension const &) = default; //!< Defaulted.
+    method_extension(method_extension &&) = default; //!< Defaulted.
+    method_extension & operator=(method_extension const &) = default; //!< Defaulted.
+    method_extension & operator=(method_extension &&) = default; //!< Defaulted.
+    ~method_extension() = default; //!< Defaulted.
+
+    /*!\brief Construct method_extension with a specific X-drop.
+     * \param[in] drop An instance of seqan3::align_cfg::x_drop that sets how far the score of a cell may drop below
+     *                 the best score before the cell is dropped; must not be negative.
+     */
+    constexpr method_extension(seqan3::align_cfg::x_drop drop) noexcept : x_drop{drop.get()}
+    {}
+    //!\}
+
+    //!\brief The maximal difference between the best score and the score of a computed cell [default: no limit].
+    int32_t x_drop{std::numeric_limits<int32_t>::max()};
+
+    //!\privatesection
+    //!\brief An internal id used to check for a valid alignment configuration.
+    static constexpr seqan3::detail::align_config_id id{seqan3::detail::align_config_id::extension};
+};
+
 } // namespace seqan3::align_cfg
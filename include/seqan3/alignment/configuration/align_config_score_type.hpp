@@ -27,6 +27,12 @@ namespace seqan3::align_cfg
  * This option configures the score type of the alignment algorithm.
  * By default, the alignment algorithm will only compute the score with score type `int32_t`.
  *
+ * If only the score and the end positions of an unbanded alignment are computed and the score type is a signed integer
+ * with at least 32 bits of which at least four fit into a SIMD register, every sequence pair whose second sequence has
+ * at least 16 letters per SIMD lane is computed with all lanes using the striped layout of Farrar, even without
+ * seqan3::align_cfg::vectorised. With a smaller score type, e.g. `int16_t`, such pairs are computed with the scalar
+ * algorithm.
+ *
  * ### Example
  *
  * \include test/snippet/alignment/configuration/align_cfg_score_type.cpp
@@ -31,6 +31,11 @@ namespace seqan3::align_cfg
  * speed-up, e.g. by running up to 64 alignments in parallel on the latest intel CPUs. In our mode we vectorise
  * multiple alignments and not a single alignment. This means that you should provide many sequences to compute as
  * one batch rather than computing them separately as there won't be performance gains.
+ * The only exception are chunks containing a single sequence pair when only the score and the end positions of an
+ * unbanded alignment are computed: the cells of this pair are distributed over all lanes with the striped layout of
+ * Farrar. Long sequence pairs are computed this way even without this configuration element, if the
+ * seqan3::align_cfg::score_type is a signed integer with at least 32 bits and at least four of them fit into a SIMD
+ * register.
  *
  * \sa For further information on SIMD see https://en.wikipedia.org/wiki/SIMD.
  *
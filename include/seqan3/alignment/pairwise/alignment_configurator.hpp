@@ -12,7 +12,9 @@
 
 #pragma once
 
+#include <seqan3/std/concepts>
 #include <functional>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -29,6 +31,9 @@
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_banded.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_striped.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_xdrop.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_alignment_matrix.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_alignment_result_builder.hpp>
 #include <seqan3/alignment/pairwise/detail/policy_affine_gap_recursion.hpp>
@@ -57,6 +62,7 @@
 #include <seqan3/core/detail/deferred_crtp_base.hpp>
 #include <seqan3/core/detail/template_inspection.hpp>
 #include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
 #include <seqan3/utility/tuple/concept.hpp>
 #include <seqan3/utility/type_traits/lazy_conditional.hpp>
 #include <seqan3/utility/views/type_reduce.hpp>
@@ -121,8 +127,9 @@ public:
     {
         const bool is_global = alignment_config_type::template exists<seqan3::align_cfg::method_global>();
         const bool is_local = alignment_config_type::template exists<seqan3::align_cfg::method_local>();
+        const bool is_extension = alignment_config_type::template exists<seqan3::align_cfg::method_extension>();
 
-        return (is_global || is_local);
+        return (is_global || is_local || is_extension);
     }
 };
 
@@ -325,7 +332,12 @@ public:
         auto const & gap_cost = config_with_result_type.get_or(edit_gap_cost);
         auto const & scoring_scheme = get<align_cfg::scoring_scheme>(cfg).scheme;
 
-        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>())
+        // The edit distance has no linear memory traceback.
+        constexpr bool skip_edit_distance = config_t::template exists<align_cfg::linear_memory>() &&
+                                            alignment_configuration_traits<
+                                                decltype(config_with_result_type)>::requires_trace_information;
+
+        if constexpr (config_t::template exists<seqan3::align_cfg::method_global>() && !skip_edit_distance)
         {
             // Only use edit distance if ...
             auto method_global_cfg = get<seqan3::align_cfg::method_global>(config_with_result_type);
@@ -359,6 +371,14 @@ public:
         if (config_t::template exists<align_cfg::min_score>())
             throw invalid_alignment_configuration{"The align_cfg::min_score configuration is only allowed for the "
                                                   "specific edit distance computation."};
+
+        if constexpr (config_t::template exists<align_cfg::method_extension>())
+        {
+            if (get<align_cfg::method_extension>(cfg).x_drop < 0)
+                throw invalid_alignment_configuration{"The x_drop of the align_cfg::method_extension configuration "
+                                                      "must not be negative."};
+        }
+
         // Configure the alignment algorithm.
         return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
                          config_with_result_type};
@@ -400,20 +420,38 @@ private:
     {
         using traits_t = alignment_configuration_traits<config_t>;
 
+        // Get the value for the sequence ends configuration.
+        auto method_global_cfg = cfg.get_or(align_cfg::method_global{});
+
         // ----------------------------------------------------------------------------
-        // Unsupported configurations
+        // Check the band
         // ----------------------------------------------------------------------------
 
         if constexpr (traits_t::is_banded)
-            throw invalid_alignment_configuration{"Banded alignments are yet not supported."};
+        {
+            auto const band = get<align_cfg::band_fixed_size>(cfg);
+
+            bool invalid_band = band.upper_diagonal < band.lower_diagonal;
+            std::string error_cause = (invalid_band) ? " The upper diagonal is smaller than the lower diagonal." : "";
+
+            // The edit distance never has free gaps in the second sequence, i.e. the band must start in the first row.
+            if (band.upper_diagonal < 0 ||
+                (band.lower_diagonal > 0 && !method_global_cfg.free_end_gaps_sequence1_leading))
+            {
+                invalid_band = true;
+                error_cause += " The band starts in a region without free gaps.";
+            }
+
+            if (invalid_band)
+                throw invalid_alignment_configuration{"The selected band [" + std::to_string(band.lower_diagonal) +
+                                                      ":" + std::to_string(band.upper_diagonal) + "] cannot be used "
+                                                      "with the current alignment configuration:" + error_cause};
+        }
 
         // ----------------------------------------------------------------------------
         // Configure semi-global alignment
         // ----------------------------------------------------------------------------
 
-        // Get the value for the sequence ends configuration.
-        auto method_global_cfg = cfg.get_or(align_cfg::method_global{});
-
         auto configure_edit_traits = [&] (auto is_semi_global)
         {
             struct edit_traits_type
@@ -463,10 +501,53 @@ private:
      * scoring scheme is the one configured in seqan3::align_cfg::scoring. If vectorisation is enabled, then the
      * appropriate scoring scheme for the vectorised alignment algorithm is selected. This involves checking whether the
      * passed scoring scheme is a matrix or a simple scoring scheme, which has only mismatch and match costs.
+     * Extension alignments are computed with seqan3::detail::pairwise_alignment_algorithm_xdrop.
      */
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
 
+    /*!\brief Wraps the algorithm into an algorithm that computes some sequence pairs differently.
+     *
+     * \tparam algorithm_t The configured alignment algorithm type.
+     * \tparam config_t The alignment configuration type.
+     *
+     * \param[in] cfg The passed configuration object.
+     *
+     * \returns the configured alignment algorithm.
+     *
+     * \details
+     *
+     * If the trace is computed in linear memory, the algorithm is wrapped into
+     * seqan3::detail::pairwise_alignment_algorithm_linear_memory. If only the score and the end positions of an
+     * unbanded alignment are computed, it is wrapped into seqan3::detail::pairwise_alignment_algorithm_striped, which
+     * computes a single sequence pair with all simd lanes. Without vectorisation this requires a score type with at
+     * least 32 bits of which at least four fit into a simd vector.
+     */
+    template <typename algorithm_t, typename config_t>
+    static constexpr auto maybe_wrap_algorithm(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using score_t = typename traits_t::original_score_type;
+
+        constexpr bool is_striped_scalar = []
+        {
+            if constexpr (std::signed_integral<score_t> && sizeof(score_t) >= sizeof(int32_t))
+                return simd_traits<simd_type_t<score_t>>::length >= 4u;
+            else
+                return false;
+        }();
+
+        if constexpr (traits_t::is_linear_memory && traits_t::requires_trace_information)
+            return pairwise_alignment_algorithm_linear_memory<config_t, algorithm_t>{cfg};
+        else if constexpr ((traits_t::is_vectorised || is_striped_scalar) &&
+                           !traits_t::is_banded &&
+                           !traits_t::is_debug &&
+                           !traits_t::requires_trace_information)
+            return pairwise_alignment_algorithm_striped<config_t, algorithm_t>{cfg};
+        else
+            return algorithm_t{cfg};
+    }
+
     /*!\brief Constructs the actual alignment algorithm wrapped in the passed std::function object.
      *
      * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
@@ -502,7 +583,13 @@ private:
             using find_optimum_t = typename select_find_optimum_policy<traits_t>::type;
             using gap_init_policy_t = deferred_crtp_base<affine_gap_init_policy>;
 
-            return alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, find_optimum_t, gap_init_policy_t, policies_t...>{cfg};
+            using algorithm_t = alignment_algorithm<config_t,
+                                                    matrix_policy_t,
+                                                    gap_policy_t,
+                                                    find_optimum_t,
+                                                    gap_init_policy_t,
+                                                    policies_t...>;
+            return maybe_wrap_algorithm<algorithm_t>(cfg);
         }
         else  // Use new alignment algorithm implementation.
         {
@@ -588,7 +675,7 @@ private:
                                                              result_builder_policy_t,
                                                              scoring_scheme_policy_t,
                                                              alignment_matrix_policy_t>;
-            return algorithm_t{cfg};
+            return maybe_wrap_algorithm<algorithm_t>(cfg);
         }
     }
 };
@@ -622,8 +709,16 @@ constexpr function_wrapper_t alignment_configurator::configure_scoring_scheme(co
                                                           std::conditional_t<is_aminoacid_scheme, matrix_simd_scheme_t, simple_simd_scheme_t>,
                                                           scoring_scheme_t>;
 
-    using scoring_scheme_policy_t = deferred_crtp_base<scoring_scheme_policy, alignment_scoring_scheme_t>;
-    return make_algorithm<function_wrapper_t, scoring_scheme_policy_t>(cfg);
+    if constexpr (traits_t::is_extension)
+    {
+        using algorithm_t = pairwise_alignment_algorithm_xdrop<config_t, alignment_scoring_scheme_t>;
+        return function_wrapper_t{algorithm_t{cfg}};
+    }
+    else
+    {
+        using scoring_scheme_policy_t = deferred_crtp_base<scoring_scheme_policy, alignment_scoring_scheme_t>;
+        return make_algorithm<function_wrapper_t, scoring_scheme_policy_t>(cfg);
+    }
 }
 //!\endcond
 } // namespace seqan3::detail
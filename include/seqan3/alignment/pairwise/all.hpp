@@ -64,7 +64,8 @@
  * frequently used in read mapping in order to align a smaller sequence into the context of a larger reference sequence.
  *
  * The standard global and local alignments can be configured using seqan3::align_cfg::method_global and
- * seqan3::align_cfg::method_local, respectively.
+ * seqan3::align_cfg::method_local, respectively. Seeds found e.g. with an index can be extended with
+ * seqan3::align_cfg::method_extension, which stops the alignment once the score drops too far below the best score.
  *
  * A **semi-global** alignment can be computed by specifying the free end-gaps in the constructor of
  * seqan3::align_cfg::method_global. The parameters enable, respectively disable, the scoring of
@@ -136,23 +137,25 @@
  * into one alignment configuration. In general, the same configuration element cannot occur more than once inside of
  * a configuration specification. The following table shows which combinations are possible.
  *
- * | **Config**                                                                  | **0** | **1** | **2** | **3** | **4** | **5** | **6** | **7** | **8** | **9** | **10** | **11** | **12** | **13** | **14** |
- * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:------:|:------:|:------:|:------:|:------:|
- * | \ref seqan3::align_cfg::band_fixed_size "0: Band"                           |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::gap_cost_affine "1: Gap scheme affine"              |  ✅   |   ❌   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::min_score "2: Min score"                            |  ✅   |   ✅   |  ❌   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::method_global "3: Method global"                    |  ✅   |   ✅   |  ✅   |  ❌   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::method_local "4: Method local"                      |  ✅   |   ✅   |  ❌   |  ❌   |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_alignment "5: Alignment output"              |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_end_position "6: End positions output"       |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_begin_position "7: Begin positions output"   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_score "8: Score output"                      |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_sequence1_id "9: Sequence1 id output"        |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |    ✅   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::output_sequence2_id "10: Sequence2 id output"       |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ❌   |   ✅   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::parallel "11: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ❌   |   ✅   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::score_type "12: Score type"                         |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ❌   |    ✅   |   ✅   |
- * | \ref seqan3::align_cfg::scoring_scheme "13: Scoring scheme"                 |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ❌   |   ✅   |
- * | \ref seqan3::align_cfg::vectorised "14: Vectorised"                         |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |    ✅   |   ✅   |   ✅   |    ✅   |   ❌   |
+ * | **Config**                                                                  | **0** | **1** | **2** | **3** | **4** | **5** | **6** | **7** | **8** | **9** | **10** | **11** | **12** | **13** | **14** | **15** | **16** |
+ * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:------:|:------:|:------:|:------:|:------:|:------:|:------:|
+ * | \ref seqan3::align_cfg::band_fixed_size "0: Band"                           |  ❌    |  ✅    |  ❌    |  ✅    |  ❌    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::gap_cost_affine "1: Gap scheme affine"              |  ✅    |  ❌    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::linear_memory "2: Linear memory"                    |  ❌    |  ✅    |  ❌    |  ✅    |  ❌    |  ✅    |  ❌    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ❌     |
+ * | \ref seqan3::align_cfg::min_score "3: Min score"                            |  ✅    |  ✅    |  ✅    |  ❌    |  ❌    |  ✅    |  ❌    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::method_extension "4: Method extension"              |  ❌    |  ✅    |  ❌    |  ❌    |  ❌    |  ❌    |  ❌    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::method_global "5: Method global"                    |  ✅    |  ✅    |  ✅    |  ✅    |  ❌    |  ❌    |  ❌    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::method_local "6: Method local"                      |  ✅    |  ✅    |  ❌    |  ❌    |  ❌    |  ❌    |  ❌    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::output_alignment "7: Alignment output"              |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ❌    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::output_end_position "8: End positions output"       |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ❌    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::output_begin_position "9: Begin positions output"   |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ❌    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::output_score "10: Score output"                     |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ❌     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::output_sequence1_id "11: Sequence1 id output"       |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅     |  ❌     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::output_sequence2_id "12: Sequence2 id output"       |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ❌     |  ✅     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::parallel "13: Parallel"                             |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ❌     |  ✅     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::score_type "14: Score type"                         |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ❌     |  ✅     |  ✅     |
+ * | \ref seqan3::align_cfg::scoring_scheme "15: Scoring scheme"                 |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ❌     |  ✅     |
+ * | \ref seqan3::align_cfg::vectorised "16: Vectorised"                         |  ✅    |  ✅    |  ❌    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅    |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ✅     |  ❌     |
  *
  * \if DEV
  * There is an additional configuration element \ref seqan3::align_cfg::detail::debug "Debug", which enables the output
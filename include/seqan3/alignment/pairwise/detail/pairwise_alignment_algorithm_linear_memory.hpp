@@ -0,0 +1,774 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_linear_memory.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <future>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/aligned_sequence/aligned_sequence_concept.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_parallel.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/utility/views/slice.hpp>
+#include <seqan3/utility/views/type_reduce.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the begin positions and the alignment in linear memory.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam full_algorithm_t          The type of the alignment algorithm that stores the full trace matrix.
+ *
+ * \details
+ *
+ * Computes the global alignment with affine gap costs with the divide-and-conquer algorithm of Myers and Miller.
+ * First, the optimal score and the end positions are computed column by column. If the leading gaps are free, the
+ * begin positions are computed in the same way on the reversed prefixes that end in the end positions. The alignment
+ * between the begin and the end positions is then a global alignment without free end gaps: the middle column of
+ * the first sequence is computed from the left and from the right, the best row to cross the middle column is
+ * selected, and both halves are aligned recursively. A horizontal gap that crosses the middle column is opened only
+ * once by passing the gap open score at the borders of the halves to the subproblems. Small subproblems are aligned
+ * with a full trace matrix. If seqan3::align_cfg::parallel is configured, the two columns and the two halves of large
+ * subproblems are computed concurrently.
+ *
+ * Sequence pairs whose full trace matrix does not exceed seqan3::align_cfg::linear_memory::memory_limit are computed
+ * by the `full_algorithm_t`.
+ *
+ * The score and the positions are the same as with the full trace matrix. If there are several optimal alignments,
+ * the alignment may differ.
+ *
+ * \note For more information, please refer to the original article:
+ *       MYERS, Eugene W.; MILLER, Webb. Optimal alignments in linear space.
+ *       Bioinformatics, 1988, 4. Jg., Nr. 1, S. 11-17.
+ */
+template <typename alignment_configuration_t, typename full_algorithm_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_linear_memory
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The configured scoring scheme type.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief A run of equal trace directions; the runs are stored from the begin to the end of the alignment.
+    using trace_segment_type = std::pair<trace_directions, size_t>;
+
+    static_assert(traits_type::is_global && !traits_type::is_banded && !traits_type::is_vectorised,
+                  "The linear memory alignment supports only unbanded, scalar global alignments.");
+
+    //!\brief Subproblems with at most this number of cells are computed with a full trace matrix.
+    static constexpr size_t base_case_cells = 1u << 14;
+    //!\brief Subproblems with at least this number of cells are split over two threads if threads are available.
+    static constexpr size_t parallel_cells = 1u << 20;
+
+    //!\brief The algorithm that computes sequence pairs with a small trace matrix.
+    full_algorithm_t full_algorithm{};
+    //!\brief The scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The score for opening a gap, without the extension of the first gap position.
+    score_type gap_open_score{};
+    //!\brief The score for extending a gap by one position.
+    score_type gap_extension_score{};
+    //!\brief The score of a gap with a single position.
+    score_type gap_open_extension_score{};
+    //!\brief A score that can be extended by a gap without an underflow.
+    score_type minus_infinity{};
+
+    //!\brief Whether the leading gaps of the first sequence are free.
+    bool free_sequence1_leading{};
+    //!\brief Whether the trailing gaps of the first sequence are free.
+    bool free_sequence1_trailing{};
+    //!\brief Whether the leading gaps of the second sequence are free.
+    bool free_sequence2_leading{};
+    //!\brief Whether the trailing gaps of the second sequence are free.
+    bool free_sequence2_trailing{};
+
+    //!\brief The maximal size of the trace matrix in bytes that is computed by the #full_algorithm.
+    size_t memory_limit{};
+    //!\brief The number of threads to compute the halves of a single alignment.
+    size_t thread_count{1u};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_linear_memory() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory(pairwise_alignment_algorithm_linear_memory const &) = default;
+                                                                                             //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory(pairwise_alignment_algorithm_linear_memory &&) = default;
+                                                                                             //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory & operator=(pairwise_alignment_algorithm_linear_memory const &) =
+        default; //!< Defaulted.
+    pairwise_alignment_algorithm_linear_memory & operator=(pairwise_alignment_algorithm_linear_memory &&) =
+        default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_linear_memory() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Reads the scoring scheme, the gap costs, the free end gaps, the memory limit and the number of threads from the
+     * configuration. If no gap cost model was provided by the user the default gap costs `-10` and `-1` are set for
+     * the gap open score and the gap extension score respectively.
+     */
+    pairwise_alignment_algorithm_linear_memory(alignment_configuration_t const & config) :
+        full_algorithm{config},
+        scoring_scheme{seqan3::get<align_cfg::scoring_scheme>(config).scheme}
+    {
+        auto const & gap_scheme = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                           align_cfg::extension_score{-1}});
+        gap_open_score = gap_scheme.open_score;
+        gap_extension_score = gap_scheme.extension_score;
+        gap_open_extension_score = gap_open_score + gap_extension_score;
+        minus_infinity = std::numeric_limits<score_type>::lowest() - (gap_open_extension_score + gap_extension_score);
+
+        auto method_global_config = config.get_or(align_cfg::method_global{});
+        free_sequence1_leading = method_global_config.free_end_gaps_sequence1_leading;
+        free_sequence1_trailing = method_global_config.free_end_gaps_sequence1_trailing;
+        free_sequence2_leading = method_global_config.free_end_gaps_sequence2_leading;
+        free_sequence2_trailing = method_global_config.free_end_gaps_sequence2_trailing;
+
+        memory_limit = config.get_or(align_cfg::linear_memory{}).memory_limit;
+
+        if constexpr (traits_type::is_parallel)
+            thread_count = std::max<size_t>(1u, get<align_cfg::parallel>(config).thread_count.value_or(1u));
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the score columns.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence and `m` be the length of the second sequence. The runtime is
+     * \f$ O(n*m) \f$ and the space is \f$ O(n+m) \f$.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto it = std::ranges::begin(indexed_sequence_pairs); it != std::ranges::end(indexed_sequence_pairs); ++it)
+        {
+            auto && [sequence_pair, idx] = *it;
+            size_t const sequence1_size = std::ranges::distance(get<0>(sequence_pair));
+            size_t const sequence2_size = std::ranges::distance(get<1>(sequence_pair));
+
+            if ((sequence1_size + 1u) * (sequence2_size + 1u) * sizeof(trace_directions) <= memory_limit)
+                full_algorithm(std::ranges::subrange{it, std::ranges::next(it)}, callback);
+            else
+                compute_single_pair(idx, get<0>(sequence_pair), get<1>(sequence_pair), callback);
+        }
+    }
+    //!\}
+
+private:
+    /*!\brief Computes the alignment of a single sequence pair and invokes the callback with the result.
+     * \param[in] idx       The index of the sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] callback  The callback function to be invoked with the alignment result.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename callback_t>
+    void compute_single_pair(size_t const idx, sequence1_t && sequence1, sequence2_t && sequence2, callback_t & callback)
+    {
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        // The subproblems need random access and the reversed sequences.
+        std::vector<std::ranges::range_value_t<sequence1_t>> const letters1(std::ranges::begin(sequence1),
+                                                                            std::ranges::end(sequence1));
+        std::vector<std::ranges::range_value_t<sequence2_t>> const letters2(std::ranges::begin(sequence2),
+                                                                            std::ranges::end(sequence2));
+        size_t const sequence1_size = letters1.size();
+        size_t const sequence2_size = letters2.size();
+
+        std::vector<score_type> optimal_column{};
+        std::vector<score_type> horizontal_column{};
+
+        // ---------------------------------------------------------------------
+        // Compute the score and the end positions.
+        // ---------------------------------------------------------------------
+
+        score_type optimal_score = std::numeric_limits<score_type>::lowest();
+        std::pair<size_t, size_t> end_positions{sequence1_size, sequence2_size};
+
+        compute_last_column(letters1,
+                            letters2,
+                            gap_open_score,
+                            free_sequence1_leading,
+                            free_sequence2_leading,
+                            optimal_column,
+                            horizontal_column,
+                            [&] (size_t const column)
+        {
+            if (free_sequence1_trailing && optimal_column[sequence2_size] > optimal_score)
+            {
+                optimal_score = optimal_column[sequence2_size];
+                end_positions = {column, sequence2_size};
+            }
+        });
+
+        if (free_sequence2_trailing)
+        {
+            for (size_t row = 0; row <= sequence2_size; ++row)
+            {
+                if (optimal_column[row] > optimal_score)
+                {
+                    optimal_score = optimal_column[row];
+                    end_positions = {sequence1_size, row};
+                }
+            }
+        }
+
+        if (!free_sequence1_trailing && !free_sequence2_trailing)
+            optimal_score = optimal_column[sequence2_size];
+
+        // ---------------------------------------------------------------------
+        // Compute the begin positions from the reversed prefixes.
+        // ---------------------------------------------------------------------
+
+        std::pair<size_t, size_t> begin_positions{0u, 0u};
+
+        if constexpr (traits_type::requires_trace_information)
+        {
+            if (free_sequence1_leading || free_sequence2_leading)
+                begin_positions = compute_begin_positions(letters1, letters2, end_positions, optimal_score);
+        }
+
+        // ---------------------------------------------------------------------
+        // Build the alignment result.
+        // ---------------------------------------------------------------------
+
+        result_value_type result{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            result.sequence1_id = idx;
+
+        if constexpr (traits_type::output_sequence2_id)
+            result.sequence2_id = idx;
+
+        if constexpr (traits_type::compute_score)
+            result.score = optimal_score;
+
+        if constexpr (traits_type::compute_end_positions)
+        {
+            result.end_positions.first = end_positions.first;
+            result.end_positions.second = end_positions.second;
+        }
+
+        if constexpr (traits_type::compute_begin_positions)
+        {
+            result.begin_positions.first = begin_positions.first;
+            result.begin_positions.second = begin_positions.second;
+        }
+
+        if constexpr (traits_type::compute_sequence_alignment)
+        {
+            std::vector<trace_segment_type> trace{};
+            compute_alignment(letters1,
+                              letters2,
+                              {begin_positions.first, end_positions.first},
+                              {begin_positions.second, end_positions.second},
+                              gap_open_score,
+                              gap_open_score,
+                              trace,
+                              thread_count);
+
+            using std::get;
+            assign_unaligned(get<0>(result.alignment),
+                             views::type_reduce(sequence1) | views::slice(begin_positions.first, end_positions.first));
+            assign_unaligned(get<1>(result.alignment),
+                             views::type_reduce(sequence2) | views::slice(begin_positions.second, end_positions.second));
+            fill_aligned_sequences(trace, get<0>(result.alignment), get<1>(result.alignment));
+        }
+
+        callback(alignment_result_type{std::move(result)});
+    }
+
+    /*!\brief Computes the score matrix column by column and keeps only the current column.
+     * \param[in] sequence1           The sequence along the columns.
+     * \param[in] sequence2           The sequence along the rows.
+     * \param[in] first_row_open      The score for opening a horizontal gap in the first row.
+     * \param[in] first_row_is_free   Whether the alignment can begin in any cell of the first row.
+     * \param[in] first_column_is_free Whether the alignment can begin in any cell of the first column.
+     * \param[out] optimal_column     The best score of every cell in the current column.
+     * \param[out] horizontal_column  The best score of every cell in the current column that ends with a horizontal
+     *                                gap, i.e. a letter of `sequence1` aligned to a gap.
+     * \param[in] on_column           Invoked with the index of every column after it was computed.
+     *
+     * \details
+     *
+     * Uses the same recursion as seqan3::detail::policy_affine_gap_recursion. After the last column was computed,
+     * `optimal_column` and `horizontal_column` hold the last column of the score matrix.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename on_column_t>
+    void compute_last_column(sequence1_t && sequence1,
+                             sequence2_t && sequence2,
+                             score_type const first_row_open,
+                             bool const first_row_is_free,
+                             bool const first_column_is_free,
+                             std::vector<score_type> & optimal_column,
+                             std::vector<score_type> & horizontal_column,
+                             on_column_t && on_column) const
+    {
+        size_t const rows = std::ranges::distance(sequence2) + 1u;
+        optimal_column.resize(rows);
+        horizontal_column.assign(rows, minus_infinity);
+
+        optimal_column[0] = score_type{};
+        score_type first_column_score = gap_open_score;
+        for (size_t row = 1; row < rows; ++row)
+        {
+            first_column_score += gap_extension_score;
+            optimal_column[row] = first_column_is_free ? score_type{} : first_column_score;
+        }
+
+        on_column(0u);
+
+        score_type first_row_score = first_row_is_free ? score_type{} : first_row_open;
+        size_t column = 0;
+        for (auto const & letter1 : sequence1)
+        {
+            score_type diagonal = optimal_column[0];
+            if (!first_row_is_free)
+                first_row_score += gap_extension_score;
+
+            optimal_column[0] = first_row_score;
+            horizontal_column[0] = first_row_score;
+
+            score_type vertical = minus_infinity;
+            size_t row = 1;
+            for (auto const & letter2 : sequence2)
+            {
+                score_type const left = optimal_column[row];
+                score_type const horizontal = std::max<score_type>(left + gap_open_extension_score,
+                                                                   horizontal_column[row] + gap_extension_score);
+                vertical = std::max<score_type>(optimal_column[row - 1] + gap_open_extension_score,
+                                                vertical + gap_extension_score);
+
+                score_type best = diagonal + scoring_scheme.score(letter1, letter2);
+                best = (best < horizontal) ? horizontal : best;
+                best = (best < vertical) ? vertical : best;
+
+                diagonal = left;
+                optimal_column[row] = best;
+                horizontal_column[row] = horizontal;
+                ++row;
+            }
+
+            on_column(++column);
+        }
+    }
+
+    /*!\brief Computes the begin positions of an optimal alignment that ends in the given end positions.
+     * \param[in] letters1        The first sequence.
+     * \param[in] letters2        The second sequence.
+     * \param[in] end_positions   The end positions in the first and the second sequence.
+     * \param[in] optimal_score   The score of the optimal alignment.
+     * \returns The begin positions in the first and the second sequence.
+     *
+     * \details
+     *
+     * Computes the score matrix of the reversed prefixes that end in the end positions. The alignment begins in the
+     * last row of this matrix if the leading gaps of the first sequence are free, and in the last column if the
+     * leading gaps of the second sequence are free.
+     */
+    template <typename letters1_t, typename letters2_t>
+    std::pair<size_t, size_t> compute_begin_positions(letters1_t const & letters1,
+                                                      letters2_t const & letters2,
+                                                      std::pair<size_t, size_t> const end_positions,
+                                                      [[maybe_unused]] score_type const optimal_score) const
+    {
+        auto reversed1 = letters1 | views::slice(0u, end_positions.first) | std::views::reverse;
+        auto reversed2 = letters2 | views::slice(0u, end_positions.second) | std::views::reverse;
+
+        std::vector<score_type> optimal_column{};
+        std::vector<score_type> horizontal_column{};
+
+        score_type best_score = std::numeric_limits<score_type>::lowest();
+        std::pair<size_t, size_t> begin_positions{0u, 0u};
+
+        compute_last_column(reversed1,
+                            reversed2,
+                            gap_open_score,
+                            false,
+                            false,
+                            optimal_column,
+                            horizontal_column,
+                            [&] (size_t const column)
+        {
+            if (free_sequence1_leading && optimal_column[end_positions.second] > best_score)
+            {
+                best_score = optimal_column[end_positions.second];
+                begin_positions = {end_positions.first - column, 0u};
+            }
+        });
+
+        if (free_sequence2_leading)
+        {
+            for (size_t row = 0; row <= end_positions.second; ++row)
+            {
+                if (optimal_column[row] > best_score)
+                {
+                    best_score = optimal_column[row];
+                    begin_positions = {0u, end_positions.second - row};
+                }
+            }
+        }
+
+        assert(best_score == optimal_score);
+        return begin_positions;
+    }
+
+    /*!\brief Computes the global alignment of the given ranges of the sequences.
+     * \param[in] letters1         The first sequence.
+     * \param[in] letters2         The second sequence.
+     * \param[in] range1           The begin and the end of the aligned range of the first sequence.
+     * \param[in] range2           The begin and the end of the aligned range of the second sequence.
+     * \param[in] start_gap_open   The score for opening a horizontal gap at the begin of the alignment.
+     * \param[in] end_gap_open     The score for opening a horizontal gap at the end of the alignment.
+     * \param[in,out] trace        The trace segments the alignment is appended to.
+     * \param[in] threads          The number of threads that may be used.
+     *
+     * \details
+     *
+     * A horizontal gap at the begin or the end of the alignment continues a gap of the neighbouring subproblem if the
+     * respective gap open score is `0`.
+     */
+    template <typename letters1_t, typename letters2_t>
+    void compute_alignment(letters1_t const & letters1,
+                           letters2_t const & letters2,
+                           std::pair<size_t, size_t> const range1,
+                           std::pair<size_t, size_t> const range2,
+                           score_type const start_gap_open,
+                           score_type const end_gap_open,
+                           std::vector<trace_segment_type> & trace,
+                           size_t const threads) const
+    {
+        size_t const columns = range1.second - range1.first;
+        size_t const rows = range2.second - range2.first;
+
+        if (columns == 0u || rows == 0u)
+        {
+            append_trace(trace, trace_directions::up, rows);
+            append_trace(trace, trace_directions::left, columns);
+            return;
+        }
+
+        if (columns == 1u || (columns + 1u) * (rows + 1u) <= base_case_cells)
+        {
+            compute_alignment_with_trace_matrix(letters1, letters2, range1, range2, start_gap_open, end_gap_open, trace);
+            return;
+        }
+
+        // ---------------------------------------------------------------------
+        // Compute the middle column from the left and from the right.
+        // ---------------------------------------------------------------------
+
+        size_t const middle = range1.first + columns / 2u;
+        bool const is_parallel = threads > 1u && columns * rows >= parallel_cells;
+
+        std::vector<score_type> forward_optimal{};
+        std::vector<score_type> forward_horizontal{};
+        std::vector<score_type> reverse_optimal{};
+        std::vector<score_type> reverse_horizontal{};
+
+        auto compute_reverse_column = [&] ()
+        {
+            compute_last_column(letters1 | views::slice(middle, range1.second) | std::views::reverse,
+                                letters2 | views::slice(range2.first, range2.second) | std::views::reverse,
+                                end_gap_open,
+                                false,
+                                false,
+                                reverse_optimal,
+                                reverse_horizontal,
+                                [] (size_t) {});
+        };
+
+        std::future<void> reverse_task{};
+        if (is_parallel)
+            reverse_task = std::async(std::launch::async, compute_reverse_column);
+        else
+            compute_reverse_column();
+
+        compute_last_column(letters1 | views::slice(range1.first, middle),
+                            letters2 | views::slice(range2.first, range2.second),
+                            start_gap_open,
+                            false,
+                            false,
+                            forward_optimal,
+                            forward_horizontal,
+                            [] (size_t) {});
+
+        if (is_parallel)
+            reverse_task.get();
+
+        // ---------------------------------------------------------------------
+        // Select the row in which the alignment crosses the middle column.
+        // ---------------------------------------------------------------------
+
+        score_type best_score = std::numeric_limits<score_type>::lowest();
+        size_t best_row = 0;
+        bool crosses_with_gap = false;
+
+        for (size_t row = 0; row <= rows; ++row)
+        {
+            score_type const score = forward_optimal[row] + reverse_optimal[rows - row];
+            // Both halves opened the horizontal gap that crosses the middle column.
+            score_type const gap_score = forward_horizontal[row] + reverse_horizontal[rows - row] - gap_open_score;
+
+            if (score > best_score)
+            {
+                best_score = score;
+                best_row = row;
+                crosses_with_gap = false;
+            }
+
+            if (gap_score > best_score)
+            {
+                best_score = gap_score;
+                best_row = row;
+                crosses_with_gap = true;
+            }
+        }
+
+        // ---------------------------------------------------------------------
+        // Align both halves.
+        // ---------------------------------------------------------------------
+
+        size_t const split_row = range2.first + best_row;
+        // The gap across the middle column contains the last letter of the left and the first letter of the right half.
+        size_t const left_end = crosses_with_gap ? middle - 1u : middle;
+        size_t const right_begin = crosses_with_gap ? middle + 1u : middle;
+        score_type const split_gap_open = crosses_with_gap ? score_type{} : gap_open_score;
+
+        std::vector<trace_segment_type> right_trace{};
+        auto compute_left_half = [&, left_threads = threads / 2u] ()
+        {
+            compute_alignment(letters1,
+                              letters2,
+                              {range1.first, left_end},
+                              {range2.first, split_row},
+                              start_gap_open,
+                              split_gap_open,
+                              trace,
+                              left_threads);
+        };
+
+        std::future<void> left_task{};
+        if (is_parallel)
+            left_task = std::async(std::launch::async, compute_left_half);
+        else
+            compute_left_half();
+
+        compute_alignment(letters1,
+                          letters2,
+                          {right_begin, range1.second},
+                          {split_row, range2.second},
+                          split_gap_open,
+                          end_gap_open,
+                          right_trace,
+                          is_parallel ? threads - threads / 2u : threads);
+
+        if (is_parallel)
+            left_task.get();
+
+        if (crosses_with_gap)
+            append_trace(trace, trace_directions::left, 2u);
+
+        for (auto const & [direction, count] : right_trace)
+            append_trace(trace, direction, count);
+    }
+
+    /*!\brief Computes the global alignment of a small subproblem with a full trace matrix.
+     * \copydetails compute_alignment
+     */
+    template <typename letters1_t, typename letters2_t>
+    void compute_alignment_with_trace_matrix(letters1_t const & letters1,
+                                             letters2_t const & letters2,
+                                             std::pair<size_t, size_t> const range1,
+                                             std::pair<size_t, size_t> const range2,
+                                             score_type const start_gap_open,
+                                             score_type const end_gap_open,
+                                             std::vector<trace_segment_type> & trace) const
+    {
+        size_t const columns = range1.second - range1.first;
+        size_t const rows = range2.second - range2.first;
+        size_t const column_size = rows + 1u;
+
+        // The best score, and the best score ending with a horizontal or a vertical gap of every cell.
+        std::vector<score_type> optimal((columns + 1u) * column_size);
+        std::vector<score_type> horizontal((columns + 1u) * column_size, minus_infinity);
+        std::vector<score_type> vertical((columns + 1u) * column_size, minus_infinity);
+
+        auto cell = [column_size] (size_t const column, size_t const row)
+        {
+            return column * column_size + row;
+        };
+
+        for (size_t row = 1; row <= rows; ++row)
+            vertical[cell(0, row)] = optimal[cell(0, row)] = gap_open_score + gap_extension_score * row;
+
+        for (size_t column = 1; column <= columns; ++column)
+        {
+            auto const & letter1 = letters1[range1.first + column - 1u];
+            horizontal[cell(column, 0)] = optimal[cell(column, 0)] = start_gap_open + gap_extension_score * column;
+
+            for (size_t row = 1; row <= rows; ++row)
+            {
+                horizontal[cell(column, row)] =
+                    std::max<score_type>(optimal[cell(column - 1u, row)] + gap_open_extension_score,
+                                         horizontal[cell(column - 1u, row)] + gap_extension_score);
+                vertical[cell(column, row)] =
+                    std::max<score_type>(optimal[cell(column, row - 1u)] + gap_open_extension_score,
+                                         vertical[cell(column, row - 1u)] + gap_extension_score);
+                optimal[cell(column, row)] =
+                    std::max({optimal[cell(column - 1u, row - 1u)] +
+                                  scoring_scheme.score(letter1, letters2[range2.first + row - 1u]),
+                              horizontal[cell(column, row)],
+                              vertical[cell(column, row)]});
+            }
+        }
+
+        // ---------------------------------------------------------------------
+        // Trace back from the last cell.
+        // ---------------------------------------------------------------------
+
+        std::vector<trace_directions> reversed_trace{};
+        size_t column = columns;
+        size_t row = rows;
+
+        // A horizontal gap at the end only pays the given gap open score.
+        trace_directions state =
+            (horizontal[cell(column, row)] - gap_open_score + end_gap_open > optimal[cell(column, row)])
+                ? trace_directions::left
+                : trace_directions::diagonal;
+
+        while (column != 0u || row != 0u)
+        {
+            if (state == trace_directions::diagonal)
+            {
+                score_type const score = optimal[cell(column, row)];
+
+                if (row == 0u)
+                    state = trace_directions::left;
+                else if (column == 0u)
+                    state = trace_directions::up;
+                else if (score == optimal[cell(column - 1u, row - 1u)] +
+                                  scoring_scheme.score(letters1[range1.first + column - 1u],
+                                                       letters2[range2.first + row - 1u]))
+                {
+                    reversed_trace.push_back(trace_directions::diagonal);
+                    --column;
+                    --row;
+                }
+                else
+                {
+                    state = (score == horizontal[cell(column, row)]) ? trace_directions::left : trace_directions::up;
+                }
+            }
+            else if (state == trace_directions::left)
+            {
+                reversed_trace.push_back(trace_directions::left);
+                bool const opened = row != 0u && horizontal[cell(column, row)] ==
+                                                 optimal[cell(column - 1u, row)] + gap_open_extension_score;
+                --column;
+                state = opened ? trace_directions::diagonal : trace_directions::left;
+            }
+            else // trace_directions::up
+            {
+                reversed_trace.push_back(trace_directions::up);
+                bool const opened = column != 0u && vertical[cell(column, row)] ==
+                                                    optimal[cell(column, row - 1u)] + gap_open_extension_score;
+                --row;
+                state = opened ? trace_directions::diagonal : trace_directions::up;
+            }
+        }
+
+        for (auto direction : reversed_trace | std::views::reverse)
+            append_trace(trace, direction, 1u);
+    }
+
+    //!\brief Appends `count` trace directions to the trace segments.
+    static void append_trace(std::vector<trace_segment_type> & trace,
+                             trace_directions const direction,
+                             size_t const count)
+    {
+        if (count == 0u)
+            return;
+
+        if (!trace.empty() && trace.back().first == direction)
+            trace.back().second += count;
+        else
+            trace.emplace_back(direction, count);
+    }
+
+    //!\brief Inserts the gaps of the trace segments into the aligned sequences like seqan3::detail::aligned_sequence_builder.
+    template <typename aligned1_t, typename aligned2_t>
+    static void fill_aligned_sequences(std::vector<trace_segment_type> const & trace,
+                                       aligned1_t & aligned1,
+                                       aligned2_t & aligned2)
+    {
+        auto it1 = std::ranges::begin(aligned1);
+        auto it2 = std::ranges::begin(aligned2);
+
+        for (auto const & [direction, count] : trace)
+        {
+            if (direction == trace_directions::up)
+                it1 = insert_gap(aligned1, it1, count);
+
+            if (direction == trace_directions::left)
+                it2 = insert_gap(aligned2, it2, count);
+
+            it1 += count;
+            it2 += count;
+        }
+    }
+};
+
+} // namespace seqan3::detail
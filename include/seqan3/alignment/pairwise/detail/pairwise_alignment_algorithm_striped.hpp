@@ -0,0 +1,483 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_striped.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the score of a single sequence pair with all simd lanes.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam algorithm_t               The type of the alignment algorithm that computes all other chunks.
+ *
+ * \details
+ *
+ * The vectorised alignment algorithm computes one sequence pair per simd lane and thus needs as many sequence pairs
+ * as there are lanes. If a chunk contains only a single sequence pair, e.g. when a single pair of long sequences is
+ * aligned, this algorithm instead distributes the cells of each column over the lanes with the striped layout of
+ * Farrar: the second sequence is split into as many segments as there are lanes and the `k`-th vector of a column
+ * holds the `k`-th row of every segment. The diagonal and the horizontal dependencies are then between vectors at the
+ * same position of two columns, and the scores of a column are added from a query profile, which stores the
+ * striped scores of every letter of the first sequence against the second sequence. The vertical gaps that cross the
+ * segment borders are corrected in a second loop that only runs as long as they can still change a score (lazy-F
+ * loop).
+ *
+ * Global alignments with free end gaps and local alignments with affine gap costs are supported. Only the score and
+ * the end positions are computed; they are the same as with the scalar algorithm. All other chunks are computed by
+ * the `algorithm_t`.
+ *
+ * The algorithm is also used without seqan3::align_cfg::vectorised if the configured score type has at least 32 bits
+ * and at least four of them fit into a simd vector (SSE4 and newer). In this case only pairs whose second sequence
+ * has at least seqan3::detail::pairwise_alignment_algorithm_striped::minimal_scalar_sequence2_size letters are
+ * computed striped, because for shorter sequences the query profile and the lazy-F loop cost more than the scalar
+ * algorithm. With seqan3::align_cfg::vectorised a single pair is always computed striped, since the vectorised
+ * algorithm would compute it in a single lane.
+ *
+ * The lanes have the configured score type, i.e. by default 32 bits: 4 lanes with SSE4, 8 with AVX2 and 16 with
+ * AVX512. Implementations like the one of Farrar use saturated 8 or 16 bit lanes instead and repeat the computation
+ * with wider lanes if a score saturates, which computes two to four times more cells per instruction. This is not
+ * done here, since the results must be exactly the same as with the scalar algorithm for every score type and
+ * scoring scheme.
+ *
+ * \note For more information, please refer to the original article:
+ *       FARRAR, Michael. Striped Smith–Waterman speeds database searches six times over other SIMD implementations.
+ *       Bioinformatics, 2007, 23. Jg., Nr. 2, S. 156-161.
+ */
+template <typename alignment_configuration_t, typename algorithm_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_striped
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The simd vector type holding one row of every segment.
+    using simd_type = simd_type_t<score_type>;
+    //!\brief The configured scoring scheme type.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of a striped column.
+    using column_type = std::vector<simd_type, aligned_allocator<simd_type, alignof(simd_type)>>;
+
+    static_assert(!traits_type::is_banded && !traits_type::requires_trace_information,
+                  "The striped alignment computes only the score and the end positions of unbanded alignments.");
+
+    //!\brief The number of segments, i.e. the number of rows that are computed at once.
+    static constexpr size_t lanes = simd_traits<simd_type>::length;
+
+public:
+    /*!\brief The minimal size of the second sequence for which a single pair is computed striped if the
+     *        alignment is not vectorised.
+     *
+     * \details
+     *
+     * Measured with dna4 sequences of equal size, the striped global alignment is faster than the scalar one from
+     * about 32 letters with SSE4, 100 letters with AVX2 and 250 letters with AVX512.
+     */
+    static constexpr size_t minimal_scalar_sequence2_size = 16u * lanes;
+
+private:
+    //!\brief The algorithm that computes all chunks that are not computed striped.
+    algorithm_t algorithm{};
+    //!\brief The scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The score for opening a gap, without the extension of the first gap position.
+    score_type gap_open_score{};
+    //!\brief The score for extending a gap by one position.
+    score_type gap_extension_score{};
+    //!\brief A score that can be extended by gaps and scores without an underflow.
+    static constexpr score_type minus_infinity = std::numeric_limits<score_type>::lowest() / 2;
+
+    //!\brief Whether the leading gaps of the first sequence are free.
+    bool free_sequence1_leading{};
+    //!\brief Whether the trailing gaps of the first sequence are free.
+    bool free_sequence1_trailing{};
+    //!\brief Whether the leading gaps of the second sequence are free.
+    bool free_sequence2_leading{};
+    //!\brief Whether the trailing gaps of the second sequence are free.
+    bool free_sequence2_trailing{};
+
+    //!\brief The number of vectors per column.
+    size_t segment_size{};
+    //!\brief The striped scores of every letter of the first sequence against the second sequence.
+    column_type profile{};
+    //!\brief The best scores of the current column.
+    column_type current_column{};
+    //!\brief The best scores of the previous column.
+    column_type previous_column{};
+    //!\brief The best scores ending with a horizontal gap in the next column.
+    column_type horizontal_column{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_striped() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped(pairwise_alignment_algorithm_striped const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped(pairwise_alignment_algorithm_striped &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_striped & operator=(pairwise_alignment_algorithm_striped const &) = default;
+                                                                                                 //!< Defaulted.
+    pairwise_alignment_algorithm_striped & operator=(pairwise_alignment_algorithm_striped &&) = default;
+                                                                                                 //!< Defaulted.
+    ~pairwise_alignment_algorithm_striped() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Reads the scoring scheme, the gap costs and the free end gaps from the configuration. If no gap cost model was
+     * provided by the user the default gap costs `-10` and `-1` are set for the gap open score and the gap extension
+     * score respectively.
+     */
+    pairwise_alignment_algorithm_striped(alignment_configuration_t const & config) :
+        algorithm{config},
+        scoring_scheme{seqan3::get<align_cfg::scoring_scheme>(config).scheme}
+    {
+        auto const & gap_scheme = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                           align_cfg::extension_score{-1}});
+        gap_open_score = gap_scheme.open_score;
+        gap_extension_score = gap_scheme.extension_score;
+
+        auto method_global_config = config.get_or(align_cfg::method_global{});
+        free_sequence1_leading = method_global_config.free_end_gaps_sequence1_leading;
+        free_sequence1_trailing = method_global_config.free_end_gaps_sequence1_trailing;
+        free_sequence2_leading = method_global_config.free_end_gaps_sequence2_leading;
+        free_sequence2_trailing = method_global_config.free_end_gaps_sequence2_trailing;
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the query profile and the columns.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `l` be the number of
+     * simd lanes. The runtime of a single sequence pair is \f$ O(n*m/l) \f$ if the lazy-F loop stops early, and the
+     * space is \f$ O(|\Sigma|*m) \f$.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+        using sequence1_t = decltype(get<0>(get<0>(*std::ranges::begin(indexed_sequence_pairs))));
+
+        // The query profile is indexed by the rank of the letters of the first sequence.
+        if constexpr (semialphabet<std::ranges::range_value_t<sequence1_t>>)
+        {
+            auto it = std::ranges::begin(indexed_sequence_pairs);
+            if (it != std::ranges::end(indexed_sequence_pairs) &&
+                std::ranges::next(it) == std::ranges::end(indexed_sequence_pairs))
+            {
+                auto && [sequence_pair, idx] = *it;
+                if (!std::ranges::empty(get<0>(sequence_pair)) &&
+                    (traits_type::is_vectorised ? !std::ranges::empty(get<1>(sequence_pair))
+                                                : std::ranges::distance(get<1>(sequence_pair)) >=
+                                                      static_cast<std::ptrdiff_t>(minimal_scalar_sequence2_size)))
+                {
+                    compute_single_pair(idx, get<0>(sequence_pair), get<1>(sequence_pair), callback);
+                    return;
+                }
+            }
+        }
+
+        algorithm(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs), callback);
+    }
+    //!\}
+
+private:
+    //!\brief Returns the maximum of both vectors in every lane.
+    static simd_type max(simd_type const & lhs, simd_type const & rhs) noexcept
+    {
+        return (lhs < rhs) ? rhs : lhs;
+    }
+
+    //!\brief Returns whether `lhs` is greater than `rhs` in any lane.
+    static bool any_greater(simd_type const & lhs, simd_type const & rhs) noexcept
+    {
+        auto const mask = lhs > rhs;
+        for (size_t lane = 0; lane < lanes; ++lane)
+            if (mask[lane])
+                return true;
+
+        return false;
+    }
+
+    //!\brief Moves every lane to the next higher lane and sets the first lane to `first`.
+    static simd_type shift_lanes(simd_type const & vector, score_type const first) noexcept
+    {
+        simd_type shifted{};
+        shifted[0] = first;
+        for (size_t lane = 1; lane < lanes; ++lane)
+            shifted[lane] = vector[lane - 1];
+
+        return shifted;
+    }
+
+    //!\brief Returns the score of the given row of the striped column.
+    score_type row_score(column_type const & column, size_t const row) const noexcept
+    {
+        return column[row % segment_size][row / segment_size];
+    }
+
+    /*!\brief Computes the score and the end positions of a single sequence pair and invokes the callback.
+     * \param[in] idx       The index of the sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] callback  The callback function to be invoked with the alignment result.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename callback_t>
+    void compute_single_pair(size_t const idx, sequence1_t && sequence1, sequence2_t && sequence2, callback_t & callback)
+    {
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+        using sequence1_alphabet_t = std::ranges::range_value_t<sequence1_t>;
+
+        constexpr bool is_local = traits_type::is_local;
+        size_t const sequence2_size = std::ranges::distance(sequence2);
+        segment_size = (sequence2_size + lanes - 1u) / lanes;
+
+        // ---------------------------------------------------------------------
+        // Initialise the query profile and the first column.
+        // ---------------------------------------------------------------------
+
+        profile.assign(alphabet_size<sequence1_alphabet_t> * segment_size, simd::fill<simd_type>(minus_infinity));
+        for (size_t rank = 0; rank < alphabet_size<sequence1_alphabet_t>; ++rank)
+        {
+            sequence1_alphabet_t const letter = assign_rank_to(rank, sequence1_alphabet_t{});
+            size_t row = 0;
+            for (auto const & letter2 : sequence2)
+            {
+                profile[rank * segment_size + row % segment_size][row / segment_size] =
+                    scoring_scheme.score(letter, letter2);
+                ++row;
+            }
+        }
+
+        simd_type const open_extension = simd::fill<simd_type>(gap_open_score + gap_extension_score);
+        simd_type const extension = simd::fill<simd_type>(gap_extension_score);
+        simd_type const open = simd::fill<simd_type>(gap_open_score);
+        simd_type const zero{};
+
+        bool const first_row_is_free = is_local || free_sequence1_leading;
+        bool const first_column_is_free = is_local || free_sequence2_leading;
+
+        // The score of the first row in the given column.
+        auto first_row_score = [&] (size_t const column) -> score_type
+        {
+            return (first_row_is_free || column == 0u)
+                       ? score_type{}
+                       : static_cast<score_type>(gap_open_score + gap_extension_score * column);
+        };
+
+        current_column.assign(segment_size, simd_type{});
+        horizontal_column.resize(segment_size);
+        for (size_t row = 0; row < segment_size * lanes; ++row)
+        {
+            current_column[row % segment_size][row / segment_size] =
+                first_column_is_free ? score_type{}
+                                     : static_cast<score_type>(gap_open_score + gap_extension_score * (row + 1u));
+        }
+
+        for (size_t segment = 0; segment < segment_size; ++segment)
+            horizontal_column[segment] = current_column[segment] + open_extension;
+
+        // ---------------------------------------------------------------------
+        // Track the optimum like the scalar algorithms: local alignments take the first optimal cell column by column
+        // (seqan3::detail::alignment_optimum), global alignments take the last optimal cell of the last row column by
+        // column and then of the last column (seqan3::detail::max_score_updater).
+        // ---------------------------------------------------------------------
+
+        score_type optimal_score = std::numeric_limits<score_type>::lowest();
+        std::pair<size_t, size_t> end_positions{0u, 0u};
+        size_t const last_row = sequence2_size - 1u;
+
+        auto track_last_row = [&] (size_t const column)
+        {
+            if (!is_local && free_sequence1_trailing && row_score(current_column, last_row) >= optimal_score)
+            {
+                optimal_score = row_score(current_column, last_row);
+                end_positions = {column, sequence2_size};
+            }
+        };
+
+        if constexpr (is_local)
+            optimal_score = score_type{};
+
+        track_last_row(0u);
+
+        // ---------------------------------------------------------------------
+        // Compute the columns.
+        // ---------------------------------------------------------------------
+
+        size_t column = 0;
+        for (auto const & letter1 : sequence1)
+        {
+            ++column;
+            std::swap(current_column, previous_column);
+            current_column.resize(segment_size);
+
+            simd_type const * column_profile = profile.data() + to_rank(letter1) * segment_size;
+            simd_type column_max = zero;
+
+            simd_type vertical = simd::fill<simd_type>(minus_infinity);
+            vertical[0] = first_row_score(column) + gap_open_score + gap_extension_score;
+            simd_type optimal = shift_lanes(previous_column[segment_size - 1u], first_row_score(column - 1u));
+
+            for (size_t segment = 0; segment < segment_size; ++segment)
+            {
+                optimal += column_profile[segment];
+                optimal = max(optimal, horizontal_column[segment]);
+                optimal = max(optimal, vertical);
+
+                if constexpr (is_local)
+                {
+                    optimal = max(optimal, zero);
+                    column_max = max(column_max, optimal);
+                }
+
+                current_column[segment] = optimal;
+
+                simd_type const open_gap = optimal + open_extension;
+                horizontal_column[segment] = max(horizontal_column[segment] + extension, open_gap);
+                vertical = max(vertical + extension, open_gap);
+                optimal = previous_column[segment];
+            }
+
+            // The lazy-F loop: propagate the vertical gaps over the segment borders as long as they are better than
+            // a gap opened in the respective cell.
+            vertical = shift_lanes(vertical, minus_infinity);
+            for (size_t segment = 0; any_greater(vertical, current_column[segment] + open);)
+            {
+                optimal = max(current_column[segment], vertical);
+                current_column[segment] = optimal;
+                horizontal_column[segment] = max(horizontal_column[segment], optimal + open_extension);
+
+                if constexpr (is_local)
+                    column_max = max(column_max, optimal);
+
+                vertical += extension;
+                if (++segment == segment_size)
+                {
+                    segment = 0;
+                    vertical = shift_lanes(vertical, minus_infinity);
+                }
+            }
+
+            if constexpr (is_local)
+            {
+                score_type best = column_max[0];
+                for (size_t lane = 1; lane < lanes; ++lane)
+                    best = std::max<score_type>(best, column_max[lane]);
+
+                if (best > optimal_score)
+                {
+                    optimal_score = best;
+                    size_t row = 0;
+                    while (row < last_row && row_score(current_column, row) != best)
+                        ++row;
+
+                    end_positions = {column, row + 1u};
+                }
+            }
+
+            track_last_row(column);
+        }
+
+        if (!is_local && free_sequence2_trailing)
+        {
+            if (first_row_score(column) >= optimal_score)
+            {
+                optimal_score = first_row_score(column);
+                end_positions = {column, 0u};
+            }
+
+            for (size_t row = 0; row < sequence2_size; ++row)
+            {
+                if (row_score(current_column, row) >= optimal_score)
+                {
+                    optimal_score = row_score(current_column, row);
+                    end_positions = {column, row + 1u};
+                }
+            }
+        }
+
+        if (!is_local && !free_sequence1_trailing && !free_sequence2_trailing)
+        {
+            optimal_score = row_score(current_column, last_row);
+            end_positions = {column, sequence2_size};
+        }
+
+        // ---------------------------------------------------------------------
+        // Build the alignment result.
+        // ---------------------------------------------------------------------
+
+        result_value_type result{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            result.sequence1_id = idx;
+
+        if constexpr (traits_type::output_sequence2_id)
+            result.sequence2_id = idx;
+
+        if constexpr (traits_type::compute_score)
+            result.score = optimal_score;
+
+        if constexpr (traits_type::compute_end_positions)
+        {
+            result.end_positions.first = end_positions.first;
+            result.end_positions.second = end_positions.second;
+        }
+
+        callback(alignment_result_type{std::move(result)});
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,613 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_xdrop.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/aligned_sequence/aligned_sequence_concept.hpp>
+#include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_method.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring_scheme.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+#include <seqan3/utility/views/slice.hpp>
+#include <seqan3/utility/views/type_reduce.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to extend a seed with the X-drop heuristic.
+ * \implements std::invocable
+ * \ingroup alignment_pairwise
+ *
+ * \tparam alignment_configuration_t  The configuration type; must be of type seqan3::configuration.
+ * \tparam alignment_scoring_scheme_t The scoring scheme type of the vectorised algorithm, i.e.
+ *                                    seqan3::detail::simd_match_mismatch_scoring_scheme or
+ *                                    seqan3::detail::simd_matrix_scoring_scheme; the configured scoring scheme type
+ *                                    for the scalar algorithm.
+ *
+ * \details
+ *
+ * Computes the alignment with affine gap costs that begins in the first cell of the alignment matrix and ends in the
+ * cell with the best score (see seqan3::align_cfg::method_extension). The alignment matrix is computed anti-diagonal
+ * by anti-diagonal: the `d`-th anti-diagonal contains the cells `(i, d - i)` and depends only on the two previous
+ * anti-diagonals. Every cell whose score is more than the X-drop below the best score of the previous anti-diagonals
+ * is dropped. The next anti-diagonal only covers the cells that can be reached from the remaining cells of the two
+ * previous anti-diagonals. Since a diagonal step skips an anti-diagonal, the computation stops as soon as all cells of
+ * two consecutive anti-diagonals were dropped.
+ *
+ * The cells of an anti-diagonal do not depend on each other. If seqan3::align_cfg::vectorised is configured, they are
+ * computed with simd vectors that hold consecutive cells of the anti-diagonal; the letters of the second sequence are
+ * stored in reverse order, such that the letters of consecutive cells are consecutive in memory as well. The sequence
+ * pairs of a chunk are computed one after another. The trace directions are only stored if the alignment is
+ * requested, and then only for the computed cells.
+ *
+ * \note For more information, please refer to the original article:
+ *       ZHANG, Zheng, et al. A greedy algorithm for aligning DNA sequences.
+ *       Journal of Computational biology, 2000, 7. Jg., Nr. 1-2, S. 203-214.
+ */
+template <typename alignment_configuration_t, typename alignment_scoring_scheme_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_xdrop
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::original_score_type;
+    //!\brief The type holding the scores of consecutive cells of an anti-diagonal; the score type if not vectorised.
+    using simd_type = typename traits_type::score_type;
+    //!\brief The configured scoring scheme type.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief A run of equal trace directions; the runs are stored from the begin to the end of the alignment.
+    using trace_segment_type = std::pair<trace_directions, size_t>;
+    //!\brief The type of an anti-diagonal; the cell `(i, d - i)` is stored at position `i + 1`.
+    using diagonal_type = std::vector<score_type>;
+
+    static_assert(traits_type::is_extension && !traits_type::is_banded,
+                  "The X-drop alignment supports only unbanded extension alignments.");
+
+    //!\brief The number of cells that are computed at once.
+    static constexpr size_t lanes = traits_type::alignments_per_vector;
+    //!\brief A score that can be extended by a gap or a letter pair without an underflow.
+    static constexpr score_type minus_infinity = std::numeric_limits<score_type>::lowest() / 2;
+    //!\brief Cells below this score are always dropped, such that cells computed only from dropped cells are dropped.
+    static constexpr score_type drop_floor = minus_infinity / 2;
+
+    //!\brief The scoring scheme.
+    scoring_scheme_type scoring_scheme{};
+    //!\brief The scoring scheme for the vectorised computation of the cells.
+    alignment_scoring_scheme_t simd_scoring_scheme{};
+    //!\brief The score for opening a gap, without the extension of the first gap position.
+    score_type gap_open_score{};
+    //!\brief The score for extending a gap by one position.
+    score_type gap_extension_score{};
+    //!\brief The maximal difference between the best score and the score of a computed cell.
+    int32_t x_drop{};
+
+    //!\brief The best scores of the last three anti-diagonals.
+    std::array<diagonal_type, 3> optimal_diagonals{};
+    //!\brief The best scores ending with a horizontal gap of the last two anti-diagonals.
+    std::array<diagonal_type, 2> horizontal_diagonals{};
+    //!\brief The best scores ending with a vertical gap of the last two anti-diagonals.
+    std::array<diagonal_type, 2> vertical_diagonals{};
+    //!\brief The ranks of the first sequence; the rank of the `i`-th letter is stored at position `i + 1`.
+    std::vector<score_type> ranks1{};
+    //!\brief The ranks of the reversed second sequence.
+    std::vector<score_type> reversed_ranks2{};
+    //!\brief The trace directions of the computed cells.
+    std::vector<trace_directions> trace_matrix{};
+    //!\brief The position of the first computed cell of every anti-diagonal in the #trace_matrix.
+    std::vector<size_t> trace_offsets{};
+    //!\brief The first computed column of every anti-diagonal.
+    std::vector<size_t> trace_first_columns{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_xdrop() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_xdrop(pairwise_alignment_algorithm_xdrop const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_xdrop(pairwise_alignment_algorithm_xdrop &&) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_xdrop & operator=(pairwise_alignment_algorithm_xdrop const &) = default;
+                                                                                             //!< Defaulted.
+    pairwise_alignment_algorithm_xdrop & operator=(pairwise_alignment_algorithm_xdrop &&) = default;
+                                                                                             //!< Defaulted.
+    ~pairwise_alignment_algorithm_xdrop() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \details
+     *
+     * Reads the scoring scheme, the gap costs and the X-drop from the configuration. If no gap cost model was
+     * provided by the user the default gap costs `-10` and `-1` are set for the gap open score and the gap extension
+     * score respectively.
+     */
+    pairwise_alignment_algorithm_xdrop(alignment_configuration_t const & config) :
+        scoring_scheme{seqan3::get<align_cfg::scoring_scheme>(config).scheme},
+        simd_scoring_scheme{scoring_scheme}
+    {
+        auto const & gap_scheme = config.get_or(align_cfg::gap_cost_affine{align_cfg::open_score{-10},
+                                                                           align_cfg::extension_score{-1}});
+        gap_open_score = gap_scheme.open_score;
+        gap_extension_score = gap_scheme.extension_score;
+        x_drop = get<align_cfg::method_extension>(config).x_drop;
+    }
+    //!\}
+
+    /*!\name Invocation
+     * \{
+     */
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \throws std::bad_alloc during allocation of the anti-diagonals and the trace directions.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Let `n` be the length of the first sequence, `m` be the length of the second sequence and `c` be the number of
+     * computed cells, which is at most \f$ (n+1)*(m+1) \f$. The runtime is \f$ O(c + n + m) \f$. The space is
+     * \f$ O(n + m) \f$ and \f$ O(c) \f$ if the alignment is computed.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+            compute_single_pair(idx, get<0>(sequence_pair), get<1>(sequence_pair), callback);
+    }
+    //!\}
+
+private:
+    //!\brief Loads the scores of consecutive cells.
+    template <typename value_t>
+    static value_t load(score_type const * scores) noexcept
+    {
+        if constexpr (std::same_as<value_t, score_type>)
+            return *scores;
+        else
+            return simd::load<value_t>(scores);
+    }
+
+    //!\brief Stores the scores of consecutive cells.
+    template <typename value_t>
+    static void store(score_type * scores, value_t const & value) noexcept
+    {
+        if constexpr (std::same_as<value_t, score_type>)
+            *scores = value;
+        else
+            simd::store(scores, value);
+    }
+
+    //!\brief Returns the given score for all consecutive cells.
+    template <typename value_t>
+    static value_t fill(score_type const score) noexcept
+    {
+        if constexpr (std::same_as<value_t, score_type>)
+            return score;
+        else
+            return simd::fill<value_t>(score);
+    }
+
+    //!\brief Returns the maximum of both scores of every cell.
+    template <typename value_t>
+    static value_t max(value_t const & lhs, value_t const & rhs) noexcept
+    {
+        return (lhs < rhs) ? rhs : lhs;
+    }
+
+    //!\brief Returns the trace directions of the given cell.
+    trace_directions trace_of(size_t const column, size_t const row) const noexcept
+    {
+        size_t const diagonal = column + row;
+        assert(column >= trace_first_columns[diagonal]);
+        return trace_matrix[trace_offsets[diagonal] + column - trace_first_columns[diagonal]];
+    }
+
+    /*!\brief Computes the alignment of a single sequence pair and invokes the callback with the result.
+     * \param[in] idx       The index of the sequence pair.
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     * \param[in] callback  The callback function to be invoked with the alignment result.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename callback_t>
+    void compute_single_pair(size_t const idx, sequence1_t && sequence1, sequence2_t && sequence2, callback_t & callback)
+    {
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        std::vector<std::ranges::range_value_t<sequence1_t>> const letters1(std::ranges::begin(sequence1),
+                                                                            std::ranges::end(sequence1));
+        std::vector<std::ranges::range_value_t<sequence2_t>> const letters2(std::ranges::begin(sequence2),
+                                                                            std::ranges::end(sequence2));
+        size_t const sequence1_size = letters1.size();
+        size_t const sequence2_size = letters2.size();
+
+        // ---------------------------------------------------------------------
+        // Initialise the anti-diagonals with the first cell.
+        // ---------------------------------------------------------------------
+
+        // The vectorised loads of the last cells read up to `lanes - 1` positions behind the anti-diagonal.
+        size_t const diagonal_size = sequence1_size + 2u + lanes;
+        for (diagonal_type & diagonal : optimal_diagonals)
+            diagonal.assign(diagonal_size, minus_infinity);
+        for (diagonal_type & diagonal : horizontal_diagonals)
+            diagonal.assign(diagonal_size, minus_infinity);
+        for (diagonal_type & diagonal : vertical_diagonals)
+            diagonal.assign(diagonal_size, minus_infinity);
+
+        if constexpr (traits_type::is_vectorised)
+        {
+            ranks1.assign(sequence1_size + 1u + lanes, score_type{});
+            for (size_t column = 0; column < sequence1_size; ++column)
+                ranks1[column + 1u] = seqan3::to_rank(letters1[column]);
+
+            reversed_ranks2.assign(sequence2_size + 1u + lanes, score_type{});
+            for (size_t row = 0; row < sequence2_size; ++row)
+                reversed_ranks2[sequence2_size - 1u - row] = seqan3::to_rank(letters2[row]);
+        }
+
+        if constexpr (traits_type::compute_sequence_alignment)
+        {
+            trace_matrix.assign(1u, trace_directions::none);
+            trace_offsets.assign(1u, 0u);
+            trace_first_columns.assign(1u, 0u);
+        }
+
+        optimal_diagonals[0][1] = score_type{};
+
+        score_type optimal_score{};
+        std::pair<size_t, size_t> end_positions{0u, 0u};
+
+        // The computed columns of the anti-diagonals in the buffers and the columns that were not dropped of the two
+        // previous anti-diagonals.
+        std::array<std::pair<size_t, size_t>, 3> computed_columns{};
+        computed_columns.fill({1u, 0u});
+        computed_columns[0] = {0u, 0u};
+        std::pair<size_t, size_t> previous_columns{0u, 0u};
+        std::pair<size_t, size_t> second_previous_columns{1u, 0u};
+
+        // ---------------------------------------------------------------------
+        // Compute the anti-diagonals.
+        // ---------------------------------------------------------------------
+
+        for (size_t diagonal = 1; diagonal <= sequence1_size + sequence2_size; ++diagonal)
+        {
+            bool const has_previous = previous_columns.first <= previous_columns.second;
+            bool const has_second_previous = second_previous_columns.first <= second_previous_columns.second;
+
+            // A diagonal step skips an anti-diagonal, so the extension only ends with two dropped anti-diagonals.
+            if (!has_previous && !has_second_previous)
+                break;
+
+            // The cells reachable from the previous anti-diagonal and with a diagonal step from the one before.
+            size_t first_column = std::numeric_limits<size_t>::max();
+            size_t last_column = 0u;
+            if (has_previous)
+            {
+                first_column = previous_columns.first;
+                last_column = previous_columns.second + 1u;
+            }
+
+            if (has_second_previous)
+            {
+                first_column = std::min(first_column, second_previous_columns.first + 1u);
+                last_column = std::max(last_column, second_previous_columns.second + 1u);
+            }
+
+            first_column = std::max(first_column, diagonal - std::min(diagonal, sequence2_size));
+            last_column = std::min(last_column, sequence1_size);
+
+            diagonal_type & current_optimal = optimal_diagonals[diagonal % 3];
+            diagonal_type const & previous_optimal = optimal_diagonals[(diagonal + 2) % 3];
+            diagonal_type const & second_previous_optimal = optimal_diagonals[(diagonal + 1) % 3];
+            diagonal_type & current_horizontal = horizontal_diagonals[diagonal % 2];
+            diagonal_type const & previous_horizontal = horizontal_diagonals[(diagonal + 1) % 2];
+            diagonal_type & current_vertical = vertical_diagonals[diagonal % 2];
+            diagonal_type const & previous_vertical = vertical_diagonals[(diagonal + 1) % 2];
+
+            // Reset the cells that were computed three (optimal) and two (gaps) anti-diagonals before.
+            auto reset = [] (diagonal_type & scores, std::pair<size_t, size_t> const columns)
+            {
+                if (columns.first <= columns.second)
+                    std::fill(scores.begin() + columns.first + 1u,
+                              scores.begin() + columns.second + 2u,
+                              minus_infinity);
+            };
+
+            reset(current_optimal, computed_columns[diagonal % 3]);
+            reset(current_horizontal, computed_columns[(diagonal + 1) % 3]);
+            reset(current_vertical, computed_columns[(diagonal + 1) % 3]);
+            computed_columns[diagonal % 3] = {first_column, last_column};
+
+            // The trace directions of the computed cells of the anti-diagonal.
+            [[maybe_unused]] trace_directions * diagonal_trace = nullptr;
+
+            if constexpr (traits_type::compute_sequence_alignment)
+            {
+                trace_offsets.push_back(trace_matrix.size());
+                trace_first_columns.push_back(first_column);
+                trace_matrix.resize(trace_matrix.size() + ((first_column <= last_column)
+                                                               ? last_column - first_column + 1u
+                                                               : 0u));
+                diagonal_trace = trace_matrix.data() + trace_offsets.back();
+            }
+
+            score_type const threshold =
+                static_cast<score_type>(std::max<int64_t>(static_cast<int64_t>(optimal_score) - x_drop, drop_floor));
+
+            // Computes the cells beginning with `column` from the three previous anti-diagonals.
+            auto compute_cells = [&] (auto const & score, size_t const column)
+            {
+                using value_t = std::remove_cvref_t<decltype(score)>;
+
+                value_t const open_extension = fill<value_t>(gap_open_score + gap_extension_score);
+                value_t const extension = fill<value_t>(gap_extension_score);
+
+                value_t const horizontal_open = load<value_t>(previous_optimal.data() + column) + open_extension;
+                value_t const horizontal_extend = load<value_t>(previous_horizontal.data() + column) + extension;
+                value_t const vertical_open = load<value_t>(previous_optimal.data() + column + 1u) + open_extension;
+                value_t const vertical_extend = load<value_t>(previous_vertical.data() + column + 1u) + extension;
+
+                value_t horizontal = max(horizontal_open, horizontal_extend);
+                value_t vertical = max(vertical_open, vertical_extend);
+                value_t optimal = load<value_t>(second_previous_optimal.data() + column) + score;
+                value_t trace = fill<value_t>(static_cast<score_type>(trace_directions::diagonal));
+
+                trace = (horizontal > optimal) ? fill<value_t>(static_cast<score_type>(trace_directions::left)) : trace;
+                optimal = max(optimal, horizontal);
+                trace = (vertical > optimal) ? fill<value_t>(static_cast<score_type>(trace_directions::up)) : trace;
+                optimal = max(optimal, vertical);
+
+                if constexpr (traits_type::compute_sequence_alignment)
+                {
+                    value_t const none = fill<value_t>(static_cast<score_type>(trace_directions::none));
+                    trace = trace | ((horizontal_open >= horizontal_extend)
+                                         ? fill<value_t>(static_cast<score_type>(trace_directions::left_open))
+                                         : none);
+                    trace = trace | ((vertical_open >= vertical_extend)
+                                         ? fill<value_t>(static_cast<score_type>(trace_directions::up_open))
+                                         : none);
+
+                    if constexpr (std::same_as<value_t, score_type>)
+                    {
+                        diagonal_trace[column - first_column] = static_cast<trace_directions>(trace);
+                    }
+                    else
+                    {
+                        for (size_t lane = 0; lane < lanes; ++lane)
+                            diagonal_trace[column - first_column + lane] = static_cast<trace_directions>(trace[lane]);
+                    }
+                }
+
+                // Drop the cells that are too far below the best score.
+                value_t const dropped = fill<value_t>(minus_infinity);
+                auto const keep = optimal >= fill<value_t>(threshold);
+                optimal = keep ? optimal : dropped;
+                horizontal = keep ? horizontal : dropped;
+                vertical = keep ? vertical : dropped;
+
+                store(current_optimal.data() + column + 1u, optimal);
+                store(current_horizontal.data() + column + 1u, horizontal);
+                store(current_vertical.data() + column + 1u, vertical);
+
+                return optimal;
+            };
+
+            score_type diagonal_optimum = minus_infinity;
+            size_t column = first_column;
+
+            if constexpr (traits_type::is_vectorised)
+            {
+                simd_type block_optimum = fill<simd_type>(minus_infinity);
+                size_t const rank2_offset = sequence2_size - diagonal;
+
+                for (; column + lanes <= last_column + 1u; column += lanes)
+                {
+                    simd_type const score =
+                        simd_scoring_scheme.score(
+                            simd_scoring_scheme.make_score_profile(load<simd_type>(ranks1.data() + column)),
+                            load<simd_type>(reversed_ranks2.data() + (rank2_offset + column)));
+
+                    block_optimum = max(block_optimum, compute_cells(score, column));
+                }
+
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    diagonal_optimum = std::max<score_type>(diagonal_optimum, block_optimum[lane]);
+            }
+
+            for (; column <= last_column; ++column)
+            {
+                size_t const row = diagonal - column;
+                score_type const score = (column == 0u || row == 0u)
+                                       ? score_type{}
+                                       : static_cast<score_type>(scoring_scheme.score(letters1[column - 1u],
+                                                                                     letters2[row - 1u]));
+                diagonal_optimum = std::max<score_type>(diagonal_optimum, compute_cells(score, column));
+            }
+
+            // Shrink the cells to the ones that were not dropped.
+            size_t first_kept = first_column;
+            while (first_kept <= last_column && current_optimal[first_kept + 1u] == minus_infinity)
+                ++first_kept;
+
+            second_previous_columns = previous_columns;
+            previous_columns = {1u, 0u};
+
+            if (first_kept > last_column)
+                continue;
+
+            size_t last_kept = last_column;
+            while (current_optimal[last_kept + 1u] == minus_infinity)
+                --last_kept;
+
+            previous_columns = {first_kept, last_kept};
+
+            if (diagonal_optimum > optimal_score)
+            {
+                optimal_score = diagonal_optimum;
+                size_t best_column = first_kept;
+                while (current_optimal[best_column + 1u] != optimal_score)
+                    ++best_column;
+
+                end_positions = {best_column, diagonal - best_column};
+            }
+        }
+
+        // ---------------------------------------------------------------------
+        // Build the alignment result.
+        // ---------------------------------------------------------------------
+
+        result_value_type result{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            result.sequence1_id = idx;
+
+        if constexpr (traits_type::output_sequence2_id)
+            result.sequence2_id = idx;
+
+        if constexpr (traits_type::compute_score)
+            result.score = optimal_score;
+
+        if constexpr (traits_type::compute_end_positions)
+        {
+            result.end_positions.first = end_positions.first;
+            result.end_positions.second = end_positions.second;
+        }
+
+        if constexpr (traits_type::compute_begin_positions)
+        {
+            result.begin_positions.first = 0u;
+            result.begin_positions.second = 0u;
+        }
+
+        if constexpr (traits_type::compute_sequence_alignment)
+        {
+            std::vector<trace_segment_type> trace{};
+            compute_trace(end_positions, trace);
+
+            using std::get;
+            assign_unaligned(get<0>(result.alignment),
+                             views::type_reduce(sequence1) | views::slice(0u, end_positions.first));
+            assign_unaligned(get<1>(result.alignment),
+                             views::type_reduce(sequence2) | views::slice(0u, end_positions.second));
+            fill_aligned_sequences(trace, get<0>(result.alignment), get<1>(result.alignment));
+        }
+
+        callback(alignment_result_type{std::move(result)});
+    }
+
+    /*!\brief Follows the stored trace directions from the end positions back to the first cell.
+     * \param[in]  end_positions The end positions of the alignment.
+     * \param[out] trace         The trace segments from the first cell to the end positions.
+     */
+    void compute_trace(std::pair<size_t, size_t> const end_positions, std::vector<trace_segment_type> & trace) const
+    {
+        std::vector<trace_directions> reversed_trace{};
+        auto [column, row] = end_positions;
+        trace_directions state = trace_directions::diagonal;
+
+        while (column != 0u || row != 0u)
+        {
+            trace_directions const directions = trace_of(column, row);
+
+            if (state == trace_directions::diagonal)
+            {
+                if ((directions & trace_directions::diagonal) == trace_directions::diagonal)
+                {
+                    reversed_trace.push_back(trace_directions::diagonal);
+                    --column;
+                    --row;
+                }
+                else
+                {
+                    state = ((directions & trace_directions::left) == trace_directions::left) ? trace_directions::left
+                                                                                               : trace_directions::up;
+                }
+            }
+            else if (state == trace_directions::left)
+            {
+                reversed_trace.push_back(trace_directions::left);
+                bool const opened = (directions & trace_directions::left_open) == trace_directions::left_open;
+                --column;
+                state = opened ? trace_directions::diagonal : trace_directions::left;
+            }
+            else // trace_directions::up
+            {
+                reversed_trace.push_back(trace_directions::up);
+                bool const opened = (directions & trace_directions::up_open) == trace_directions::up_open;
+                --row;
+                state = opened ? trace_directions::diagonal : trace_directions::up;
+            }
+        }
+
+        for (auto direction : reversed_trace | std::views::reverse)
+        {
+            if (!trace.empty() && trace.back().first == direction)
+                ++trace.back().second;
+            else
+                trace.emplace_back(direction, 1u);
+        }
+    }
+
+    //!\brief Inserts the gaps of the trace segments into the aligned sequences like seqan3::detail::aligned_sequence_builder.
+    template <typename aligned1_t, typename aligned2_t>
+    static void fill_aligned_sequences(std::vector<trace_segment_type> const & trace,
+                                       aligned1_t & aligned1,
+                                       aligned2_t & aligned2)
+    {
+        auto it1 = std::ranges::begin(aligned1);
+        auto it2 = std::ranges::begin(aligned2);
+
+        for (auto const & [direction, count] : trace)
+        {
+            if (direction == trace_directions::up)
+                it1 = insert_gap(aligned1, it1, count);
+
+            if (direction == trace_directions::left)
+                it2 = insert_gap(aligned2, it2, count);
+
+            it1 += count;
+            it2 += count;
+        }
+    }
+};
+
+} // namespace seqan3::detail
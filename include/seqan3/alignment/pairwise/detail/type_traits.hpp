@@ -18,6 +18,7 @@
 #include <seqan3/alignment/configuration/align_config_result_type.hpp>
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
 #include <seqan3/alignment/configuration/align_config_output.hpp>
@@ -126,10 +127,14 @@ public:
         configuration_t::template exists<seqan3::align_cfg::method_global>();
     //!\brief Flag indicating whether local alignment mode is enabled.
     static constexpr bool is_local = configuration_t::template exists<seqan3::align_cfg::method_local>();
+    //!\brief Flag indicating whether extension alignment method is enabled.
+    static constexpr bool is_extension = configuration_t::template exists<seqan3::align_cfg::method_extension>();
     //!\brief Flag indicating whether banded alignment mode is enabled.
     static constexpr bool is_banded = configuration_t::template exists<align_cfg::band_fixed_size>();
     //!\brief Flag indicating whether debug mode is enabled.
     static constexpr bool is_debug = configuration_t::template exists<detail::debug_mode>();
+    //!\brief Flag indicating whether the alignment is computed in linear memory.
+    static constexpr bool is_linear_memory = configuration_t::template exists<align_cfg::linear_memory>();
     //!\brief Flag indicating whether a user provided callback was given.
     static constexpr bool is_one_way_execution = configuration_t::template exists<align_cfg::on_result>();
     //!\brief The selected scoring scheme.
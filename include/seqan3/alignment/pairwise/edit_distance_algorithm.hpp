@@ -16,7 +16,9 @@
 
 #include <seqan3/alignment/configuration/align_config_edit.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_banded.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_unbanded.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_unbanded_simd.hpp>
 
 namespace seqan3::detail
 {
@@ -33,7 +35,10 @@ namespace seqan3::detail
  * Within the alignment configuration a std::function object storing this wrapper is returned
  * if an edit distance should be computed. On invocation it delegates the call to the actual implementation
  * of the edit distance algorithm, while the interface is unified with the execution model of the pairwise alignment
- * algorithms.
+ * algorithms. If seqan3::align_cfg::band_fixed_size is configured, seqan3::detail::edit_distance_banded is used,
+ * otherwise seqan3::detail::edit_distance_unbanded. If seqan3::align_cfg::vectorised is configured and only the score
+ * and the end positions are requested, the unbanded edit distance is computed by
+ * seqan3::detail::edit_distance_unbanded_simd for several sequence pairs at once.
  */
 template <typename config_t, typename traits_t>
 class edit_distance_algorithm
@@ -43,6 +48,11 @@ private:
     using configuration_traits_type = alignment_configuration_traits<config_t>;
     //!\brief The configured alignment result type.
     using alignment_result_type = typename configuration_traits_type::alignment_result_type;
+    //!\brief Whether the sequence pairs are computed by seqan3::detail::edit_distance_unbanded_simd.
+    static constexpr bool is_vectorised = configuration_traits_type::is_vectorised &&
+                                          !configuration_traits_type::is_banded &&
+                                          !configuration_traits_type::compute_begin_positions &&
+                                          !configuration_traits_type::compute_sequence_alignment;
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
@@ -95,11 +105,25 @@ public:
     {
         using std::get;
 
-        for (auto && [sequence_pair, index] : indexed_sequence_pairs)
-            compute_single_pair(index,
-                                get<0>(sequence_pair),
-                                get<1>(sequence_pair),
-                                std::forward<callback_t>(callback));
+        if constexpr (is_vectorised)
+        {
+            using sequence_pair_t = std::tuple_element_t<0, std::ranges::range_value_t<indexed_sequence_pairs_t>>;
+            using edit_traits = default_edit_distance_trait_type<std::tuple_element_t<0, sequence_pair_t>,
+                                                                 std::tuple_element_t<1, sequence_pair_t>,
+                                                                 config_t,
+                                                                 typename traits_t::is_semi_global_type>;
+
+            edit_distance_unbanded_simd algo{*cfg_ptr, edit_traits{}};
+            algo(std::forward<indexed_sequence_pairs_t>(indexed_sequence_pairs), std::forward<callback_t>(callback));
+        }
+        else
+        {
+            for (auto && [sequence_pair, index] : indexed_sequence_pairs)
+                compute_single_pair(index,
+                                    get<0>(sequence_pair),
+                                    get<1>(sequence_pair),
+                                    std::forward<callback_t>(callback));
+        }
     }
 private:
 
@@ -124,8 +148,16 @@ private:
                                                              second_range_t,
                                                              config_t,
                                                              typename traits_t::is_semi_global_type>;
-        edit_distance_unbanded algo{first_range, second_range, *cfg_ptr, edit_traits{}};
-        algo(idx, callback);
+        if constexpr (configuration_traits_type::is_banded)
+        {
+            edit_distance_banded algo{first_range, second_range, *cfg_ptr, edit_traits{}};
+            algo(idx, callback);
+        }
+        else
+        {
+            edit_distance_unbanded algo{first_range, second_range, *cfg_ptr, edit_traits{}};
+            algo(idx, callback);
+        }
     }
 
     //!\brief The alignment configuration stored on the heap.
@@ -0,0 +1,668 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides a pairwise alignment algorithm for edit distance within a band.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <seqan3/std/bit>
+#include <cassert>
+#include <cstdint>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_concept.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief This calculates an alignment using the edit distance within a band.
+ * \ingroup alignment_pairwise
+ * \tparam database_t     \copydoc default_edit_distance_trait_type::database_type
+ * \tparam query_t        \copydoc default_edit_distance_trait_type::query_type
+ * \tparam align_config_t The configuration type; must be of type seqan3::configuration.
+ * \tparam edit_traits    The traits type; must be a seqan3::detail::default_edit_distance_trait_type.
+ *
+ * \details
+ *
+ * Computes the bit-parallel algorithm of Myers and Hyyrö only for the cells within the band given by
+ * seqan3::align_cfg::band_fixed_size. As in the other alignment algorithms, the first sequence (database) spans the
+ * columns, the second sequence (query) spans the rows and a cell (`row`, `column`) lies in the band if
+ * `lower_diagonal <= column - row <= upper_diagonal`.
+ *
+ * The vertical differences of a column are not stored per row of the query but relative to the first row of the band
+ * in this column. Moving to the next column, the band moves down by one row, which is a right shift of the bit
+ * vectors by one bit. Hence, only `(upper_diagonal - lower_diagonal + 1) / word_size` machine words are computed per
+ * column, independent of the length of the query. A cell above or below the band is never better than its neighbour
+ * within the band, such that treating it like a cell that is one larger than its neighbour gives the exact score of
+ * the best alignment within the band.
+ *
+ * The score of the first row of the band is tracked per column. If the begin positions or the alignment are
+ * requested, the bit vectors of every column are stored and the trace is recomputed from the scores of the
+ * neighbouring cells, preferring seqan3::detail::trace_directions::left over seqan3::detail::trace_directions::up
+ * over seqan3::detail::trace_directions::diagonal like seqan3::detail::edit_distance_unbanded.
+ */
+template <std::ranges::viewable_range database_t,
+          std::ranges::viewable_range query_t,
+          typename align_config_t,
+          typename edit_traits>
+class edit_distance_banded : public edit_traits
+{
+public:
+    using typename edit_traits::word_type;
+    using typename edit_traits::score_type;
+    using typename edit_traits::database_type;
+    using typename edit_traits::query_type;
+    using typename edit_traits::align_config_type;
+    using edit_traits::word_size;
+
+private:
+    using typename edit_traits::query_alphabet_type;
+    using typename edit_traits::alignment_result_type;
+    using edit_traits::use_max_errors;
+    using edit_traits::is_semi_global;
+    using edit_traits::is_global;
+    using edit_traits::compute_end_positions;
+    using edit_traits::compute_begin_positions;
+    using edit_traits::compute_sequence_alignment;
+    using edit_traits::compute_trace_matrix;
+
+    struct trace_path_iterator;
+
+    //!\brief The horizontal/database sequence.
+    database_t database;
+    //!\brief The vertical/query sequence.
+    query_t query;
+    //!\brief The configuration.
+    align_config_t config;
+
+    //!\brief The lower diagonal of the band.
+    int64_t lower_diagonal{};
+    //!\brief The upper diagonal of the band.
+    int64_t upper_diagonal{};
+    //!\brief The size of the query.
+    int64_t query_size{};
+    //!\brief The size of the database.
+    int64_t database_size{};
+    //!\brief The first computed column, i.e. the first column with a band cell below the first row.
+    int64_t first_column{};
+    //!\brief The last computed column.
+    int64_t last_column{};
+    //!\brief The number of machine words that cover the band of one column.
+    size_t block_count{};
+    //!\brief The number of machine words of one bit mask in #bit_masks.
+    size_t mask_block_count{};
+
+    //!\brief The maximal number of errors if #use_max_errors is true.
+    score_type max_errors{};
+    //!\brief The score of the best cell in the last row.
+    score_type best_score{};
+    //!\brief The column of #best_score.
+    int64_t best_score_column{};
+
+    //!\brief The positive vertical differences of the current column, followed by a word of `1`s.
+    std::vector<word_type> vp{};
+    //!\brief The negative vertical differences of the current column, followed by a word of `0`s.
+    std::vector<word_type> vn{};
+    /*!\brief The machine words which translate a letter of the query into a bit mask.
+     *
+     * \details
+     *
+     * Each bit position which is true (= 1) corresponds to a match of a letter in the query at this position.
+     */
+    std::vector<word_type> bit_masks{};
+
+    //!\brief The #vp of each computed column, if #compute_trace_matrix is true.
+    std::vector<word_type> trace_vp{};
+    //!\brief The #vn of each computed column, if #compute_trace_matrix is true.
+    std::vector<word_type> trace_vn{};
+    //!\brief The score of the first row of the band in each computed column, if #compute_trace_matrix is true.
+    std::vector<score_type> trace_top_score{};
+
+    //!\brief The first row of the band in `column`; row `0` is never part of the bit vectors.
+    int64_t first_row(int64_t const column) const noexcept
+    {
+        return std::max<int64_t>(1, column - upper_diagonal);
+    }
+
+    //!\brief The last row of the band in `column`.
+    int64_t last_row(int64_t const column) const noexcept
+    {
+        return std::min<int64_t>(query_size, column - lower_diagonal);
+    }
+
+    //!\brief Whether the cell (`row`, `column`) lies in the band and in the matrix.
+    bool in_band(int64_t const row, int64_t const column) const noexcept
+    {
+        return row >= 0 && column >= 0 && row <= query_size && column <= database_size &&
+               column - row >= lower_diagonal && column - row <= upper_diagonal;
+    }
+
+    //!\brief Returns the difference `+1`, `0` or `-1` at `bit` of the bit vectors `positive` and `negative`.
+    static score_type difference_at(word_type const positive, word_type const negative, size_t const bit) noexcept
+    {
+        return static_cast<score_type>((positive >> bit) & 1u) - static_cast<score_type>((negative >> bit) & 1u);
+    }
+
+    //!\brief Returns the sum of the differences `1` to `count` of the bit vectors `positive` and `negative`.
+    static score_type sum_of_differences(word_type const * positive,
+                                         word_type const * negative,
+                                         size_t const count) noexcept
+    {
+        score_type sum = -difference_at(positive[0], negative[0], 0u);
+        size_t const full_blocks = (count + 1u) / word_size;
+        size_t const rest = (count + 1u) % word_size;
+
+        for (size_t block = 0; block < full_blocks; ++block)
+            sum += std::popcount(positive[block]) - std::popcount(negative[block]);
+
+        if (rest != 0u)
+        {
+            word_type const mask = (word_type{1u} << rest) - 1u;
+            sum += std::popcount(static_cast<word_type>(positive[full_blocks] & mask)) -
+                   std::popcount(static_cast<word_type>(negative[full_blocks] & mask));
+        }
+
+        return sum;
+    }
+
+    //!\brief The score of the cell (`row`, `column`) which must lie in the band; requires the stored bit vectors.
+    score_type cell_score(int64_t const row, int64_t const column) const noexcept
+    {
+        assert(in_band(row, column));
+
+        if (row == 0)
+            return is_global ? column : 0;
+
+        if (column == 0)
+            return row;
+
+        assert(column >= first_column && column <= last_column);
+        size_t const offset = (column - first_column) * block_count;
+        return trace_top_score[column - first_column] +
+               sum_of_differences(trace_vp.data() + offset, trace_vn.data() + offset, row - first_row(column));
+    }
+
+    //!\brief Whether the computation produced a valid alignment.
+    bool is_valid() const noexcept
+    {
+        if constexpr (use_max_errors)
+            return best_score <= max_errors;
+        else
+            return true;
+    }
+
+    //!\brief Returns the coordinate after the last cell of the matrix.
+    advanceable_alignment_coordinate<> invalid_coordinate() const noexcept
+    {
+        return {column_index_type{static_cast<size_t>(database_size)}, row_index_type{static_cast<size_t>(query_size)}};
+    }
+
+    //!\brief Returns the end position of the best alignment or an invalid coordinate.
+    advanceable_alignment_coordinate<> end_positions() const noexcept
+    {
+        if (!is_valid())
+            return invalid_coordinate();
+
+        return {column_index_type{static_cast<size_t>(best_score_column)},
+                row_index_type{static_cast<size_t>(query_size)}};
+    }
+
+    //!\brief Returns the trace path from the best cell of the last row.
+    auto trace_path() const
+    {
+        matrix_coordinate const trace_begin{row_index_type{static_cast<size_t>(query_size)},
+                                            column_index_type{static_cast<size_t>(best_score_column)}};
+        return std::ranges::subrange<trace_path_iterator, std::default_sentinel_t>{trace_path_iterator{this,
+                                                                                                       trace_begin},
+                                                                                   std::default_sentinel};
+    }
+
+    //!\brief A single compute step of a machine word, see seqan3::detail::edit_distance_unbanded.
+    static void compute_step(word_type const b,
+                             word_type & vp,
+                             word_type & vn,
+                             word_type & hp,
+                             word_type & hn,
+                             word_type & carry_d0,
+                             word_type & carry_hp,
+                             word_type & carry_hn) noexcept
+    {
+        word_type x = b | vn;
+        word_type const t = vp + (x & vp) + carry_d0;
+
+        word_type const d0 = (t ^ vp) | x;
+        hn = vp & d0;
+        hp = vn | ~(vp | d0);
+
+        carry_d0 = (carry_d0 != 0u) ? t <= vp : t < vp;
+
+        x = (hp << 1u) | carry_hp;
+        vn = x & d0;
+        vp = (hn << 1u) | ~(x | d0) | carry_hn;
+
+        carry_hp = hp >> (word_size - 1u);
+        carry_hn = hn >> (word_size - 1u);
+    }
+
+    //!\brief Updates the best score with the score of the last row in `column`.
+    void update_best_score(score_type const score, int64_t const column) noexcept
+    {
+        if constexpr (is_global)
+        {
+            best_score = score;
+            best_score_column = column;
+        }
+        else // is_semi_global: the right-most best column, like seqan3::detail::edit_distance_unbanded.
+        {
+            if (score <= best_score)
+            {
+                best_score = score;
+                best_score_column = column;
+            }
+        }
+    }
+
+    //!\brief Compute the alignment.
+    void compute()
+    {
+        // The virtual column before the first computed column. Its first row is row 1 and all cells below are one
+        // larger than the cell above.
+        int64_t column = first_column - 1;
+        int64_t row_begin = 1;
+        score_type top_score = (is_global ? column : 0) + 1;
+        score_type last_row_score{};
+        bool last_row_in_band = last_row(column) == query_size;
+
+        if (last_row_in_band) // only in column 0
+        {
+            last_row_score = query_size;
+            update_best_score(last_row_score, column);
+        }
+
+        auto database_it = std::ranges::begin(database);
+        std::ranges::advance(database_it, column);
+
+        for (++column; column <= last_column; ++column, ++database_it)
+        {
+            int64_t const new_row_begin = first_row(column);
+            int64_t const row_end = last_row(column) + 1;
+            size_t const rows = row_end - new_row_begin;
+            size_t const active_blocks = (rows + word_size - 1u) / word_size;
+
+            // The band moves down by one row if its first row increases.
+            bool const shift_band = new_row_begin != row_begin;
+            row_begin = new_row_begin;
+
+            // The first row of the matrix increases in global alignments and outside of the band.
+            word_type carry_hp = (is_semi_global && row_begin == 1 && column <= upper_diagonal) ? 0u : 1u;
+            word_type carry_hn{0u};
+            word_type carry_d0{0u};
+            word_type hp{};
+            word_type hn{};
+
+            query_alphabet_type const letter{static_cast<query_alphabet_type>(*database_it)};
+            size_t const mask_offset = mask_block_count * seqan3::to_rank(letter);
+            size_t const mask_block = (row_begin - 1) / word_size;
+            size_t const mask_shift = (row_begin - 1) % word_size;
+            size_t const last_bit = (rows - 1u) % word_size;
+
+            // Each word is shifted, computed and masked in one pass, such that it is loaded and stored only once.
+            for (size_t block = 0; block < active_blocks; ++block)
+            {
+                word_type block_vp = vp[block];
+                word_type block_vn = vn[block];
+
+                if (shift_band)
+                {
+                    block_vp = (block_vp >> 1u) | (vp[block + 1u] << (word_size - 1u));
+                    block_vn = (block_vn >> 1u) | (vn[block + 1u] << (word_size - 1u));
+
+                    if (block == 0u)
+                        top_score += difference_at(block_vp, block_vn, 0u);
+                }
+
+                word_type const * mask = bit_masks.data() + mask_offset + mask_block + block;
+                word_type b = mask[0] >> mask_shift;
+                if (mask_shift != 0u)
+                    b |= mask[1] << (word_size - mask_shift);
+
+                compute_step(b, block_vp, block_vn, hp, hn, carry_d0, carry_hp, carry_hn);
+
+                if (block == 0u)
+                    top_score += difference_at(hp, hn, 0u);
+
+                // Rows below the band are one larger than the row above.
+                if (block + 1u == active_blocks && last_bit + 1u != word_size)
+                {
+                    word_type const below_band = ~word_type{0u} << (last_bit + 1u);
+                    block_vp |= below_band;
+                    block_vn &= ~below_band;
+                }
+
+                vp[block] = block_vp;
+                vn[block] = block_vn;
+            }
+
+            // The last row of the band either moves down into rows that were outside of the band or stays at the
+            // last row of the matrix.
+            if (row_end - 1 == query_size)
+            {
+                if (last_row_in_band)
+                {
+                    last_row_score += difference_at(hp, hn, last_bit);
+                }
+                else
+                {
+                    last_row_score = top_score + sum_of_differences(vp.data(), vn.data(), rows - 1u);
+                    last_row_in_band = true;
+                }
+
+                update_best_score(last_row_score, column);
+            }
+
+            if constexpr (compute_trace_matrix)
+            {
+                trace_vp.insert(trace_vp.end(), vp.begin(), vp.begin() + block_count);
+                trace_vn.insert(trace_vn.end(), vn.begin(), vn.begin() + block_count);
+                trace_top_score.push_back(top_score);
+            }
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    //!\brief The class template parameter may resolve to an lvalue reference which prohibits default constructibility.
+    edit_distance_banded() = delete;
+    edit_distance_banded(edit_distance_banded const &) = default;             //!< Defaulted.
+    edit_distance_banded(edit_distance_banded &&) = default;                  //!< Defaulted.
+    edit_distance_banded & operator=(edit_distance_banded const &) = default; //!< Defaulted.
+    edit_distance_banded & operator=(edit_distance_banded &&) = default;      //!< Defaulted.
+    ~edit_distance_banded() = default;                                        //!< Defaulted.
+
+    /*!\brief Constructor
+     * \param[in] _database \copydoc database
+     * \param[in] _query    \copydoc query
+     * \param[in] _config   \copydoc config
+     * \param[in] _traits   The traits object. Only the type information will be used.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the band ends before the last cell of a global alignment or
+     *         before the last row.
+     */
+    edit_distance_banded(database_t _database,
+                         query_t _query,
+                         align_config_t _config,
+                         edit_traits const & SEQAN3_DOXYGEN_ONLY(_traits)) :
+        database{std::forward<database_t>(_database)},
+        query{std::forward<query_t>(_query)},
+        config{std::forward<align_config_t>(_config)}
+    {
+        static constexpr size_t alphabet_size_ = alphabet_size<query_alphabet_type>;
+
+        auto const band = get<align_cfg::band_fixed_size>(config);
+        lower_diagonal = band.lower_diagonal;
+        upper_diagonal = band.upper_diagonal;
+        query_size = std::ranges::size(query);
+        database_size = std::ranges::size(database);
+
+        bool const upper_diagonal_ends_before_last_cell = upper_diagonal + query_size < database_size;
+        bool const lower_diagonal_ends_behind_last_cell = query_size + lower_diagonal > database_size;
+
+        if (lower_diagonal_ends_behind_last_cell || (is_global && upper_diagonal_ends_before_last_cell))
+            throw invalid_alignment_configuration{"The selected band [" + std::to_string(lower_diagonal) + ":" +
+                                                  std::to_string(upper_diagonal) + "] cannot be used with the current "
+                                                  "alignment configuration: The band ends in a region without free "
+                                                  "gaps."};
+
+        if constexpr (use_max_errors)
+            max_errors = -get<align_cfg::min_score>(config).score;
+
+        first_column = std::max<int64_t>(1, lower_diagonal + 1);
+        last_column = std::min(database_size, query_size + upper_diagonal);
+        best_score = query_size + database_size + 1;
+        best_score_column = database_size;
+
+        if (query_size == 0) // [[unlikely]]
+        {
+            // The first row is the last row.
+            best_score = is_global ? database_size : 0;
+            best_score_column = is_global ? database_size : std::min(database_size, upper_diagonal);
+            first_column = 1;
+            last_column = 0;
+            return;
+        }
+
+        size_t const band_rows = std::min(query_size, upper_diagonal - lower_diagonal + 1);
+        block_count = (band_rows + word_size - 1u) / word_size;
+        // The bit masks are read at the first row of the band, which may reach block_count words behind the query.
+        mask_block_count = (query_size + word_size - 1u) / word_size + block_count + 1u;
+
+        vp.resize(block_count + 1u, ~word_type{0u});
+        vn.resize(block_count + 1u, word_type{0u});
+        bit_masks.resize(alphabet_size_ * mask_block_count, 0u);
+
+        // encoding the letters as bit-vectors
+        for (int64_t j = 0; j < query_size; j++)
+        {
+            size_t const i = mask_block_count * seqan3::to_rank(query[j]) + j / word_size;
+            bit_masks[i] |= word_type{1u} << (j % word_size);
+        }
+
+        if constexpr (compute_trace_matrix)
+        {
+            size_t const columns = std::max<int64_t>(0, last_column - first_column + 1);
+            trace_vp.reserve(columns * block_count);
+            trace_vn.reserve(columns * block_count);
+            trace_top_score.reserve(columns);
+        }
+    }
+    //!\}
+
+    /*!\brief Generic invocable interface.
+     * \param[in] idx The index of the currently processed sequence pair.
+     * \param[in] callback The callback function to be invoked with the alignment result.
+     */
+    template <typename callback_t>
+    void operator()([[maybe_unused]] size_t const idx, callback_t && callback)
+    {
+        using traits_type = alignment_configuration_traits<align_config_t>;
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        if (query_size != 0)
+            compute();
+
+        auto cached_end_positions = end_positions();
+        advanceable_alignment_coordinate<> cached_begin_positions{invalid_coordinate()};
+
+        result_value_type res_vt{};
+
+        if constexpr (traits_type::output_sequence1_id)
+            res_vt.sequence1_id = idx;
+
+        if constexpr (traits_type::output_sequence2_id)
+            res_vt.sequence2_id = idx;
+
+        if constexpr (traits_type::compute_score)
+            res_vt.score = is_valid() ? -best_score : matrix_inf<score_type>;
+
+        if constexpr (compute_begin_positions)
+        {
+            if (is_valid())
+            {
+                if constexpr (traits_type::compute_sequence_alignment)
+                {
+                    aligned_sequence_builder builder{database, query};
+                    auto trace_res = builder(trace_path());
+                    res_vt.alignment = std::move(trace_res.alignment);
+                    cached_begin_positions.first = trace_res.first_sequence_slice_positions.first;
+                    cached_begin_positions.second = trace_res.second_sequence_slice_positions.first;
+                }
+                else
+                {
+                    auto path = trace_path();
+                    auto it = std::ranges::begin(path);
+                    for (; it != std::ranges::end(path); ++it)
+                    {}
+
+                    cached_begin_positions.first = it.coordinate().col;
+                    cached_begin_positions.second = it.coordinate().row;
+                }
+            }
+        }
+
+        if constexpr (traits_type::compute_end_positions)
+            res_vt.end_positions = std::move(cached_end_positions);
+
+        if constexpr (traits_type::compute_begin_positions)
+            res_vt.begin_positions = std::move(cached_begin_positions);
+
+        callback(alignment_result_type{std::move(res_vt)});
+    }
+};
+
+/*!\brief The iterator over the trace path of seqan3::detail::edit_distance_banded.
+ *
+ * \details
+ *
+ * Returns exactly one of seqan3::detail::trace_directions::left, seqan3::detail::trace_directions::up and
+ * seqan3::detail::trace_directions::diagonal per cell, and seqan3::detail::trace_directions::none at the begin of the
+ * alignment, as needed by the seqan3::detail::aligned_sequence_builder.
+ */
+template <std::ranges::viewable_range database_t,
+          std::ranges::viewable_range query_t,
+          typename align_config_t,
+          typename edit_traits>
+struct edit_distance_banded<database_t, query_t, align_config_t, edit_traits>::trace_path_iterator
+{
+    /*!\name Associated types
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::value_type
+    using value_type = trace_directions;
+    //!\copydoc seqan3::detail::trace_iterator_base::difference_type
+    using difference_type = std::ptrdiff_t;
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator*
+    value_type operator*() const
+    {
+        int64_t const row = coordinate_.row;
+        int64_t const column = coordinate_.col;
+
+        if (row == 0)
+            return (is_global && column != 0) ? trace_directions::left : trace_directions::none;
+
+        if (column == 0)
+            return trace_directions::up;
+
+        score_type const score = parent->cell_score(row, column);
+
+        if (parent->in_band(row, column - 1) && parent->cell_score(row, column - 1) + 1 == score)
+            return trace_directions::left;
+        else if (parent->in_band(row - 1, column) && parent->cell_score(row - 1, column) + 1 == score)
+            return trace_directions::up;
+
+        assert(parent->in_band(row - 1, column - 1));
+        return trace_directions::diagonal;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::coordinate
+    [[nodiscard]] matrix_coordinate const & coordinate() const
+    {
+        return coordinate_;
+    }
+    //!\}
+
+    /*!\name Arithmetic operators
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator++
+    trace_path_iterator & operator++()
+    {
+        value_type const dir = *(*this);
+
+        if (dir == trace_directions::left || dir == trace_directions::diagonal)
+            --coordinate_.col;
+
+        if (dir == trace_directions::up || dir == trace_directions::diagonal)
+            --coordinate_.row;
+
+        return *this;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator++
+    void operator++(int)
+    {
+        ++(*this);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\copydoc seqan3::detail::trace_iterator_base::operator==(derived_t const &, std::default_sentinel_t const &)
+    friend bool operator==(trace_path_iterator const & it, std::default_sentinel_t)
+    {
+        return *it == trace_directions::none;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator==(std::default_sentinel_t const &, derived_t const &)
+    friend bool operator==(std::default_sentinel_t, trace_path_iterator const & it)
+    {
+        return it == std::default_sentinel;
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator!=(derived_t const &, std::default_sentinel_t const &)
+    friend bool operator!=(trace_path_iterator const & it, std::default_sentinel_t)
+    {
+        return !(it == std::default_sentinel);
+    }
+
+    //!\copydoc seqan3::detail::trace_iterator_base::operator!=(std::default_sentinel_t const &, derived_t const &)
+    friend bool operator!=(std::default_sentinel_t, trace_path_iterator const & it)
+    {
+        return it != std::default_sentinel;
+    }
+    //!\}
+
+    //!\brief The algorithm that holds the stored columns.
+    edit_distance_banded const * parent{nullptr};
+    //!\brief The current coordinate.
+    matrix_coordinate coordinate_{};
+};
+
+/*!\name Type deduction guides
+ * \relates seqan3::detail::edit_distance_banded
+ * \{
+ */
+
+//!\brief Deduce the type from the provided arguments.
+template <typename database_t, typename query_t, typename config_t, typename traits_t>
+edit_distance_banded(database_t && database, query_t && query, config_t config, traits_t)
+    -> edit_distance_banded<database_t, query_t, config_t, traits_t>;
+//!\}
+
+} // namespace seqan3::detail
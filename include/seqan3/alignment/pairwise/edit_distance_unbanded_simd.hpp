@@ -0,0 +1,404 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides a vectorised edit distance which computes one sequence pair per simd lane.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <cstdint>
+#include <seqan3/std/ranges>
+#include <vector>
+
+#include <seqan3/alignment/matrix/detail/advanceable_alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/matrix_coordinate.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/edit_distance_fwd.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief This calculates the edit distance of several sequence pairs at once, one pair per simd lane.
+ * \ingroup alignment_pairwise
+ * \tparam align_config_t The configuration type; must be of type seqan3::configuration.
+ * \tparam edit_traits    The traits type; must be a seqan3::detail::default_edit_distance_trait_type.
+ *
+ * \details
+ *
+ * Computes the bit-parallel algorithm of Myers like seqan3::detail::edit_distance_unbanded, but every lane of the simd
+ * vector holds the machine word of a different sequence pair. Queries with at most `word_size` letters need a single
+ * word per lane. Longer queries are split into blocks of `word_size` rows and the carries are propagated from block
+ * to block within each lane. All lanes compute as many blocks as needed by the longest query of the batch and as many
+ * columns as needed by the longest database; the score of each lane is only taken from its own last row and its own
+ * columns.
+ *
+ * The bit masks of the queries are stored interleaved, such that the masks of one letter and block of all lanes form
+ * one simd vector. For alphabets with up to four letters, the mask of the database letter of each lane is selected
+ * from these vectors by comparing the letters with every rank, which needs `alphabet_size` comparisons per column and
+ * `alphabet_size` bitwise operations per block. For larger alphabets, the masks are gathered lane by lane.
+ *
+ * Only the score and the end positions are computed. The min score (seqan3::align_cfg::min_score) is checked after
+ * the computation, i.e. the computation is not cut off early.
+ */
+template <typename align_config_t, typename edit_traits>
+class edit_distance_unbanded_simd : public edit_traits
+{
+public:
+    using typename edit_traits::word_type;
+    using typename edit_traits::score_type;
+    using typename edit_traits::align_config_type;
+    using edit_traits::word_size;
+
+    //!\brief The simd vector with one machine word per sequence pair.
+    using simd_type = simd_type_t<word_type>;
+    //!\brief The number of sequence pairs that are computed at once.
+    static constexpr size_t lanes = simd_traits<simd_type>::length;
+
+private:
+    using typename edit_traits::query_alphabet_type;
+    using typename edit_traits::alignment_result_type;
+    using edit_traits::use_max_errors;
+    using edit_traits::is_semi_global;
+    using edit_traits::is_global;
+
+    static_assert(!edit_traits::compute_begin_positions,
+                  "The vectorised edit distance computes only the score and the end positions.");
+
+    //!\brief The alphabet size of the query, which is also the index of the padding letter behind a database.
+    static constexpr size_t alphabet_size_ = alphabet_size<query_alphabet_type>;
+    //!\brief Whether the bit masks are selected by comparing the database letters with every rank instead of gathered.
+    //!\details Selecting is faster than gathering for alphabets of size 4, but slower for seqan3::dna15.
+    static constexpr bool select_bit_masks = alphabet_size_ <= 4u;
+
+    //!\brief The configuration.
+    align_config_t config;
+    //!\brief The maximal number of errors if #use_max_errors is true.
+    score_type max_errors{};
+
+    //!\brief The number of sequence pairs in the current batch.
+    size_t pair_count{};
+    //!\brief The index of each sequence pair.
+    std::array<size_t, lanes> ids{};
+    //!\brief The size of each database.
+    std::array<size_t, lanes> database_sizes{};
+    //!\brief The size of each query.
+    std::array<size_t, lanes> query_sizes{};
+
+    //!\brief The number of machine words per lane.
+    size_t block_count{};
+    //!\brief The bit masks of all queries; the word of `block` for a letter `rank` in `lane` is at
+    //!       `(block * (alphabet_size + 1) + rank) * lanes + lane`.
+    std::vector<word_type> bit_masks{};
+    //!\brief The offset of the bit mask of each letter of all databases in the first block of #bit_masks, column by
+    //!       column; only used if #select_bit_masks is false.
+    std::vector<uint32_t> database_offsets{};
+    //!\brief The rank of the letter of all databases, one simd vector per column; only used if #select_bit_masks is
+    //!       true.
+    std::vector<simd_type> database_ranks{};
+    //!\brief The number of columns of the current batch.
+    size_t column_count{};
+    //!\brief Per block, the bit of the last row of a query in its last block and `0` otherwise.
+    std::vector<simd_type> score_masks{};
+    //!\brief The positive vertical differences of every block.
+    std::vector<simd_type> vp{};
+    //!\brief The negative vertical differences of every block.
+    std::vector<simd_type> vn{};
+
+    //!\brief Returns `1` in every lane where `word` is not `0`, otherwise `0`.
+    static simd_type is_not_zero(simd_type const & word) noexcept
+    {
+        return (word | (simd_type{} - word)) >> (word_size - 1u);
+    }
+
+    /*!\brief Encodes the queries as bit masks and the databases as offsets into the bit masks.
+     * \param[in] batch The iterators to the indexed sequence pairs of the current batch.
+     */
+    template <typename iterator_t>
+    void initialise(std::array<iterator_t, lanes> const & batch)
+    {
+        using std::get;
+
+        for (size_t lane = 0; lane < pair_count; ++lane)
+        {
+            auto && [sequence_pair, idx] = *batch[lane];
+            ids[lane] = idx;
+            database_sizes[lane] = std::ranges::distance(get<0>(sequence_pair));
+            query_sizes[lane] = std::ranges::distance(get<1>(sequence_pair));
+        }
+
+        size_t const max_query_size = *std::ranges::max_element(query_sizes.begin(), query_sizes.begin() + pair_count);
+        size_t const max_database_size = *std::ranges::max_element(database_sizes.begin(),
+                                                                   database_sizes.begin() + pair_count);
+        block_count = std::max<size_t>(1u, (max_query_size + word_size - 1u) / word_size);
+
+        // The padding letter behind the end of a database matches nothing.
+        column_count = max_database_size;
+        bit_masks.assign(block_count * (alphabet_size_ + 1u) * lanes, word_type{0u});
+        score_masks.assign(block_count, simd_type{});
+
+        if constexpr (select_bit_masks)
+            database_ranks.assign(column_count, simd::fill<simd_type>(alphabet_size_));
+        else
+            database_offsets.assign(column_count * lanes, alphabet_size_ * lanes);
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            if (lane >= pair_count)
+            {
+                query_sizes[lane] = 0u;
+                database_sizes[lane] = 0u;
+            }
+
+            if constexpr (!select_bit_masks)
+                for (size_t column = 0; column < column_count; ++column)
+                    database_offsets[column * lanes + lane] += lane;
+
+            if (lane >= pair_count)
+                continue;
+
+            auto && [sequence_pair, idx] = *batch[lane];
+
+            size_t column = 0;
+            for (auto && letter : get<0>(sequence_pair))
+            {
+                size_t const rank = seqan3::to_rank(static_cast<query_alphabet_type>(letter));
+
+                if constexpr (select_bit_masks)
+                    database_ranks[column][lane] = rank;
+                else
+                    database_offsets[column * lanes + lane] = rank * lanes + lane;
+
+                ++column;
+            }
+
+            size_t row = 0;
+            for (auto && letter : get<1>(sequence_pair))
+            {
+                size_t const i = ((row / word_size) * (alphabet_size_ + 1u) + seqan3::to_rank(letter)) * lanes + lane;
+                bit_masks[i] |= word_type{1u} << (row % word_size);
+                ++row;
+            }
+
+            if (row == 0u)
+                continue;
+
+            size_t const last_row = row - 1u;
+            score_masks[last_row / word_size][lane] = word_type{1u} << (last_row % word_size);
+        }
+
+        vp.assign(block_count, simd::fill<simd_type>(~word_type{0u}));
+        vn.assign(block_count, simd_type{});
+    }
+
+    /*!\brief Computes the score and the end column of the best alignment of every lane.
+     * \returns The best score and the end column of every lane.
+     */
+    std::pair<simd_type, simd_type> compute()
+    {
+        simd_type score{};
+        simd_type database_size{};
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            score[lane] = query_sizes[lane];
+            database_size[lane] = database_sizes[lane];
+        }
+
+        simd_type best_score = score;
+        simd_type best_column{};
+        simd_type const one = simd::fill<simd_type>(1u);
+        // The first row increases in global alignments.
+        simd_type const first_carry_hp = simd::fill<simd_type>(is_global ? 1u : 0u);
+
+        alignas(alignof(simd_type)) std::array<word_type, lanes> gathered{};
+        simd_type const all_ones = simd::fill<simd_type>(~word_type{0u});
+        // Per rank, all bits are set in the lanes whose database letter has this rank.
+        std::array<simd_type, select_bit_masks ? alphabet_size_ : 0u> is_rank{};
+
+        for (size_t column = 0; column < column_count; ++column)
+        {
+            simd_type carry_d0{};
+            simd_type carry_hp = first_carry_hp;
+            simd_type carry_hn{};
+
+            if constexpr (select_bit_masks)
+            {
+                for (size_t rank = 0; rank < alphabet_size_; ++rank)
+                    is_rank[rank] = (database_ranks[column] == simd::fill<simd_type>(rank)) ? all_ones : simd_type{};
+            }
+
+            for (size_t block = 0; block < block_count; ++block)
+            {
+                word_type const * block_masks = bit_masks.data() + block * (alphabet_size_ + 1u) * lanes;
+                simd_type b{};
+
+                if constexpr (select_bit_masks)
+                {
+                    for (size_t rank = 0; rank < alphabet_size_; ++rank)
+                        b |= is_rank[rank] & simd::load<simd_type>(block_masks + rank * lanes);
+                }
+                else
+                {
+                    uint32_t const * offsets = database_offsets.data() + column * lanes;
+                    for (size_t lane = 0; lane < lanes; ++lane)
+                        gathered[lane] = block_masks[offsets[lane]];
+
+                    b = simd::load<simd_type>(gathered.data());
+                }
+
+                simd_type const block_vp = vp[block];
+                simd_type const block_vn = vn[block];
+
+                simd_type x = b | block_vn;
+                simd_type const y = x & block_vp;
+                simd_type const sum = block_vp + y;
+                simd_type const t = sum + carry_d0;
+                simd_type const d0 = (t ^ block_vp) | x;
+                simd_type const hn = block_vp & d0;
+                simd_type const hp = block_vn | ~(block_vp | d0);
+
+                // The carry of `block_vp + y + carry_d0` out of the highest bit.
+                carry_d0 = (((block_vp & y) | ((block_vp | y) & ~sum)) | (sum & ~t)) >> (word_size - 1u);
+
+                x = (hp << 1u) | carry_hp;
+                vn[block] = x & d0;
+                vp[block] = (hn << 1u) | ~(x | d0) | carry_hn;
+
+                carry_hp = hp >> (word_size - 1u);
+                carry_hn = hn >> (word_size - 1u);
+
+                score += is_not_zero(hp & score_masks[block]);
+                score -= is_not_zero(hn & score_masks[block]);
+            }
+
+            simd_type const current_column = simd::fill<simd_type>(column) + one;
+
+            if constexpr (is_global)
+            {
+                best_score = (current_column == database_size) ? score : best_score;
+            }
+            else // is_semi_global: the right-most best column like seqan3::detail::edit_distance_unbanded.
+            {
+                auto const is_better = (current_column <= database_size) && (score <= best_score);
+                best_score = is_better ? score : best_score;
+                best_column = is_better ? current_column : best_column;
+            }
+        }
+
+        if constexpr (is_global)
+            best_column = database_size;
+
+        return {best_score, best_column};
+    }
+
+    /*!\brief Computes the current batch and invokes the callback for each sequence pair.
+     * \param[in] batch    The iterators to the indexed sequence pairs of the current batch.
+     * \param[in] callback The callback function to be invoked with each alignment result.
+     */
+    template <typename iterator_t, typename callback_t>
+    void compute_batch(std::array<iterator_t, lanes> const & batch, callback_t && callback)
+    {
+        using traits_type = alignment_configuration_traits<align_config_t>;
+        using result_value_type = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+
+        initialise(batch);
+        auto [best_score, best_column] = compute();
+
+        for (size_t lane = 0; lane < pair_count; ++lane)
+        {
+            score_type score = best_score[lane];
+            size_t column = best_column[lane];
+
+            if (query_sizes[lane] == 0u) // [[unlikely]] The first row is the last row.
+            {
+                score = is_global ? database_sizes[lane] : 0;
+                column = database_sizes[lane];
+            }
+
+            bool is_valid = true;
+            if constexpr (use_max_errors)
+                is_valid = score <= max_errors;
+
+            result_value_type res_vt{};
+
+            if constexpr (traits_type::output_sequence1_id)
+                res_vt.sequence1_id = ids[lane];
+
+            if constexpr (traits_type::output_sequence2_id)
+                res_vt.sequence2_id = ids[lane];
+
+            if constexpr (traits_type::compute_score)
+                res_vt.score = is_valid ? -score : matrix_inf<score_type>;
+
+            if constexpr (traits_type::compute_end_positions)
+            {
+                if (!is_valid)
+                    column = database_sizes[lane];
+
+                res_vt.end_positions = advanceable_alignment_coordinate<>{column_index_type{column},
+                                                                          row_index_type{query_sizes[lane]}};
+            }
+
+            callback(alignment_result_type{std::move(res_vt)});
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    edit_distance_unbanded_simd() = default; //!< Defaulted
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd const &) = default; //!< Defaulted
+    edit_distance_unbanded_simd(edit_distance_unbanded_simd &&) = default; //!< Defaulted
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd const &) = default; //!< Defaulted
+    edit_distance_unbanded_simd & operator=(edit_distance_unbanded_simd &&) = default; //!< Defaulted
+    ~edit_distance_unbanded_simd() = default; //!< Defaulted
+
+    /*!\brief Constructor
+     * \param[in] _config The configuration.
+     * \param[in] _traits The traits object. Only needed for template argument deduction.
+     */
+    edit_distance_unbanded_simd(align_config_t const & _config,
+                                edit_traits const & SEQAN3_DOXYGEN_ONLY(_traits) = {}) :
+        config{_config}
+    {
+        if constexpr (use_max_errors)
+            max_errors = -get<align_cfg::min_score>(config).score;
+    }
+    //!\}
+
+    /*!\brief Computes the edit distance of all sequence pairs, #lanes pairs at a time.
+     * \tparam indexed_sequence_pairs_t The type of the range of the indexed sequence pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t               The type of the callback function that is called with the alignment result.
+     * \param[in] indexed_sequence_pairs The indexed sequence pairs to align.
+     * \param[in] callback               The callback function to be invoked with each alignment result.
+     */
+    template <typename indexed_sequence_pairs_t, typename callback_t>
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        std::array<std::ranges::iterator_t<indexed_sequence_pairs_t>, lanes> batch{};
+        auto it = std::ranges::begin(indexed_sequence_pairs);
+
+        while (it != std::ranges::end(indexed_sequence_pairs))
+        {
+            for (pair_count = 0; pair_count < lanes && it != std::ranges::end(indexed_sequence_pairs); ++it)
+                batch[pair_count++] = it;
+
+            compute_batch(batch, callback);
+        }
+    }
+};
+
+} // namespace seqan3::detail
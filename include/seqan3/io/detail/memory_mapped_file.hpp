@@ -0,0 +1,286 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::memory_mapped_file, seqan3::detail::memory_mapped_streambuf and
+ *        seqan3::detail::open_binary_file.
+ * \author Rene Rahn <rene.rahn AT fu-berlin.de>
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <streambuf>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SEQAN3_HAS_MMAP 1
+#else
+#define SEQAN3_HAS_MMAP 0
+#endif
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Opens the file at `path` as a binary file stream.
+ * \ingroup io
+ * \tparam stream_t The type of the stream; must be std::ifstream or std::ofstream.
+ * \param[in] path The file to open.
+ * \returns The opened stream.
+ * \throws std::filesystem::filesystem_error with the error reported by the operating system, e.g.
+ *         std::errc::no_such_file_or_directory or std::errc::permission_denied, if the file cannot be opened.
+ */
+template <typename stream_t>
+//!\cond
+    requires std::same_as<stream_t, std::ifstream> || std::same_as<stream_t, std::ofstream>
+//!\endcond
+stream_t open_binary_file(std::filesystem::path const & path)
+{
+    errno = 0;
+    stream_t stream{path, std::ios::binary};
+
+    if (!stream.is_open())
+    {
+        // The standard streams do not report why opening failed, but all common implementations leave errno set.
+        int const error = errno != 0 ? errno : EIO;
+        char const * const message = std::same_as<stream_t, std::ifstream> ? "Could not open file for reading."
+                                                                           : "Could not open file for writing.";
+        throw std::filesystem::filesystem_error{message, path, std::error_code{error, std::generic_category()}};
+    }
+
+    return stream;
+}
+
+/*!\brief A read-only view on the contents of a file that is mapped into memory.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The file is mapped with `mmap` as a shared, read-only mapping. The pages are thus backed by the page cache of the
+ * operating system and shared between all processes mapping the same file. Pages are only read from disk when they
+ * are accessed for the first time.
+ *
+ * On platforms without `mmap`, the file is read into memory instead and the same interface is provided.
+ *
+ * This class assumes owning semantics. It is not copy-constructible or copy-assignable.
+ */
+class memory_mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_file() = default;                                           //!< Defaulted.
+    memory_mapped_file(memory_mapped_file const &) = delete;                  //!< Deleted.
+    memory_mapped_file & operator=(memory_mapped_file const &) = delete;      //!< Deleted.
+
+    //!\brief Move constructor; the moved-from object does not refer to a mapping anymore.
+    memory_mapped_file(memory_mapped_file && other) noexcept
+    {
+        swap(other);
+    }
+
+    //!\brief Move assignment; the previously mapped file is unmapped.
+    memory_mapped_file & operator=(memory_mapped_file && other) noexcept
+    {
+        memory_mapped_file tmp{std::move(other)};
+        swap(tmp);
+        return *this;
+    }
+
+    /*!\brief Maps the file at `path` into memory.
+     * \param[in] path The file to map.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened or mapped.
+     */
+    explicit memory_mapped_file(std::filesystem::path const & path)
+    {
+#if SEQAN3_HAS_MMAP
+        int const file_descriptor = ::open(path.c_str(), O_RDONLY);
+        if (file_descriptor == -1)
+            throw std::filesystem::filesystem_error{"Could not open file for mapping.", path,
+                                                    std::error_code{errno, std::generic_category()}};
+
+        struct stat file_status{};
+        if (::fstat(file_descriptor, &file_status) == -1)
+        {
+            int const error = errno;
+            ::close(file_descriptor);
+            throw std::filesystem::filesystem_error{"Could not determine the size of the file.", path,
+                                                    std::error_code{error, std::generic_category()}};
+        }
+
+        size_ = static_cast<size_t>(file_status.st_size);
+
+        if (size_ > 0)
+        {
+            void * mapping = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, file_descriptor, 0);
+            if (mapping == MAP_FAILED)
+            {
+                int const error = errno;
+                ::close(file_descriptor);
+                throw std::filesystem::filesystem_error{"Could not map file into memory.", path,
+                                                        std::error_code{error, std::generic_category()}};
+            }
+            data_ = static_cast<std::byte const *>(mapping);
+        }
+
+        ::close(file_descriptor); // The mapping stays valid after closing the file descriptor.
+#else // SEQAN3_HAS_MMAP
+        std::ifstream file = open_binary_file<std::ifstream>(path);
+        fallback_buffer.resize(std::filesystem::file_size(path));
+        file.read(reinterpret_cast<char *>(fallback_buffer.data()), fallback_buffer.size());
+        data_ = fallback_buffer.data();
+        size_ = fallback_buffer.size();
+#endif // SEQAN3_HAS_MMAP
+    }
+
+    //!\brief Unmaps the file.
+    ~memory_mapped_file()
+    {
+#if SEQAN3_HAS_MMAP
+        if (data_ != nullptr)
+            ::munmap(const_cast<std::byte *>(data_), size_);
+#endif // SEQAN3_HAS_MMAP
+    }
+    //!\}
+
+    //!\brief Returns a pointer to the first byte of the mapped file.
+    std::byte const * data() const noexcept
+    {
+        return data_;
+    }
+
+    //!\brief Returns the size of the mapped file in bytes.
+    size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    //!\brief Whether a non-empty file is mapped.
+    bool empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    /*!\brief Hints the operating system to read the whole file ahead, e.g. before it is accessed sequentially.
+     *
+     * \details
+     *
+     * This is a no-op on platforms without `mmap`.
+     */
+    void will_need() const noexcept
+    {
+#if SEQAN3_HAS_MMAP
+        if (data_ != nullptr)
+            ::madvise(const_cast<std::byte *>(data_), size_, MADV_WILLNEED);
+#endif // SEQAN3_HAS_MMAP
+    }
+
+    /*!\brief Hints the operating system that the file is read once from front to back.
+     *
+     * \details
+     *
+     * Pages are read ahead aggressively and may be dropped soon after they were accessed. This is a no-op on platforms
+     * without `mmap`.
+     */
+    void will_read_sequentially() const noexcept
+    {
+#if SEQAN3_HAS_MMAP
+        if (data_ != nullptr)
+            ::madvise(const_cast<std::byte *>(data_), size_, MADV_SEQUENTIAL);
+#endif // SEQAN3_HAS_MMAP
+    }
+
+    //!\brief Swaps the mapping with `other`.
+    void swap(memory_mapped_file & other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+#if !SEQAN3_HAS_MMAP
+        std::swap(fallback_buffer, other.fallback_buffer);
+#endif // !SEQAN3_HAS_MMAP
+    }
+
+private:
+    //!\brief The first byte of the mapping.
+    std::byte const * data_{nullptr};
+    //!\brief The size of the mapping in bytes.
+    size_t size_{0u};
+#if !SEQAN3_HAS_MMAP
+    //!\brief Stores the file contents on platforms without `mmap`.
+    std::vector<std::byte> fallback_buffer{};
+#endif // !SEQAN3_HAS_MMAP
+};
+
+/*!\brief A read-only stream buffer over a contiguous range of bytes, e.g. a seqan3::detail::memory_mapped_file.
+ * \ingroup io
+ *
+ * \details
+ *
+ * The bytes are read directly from the given memory without any intermediate buffering, i.e. `std::istream::read`
+ * copies directly from the mapping into its destination. The buffer does not own the memory.
+ */
+class memory_mapped_streambuf : public std::streambuf
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    memory_mapped_streambuf() = delete;                                                //!< Deleted.
+    memory_mapped_streambuf(memory_mapped_streambuf const &) = delete;                 //!< Deleted.
+    memory_mapped_streambuf & operator=(memory_mapped_streambuf const &) = delete;     //!< Deleted.
+    memory_mapped_streambuf(memory_mapped_streambuf &&) = delete;                      //!< Deleted.
+    memory_mapped_streambuf & operator=(memory_mapped_streambuf &&) = delete;          //!< Deleted.
+    ~memory_mapped_streambuf() override = default;                                     //!< Defaulted.
+
+    /*!\brief Constructs the stream buffer over `[data, data + size)`.
+     * \param[in] data The first byte to read.
+     * \param[in] size The number of bytes that can be read.
+     */
+    memory_mapped_streambuf(std::byte const * data, size_t const size)
+    {
+        // The get area is never written to, but std::streambuf expects non-const pointers.
+        char * begin = const_cast<char *>(reinterpret_cast<char const *>(data));
+        setg(begin, begin, begin + size);
+    }
+    //!\}
+
+protected:
+    //!\brief Supports std::istream::tellg and std::istream::seekg relative to the current position.
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode) override
+    {
+        char * target = direction == std::ios_base::beg ? eback() + offset
+                      : direction == std::ios_base::cur ? gptr() + offset
+                                                        : egptr() + offset;
+
+        if (target < eback() || target > egptr())
+            return pos_type(off_type(-1));
+
+        setg(eback(), target, egptr());
+        return pos_type(target - eback());
+    }
+
+    //!\brief Supports std::istream::seekg to absolute positions.
+    pos_type seekpos(pos_type position, std::ios_base::openmode mode) override
+    {
+        return seekoff(off_type(position), std::ios_base::beg, mode);
+    }
+};
+
+} // namespace seqan3::detail
@@ -46,15 +46,16 @@
  * into one search configuration. In general, the same configuration element cannot occur more than once inside of
  * a configuration specification. The following table shows which combinations are possible.
  *
- * | **Configuration group**                                                     | **0** | **1** | **2** | **3** | **4** | **5** | **6** |
- * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|
- * | \ref seqan3::search_cfg::max_error_total  "0: Max error total"              |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_substitution "1: Max error substitution" |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_insertion "2: Max error insertion"       |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |  ✅   |
- * | \ref seqan3::search_cfg::max_error_deletion "3: Max error deletion"         |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |
- * | \ref search_configuration_subsection_output "4: Output"                     |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |
- * | \ref search_configuration_subsection_hit_strategy "5: Hit"                  |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |
- * | \ref seqan3::search_cfg::parallel "6: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |
+ * | **Configuration group**                                                     | **0** | **1** | **2** | **3** | **4** | **5** | **6** | **7** |
+ * |:----------------------------------------------------------------------------|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|:-----:|
+ * | \ref seqan3::search_cfg::max_error_total  "0: Max error total"              |  ❌   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_substitution "1: Max error substitution" |  ✅   |   ❌   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_insertion "2: Max error insertion"       |  ✅   |   ✅   |  ❌   |  ✅   |   ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::max_error_deletion "3: Max error deletion"         |  ✅   |   ✅   |  ✅   |  ❌   |   ✅   |  ✅   |  ✅   |  ✅   |
+ * | \ref search_configuration_subsection_output "4: Output"                     |  ✅   |   ✅   |  ✅   |  ✅   |   ❌   |  ✅   |  ✅   |  ✅   |
+ * | \ref search_configuration_subsection_hit_strategy "5: Hit"                  |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ❌   |  ✅   |  ✅   |
+ * | \ref seqan3::search_cfg::parallel "6: Parallel"                             |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ❌   |  ✅   |
+ * | \ref seqan3::search_cfg::batch "7: Batch"                                   |  ✅   |   ✅   |  ✅   |  ✅   |   ✅   |  ✅   |  ✅   |  ❌   |
  *
  * \subsection search_configuration_subsection_error 0 - 3: Max Error Configuration
  *
@@ -160,6 +161,16 @@
  *
  * \include test/snippet/search/configuration_parallel.cpp
  *
+ * \subsection search_configuration_subsection_batch 7: Batch Configuration
+ *
+ * This configuration lets the search algorithm process the queries in batches of the given size. The exact searches
+ * of all queries in a batch are interleaved to hide the latency of the memory accesses to the index.
+ * The results are the same as without this configuration.
+ *
+ * The seqan3::search_cfg::batch configuration element can be combined with any other search configuration.
+ *
+ * \include test/snippet/search/configuration_batch.cpp
+ *
  * ### User callback
  *
  * In the default case, a call to seqan3::search returns a lazy range over the results of the search. This lazy range
@@ -179,6 +190,7 @@
 
 #pragma once
 
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/default_configuration.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
@@ -0,0 +1,76 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::search_cfg::batch.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/core/configuration/pipeable_config_element.hpp>
+#include <seqan3/search/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Configuration element to search the queries in batches, interleaving the index accesses of the queries.
+ * \ingroup search_configuration
+ * \see search_configuration
+ *
+ * \details
+ *
+ * By default, seqan3::search processes one query after another. Each step of a search is a rank query on the
+ * index whose memory location depends on the result of the previous step, so for large indices the search mostly
+ * waits for memory. With this configuration element, the queries are split into batches of `size` queries. The
+ * cursors of all queries of a batch are extended by one character in turn. After extending a cursor, the memory
+ * that the first rank query of its next step reads, i.e. the word of the bit vector of the wavelet tree root and
+ * the block of its rank support, is prefetched while the other cursors are extended. For
+ * seqan3::sdsl_epr_index_type, this covers the whole rank query.
+ *
+ * Only exact searches are batched: queries that allow errors are searched one after another as before. The
+ * deeper levels of the wavelet tree are not prefetched, since they depend on the result at the root. The results
+ * and their order are the same as without this configuration element. It can be combined with
+ * seqan3::search_cfg::parallel, in which case each thread searches whole batches.
+ *
+ * The size must be greater than `0`. A size of 16 to 64 is usually a good choice; the best value depends on the
+ * size of the index and the memory system.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/configuration_batch.cpp
+ */
+class batch : private pipeable_config_element
+{
+public:
+    //!\brief The number of queries that are searched together [default: 16].
+    size_t size{16u};
+
+    /*!\name Constructors, assignment and destructor
+     * \{
+     */
+    constexpr batch() = default; //!< Defaulted.
+    constexpr batch(batch const &) = default; //!< Defaulted.
+    constexpr batch(batch &&) = default; //!< Defaulted.
+    constexpr batch & operator=(batch const &) = default; //!< Defaulted.
+    constexpr batch & operator=(batch &&) = default; //!< Defaulted.
+    ~batch() = default; //!< Defaulted.
+
+    /*!\brief Initialises the batch size.
+     * \param[in] size The number of queries that are searched together.
+     */
+    constexpr explicit batch(size_t const size) : size{size}
+    {}
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr seqan3::detail::search_config_id id{seqan3::detail::search_config_id::batch};
+};
+
+} // namespace seqan3::search_cfg
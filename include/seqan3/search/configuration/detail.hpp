@@ -52,6 +52,7 @@ enum struct search_config_id : uint8_t
     output_index_cursor, //!< Identifier for the output configuration of the index_cursor.
     hit, //!< Identifier for the hit configuration (all, all_best, single_best, strata).
     parallel, //!< Identifier for the parallel execution configuration.
+    batch, //!< Identifier for the batched execution configuration.
     result_type, //!< Identifier for the configured search result type.
     //!\cond
     // ATTENTION: Must always be the last item; will be used to determine the number of ids.
@@ -90,19 +91,21 @@ inline constexpr std::array<std::array<bool, static_cast<uint8_t>(search_config_
        // |  |  |  |  |  |  |  |  output_index_cursor,
        // |  |  |  |  |  |  |  |  |  hit,
        // |  |  |  |  |  |  |  |  |  |  parallel,
-       // |  |  |  |  |  |  |  |  |  |  |  result_type
-        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // max_error_total
-        { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // max_error_substitution
-        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // max_error_insertion
-        { 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, // max_error_deletion
-        { 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, // on_result
-        { 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // output_query_id
-        { 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // output_reference_id
-        { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // output_reference_begin_position
-        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, // output_index_cursor
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, // hit
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, // parallel
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}  // result_type
+       // |  |  |  |  |  |  |  |  |  |  |  batch,
+       // |  |  |  |  |  |  |  |  |  |  |  |  result_type
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // max_error_total
+        { 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // max_error_substitution
+        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // max_error_insertion
+        { 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // max_error_deletion
+        { 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, // on_result
+        { 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, // output_query_id
+        { 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // output_reference_id
+        { 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // output_reference_begin_position
+        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // output_index_cursor
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, // hit
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, // parallel
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, // batch
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}  // result_type
     }
 };
 
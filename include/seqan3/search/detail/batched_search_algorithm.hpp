@@ -0,0 +1,222 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::batched_search_algorithm.
+ */
+
+#pragma once
+
+#include <memory>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/search/configuration/batch.hpp>
+#include <seqan3/search/detail/search_traits.hpp>
+#include <seqan3/utility/tuple/concept.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The algorithm that searches a batch of queries by interleaving the extensions of their cursors.
+ * \ingroup search
+ * \tparam single_query_algorithm_t The algorithm that searches a single query; used for all queries that are not
+ *                                  searched exactly.
+ * \tparam configuration_t The search configuration type.
+ * \tparam index_t The type of index.
+ * \tparam policies_t A template parameter pack over the policies to specify the behavior of the algorithm.
+ *
+ * \details
+ *
+ * A search without errors is a chain of cursor extensions. Each extension is a rank query on the index whose position
+ * depends on the result of the previous extension, so the memory accesses of a single query cannot overlap.
+ * This algorithm keeps one cursor per query of the batch and extends them by one character in a round-robin fashion.
+ * After extending a cursor, the memory that the first rank query of its next extension reads is prefetched, i.e. the
+ * bit vector word and the rank support block of the wavelet tree root or the superblock of an EPR dictionary (see
+ * seqan3::detail::fm_index_prefetch_rank), and the remaining cursors of the batch are extended in the meantime.
+ * Cursors that fail to extend or reach the end of their query leave the round.
+ *
+ * Queries with errors and empty queries are delegated to `single_query_algorithm_t`, as are all queries if the cursor
+ * of the index cannot prefetch (e.g. seqan3::kmer_index_cursor). The results are reported in the
+ * order of the queries within the batch, exactly as if each query was searched on its own.
+ */
+template <typename single_query_algorithm_t, typename configuration_t, typename index_t, typename ...policies_t>
+class batched_search_algorithm : protected policies_t...
+{
+private:
+    //!\brief The search configuration traits.
+    using traits_t = search_traits<configuration_t>;
+    //!\brief The search result type.
+    using search_result_type = typename traits_t::search_result_type;
+    //!\brief The cursor type of the index.
+    using cursor_type = typename index_t::cursor_type;
+
+    static_assert(!std::same_as<search_result_type, empty_type>, "The search result type was not configured.");
+
+    //!\brief Whether the cursor supports prefetching; otherwise all queries are delegated to the single algorithm.
+    static constexpr bool interleave_exact_search = requires (cursor_type const & cursor)
+    {
+        cursor.prefetch_extend_right();
+    };
+
+    //!\brief The state of the exact search of a single query of the batch.
+    struct exact_search_state
+    {
+        //!\brief The cursor pointing to the searched prefix of the query.
+        cursor_type cursor{};
+        //!\brief The length of the searched prefix of the query.
+        size_t position{};
+        //!\brief Whether the query is searched by this algorithm.
+        bool searched_exactly{false};
+        //!\brief Whether the whole query was found.
+        bool found{false};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    batched_search_algorithm() = default; //!< Defaulted.
+    batched_search_algorithm(batched_search_algorithm const &) = default; //!< Defaulted.
+    batched_search_algorithm(batched_search_algorithm &&) = default; //!< Defaulted.
+    batched_search_algorithm & operator=(batched_search_algorithm const &) = default; //!< Defaulted.
+    batched_search_algorithm & operator=(batched_search_algorithm &&) = default; //!< Defaulted.
+    ~batched_search_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs from a configuration object and an index.
+     * \param[in] cfg The configuration object that guides the search algorithm.
+     * \param[in] index The index used in the algorithm.
+     */
+    batched_search_algorithm(configuration_t const & cfg, index_t const & index) :
+        policies_t{cfg}...,
+        single_query_algorithm{cfg, index},
+        index_ptr{std::addressof(index)}
+    {}
+    //!\}
+
+    /*!\brief Searches a batch of query sequences in an index.
+     *
+     * \tparam indexed_queries_t The type of the batch; must model std::ranges::forward_range and its reference type
+     *                           must model seqan3::tuple_like with exactly two elements, the index of the query and
+     *                           the query, which must model std::ranges::random_access_range and
+     *                           std::ranges::sized_range over the index's alphabet.
+     * \tparam callback_t The callback type to be invoked on a search result; must model std::invocable with the
+     *                    search result.
+     *
+     * \param[in] indexed_queries The batch of indexed query sequences to be searched in the index.
+     * \param[in] callback The callback to call on a search result.
+     *
+     * ### Complexity
+     *
+     * \f$O(\sum |query|)\f$ for the queries that are searched without errors.
+     */
+    template <std::ranges::forward_range indexed_queries_t, typename callback_t>
+    //!\cond
+        requires tuple_like<std::ranges::range_value_t<indexed_queries_t>> &&
+                 std::invocable<callback_t, search_result_type>
+    //!\endcond
+    void operator()(indexed_queries_t && indexed_queries, callback_t && callback)
+    {
+        using std::get;
+        using indexed_query_t = std::remove_cvref_t<std::ranges::range_reference_t<indexed_queries_t>>;
+
+        std::vector<indexed_query_t> queries{};
+        for (auto && indexed_query : indexed_queries)
+            queries.push_back(indexed_query);
+
+        std::vector<exact_search_state> states(queries.size());
+        std::vector<size_t> active{};
+        active.reserve(queries.size());
+
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            auto && query = get<1>(queries[i]);
+            if (!interleave_exact_search ||
+                std::ranges::empty(query) ||
+                this->max_error_counts(query).total != 0) // see policy_max_error
+                continue;
+
+            states[i].cursor = index_ptr->cursor();
+            states[i].searched_exactly = true;
+            active.push_back(i);
+        }
+
+        search_exact_interleaved(queries, states, active);
+
+        for (size_t i = 0; i < queries.size(); ++i)
+        {
+            if (!states[i].searched_exactly)
+            {
+                single_query_algorithm(indexed_query_t{queries[i]}, callback);
+                continue;
+            }
+
+            if constexpr (interleave_exact_search)
+            {
+                std::vector<cursor_type> internal_hits{};
+                if (states[i].found)
+                    internal_hits.push_back(std::move(states[i].cursor));
+
+                // see policy_search_result_builder
+                this->make_results(std::move(internal_hits), get<0>(queries[i]), callback);
+            }
+        }
+    }
+
+private:
+    //!\brief The algorithm used for all queries that are not searched exactly.
+    single_query_algorithm_t single_query_algorithm{};
+
+    //!\brief A pointer to the index which is searched.
+    index_t const * index_ptr{nullptr};
+
+    /*!\brief Extends the cursors of all active queries character by character until they fail or are found.
+     * \param[in] queries The indexed queries of the batch.
+     * \param[in, out] states The search state of each query.
+     * \param[in, out] active The positions of the queries that are still searched; empty after the call.
+     */
+    template <typename indexed_query_t>
+    void search_exact_interleaved(std::vector<indexed_query_t> const & queries,
+                                  std::vector<exact_search_state> & states,
+                                  std::vector<size_t> & active) const
+    {
+        using std::get;
+
+        if constexpr (interleave_exact_search)
+        {
+            while (!active.empty())
+            {
+                size_t still_active{0u};
+
+                for (size_t const i : active)
+                {
+                    exact_search_state & state = states[i];
+                    auto && query = get<1>(queries[i]);
+
+                    if (!state.cursor.extend_right(query[state.position]))
+                        continue;
+
+                    if (++state.position == std::ranges::size(query))
+                    {
+                        state.found = true;
+                        continue;
+                    }
+
+                    // The next extension of this cursor happens after all other active cursors have been extended.
+                    state.cursor.prefetch_extend_right();
+                    active[still_active++] = i;
+                }
+
+                active.resize(still_active);
+            }
+        }
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,349 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::kmer_index_search_algorithm.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <functional>
+#include <seqan3/std/ranges>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/search/configuration/hit.hpp>
+#include <seqan3/search/detail/search_common.hpp>
+#include <seqan3/search/detail/search_traits.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The algorithm that searches a query in a seqan3::kmer_index by looking up k-mers of the query (seeds) and
+ *        verifying the candidate positions in the text.
+ * \ingroup search
+ * \tparam configuration_t The search configuration type.
+ * \tparam index_t The type of index; a seqan3::kmer_index.
+ * \tparam policies_t A template parameter pack over the policies to specify the behavior of the algorithm.
+ *
+ * \details
+ *
+ * A query with at most \f$e\f$ errors is split into \f$e + 1\f$ pieces of equal length. By the pigeonhole principle,
+ * one of the pieces occurs without errors in the text, and so does the k-mer at the begin of this piece. For each
+ * occurrence of each of these k-mers, the query is verified at the corresponding position of the text: with the
+ * Hamming distance if only substitutions are allowed, otherwise with the edit distance, where the begin position of a
+ * match may be shifted by up to \f$e\f$ positions. A match is reported once per begin position with its least number
+ * of errors.
+ *
+ * Each piece must be at least as long as the shape of the index, otherwise std::invalid_argument is thrown. With
+ * insertions or deletions, only the total number of errors can be restricted; restricting single error types
+ * throws std::invalid_argument as well.
+ */
+template <typename configuration_t, typename index_t, typename ...policies_t>
+class kmer_index_search_algorithm : protected policies_t...
+{
+private:
+    //!\brief The search configuration traits.
+    using traits_t = search_traits<configuration_t>;
+    //!\brief The search result type.
+    using search_result_type = typename traits_t::search_result_type;
+    //!\brief The cursor type of the index.
+    using cursor_type = typename index_t::cursor_type;
+    //!\brief The size type of the index.
+    using size_type = typename index_t::size_type;
+
+    static_assert(!std::same_as<search_result_type, empty_type>, "The search result type was not configured.");
+
+    //!\brief A verified match of the query.
+    struct match
+    {
+        //!\brief The begin position of the match in the concatenated text of the index.
+        size_type begin{};
+        //!\brief The number of errors of the match.
+        uint8_t errors{};
+        //!\brief The occurrence of the seed that lead to the match in the occurrence array of the index.
+        size_type occurrence{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_index_search_algorithm() = default; //!< Defaulted.
+    kmer_index_search_algorithm(kmer_index_search_algorithm const &) = default; //!< Defaulted.
+    kmer_index_search_algorithm(kmer_index_search_algorithm &&) = default; //!< Defaulted.
+    kmer_index_search_algorithm & operator=(kmer_index_search_algorithm const &) = default; //!< Defaulted.
+    kmer_index_search_algorithm & operator=(kmer_index_search_algorithm &&) = default; //!< Defaulted.
+    ~kmer_index_search_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs from a configuration object and an index.
+     * \param[in] cfg The configuration object that guides the search algorithm.
+     * \param[in] index The index used in the algorithm.
+     *
+     * \details
+     *
+     * Initialises the stratum value from the configuration if it was set by the user.
+     */
+    kmer_index_search_algorithm(configuration_t const & cfg, index_t const & index) : policies_t{cfg}...
+    {
+        stratum = cfg.get_or(search_cfg::hit_strata{0}).stratum;
+        index_ptr = &index;
+    }
+    //!\}
+
+    /*!\brief Searches a query sequence in a k-mer index.
+     *
+     * \tparam indexed_query_t The type of the indexed query sequence; must model seqan3::tuple_like with exactly two
+     *                         elements and the second tuple element must model std::ranges::random_access_range and
+     *                         std::ranges::sized_range over the index's alphabet.
+     * \tparam callback_t The callback type to be invoked on a search result; must model std::invocable with the
+     *                    search result.
+     *
+     * \param[in] indexed_query The indexed query sequence to be searched in the index.
+     * \param[in] callback The callback to call on a search result.
+     *
+     * \throws std::invalid_argument if the query is too short for the number of errors or if single error types are
+     *         restricted while allowing insertions or deletions.
+     *
+     * ### Complexity
+     *
+     * \f$O((e + 1) \cdot occ \cdot |query| \cdot e)\f$ where \f$e\f$ is the maximum number of errors and \f$occ\f$
+     * is the number of occurrences of a k-mer of the query.
+     */
+    template <typename indexed_query_t, typename callback_t>
+    //!\cond
+        requires (std::tuple_size_v<indexed_query_t> == 2) &&
+                 std::ranges::random_access_range<std::tuple_element_t<1, indexed_query_t>> &&
+                 std::invocable<callback_t, search_result_type>
+    //!\endcond
+    void operator()(indexed_query_t && indexed_query, callback_t && callback)
+    {
+        auto && [query_idx, query] = indexed_query;
+        std::vector<match> matches = find_matches(query, this->max_error_counts(query)); // see policy_max_error
+
+        if constexpr (!traits_t::search_all_hits)
+        {
+            if (!matches.empty())
+            {
+                auto best = std::ranges::min_element(matches, std::less<>{}, &match::errors);
+                if constexpr (traits_t::search_single_best_hit)
+                {
+                    matches = std::vector<match>{*best};
+                }
+                else
+                {
+                    size_t max_errors = best->errors;
+                    if constexpr (traits_t::search_strata_hits)
+                        max_errors += stratum;
+
+                    std::erase_if(matches, [max_errors] (match const & m) { return m.errors > max_errors; });
+                }
+            }
+        }
+
+        std::vector<cursor_type> internal_hits{};
+        internal_hits.reserve(matches.size());
+        for (match const & m : matches)
+        {
+            using difference_type = typename cursor_type::difference_type;
+            difference_type const offset = static_cast<difference_type>(index_ptr->occurrence(m.occurrence)) -
+                                           static_cast<difference_type>(m.begin);
+            internal_hits.emplace_back(*index_ptr, m.occurrence, m.occurrence + 1u, offset);
+        }
+
+        this->make_results(std::move(internal_hits), query_idx, callback); // see policy_search_result_builder
+    }
+
+private:
+    //!\brief A pointer to the k-mer index.
+    index_t const * index_ptr{nullptr};
+
+    //!\brief The stratum value if set.
+    uint8_t stratum{};
+
+    //!\brief The previous row of the dynamic programming matrix of the edit distance verification.
+    std::vector<uint16_t> previous_row{};
+    //!\brief The current row of the dynamic programming matrix of the edit distance verification.
+    std::vector<uint16_t> current_row{};
+
+    /*!\brief Finds all matches of the query.
+     * \param[in] query The query.
+     * \param[in] error_state The number of errors allowed.
+     * \returns The matches, sorted by their begin position, with one match per begin position.
+     */
+    template <typename query_t>
+    std::vector<match> find_matches(query_t & query, search_param const error_state)
+    {
+        bool const substitutions_only = error_state.insertion == 0 && error_state.deletion == 0;
+        uint8_t const max_errors = substitutions_only ? std::min(error_state.total, error_state.substitution)
+                                                      : error_state.total;
+
+        if (!substitutions_only && (error_state.substitution != max_errors ||
+                                    error_state.insertion != max_errors ||
+                                    error_state.deletion != max_errors))
+        {
+            throw std::invalid_argument{"A search in a seqan3::kmer_index with insertions or deletions can only "
+                                        "restrict the total number of errors."};
+        }
+
+        size_t const query_length = std::ranges::size(query);
+        size_t const span = std::ranges::size(index_ptr->shape());
+        size_t const piece_length = query_length / (max_errors + 1u);
+
+        if (piece_length < span || piece_length == 0u)
+        {
+            throw std::invalid_argument{"The query is too short to be searched in a seqan3::kmer_index with this number "
+                                        "of errors. It must contain max_error + 1 non-overlapping k-mers."};
+        }
+
+        auto query_hashes = query | views::kmer_hash(index_ptr->shape());
+        std::vector<match> matches{};
+
+        for (size_t piece = 0; piece <= max_errors; ++piece)
+        {
+            size_type const seed_begin = piece * piece_length;
+            auto const [first, last] = index_ptr->occurrence_range(query_hashes[seed_begin]);
+
+            for (size_type i = first; i < last; ++i)
+            {
+                size_type const seed_position = index_ptr->occurrence(i);
+                size_type const reference_id = index_ptr->to_reference_position(seed_position).first;
+                size_type const reference_begin = index_ptr->text_begin[reference_id];
+                size_type const reference_end = index_ptr->text_begin[reference_id + 1];
+                size_type const seed_offset = seed_position - reference_begin; // position of the seed in its text
+
+                if (substitutions_only)
+                {
+                    if (seed_offset < seed_begin || seed_position - seed_begin + query_length > reference_end)
+                        continue;
+
+                    size_type const begin = seed_position - seed_begin;
+                    if (size_t const errors = hamming_distance(query, begin, max_errors); errors <= max_errors)
+                        matches.push_back(match{begin, static_cast<uint8_t>(errors), i});
+                }
+                else
+                {
+                    if (seed_offset + max_errors < seed_begin)
+                        continue;
+
+                    // Insertions and deletions before the seed shift the begin of the match by up to max_errors.
+                    size_type const begin_first = reference_begin + ((seed_offset > seed_begin + max_errors)
+                                                                     ? seed_offset - seed_begin - max_errors
+                                                                     : 0u);
+                    size_type const begin_last = reference_begin + std::min<size_type>(seed_offset + max_errors -
+                                                                                       seed_begin,
+                                                                                       reference_end -
+                                                                                       reference_begin - 1u);
+
+                    for (size_type begin = begin_first; begin <= begin_last; ++begin)
+                    {
+                        size_t const errors = edit_distance(query, begin, reference_end, max_errors);
+                        if (errors <= max_errors)
+                            matches.push_back(match{begin, static_cast<uint8_t>(errors), i});
+                    }
+                }
+            }
+        }
+
+        // Keep the match with the fewest errors for each begin position.
+        std::ranges::sort(matches, [] (match const & lhs, match const & rhs)
+        {
+            return std::tie(lhs.begin, lhs.errors) < std::tie(rhs.begin, rhs.errors);
+        });
+        auto [erase_begin, erase_end] = std::ranges::unique(matches, std::ranges::equal_to{}, &match::begin);
+        matches.erase(erase_begin, erase_end);
+
+        return matches;
+    }
+
+    /*!\brief Returns the number of mismatches of the query and the text at `begin`.
+     * \param[in] query The query.
+     * \param[in] begin The begin position in the concatenated text of the index.
+     * \param[in] max_errors The number of errors after which the comparison stops.
+     * \returns The number of mismatches, or a number greater than `max_errors`.
+     */
+    template <typename query_t>
+    size_t hamming_distance(query_t & query, size_type const begin, uint8_t const max_errors) const
+    {
+        size_t errors{0u};
+        size_t const query_length = std::ranges::size(query);
+
+        for (size_t i = 0; i < query_length && errors <= max_errors; ++i)
+            errors += to_rank(query[i]) != to_rank(index_ptr->text[begin + i]);
+
+        return errors;
+    }
+
+    /*!\brief Returns the edit distance of the query and the best prefix of the text starting at `begin`, where the
+     *        first character of the text is not deleted.
+     * \param[in] query The query.
+     * \param[in] begin The begin position in the concatenated text of the index.
+     * \param[in] end The end of the text that contains `begin`.
+     * \param[in] max_errors The maximal number of errors.
+     * \returns The edit distance, or a number greater than `max_errors`.
+     *
+     * \details
+     *
+     * Only the cells of the dynamic programming matrix with a distance of at most `max_errors` to the main diagonal
+     * are computed.
+     */
+    template <typename query_t>
+    size_t edit_distance(query_t & query, size_type const begin, size_type const end, uint8_t const max_errors)
+    {
+        size_t const query_length = std::ranges::size(query);
+        size_t const text_length = std::min<size_t>(end - begin, query_length + max_errors);
+        uint16_t const infinity = max_errors + 1u;
+
+        // Row 0: the alignment may not start with a deletion of a text character.
+        previous_row.assign(text_length + 1u, infinity);
+        current_row.assign(text_length + 1u, infinity);
+        previous_row[0] = 0u;
+
+        for (size_t i = 1; i <= query_length; ++i)
+        {
+            size_t const band_begin = (i > max_errors) ? i - max_errors : 1u;
+            size_t const band_end = std::min<size_t>(text_length, i + max_errors);
+
+            current_row[0] = std::min<size_t>(i, infinity);
+            if (band_begin > 1u && band_begin - 1u <= text_length)
+                current_row[band_begin - 1u] = infinity; // left of the band
+
+            uint16_t row_minimum = current_row[0];
+            for (size_t j = band_begin; j <= band_end; ++j)
+            {
+                uint16_t const diagonal = previous_row[j - 1] + (to_rank(query[i - 1]) !=
+                                                                 to_rank(index_ptr->text[begin + j - 1]));
+                uint16_t const value = std::min({diagonal,
+                                                 static_cast<uint16_t>(previous_row[j] + 1u),
+                                                 static_cast<uint16_t>(current_row[j - 1] + 1u),
+                                                 infinity});
+                current_row[j] = value;
+                row_minimum = std::min(row_minimum, value);
+            }
+
+            if (row_minimum >= infinity)
+                return infinity;
+
+            std::swap(previous_row, current_row);
+        }
+
+        size_t const last_begin = (query_length > max_errors) ? query_length - max_errors : 1u;
+        size_t const last_end = std::min<size_t>(text_length, query_length + max_errors);
+        uint16_t distance = infinity;
+        for (size_t j = last_begin; j <= last_end; ++j)
+            distance = std::min(distance, previous_row[j]);
+
+        return distance;
+    }
+};
+
+} // namespace seqan3::detail
@@ -13,14 +13,18 @@
 #pragma once
 
 #include <seqan3/core/detail/template_inspection.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/output.hpp>
 #include <seqan3/search/configuration/result_type.hpp>
 #include <seqan3/search/detail/policy_max_error.hpp>
+#include <seqan3/search/detail/batched_search_algorithm.hpp>
+#include <seqan3/search/detail/kmer_index_search_algorithm.hpp>
 #include <seqan3/search/detail/policy_search_result_builder.hpp>
 #include <seqan3/search/detail/search_scheme_algorithm.hpp>
 #include <seqan3/search/detail/unidirectional_search_algorithm.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
 #include <seqan3/search/search_result.hpp>
 #include <seqan3/utility/detail/multi_invocable.hpp>
 #include <seqan3/utility/type_traits/lazy_conditional.hpp>
@@ -80,7 +84,16 @@ private:
         using type =
             lazy_conditional_t<template_specialisation_of<typename index_t::cursor_type, bi_fm_index_cursor>,
                                lazy<search_scheme_algorithm, configuration_t, index_t, policies_t...>,
-                               lazy<unidirectional_search_algorithm, configuration_t, index_t, policies_t...>>;
+                               lazy_conditional_t<template_specialisation_of<typename index_t::cursor_type,
+                                                                             kmer_index_cursor>,
+                                                  lazy<kmer_index_search_algorithm,
+                                                       configuration_t,
+                                                       index_t,
+                                                       policies_t...>,
+                                                  lazy<unidirectional_search_algorithm,
+                                                       configuration_t,
+                                                       index_t,
+                                                       policies_t...>>>;
     };
 
 public:
@@ -150,7 +163,8 @@ public:
 
     /*!\brief Chooses the appropriate search algorithm depending on the index.
      *
-     * \tparam query_t An explicit template argument for the query type the search algorithm is invoked with.
+     * \tparam query_t An explicit template argument for the query type the search algorithm is invoked with; a
+     *                 batch of queries if seqan3::search_cfg::batch is configured.
      * \tparam configuration_t The type of the search configuration.
      * \tparam index_t The type of the index.
      * \param[in] cfg The search configuration object that is passed to the algorithm.
@@ -160,13 +174,24 @@ public:
      * \details
      *
      * If the cursor of `index_t` models seqan3::detail::template_specialisation_of a seqan3::bi_fm_index_cursor,
-     * then the seqan3::detail::search_scheme_algorithm is chosen. Otherwise, the
-     * seqan3::detail::unidirectional_search_algorithm is chosen.
+     * then the seqan3::detail::search_scheme_algorithm is chosen. For a seqan3::kmer_index, the
+     * seqan3::detail::kmer_index_search_algorithm is chosen. Otherwise, the
+     * seqan3::detail::unidirectional_search_algorithm is chosen. If seqan3::search_cfg::batch is configured, the
+     * chosen algorithm is wrapped into the seqan3::detail::batched_search_algorithm.
      */
     template <typename query_t, typename configuration_t, typename index_t>
     static auto configure_algorithm(configuration_t const & cfg, index_t const & index)
     {
-        using query_index_t = std::tuple_element_t<0, query_t>;
+        auto select_indexed_query = [] ()
+        {
+            if constexpr (configuration_t::template exists<search_cfg::batch>())
+                return std::type_identity<std::ranges::range_reference_t<query_t>>{};
+            else
+                return std::type_identity<query_t>{};
+        };
+
+        using indexed_query_t = typename decltype(select_indexed_query())::type;
+        using query_index_t = std::tuple_element_t<0, std::remove_cvref_t<indexed_query_t>>;
         using search_result_t = typename select_search_result<configuration_t, index_t, query_index_t>::type;
         using callback_t = std::function<void(search_result_t)>;
         using type_erased_algorithm_t = std::function<void(query_t, callback_t)>;
@@ -201,7 +226,19 @@ public:
                                              policy_max_error,
                                              policy_search_result_builder<configuration_t>>::type;
 
-        return selected_algorithm_t{config, index};
+        if constexpr (configuration_t::template exists<search_cfg::batch>())
+        {
+            using batched_algorithm_t = batched_search_algorithm<selected_algorithm_t,
+                                                                 configuration_t,
+                                                                 index_t,
+                                                                 policy_max_error,
+                                                                 policy_search_result_builder<configuration_t>>;
+            return batched_algorithm_t{config, index};
+        }
+        else
+        {
+            return selected_algorithm_t{config, index};
+        }
     }
 };
 
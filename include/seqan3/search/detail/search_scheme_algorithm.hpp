@@ -13,8 +13,12 @@
 #pragma once
 
 #include <type_traits>
+#include <variant>
+#include <vector>
 
+#include <seqan3/alphabet/concept.hpp>
 #include <seqan3/search/detail/search_common.hpp>
+#include <seqan3/search/detail/search_scheme_generator.hpp>
 #include <seqan3/search/detail/search_scheme_precomputed.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
@@ -65,12 +69,39 @@ public:
      *
      * \details
      *
-     * Initialises the stratum value from the configuration if it was set by the user.
+     * Initialises the stratum value from the configuration if it was set by the user. If the errors are configured
+     * as error counts, the candidate search schemes for more than three errors are generated here, once for all
+     * queries.
      */
     search_scheme_algorithm(configuration_t const & cfg, index_t const & index) : policies_t{cfg}...
     {
         stratum = cfg.get_or(search_cfg::hit_strata{0}).stratum;
         index_ptr = std::addressof(index);
+
+        // Error rates depend on the query length and count as zero errors here.
+        auto to_count = [&cfg] (auto const & default_error) -> size_t
+        {
+            auto const error = cfg.get_or(default_error).error;
+            auto const * error_count = std::get_if<search_cfg::error_count>(&error);
+            return (error_count != nullptr) ? error_count->get() : 0u;
+        };
+
+        search_cfg::error_count const no_error{0};
+        size_t max_total = to_count(search_cfg::max_error_total{no_error});
+        if constexpr (!traits_t::has_max_error_total)
+        {
+            max_total = to_count(search_cfg::max_error_substitution{no_error}) +
+                        to_count(search_cfg::max_error_insertion{no_error}) +
+                        to_count(search_cfg::max_error_deletion{no_error});
+        }
+        max_total = std::min<size_t>(255u, max_total + stratum); // Strata search with more errors than configured.
+
+        if (max_total > 3u)
+        {
+            search_scheme_candidates_by_errors.resize(max_total + 1);
+            for (size_t errors = 4; errors <= max_total; ++errors)
+                search_scheme_candidates_by_errors[errors] = search_scheme_candidates(0, errors);
+        }
     }
     //!\}
 
@@ -125,6 +156,15 @@ private:
     //!\brief The stratum value if set.
     uint8_t stratum{};
 
+    /*!\brief The candidate search schemes for each number of errors greater than three.
+     *
+     * \details
+     *
+     * Only filled for the error counts known at construction. Since queries may be searched concurrently, this member
+     * is not modified after construction.
+     */
+    std::vector<std::vector<search_scheme_dyn_type>> search_scheme_candidates_by_errors{};
+
     // forward declaration
     template <bool abort_on_hit, typename query_t, typename delegate_t>
     inline void search_algo_bi(query_t & query, search_param const error_left, delegate_t && delegate);
@@ -177,14 +217,20 @@ private:
     }
 };
 
-/*!\brief Computes a (non-optimal) search scheme. Currently the generated search scheme represents trivial backtracking.
+/*!\brief Computes a search scheme with `max_error + 1` blocks that covers every error distribution with at least
+ *        `min_error` and at most `max_error` errors exactly once.
  * \ingroup search
  * \param[in] min_error Minimum number of errors allowed.
  * \param[in] max_error Maximum number of errors allowed.
  *
+ * \details
+ *
+ * See seqan3::detail::generate_search_scheme for the construction. For a given query and index,
+ * seqan3::detail::select_search_scheme usually finds a better search scheme.
+ *
  * ### Complexity
  *
- * Constant.
+ * \f$O(max\_error^2)\f$.
  *
  * ### Exceptions
  *
@@ -192,13 +238,10 @@ private:
  */
 inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const max_error)
 {
-    // TODO: Replace this at least by the pigeonhole principle or even better by 01*0 schemes.
-    // NOTE: Make sure that the searches are sorted by their asymptotical running time (i.e. upper error bound string),
-    //       s.t. easy to compute searches come first. This improves the running time of algorithms that abort after the
-    //       first hit (e.g. search strategy: best). Even though it is not guaranteed, this seems to be a good greedy
-    //       approach.
-    std::vector<search_dyn> scheme{{{1}, {min_error}, {max_error}}};
-    return scheme;
+    // NOTE: The searches are sorted by their asymptotical running time (i.e. upper error bound string), s.t. easy to
+    //       compute searches come first. This improves the running time of algorithms that abort after the first hit
+    //       (e.g. search strategy: best). Even though it is not guaranteed, this seems to be a good greedy approach.
+    return generate_search_scheme(min_error, max_error, max_error + 1);
 }
 
 /*!\brief Returns for each search the cumulative length of blocks in the order of blocks in each search and the
@@ -684,9 +727,21 @@ inline void search_scheme_algorithm<configuration_t, index_t, policies_t...>::se
             search_ss<abort_on_hit>(*index_ptr, query, error_left, optimum_search_scheme<0, 3>, delegate);
             break;
         default:
-            auto const & search_scheme{compute_ss(0, error_left.total)};
+        {
+            // Error rates are resolved per query, so their candidates are generated for the query at hand.
+            std::vector<search_scheme_dyn_type> query_candidates{};
+            if (error_left.total >= search_scheme_candidates_by_errors.size())
+                query_candidates = search_scheme_candidates(0, error_left.total);
+
+            auto const & candidates = query_candidates.empty() ? search_scheme_candidates_by_errors[error_left.total]
+                                                               : query_candidates;
+            auto const & search_scheme{select_search_scheme(candidates,
+                                                            std::ranges::size(query),
+                                                            alphabet_size<typename index_t::alphabet_type>,
+                                                            index_ptr->size())};
             search_ss<abort_on_hit>(*index_ptr, query, error_left, search_scheme, delegate);
             break;
+        }
     }
 }
 
@@ -0,0 +1,296 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::generate_search_scheme, seqan3::detail::search_scheme_cost,
+ *        seqan3::detail::search_scheme_candidates and seqan3::detail::select_search_scheme.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <ranges>
+#include <vector>
+
+#include <seqan3/search/detail/search_scheme_precomputed.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Generates a search scheme with `blocks` blocks that covers every error distribution with at least
+ *        `min_error` and at most `max_error` errors exactly once.
+ * \ingroup search
+ * \param[in] min_error Minimum number of errors allowed.
+ * \param[in] max_error Maximum number of errors allowed.
+ * \param[in] blocks    Number of blocks the query is split into; must be greater than `max_error`.
+ * \returns The search scheme, sorted s.t. searches with lower upper error bounds come first.
+ *
+ * \details
+ *
+ * Let \f$d_j\f$ be the number of errors in block \f$j\f$ and \f$P_j = d_1 + \ldots + d_j\f$. Since
+ * \f$P_{blocks} \leq max\_error < blocks\f$, there is a first block \f$i \leq max\_error + 1\f$ with
+ * \f$P_i = i - 1\f$. For this block, \f$d_i = 0\f$ and \f$P_j \geq j\f$ holds for all \f$j < i\f$. The `i`-th search
+ * covers exactly the error distributions with this first block `i`: it searches block `i` without errors, then the
+ * blocks `i - 1` to `1` from right to left, allowing at most one additional error per block, and finally the blocks
+ * `i + 1` to `blocks` from left to right. In contrast to the trivial scheme, every search starts with an exact block
+ * and the number of errors grows slowly in the beginning, where most nodes of the search tree are located.
+ *
+ * ### Complexity
+ *
+ * \f$O(max\_error \cdot blocks)\f$.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline search_scheme_dyn_type generate_search_scheme(uint8_t const min_error,
+                                                     uint8_t const max_error,
+                                                     uint8_t const blocks)
+{
+    assert(min_error <= max_error);
+    assert(blocks > max_error);
+
+    search_scheme_dyn_type scheme{};
+    uint8_t const searches = std::min<uint8_t>(blocks, max_error + 1);
+
+    for (uint8_t start = 1; start <= searches; ++start)
+    {
+        search_dyn search{};
+        search.pi.reserve(blocks);
+        search.l.reserve(blocks);
+        search.u.reserve(blocks);
+
+        // Blocks `start`, `start - 1`, ..., `1`: P_j >= j for j < start and P_start = start - 1.
+        for (uint8_t step = 0; step < start; ++step)
+        {
+            search.pi.push_back(start - step);
+            search.l.push_back(step + 1 == start ? start - 1 : 0);
+            search.u.push_back(step);
+        }
+
+        // Blocks `start + 1`, ..., `blocks`: the remaining errors.
+        for (uint8_t block = start + 1; block <= blocks; ++block)
+        {
+            search.pi.push_back(block);
+            search.l.push_back(start - 1);
+            search.u.push_back(max_error);
+        }
+
+        search.l.back() = std::max(search.l.back(), min_error);
+        scheme.push_back(std::move(search));
+    }
+
+    // Searches with a low upper bound string are fast; search them first, which helps e.g. the search strategy best.
+    std::ranges::stable_sort(scheme, [] (search_dyn const & lhs, search_dyn const & rhs) { return lhs.u < rhs.u; });
+
+    return scheme;
+}
+
+/*!\brief Estimates the number of nodes of the search tree that are visited when searching a query with a search scheme.
+ * \ingroup search
+ * \tparam search_scheme_t Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \param[in] search_scheme The search scheme.
+ * \param[in] query_length  The length of the query; must be at least the number of blocks of `search_scheme`.
+ * \param[in] sigma         The size of the alphabet of the text.
+ * \param[in] text_length   The length of the text.
+ * \returns The expected number of visited nodes.
+ *
+ * \details
+ *
+ * For every search and every prefix of the search order, the number of strings that respect the error bounds of the
+ * search is counted. Each of them is expected to occur in a random text with probability
+ * \f$\min(1, text\_length / \sigma^{depth})\f$. Only substitutions are considered; insertions and deletions
+ * increase the costs of all search schemes alike.
+ *
+ * ### Complexity
+ *
+ * \f$O(|search\_scheme| \cdot query\_length \cdot max\_error)\f$.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+template <typename search_scheme_t>
+inline double search_scheme_cost(search_scheme_t const & search_scheme,
+                                 size_t const query_length,
+                                 size_t const sigma,
+                                 size_t const text_length)
+{
+    uint8_t const blocks = search_scheme[0].blocks();
+    assert(query_length >= blocks);
+
+    // Same distribution of the query among the blocks as seqan3::detail::search_scheme_block_info.
+    auto block_length = [&] (uint8_t const block) // 1-based
+    {
+        return query_length / blocks + (static_cast<size_t>(block - 1) < query_length % blocks);
+    };
+
+    uint8_t max_error{0};
+    for (auto const & search : search_scheme)
+        max_error = std::max<uint8_t>(max_error, search.u[blocks - 1]);
+
+    double const log_sigma = std::log(static_cast<double>(sigma));
+    double const log_text_length = std::log(static_cast<double>(std::max<size_t>(text_length, 1u)));
+    double cost{0.0};
+
+    std::vector<double> strings(max_error + 1);
+    std::vector<double> next_strings(max_error + 1);
+
+    for (auto const & search : search_scheme)
+    {
+        std::ranges::fill(strings, 0.0);
+        strings[0] = 1.0;
+        size_t depth{0};
+
+        for (uint8_t block_id = 0; block_id < blocks; ++block_id)
+        {
+            size_t const length = block_length(search.pi[block_id]);
+            for (size_t position = 1; position <= length; ++position)
+            {
+                ++depth;
+                double const occurrence = std::exp(std::min(0.0, log_text_length - depth * log_sigma));
+                size_t const chars_left = length - position;
+
+                for (uint8_t errors = 0; errors <= max_error; ++errors)
+                {
+                    next_strings[errors] = 0.0;
+                    // The lower bound of the block can still be reached with the remaining characters of the block.
+                    if (errors > search.u[block_id] || errors + chars_left < search.l[block_id])
+                        continue;
+
+                    next_strings[errors] = strings[errors] +
+                                           (errors > 0 ? strings[errors - 1] * (sigma - 1) : 0.0);
+                    cost += next_strings[errors] * occurrence;
+                }
+
+                std::swap(strings, next_strings);
+            }
+        }
+    }
+
+    return cost;
+}
+
+/*!\brief Returns the search schemes that seqan3::detail::select_search_scheme chooses from.
+ * \ingroup search
+ * \param[in] min_error Minimum number of errors allowed.
+ * \param[in] max_error Maximum number of errors allowed.
+ * \returns The trivial search scheme followed by the schemes of seqan3::detail::generate_search_scheme with
+ *          `max_error + 1` to `max_error + 3` blocks.
+ *
+ * \details
+ *
+ * The candidates do not depend on the query, hence they can be generated once and used for all queries that are
+ * searched with the same number of errors.
+ *
+ * ### Complexity
+ *
+ * \f$O(max\_error^2)\f$.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline std::vector<search_scheme_dyn_type> search_scheme_candidates(uint8_t const min_error, uint8_t const max_error)
+{
+    assert(min_error <= max_error);
+
+    std::vector<search_scheme_dyn_type> candidates{};
+    candidates.push_back(search_scheme_dyn_type{{{1}, {min_error}, {max_error}}});
+
+    for (size_t blocks = max_error + 1u; blocks <= std::min<size_t>(max_error + 3u, 255u); ++blocks)
+        candidates.push_back(generate_search_scheme(min_error, max_error, static_cast<uint8_t>(blocks)));
+
+    return candidates;
+}
+
+/*!\brief Returns the candidate with the lowest estimated costs for the given parameters.
+ * \ingroup search
+ * \param[in] candidates   The search schemes to choose from, as returned by seqan3::detail::search_scheme_candidates.
+ * \param[in] query_length The length of the query.
+ * \param[in] sigma        The size of the alphabet of the text.
+ * \param[in] text_length  The length of the text.
+ * \returns A reference to the selected element of `candidates`.
+ *
+ * \details
+ *
+ * Candidates with more blocks than the query has characters are skipped. The remaining candidates are compared by
+ * seqan3::detail::search_scheme_cost. If no candidate is left, the first candidate, i.e. the trivial search scheme,
+ * is returned.
+ *
+ * ### Complexity
+ *
+ * \f$O(|candidates| \cdot query\_length \cdot max\_error^2)\f$.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline search_scheme_dyn_type const & select_search_scheme(std::vector<search_scheme_dyn_type> const & candidates,
+                                                           size_t const query_length,
+                                                           size_t const sigma,
+                                                           size_t const text_length)
+{
+    assert(!candidates.empty());
+
+    search_scheme_dyn_type const * best = &candidates.front();
+
+    if (query_length == 0)
+        return *best;
+
+    double best_cost = search_scheme_cost(*best, query_length, sigma, text_length);
+
+    for (auto const & candidate : candidates | std::views::drop(1))
+    {
+        if (candidate.front().blocks() > query_length)
+            continue;
+
+        if (double const cost = search_scheme_cost(candidate, query_length, sigma, text_length); cost < best_cost)
+        {
+            best = &candidate;
+            best_cost = cost;
+        }
+    }
+
+    return *best;
+}
+
+/*!\brief Returns the search scheme with the lowest estimated costs for the given parameters.
+ * \ingroup search
+ * \param[in] min_error    Minimum number of errors allowed.
+ * \param[in] max_error    Maximum number of errors allowed.
+ * \param[in] query_length The length of the query.
+ * \param[in] sigma        The size of the alphabet of the text.
+ * \param[in] text_length  The length of the text.
+ * \returns The selected search scheme.
+ *
+ * \details
+ *
+ * Generates the seqan3::detail::search_scheme_candidates and selects one of them. Nothing is cached; when searching
+ * many queries with the same number of errors, generate the candidates once and use the overload taking them.
+ *
+ * ### Complexity
+ *
+ * \f$O(query\_length \cdot max\_error^2)\f$.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline search_scheme_dyn_type select_search_scheme(uint8_t const min_error,
+                                                   uint8_t const max_error,
+                                                   size_t const query_length,
+                                                   size_t const sigma,
+                                                   size_t const text_length)
+{
+    std::vector<search_scheme_dyn_type> const candidates = search_scheme_candidates(min_error, max_error);
+    return select_search_scheme(candidates, query_length, sigma, text_length);
+}
+
+} // namespace seqan3::detail
@@ -11,11 +11,16 @@
  */
 
 /*!\defgroup search_dream_index DREAM Index
- * \brief Provides seqan3::interleaved_bloom_filter.
+ * \brief Provides seqan3::interleaved_bloom_filter, seqan3::interleaved_bloom_filter_builder,
+ *        seqan3::merge_interleaved_bloom_filter_files and seqan3::hierarchical_interleaved_bloom_filter.
  * \ingroup search
  * \see search
  */
 
 #pragma once
 
+#include <seqan3/search/dream_index/hierarchical_interleaved_bloom_filter.hpp>
 #include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter_builder.hpp>
+#include <seqan3/search/dream_index/merge_interleaved_bloom_filter_files.hpp>
+#include <seqan3/search/dream_index/threshold.hpp>
@@ -0,0 +1,321 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::block_compressed_bitvector.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <seqan3/std/bit>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <seqan3/std/span>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief An immutable, compressed bitvector that decodes ranges of 64-bit words quickly.
+ * \ingroup search_dream_index
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * The bitvector is divided into blocks of 256 bits, such that a position within a block fits into one byte. A block
+ * with fewer than 32 set bits is stored as the sorted list of the positions of its set bits. All other blocks are
+ * stored as raw words. Hence, a block never needs more space than in the uncompressed bitvector, and an empty block
+ * needs no space at all.
+ *
+ * The start of each block is stored as 16-bit offset relative to a superblock of 2048 blocks. The directory adds about
+ * 6% of the uncompressed size. A block is stored raw iff it is 32 bytes long.
+ *
+ * Hence, the encoding is only smaller than the raw words if most blocks have a density of set bits below 12.5%
+ * (32 of 256 bits). An Interleaved Bloom Filter whose size was chosen for a target false positive rate has about half
+ * of its bits set; almost all of its blocks are stored raw and the compressed bitvector is about 6% larger than the
+ * uncompressed one. The encoding pays off for sparse filters, e.g. bins that are much larger than their content.
+ *
+ * In contrast to `sdsl::sd_vector`, there is no random access to single bits. Instead, decode_words() and and_words()
+ * decode a range of words block by block, which is what the queries of the seqan3::interleaved_bloom_filter need:
+ * a raw block is copied, and a sparse block costs one operation per set bit.
+ */
+class block_compressed_bitvector
+{
+private:
+    //!\brief The number of words per block.
+    static constexpr size_t block_words{4u};
+    //!\brief The size of a raw block in bytes.
+    static constexpr size_t block_bytes{block_words * sizeof(uint64_t)};
+    //!\brief The number of blocks per superblock.
+    static constexpr size_t superblock_blocks{2048u};
+
+    //!\brief The number of bits.
+    size_t bit_count{};
+    //!\brief The offset of each superblock into `payload`.
+    std::vector<uint64_t> superblock_offsets{};
+    //!\brief The offset of each block relative to its superblock, with one additional entry for the end.
+    std::vector<uint16_t> block_offsets{};
+    //!\brief The raw blocks and the set bit positions of the sparse blocks.
+    std::vector<uint8_t> payload{};
+
+    //!\brief Returns the offset of `block` into `payload`.
+    size_t block_offset(size_t const block) const noexcept
+    {
+        return superblock_offsets[block / superblock_blocks] + block_offsets[block];
+    }
+
+    /*!\brief Decodes the words `[word, word + word_count)` block by block and combines them with `out`.
+     * \tparam and_words Whether the words are combined with bitwise AND or copied.
+     * \param[in] word       The first word of the range.
+     * \param[in] word_count The number of words of the range.
+     * \param[in,out] out    The words to combine.
+     */
+    template <bool and_words>
+    void apply(size_t word, size_t word_count, uint64_t * out) const noexcept
+    {
+        assert(word + word_count <= (bit_count + 63u) / 64u);
+
+        std::array<uint64_t, block_words> decoded;
+
+        while (word_count > 0u)
+        {
+            size_t const block = word / block_words;
+            size_t const first = word % block_words;
+            size_t const count = std::min(block_words - first, word_count);
+            size_t const begin = block_offset(block);
+            size_t const length = block_offset(block + 1u) - begin;
+
+            if (length == block_bytes)
+            {
+                std::memcpy(decoded.data(), payload.data() + begin, block_bytes);
+            }
+            else
+            {
+                decoded.fill(0u);
+                for (uint8_t const position : std::span{payload.data() + begin, length})
+                    decoded[position >> 6] |= 1ULL << (position & 63u);
+            }
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if constexpr (and_words)
+                    out[i] &= decoded[first + i];
+                else
+                    out[i] = decoded[first + i];
+            }
+
+            word += count;
+            word_count -= count;
+            out += count;
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    block_compressed_bitvector() = default; //!< Defaulted.
+    block_compressed_bitvector(block_compressed_bitvector const &) = default; //!< Defaulted.
+    block_compressed_bitvector & operator=(block_compressed_bitvector const &) = default; //!< Defaulted.
+    block_compressed_bitvector(block_compressed_bitvector &&) = default; //!< Defaulted.
+    block_compressed_bitvector & operator=(block_compressed_bitvector &&) = default; //!< Defaulted.
+    ~block_compressed_bitvector() = default; //!< Defaulted.
+
+    /*!\brief Compresses a bitvector.
+     * \param[in] words The words of the bitvector; bits beyond `bits` must be `0`.
+     * \param[in] bits  The number of bits.
+     */
+    block_compressed_bitvector(uint64_t const * words, size_t const bits) : bit_count{bits}
+    {
+        size_t const word_count = (bits + 63u) / 64u;
+        size_t const block_count = (word_count + block_words - 1u) / block_words;
+
+        superblock_offsets.reserve(block_count / superblock_blocks + 2u);
+        block_offsets.reserve(block_count + 1u);
+
+        std::array<uint64_t, block_words> block_data;
+        for (size_t block = 0; block <= block_count; ++block)
+        {
+            if (block % superblock_blocks == 0u)
+                superblock_offsets.push_back(payload.size());
+
+            block_offsets.push_back(payload.size() - superblock_offsets.back());
+
+            if (block == block_count)
+                break;
+
+            block_data.fill(0u);
+            size_t const first_word = block * block_words;
+            std::memcpy(block_data.data(),
+                        words + first_word,
+                        std::min(block_words, word_count - first_word) * sizeof(uint64_t));
+
+            size_t set_bits{};
+            for (uint64_t const word : block_data)
+                set_bits += std::popcount(word);
+
+            if (set_bits * sizeof(uint8_t) < block_bytes)
+            {
+                for (size_t i = 0; i < block_words; ++i)
+                    for (uint64_t bits = block_data[i]; bits != 0u; bits &= bits - 1u)
+                        payload.push_back(static_cast<uint8_t>((i << 6) + std::countr_zero(bits)));
+            }
+            else
+            {
+                size_t const end = payload.size();
+                payload.resize(end + block_bytes);
+                std::memcpy(payload.data() + end, block_data.data(), block_bytes);
+            }
+        }
+
+        payload.shrink_to_fit();
+    }
+    //!\}
+
+    //!\brief Returns the number of bits.
+    size_t size() const noexcept
+    {
+        return bit_count;
+    }
+
+    //!\brief Returns the size of the compressed bitvector in bytes.
+    size_t size_in_bytes() const noexcept
+    {
+        return superblock_offsets.size() * sizeof(uint64_t) +
+               block_offsets.size() * sizeof(uint16_t) +
+               payload.size() * sizeof(uint8_t);
+    }
+
+    /*!\brief Copies the words `[word, word + word_count)` to `out`.
+     * \param[in] word       The first word to decode.
+     * \param[in] word_count The number of words to decode.
+     * \param[out] out       The decoded words.
+     */
+    void decode_words(size_t const word, size_t const word_count, uint64_t * out) const noexcept
+    {
+        apply<false>(word, word_count, out);
+    }
+
+    /*!\brief Combines the words `[word, word + word_count)` with `out` by bitwise AND.
+     * \param[in] word       The first word to decode.
+     * \param[in] word_count The number of words to decode.
+     * \param[in,out] out    The words to combine.
+     */
+    void and_words(size_t const word, size_t const word_count, uint64_t * out) const noexcept
+    {
+        apply<true>(word, word_count, out);
+    }
+
+    //!\brief Test for equality.
+    friend bool operator==(block_compressed_bitvector const & lhs, block_compressed_bitvector const & rhs) noexcept
+    {
+        // The encoding is unique.
+        return std::tie(lhs.bit_count, lhs.superblock_offsets, lhs.block_offsets, lhs.payload) ==
+               std::tie(rhs.bit_count, rhs.superblock_offsets, rhs.block_offsets, rhs.payload);
+    }
+
+    /*!\brief Writes the bitvector to `out`.
+     * \param[in,out] out The stream to write to.
+     * \returns The number of written bytes.
+     */
+    uint64_t serialize(std::ostream & out) const
+    {
+        uint64_t written{};
+        auto write_vector = [&] (auto const & vector)
+        {
+            uint64_t const size = vector.size();
+            out.write(reinterpret_cast<char const *>(&size), sizeof(size));
+            out.write(reinterpret_cast<char const *>(vector.data()), size * sizeof(vector[0]));
+            written += sizeof(size) + size * sizeof(vector[0]);
+        };
+
+        uint64_t const bits = bit_count;
+        out.write(reinterpret_cast<char const *>(&bits), sizeof(bits));
+        written += sizeof(bits);
+        write_vector(superblock_offsets);
+        write_vector(block_offsets);
+        write_vector(payload);
+        return written;
+    }
+
+    /*!\brief Reads a bitvector written by serialize().
+     * \param[in,out] in The stream to read from.
+     * \throws std::runtime_error if the stream ends early or does not contain a valid bitvector.
+     *
+     * \details
+     *
+     * The directory is checked before it is used, such that a corrupted stream can not cause out-of-bounds accesses
+     * in decode_words() and and_words().
+     */
+    void load(std::istream & in)
+    {
+        auto read = [&] (void * const data, size_t const bytes)
+        {
+            if (!in.read(static_cast<char *>(data), bytes))
+                throw std::runtime_error{"The compressed bitvector could not be read."};
+        };
+
+        auto read_vector = [&] (auto & vector, uint64_t const min_size, uint64_t const max_size)
+        {
+            uint64_t size{};
+            read(&size, sizeof(size));
+            if (size < min_size || size > max_size)
+                throw std::runtime_error{"The compressed bitvector is corrupted."};
+            vector.resize(size);
+            read(vector.data(), size * sizeof(vector[0]));
+        };
+
+        uint64_t bits{};
+        read(&bits, sizeof(bits));
+        if (bits > std::numeric_limits<uint64_t>::max() - 255u)
+            throw std::runtime_error{"The compressed bitvector is corrupted."};
+
+        size_t const block_count = (bits + 255u) / 256u;
+        size_t const superblock_count = block_count / superblock_blocks + 1u;
+        bit_count = bits;
+        read_vector(superblock_offsets, superblock_count, superblock_count);
+        read_vector(block_offsets, block_count + 1u, block_count + 1u);
+        read_vector(payload, 0u, block_count * block_bytes);
+
+        // Each block must start at or after the end of the previous one and be at most as long as a raw block.
+        size_t end{};
+        for (size_t block = 0; block <= block_count; ++block)
+        {
+            size_t const begin = block_offset(block);
+            if (begin < end || begin - end > block_bytes || begin > payload.size() || (block == 0u && begin != 0u))
+                throw std::runtime_error{"The compressed bitvector is corrupted."};
+            end = begin;
+        }
+
+        if (end != payload.size())
+            throw std::runtime_error{"The compressed bitvector is corrupted."};
+    }
+
+    //!\cond
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(bit_count);
+        archive(superblock_offsets);
+        archive(block_offsets);
+        archive(payload);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,259 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the native file layout of seqan3::interleaved_bloom_filter and seqan3::bloom_filter.
+ */
+
+#pragma once
+
+#include <array>
+#include <seqan3/std/concepts>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <memory>
+#include <seqan3/std/ranges>
+#include <stdexcept>
+#include <string>
+
+#include <sdsl/bit_vectors.hpp>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/io/detail/memory_mapped_file.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief The header of a file written by seqan3::interleaved_bloom_filter::store or seqan3::bloom_filter::store.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * The header is followed by padding up to `payload_offset` and the bitvector. The bitvector of an uncompressed filter
+ * is stored as its raw 64-bit words, such that the file can be mapped into memory and queried without a copy.
+ * `payload_offset` is a multiple of seqan3::detail::bloom_filter_file_header::payload_alignment, hence the mapped words
+ * are aligned to a page. The compressed bitvector is stored in its SDSL serialisation.
+ *
+ * A seqan3::bloom_filter is stored like an Interleaved Bloom Filter with a single bin. A seqan3::blocked_bloom_filter
+ * is stored like a seqan3::bloom_filter whose `bin_size` is the number of bits of all its blocks.
+ */
+struct bloom_filter_file_header
+{
+    //!\brief The magic string identifying the file.
+    static constexpr std::array<char, 8> expected_magic{'S', 'Q', '3', 'B', 'L', 'O', 'O', 'M'};
+    //!\brief The current version of the file layout.
+    static constexpr uint32_t current_version{2u};
+    //!\brief The alignment of the payload in bytes.
+    static constexpr uint64_t payload_alignment{4096u};
+
+    //!\brief The magic string identifying the file.
+    std::array<char, 8> magic{expected_magic};
+    //!\brief The version of the file layout.
+    uint32_t version{current_version};
+    //!\brief Whether the file contains a seqan3::interleaved_bloom_filter.
+    uint8_t is_interleaved{};
+    //!\brief Whether the bitvector is compressed.
+    uint8_t is_compressed{};
+    //!\brief Whether the file contains a seqan3::blocked_bloom_filter.
+    uint8_t is_blocked{};
+    //!\brief Padding to 16 bytes.
+    uint8_t padding1{};
+    //!\brief The number of bins.
+    uint64_t bins{};
+    //!\brief The number of technical bins.
+    uint64_t technical_bins{};
+    //!\brief The size of a bin in bits.
+    uint64_t bin_size{};
+    //!\brief The number of bits to shift the hash value before doing multiplicative hashing.
+    uint64_t hash_shift{};
+    //!\brief The number of hash functions.
+    uint64_t hash_funs{};
+    //!\brief The position of the bitvector in the file in bytes.
+    uint64_t payload_offset{payload_alignment};
+    //!\brief The size of the bitvector in the file in bytes.
+    uint64_t payload_bytes{};
+    //!\brief Padding to 128 bytes.
+    std::array<uint8_t, 56> padding2{};
+
+    //!\brief Returns the number of 64-bit words of the uncompressed bitvector.
+    uint64_t uncompressed_payload_words() const noexcept
+    {
+        uint64_t const bits = bin_size * technical_bins;
+        return (bits >> 6) + ((bits & 63u) != 0u);
+    }
+
+    //!\brief Returns the number of bytes of the uncompressed bitvector.
+    uint64_t uncompressed_payload_bytes() const noexcept
+    {
+        return uncompressed_payload_words() * sizeof(uint64_t);
+    }
+
+    /*!\brief Checks that a file of `file_size` bytes at `path` contains a filter of the same kind as `expected`.
+     * \param[in] expected  The header of the filter type the file is loaded into.
+     * \param[in] file_size The size of the loaded file in bytes.
+     * \param[in] path      The loaded file, used in the error messages.
+     * \throws std::runtime_error if the file is no filter file, was stored with a different version, is truncated or
+     *                            its header describes an invalid filter.
+     * \throws std::logic_error if the filter in the file does not match the filter it is loaded into.
+     */
+    void validate(bloom_filter_file_header const & expected,
+                  uint64_t const file_size,
+                  std::filesystem::path const & path) const
+    {
+        if (magic != expected_magic)
+            throw std::runtime_error{"The file " + path.string() + " does not contain a seqan3 Bloom Filter."};
+
+        if (version != current_version)
+            throw std::runtime_error{"The file " + path.string() + " was stored with file layout version " +
+                                     std::to_string(version) + " but version " + std::to_string(current_version) +
+                                     " is expected."};
+
+        if (payload_offset % payload_alignment != 0u || payload_offset > file_size ||
+            payload_bytes > file_size - payload_offset)
+            throw std::runtime_error{"The file " + path.string() + " is truncated."};
+
+        if (is_interleaved != expected.is_interleaved)
+            throw std::logic_error{std::string{"The file contains a "} +
+                                   (is_interleaved ? "interleaved_bloom_filter" : "bloom_filter") +
+                                   " but it is being read into a " +
+                                   (expected.is_interleaved ? "interleaved_bloom_filter." : "bloom_filter.")};
+
+        if (is_blocked != expected.is_blocked)
+            throw std::logic_error{std::string{"The file contains a "} +
+                                   (is_blocked ? "blocked_bloom_filter" : "bloom_filter") +
+                                   " but it is being read into a " +
+                                   (expected.is_blocked ? "blocked_bloom_filter." : "bloom_filter.")};
+
+        if (is_compressed != expected.is_compressed)
+            throw std::logic_error{std::string{"The file contains a "} +
+                                   (is_compressed ? "compressed" : "uncompressed") +
+                                   " filter but it is being read into a " +
+                                   (expected.is_compressed ? "compressed" : "uncompressed") + " filter."};
+
+        // The hash functions of a seqan3::blocked_bloom_filter may set up to one bit in each of the 8 words of a block.
+        if (hash_funs == 0u || hash_funs > (is_blocked ? 8u : 5u) || hash_shift >= 64u)
+            throw std::runtime_error{"The file " + path.string() + " has invalid hash function parameters."};
+
+        if (bin_size == 0u || bins == 0u || bins > technical_bins ||
+            (is_interleaved ? technical_bins % 64u != 0u : technical_bins != 1u) ||
+            (is_blocked && bin_size % 512u != 0u))
+            throw std::runtime_error{"The file " + path.string() + " has an invalid filter size."};
+
+        // The number of bytes of the uncompressed bitvector must not overflow.
+        if (technical_bins > std::numeric_limits<uint64_t>::max() / bin_size ||
+            uncompressed_payload_words() > std::numeric_limits<uint64_t>::max() / sizeof(uint64_t))
+            throw std::runtime_error{"The file " + path.string() + " has an invalid filter size."};
+
+        if (!is_compressed && payload_bytes != uncompressed_payload_bytes())
+            throw std::runtime_error{"The file " + path.string() + " is truncated."};
+    }
+};
+
+static_assert(sizeof(bloom_filter_file_header) == 128, "The bloom_filter_file_header must have a size of 128 bytes.");
+
+/*!\brief Writes a filter file whose bitvector is written by a callback.
+ * \tparam write_payload_t The type of the callback; must be invocable with `std::ostream &` and return the number of
+ *                         written bytes.
+ * \param[in] path          The file to write.
+ * \param[in] header        The header; `payload_bytes` is set by this function.
+ * \param[in] write_payload Writes the bitvector to the stream; may write it piece by piece.
+ * \throws std::filesystem::filesystem_error if the file cannot be written.
+ */
+template <typename write_payload_t>
+void write_bloom_filter_file(std::filesystem::path const & path,
+                             bloom_filter_file_header header,
+                             write_payload_t && write_payload)
+{
+    std::ofstream out = open_binary_file<std::ofstream>(path);
+
+    std::array<char, bloom_filter_file_header::payload_alignment> padding{};
+    out.write(padding.data(), padding.size()); // Overwritten by the header.
+
+    header.payload_bytes = write_payload(static_cast<std::ostream &>(out));
+
+    out.seekp(0);
+    out.write(reinterpret_cast<char const *>(&header), sizeof(header));
+
+    if (!out.good())
+        throw std::filesystem::filesystem_error{"Could not write the filter.", path,
+                                                std::make_error_code(std::errc::io_error)};
+}
+
+/*!\brief Writes a filter file.
+ * \tparam data_t The type of the bitvector; sdsl::bit_vector and contiguous ranges of `uint64_t` are stored as raw
+ *                words, other types are serialised.
+ * \param[in] path   The file to write.
+ * \param[in] header The header; `payload_bytes` is set by this function.
+ * \param[in] data   The bitvector.
+ * \throws std::filesystem::filesystem_error if the file cannot be written.
+ */
+template <typename data_t>
+void store_bloom_filter_file(std::filesystem::path const & path, bloom_filter_file_header header, data_t const & data)
+{
+    write_bloom_filter_file(path, header, [&data] (std::ostream & out) -> uint64_t
+    {
+        if constexpr (std::same_as<data_t, sdsl::bit_vector>)
+        {
+            uint64_t const payload_bytes = ((data.size() + 63u) >> 6) * sizeof(uint64_t);
+            out.write(reinterpret_cast<char const *>(data.data()), payload_bytes);
+            return payload_bytes;
+        }
+        else if constexpr (std::ranges::contiguous_range<data_t>)
+        {
+            static_assert(std::same_as<std::ranges::range_value_t<data_t>, uint64_t>);
+            uint64_t const payload_bytes = std::ranges::size(data) * sizeof(uint64_t);
+            out.write(reinterpret_cast<char const *>(std::ranges::data(data)), payload_bytes);
+            return payload_bytes;
+        }
+        else
+        {
+            return data.serialize(out);
+        }
+    });
+}
+
+//!\brief A mapped filter file, see seqan3::detail::map_bloom_filter_file.
+struct mapped_bloom_filter_file
+{
+    //!\brief The header of the file.
+    bloom_filter_file_header header{};
+    //!\brief The mapped file.
+    std::shared_ptr<memory_mapped_file const> file{};
+
+    //!\brief The first byte of the bitvector.
+    std::byte const * payload() const noexcept
+    {
+        return file->data() + header.payload_offset;
+    }
+};
+
+/*!\brief Maps a filter file into memory and validates its header.
+ * \param[in] path     The file to map.
+ * \param[in] expected The header of the filter type the file is loaded into.
+ * \throws std::filesystem::filesystem_error if the file cannot be opened.
+ * \throws std::runtime_error or std::logic_error, see seqan3::detail::bloom_filter_file_header::validate.
+ */
+inline mapped_bloom_filter_file map_bloom_filter_file(std::filesystem::path const & path,
+                                                      bloom_filter_file_header const & expected)
+{
+    mapped_bloom_filter_file result{};
+    result.file = std::make_shared<memory_mapped_file const>(path);
+
+    if (result.file->size() < sizeof(bloom_filter_file_header))
+        throw std::runtime_error{"The file " + path.string() + " does not contain a seqan3 Bloom Filter."};
+
+    std::memcpy(&result.header, result.file->data(), sizeof(bloom_filter_file_header));
+    result.header.validate(expected, result.file->size(), path);
+
+    return result;
+}
+
+} // namespace seqan3::detail
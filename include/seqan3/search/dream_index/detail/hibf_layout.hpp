@@ -0,0 +1,273 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::hibf_layout.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Distributes user bins of very different sizes among the technical bins of a hierarchy of
+ *        Interleaved Bloom Filters.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * Each Interleaved Bloom Filter (IBF) of the hierarchy has the same number of technical bins and is sized for its
+ * largest technical bin. A technical bin either stores
+ *
+ *  * a part of a user bin: large user bins are split into several technical bins of the same IBF,
+ *  * a whole user bin or
+ *  * a merged bin: consecutive small user bins are stored together in one technical bin, and a child IBF on the next
+ *    lower level distinguishes them.
+ *
+ * The user bins are sorted by decreasing size. On each level, a dynamic program over the number of technical bins
+ * and the number of user bins minimises the maximal load of a technical bin, which determines the size of the IBF.
+ * A query hits a user bin that is split into `k` technical bins if it hits any of them. To keep the false positive
+ * rate of the user bin, the load of its parts is multiplied by the factor by which a Bloom Filter needs to be larger
+ * for a false positive rate of \f$1 - (1 - p)^{1/k}\f$ instead of \f$p\f$.
+ * The load of a merged bin is the sum of the sizes of its user bins, multiplied by `merge_penalty` to account for the
+ * memory of the child IBF and the additional query time. The layout of a merged bin is computed recursively.
+ * Technical bins may stay empty.
+ */
+struct hibf_layout
+{
+    //!\brief Marks technical bins that do not store (a part of) a single user bin.
+    static constexpr size_t merged_bin = std::numeric_limits<size_t>::max();
+
+    //!\brief The layout of a single IBF of the hierarchy.
+    struct node
+    {
+        //!\brief For each technical bin, the user bin it stores (a part of), or seqan3::detail::hibf_layout::merged_bin.
+        std::vector<size_t> user_bins{};
+        //!\brief For each technical bin, the index of the child node if it is a merged bin, or the own index. Merged bins
+        //!       that point to the own index are empty.
+        std::vector<size_t> children{};
+        //!\brief The maximal number of elements of a technical bin, corrected for split user bins.
+        size_t max_load{};
+
+        //!\cond
+        template <cereal_archive archive_t>
+        void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+        {
+            archive(user_bins);
+            archive(children);
+            archive(max_load);
+        }
+        //!\endcond
+    };
+
+    //!\brief The nodes of the hierarchy; the root is the first node and parents precede their children.
+    std::vector<node> nodes{};
+
+    /*!\brief Computes the layout.
+     * \param[in] user_bin_sizes      The number of elements of each user bin.
+     * \param[in] technical_bins      The number of technical bins per IBF; must be at least 2.
+     * \param[in] false_positive_rate The false positive rate of the user bins; must be in `(0, 1)`.
+     * \param[in] hash_funs           The number of hash functions of the IBFs; must be at least 1.
+     * \param[in] merge_penalty       The factor by which the load of a merged bin is increased; must be at least 1.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * \f$O(t^2 \cdot n + t \cdot n^2)\f$ per level in the worst case, where \f$t\f$ is the number of technical bins and
+     * \f$n\f$ the number of user bins of the level. Merged bins are only extended while their load is below the best
+     * solution found so far, which is usually much faster.
+     */
+    hibf_layout(std::vector<size_t> const & user_bin_sizes,
+                size_t const technical_bins,
+                double const false_positive_rate,
+                size_t const hash_funs,
+                double const merge_penalty = 1.2) :
+        technical_bins_{technical_bins},
+        merge_penalty_{merge_penalty},
+        split_correction(technical_bins + 1u, 1.0)
+    {
+        assert(technical_bins >= 2u);
+        assert(false_positive_rate > 0.0 && false_positive_rate < 1.0);
+        assert(hash_funs >= 1u);
+        assert(merge_penalty >= 1.0);
+
+        for (size_t parts = 2u; parts <= technical_bins; ++parts)
+        {
+            double const part_rate = 1.0 - std::pow(1.0 - false_positive_rate, 1.0 / parts);
+            split_correction[parts] = bits_per_value(part_rate, hash_funs) / bits_per_value(false_positive_rate,
+                                                                                             hash_funs);
+        }
+
+        std::vector<size_t> order(user_bin_sizes.size());
+        std::iota(order.begin(), order.end(), size_t{0u});
+        std::ranges::stable_sort(order, [&] (size_t const lhs, size_t const rhs)
+        {
+            return user_bin_sizes[lhs] > user_bin_sizes[rhs];
+        });
+
+        if (!order.empty())
+            compute_node(order, user_bin_sizes);
+    }
+
+    /*!\brief The number of bits per value of a Bloom Filter with the given false positive rate.
+     * \param[in] false_positive_rate The false positive rate; must be in `(0, 1)`.
+     * \param[in] hash_funs           The number of hash functions.
+     */
+    static double bits_per_value(double const false_positive_rate, size_t const hash_funs) noexcept
+    {
+        double const h = hash_funs;
+        return -h / std::log(1.0 - std::pow(false_positive_rate, 1.0 / h));
+    }
+
+    hibf_layout() = default; //!< Defaulted.
+
+    //!\cond
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(nodes);
+    }
+    //!\endcond
+
+private:
+    //!\brief The number of technical bins per IBF.
+    size_t technical_bins_{};
+    //!\brief The factor by which the load of a merged bin is increased.
+    double merge_penalty_{};
+    //!\brief The factor by which the load of a user bin split into `i` technical bins is increased.
+    std::vector<double> split_correction{};
+
+    /*!\brief Computes the layout of one IBF storing the given user bins and, recursively, its children.
+     * \param[in] user_bins The ids of the user bins, sorted by decreasing size.
+     * \param[in] sizes     The sizes of all user bins.
+     * \returns The index of the node.
+     */
+    size_t compute_node(std::vector<size_t> const & user_bins, std::vector<size_t> const & sizes)
+    {
+        size_t const n = user_bins.size();
+        size_t const t = technical_bins_;
+
+        std::vector<double> prefix_sum(n + 1u, 0.0);
+        for (size_t i = 0u; i < n; ++i)
+            prefix_sum[i + 1u] = prefix_sum[i] + sizes[user_bins[i]];
+
+        // cost[j][i]: the minimal maximal load of j technical bins that store the first i user bins.
+        // The last technical bins either store a part of user bin i - 1 (`split[j][i]` technical bins, `start = i - 1`),
+        // the merged user bins [start, i) in a single technical bin (`split[j][i] = 0`) or nothing (`start = i`).
+        constexpr double infinity = std::numeric_limits<double>::infinity();
+        std::vector<std::vector<double>> cost(t + 1u, std::vector<double>(n + 1u, infinity));
+        std::vector<std::vector<size_t>> split(t + 1u, std::vector<size_t>(n + 1u, 0u));
+        std::vector<std::vector<size_t>> start(t + 1u, std::vector<size_t>(n + 1u, 0u));
+        cost[0][0] = 0.0;
+
+        for (size_t j = 1u; j <= t; ++j)
+        {
+            cost[j][0] = 0.0;
+
+            for (size_t i = 1u; i <= n; ++i)
+            {
+                // The last technical bin is empty.
+                double best = cost[j - 1u][i];
+                split[j][i] = 0u;
+                start[j][i] = i;
+
+                double const size = sizes[user_bins[i - 1u]];
+
+                // User bin i - 1 is stored in the last `parts` technical bins.
+                for (size_t parts = 1u; parts <= j; ++parts)
+                {
+                    double const candidate = std::max(cost[j - parts][i - 1u],
+                                                      std::ceil(size / parts) * split_correction[parts]);
+                    if (candidate < best)
+                    {
+                        best = candidate;
+                        split[j][i] = parts;
+                        start[j][i] = i - 1u;
+                    }
+                }
+
+                // User bins [first, i) are merged into the last technical bin. A merged bin never contains all user bins,
+                // otherwise the child IBF would have the same layout.
+                for (size_t first = i - 1u; first-- > (i == n);)
+                {
+                    double const load = merge_penalty_ * (prefix_sum[i] - prefix_sum[first]);
+                    if (load >= best)
+                        break;
+
+                    double const candidate = std::max(cost[j - 1u][first], load);
+                    if (candidate < best)
+                    {
+                        best = candidate;
+                        split[j][i] = 0u;
+                        start[j][i] = first;
+                    }
+                }
+
+                cost[j][i] = best;
+            }
+        }
+
+        size_t const node_idx = nodes.size();
+        nodes.emplace_back();
+        nodes[node_idx].user_bins.resize(t, merged_bin);
+        nodes[node_idx].children.resize(t, node_idx);
+
+        // Trace back from the last technical bin.
+        std::vector<std::pair<size_t, std::vector<size_t>>> merged{}; // technical bin and its user bins
+        double max_load{};
+        for (size_t j = t, i = n; j > 0u && i > 0u;)
+        {
+            size_t const first = start[j][i];
+
+            if (first == i)
+            {
+                j -= 1u;
+            }
+            else if (size_t const parts = split[j][i]; parts > 0u)
+            {
+                size_t const user_bin = user_bins[i - 1u];
+                max_load = std::max(max_load, std::ceil(static_cast<double>(sizes[user_bin]) / parts) *
+                                              split_correction[parts]);
+                for (size_t part = 0u; part < parts; ++part)
+                    nodes[node_idx].user_bins[j - 1u - part] = user_bin;
+                j -= parts;
+            }
+            else
+            {
+                max_load = std::max(max_load, prefix_sum[i] - prefix_sum[first]);
+                merged.emplace_back(j - 1u, std::vector<size_t>(user_bins.begin() + first, user_bins.begin() + i));
+                j -= 1u;
+            }
+
+            i = first;
+        }
+
+        nodes[node_idx].max_load = std::ceil(max_load);
+
+        for (auto const & [technical_bin, merged_user_bins] : merged)
+        {
+            size_t const child_idx = compute_node(merged_user_bins, sizes);
+            nodes[node_idx].children[technical_bin] = child_idx;
+        }
+
+        return node_idx;
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,436 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::hierarchical_interleaved_bloom_filter.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cmath>
+#include <seqan3/std/ranges>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/search/dream_index/detail/hibf_layout.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A hierarchy of Interleaved Bloom Filters for user bins of very different sizes.
+ * \ingroup search_dream_index
+ * \tparam data_layout_mode_ Indicates whether the underlying Interleaved Bloom Filters are compressed.
+ *                           See seqan3::data_layout.
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * A seqan3::interleaved_bloom_filter sizes every bin for the largest bin. If the sizes of the bins differ a lot, most
+ * of the memory is spent on the small bins, which then have a much lower false positive rate than required.
+ *
+ * The Hierarchical Interleaved Bloom Filter (HIBF) distinguishes the *user bins*, i.e. the sets of values given by the
+ * user, from the *technical bins* of its Interleaved Bloom Filters (IBFs). Every IBF of the hierarchy has the same
+ * number of technical bins. Large user bins are split into several technical bins, such that the IBF can be sized for
+ * a fraction of their size. Small user bins are merged into a single technical bin, which is resolved by a child IBF
+ * on the next lower level. The layout, i.e. which user bins are split or merged, is computed on construction and
+ * minimises the maximal load of the technical bins on every level.
+ *
+ * Each IBF is sized s.t. the user bins stored in its technical bins have at most the given false positive rate.
+ *
+ * ### Querying
+ *
+ * To count the occurrences of a range of values in the user bins, call
+ * seqan3::hierarchical_interleaved_bloom_filter::counting_agent() and use the returned
+ * seqan3::hierarchical_interleaved_bloom_filter::counting_agent_type. The counts of a split user bin are the sum of the
+ * counts of its technical bins. A child IBF is only queried if its merged bin has at least one hit.
+ *
+ * ### Compression
+ *
+ * Like the seqan3::interleaved_bloom_filter, the HIBF can be compressed by passing `data_layout::compressed` as
+ * template argument. The compressed HIBF can only be constructed from an uncompressed one and is immutable.
+ *
+ * ### Thread safety
+ *
+ * The HIBF promises the basic thread-safety by the STL that all calls to `const` member functions are safe from
+ * multiple threads.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/hierarchical_interleaved_bloom_filter.cpp
+ */
+template <data_layout data_layout_mode_ = data_layout::uncompressed>
+class hierarchical_interleaved_bloom_filter
+{
+private:
+    //!\cond
+    template <data_layout data_layout_mode>
+    friend class hierarchical_interleaved_bloom_filter;
+    //!\endcond
+
+    //!\brief The type of the underlying Interleaved Bloom Filters.
+    using ibf_t = interleaved_bloom_filter<data_layout_mode_>;
+
+    //!\brief The number of user bins.
+    size_t user_bins{};
+    //!\brief The layout of the hierarchy.
+    detail::hibf_layout layout{};
+    //!\brief The Interleaved Bloom Filters; the i-th IBF has the layout of the i-th node of the layout.
+    std::vector<ibf_t> ibfs{};
+
+    /*!\brief Returns the part of a user bin that is split into `parts` technical bins that stores `value`.
+     * \param[in] value The value.
+     * \param[in] parts The number of technical bins of the user bin; must be at least 1.
+     *
+     * \details
+     *
+     * Mixes the bits of the value (the finaliser of MurmurHash3), s.t. consecutive values are spread evenly.
+     */
+    static size_t split_part(uint64_t value, size_t const parts) noexcept
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33;
+        return value % parts;
+    }
+
+    //!\brief Appends the user bins stored in the subtree of the given node to `result`.
+    void collect_user_bins(size_t const node_idx, std::vector<size_t> & result) const
+    {
+        auto const & node = layout.nodes[node_idx];
+        for (size_t technical_bin = 0u; technical_bin < node.user_bins.size(); ++technical_bin)
+        {
+            if (node.user_bins[technical_bin] != detail::hibf_layout::merged_bin)
+                result.push_back(node.user_bins[technical_bin]);
+            else if (node.children[technical_bin] != node_idx)
+                collect_user_bins(node.children[technical_bin], result);
+        }
+    }
+
+public:
+    //!\brief Indicates whether the Interleaved Bloom Filters are compressed.
+    static constexpr data_layout data_layout_mode = data_layout_mode_;
+
+    template <std::integral value_t>
+    class counting_agent_type; // documented upon definition below
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    hierarchical_interleaved_bloom_filter() = default; //!< Defaulted.
+    hierarchical_interleaved_bloom_filter(hierarchical_interleaved_bloom_filter const &) = default; //!< Defaulted.
+    hierarchical_interleaved_bloom_filter & operator=(hierarchical_interleaved_bloom_filter const &) = default; //!< Defaulted.
+    hierarchical_interleaved_bloom_filter(hierarchical_interleaved_bloom_filter &&) = default; //!< Defaulted.
+    hierarchical_interleaved_bloom_filter & operator=(hierarchical_interleaved_bloom_filter &&) = default; //!< Defaulted.
+    ~hierarchical_interleaved_bloom_filter() = default; //!< Defaulted.
+
+    /*!\brief Construct an uncompressed Hierarchical Interleaved Bloom Filter.
+     * \tparam user_bins_t The type of the user bins; must model std::ranges::forward_range over ranges that model
+     *                     std::ranges::forward_range over std::unsigned_integral values.
+     * \param[in] user_bins_      The values of each user bin, e.g. the results of seqan3::views::minimiser_hash.
+     * \param[in] false_positive_rate The false positive rate of the user bins in each IBF.
+     * \param[in] technical_bins The number of technical bins of each IBF. Should be a multiple of 64.
+     * \param[in] funs           The number of hash functions. Default 2. At least 1, at most 5.
+     * \throws std::logic_error if `false_positive_rate` is not in `(0, 1)`, `technical_bins` is less than 2 or the
+     *                          number of hash functions is invalid.
+     *
+     * \attention This constructor can only be used to construct **uncompressed** Hierarchical Interleaved Bloom Filters.
+     *
+     * \details
+     *
+     * The user bins are iterated in two passes. The first pass counts the distinct values of each user bin to compute
+     * the layout; only the values of one user bin are held in memory at a time. The second pass inserts the values of
+     * each user bin once on every level of the hierarchy that stores it. The values of a split user bin are
+     * distributed among its technical bins by a hash of the value, s.t. each distinct value is stored in exactly one
+     * of them.
+     */
+    template <std::ranges::forward_range user_bins_t>
+    //!\cond
+        requires (data_layout_mode == data_layout::uncompressed) &&
+                 std::ranges::forward_range<std::ranges::range_reference_t<user_bins_t>> &&
+                 std::unsigned_integral<std::ranges::range_value_t<std::ranges::range_reference_t<user_bins_t>>>
+    //!\endcond
+    hierarchical_interleaved_bloom_filter(user_bins_t && user_bins_,
+                                          double const false_positive_rate = 0.05,
+                                          seqan3::bin_count const technical_bins = seqan3::bin_count{64u},
+                                          seqan3::hash_function_count const funs = seqan3::hash_function_count{2u})
+    {
+        if (!(false_positive_rate > 0.0 && false_positive_rate < 1.0))
+            throw std::logic_error{"The false positive rate must be in (0, 1)."};
+        if (technical_bins.get() < 2u)
+            throw std::logic_error{"The number of technical bins must be >= 2."};
+        if (funs.get() == 0u || funs.get() > 5u)
+            throw std::logic_error{"The number of hash functions must be > 0 and <= 5."};
+
+        // First pass: the number of distinct values of each user bin.
+        std::vector<std::ranges::iterator_t<user_bins_t>> user_bin_its{};
+        std::vector<size_t> sizes{};
+        {
+            std::vector<uint64_t> bin_values{};
+            for (auto it = std::ranges::begin(user_bins_); it != std::ranges::end(user_bins_); ++it)
+            {
+                bin_values.clear();
+                for (auto && value : *it)
+                    bin_values.push_back(value);
+
+                std::ranges::sort(bin_values);
+                sizes.push_back(std::ranges::distance(bin_values.begin(), std::ranges::unique(bin_values).begin()));
+                user_bin_its.push_back(it);
+            }
+        }
+
+        user_bins = sizes.size();
+        if (user_bins == 0u)
+            return;
+
+        layout = detail::hibf_layout{sizes, technical_bins.get(), false_positive_rate, funs.get()};
+        double const bits_per_value = detail::hibf_layout::bits_per_value(false_positive_rate, funs.get());
+
+        // Second pass: insert the values into the technical bins of every node.
+        ibfs.reserve(layout.nodes.size());
+        std::vector<size_t> merged{};
+        for (size_t node_idx = 0u; node_idx < layout.nodes.size(); ++node_idx)
+        {
+            auto const & node = layout.nodes[node_idx];
+            size_t const bits = std::ceil(bits_per_value * std::max<size_t>(node.max_load, 1u));
+            ibf_t & ibf = ibfs.emplace_back(seqan3::bin_count{node.user_bins.size()}, seqan3::bin_size{bits}, funs);
+
+            for (size_t technical_bin = 0u, next{}; technical_bin < node.user_bins.size(); technical_bin = next)
+            {
+                size_t const user_bin = node.user_bins[technical_bin];
+
+                // A split user bin occupies the consecutive technical bins [technical_bin, next).
+                next = technical_bin + 1u;
+                if (user_bin != detail::hibf_layout::merged_bin)
+                {
+                    while (next < node.user_bins.size() && node.user_bins[next] == user_bin)
+                        ++next;
+
+                    size_t const parts = next - technical_bin;
+                    for (auto && value : *user_bin_its[user_bin])
+                        ibf.emplace(value, seqan3::bin_index{technical_bin + split_part(value, parts)});
+                }
+                else if (node.children[technical_bin] != node_idx)
+                {
+                    merged.clear();
+                    collect_user_bins(node.children[technical_bin], merged);
+                    for (size_t const merged_user_bin : merged)
+                        for (auto && value : *user_bin_its[merged_user_bin])
+                            ibf.emplace(value, seqan3::bin_index{technical_bin});
+                }
+            }
+        }
+    }
+
+    /*!\brief Construct a compressed Hierarchical Interleaved Bloom Filter.
+     * \param[in] hibf The uncompressed seqan3::hierarchical_interleaved_bloom_filter.
+     *
+     * \attention This constructor can only be used to construct **compressed** Hierarchical Interleaved Bloom Filters.
+     */
+    hierarchical_interleaved_bloom_filter(hierarchical_interleaved_bloom_filter<data_layout::uncompressed> const & hibf)
+    //!\cond
+        requires (data_layout_mode == data_layout::compressed)
+    //!\endcond
+        : user_bins{hibf.user_bins}, layout{hibf.layout}
+    {
+        ibfs.reserve(hibf.ibfs.size());
+        for (auto const & ibf : hibf.ibfs)
+            ibfs.emplace_back(ibf);
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Returns a seqan3::hierarchical_interleaved_bloom_filter::counting_agent_type to be used for counting.
+     * \tparam value_t The type of the counters. Default uint16_t.
+     */
+    template <typename value_t = uint16_t>
+    counting_agent_type<value_t> counting_agent() const
+    {
+        return counting_agent_type<value_t>{*this};
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of user bins.
+    size_t user_bin_count() const noexcept
+    {
+        return user_bins;
+    }
+
+    //!\brief Returns the number of Interleaved Bloom Filters of the hierarchy.
+    size_t ibf_count() const noexcept
+    {
+        return ibfs.size();
+    }
+
+    //!\brief Returns the total size in bits of the underlying bitvectors.
+    size_t bit_size() const noexcept
+    {
+        size_t result{};
+        for (auto const & ibf : ibfs)
+            result += ibf.bit_size();
+        return result;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Test for equality.
+    friend bool operator==(hierarchical_interleaved_bloom_filter const & lhs,
+                           hierarchical_interleaved_bloom_filter const & rhs) noexcept
+    {
+        return lhs.user_bins == rhs.user_bins && lhs.ibfs == rhs.ibfs;
+    }
+
+    //!\brief Test for inequality.
+    friend bool operator!=(hierarchical_interleaved_bloom_filter const & lhs,
+                           hierarchical_interleaved_bloom_filter const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(user_bins);
+        archive(layout);
+        archive(ibfs);
+    }
+    //!\endcond
+};
+
+/*!\brief Manages counting ranges of values for the seqan3::hierarchical_interleaved_bloom_filter.
+ * \tparam value_t The type of the counters; must model std::integral.
+ *
+ * \details
+ *
+ * Like the seqan3::interleaved_bloom_filter::counting_agent_type, this class holds one counting agent per IBF of the
+ * hierarchy and the result buffer. Create one agent per thread.
+ */
+template <data_layout data_layout_mode>
+template <std::integral value_t>
+class hierarchical_interleaved_bloom_filter<data_layout_mode>::counting_agent_type
+{
+private:
+    //!\brief The type of the augmented seqan3::hierarchical_interleaved_bloom_filter.
+    using hibf_t = hierarchical_interleaved_bloom_filter<data_layout_mode>;
+    //!\brief The type of the counting agents of the underlying IBFs.
+    using ibf_agent_t = typename interleaved_bloom_filter<data_layout_mode>::template counting_agent_type<value_t>;
+
+    //!\brief A pointer to the augmented seqan3::hierarchical_interleaved_bloom_filter.
+    hibf_t const * hibf_ptr{nullptr};
+    //!\brief One counting agent per IBF.
+    std::vector<ibf_agent_t> agents{};
+
+    //!\brief Adds the counts of the values in the IBF `node_idx` and its children to the result buffer.
+    template <typename value_range_t>
+    void count(size_t const node_idx, value_range_t & values) noexcept
+    {
+        auto const & node = hibf_ptr->layout.nodes[node_idx];
+        counting_vector<value_t> const & counts = agents[node_idx].bulk_count(values);
+
+        for (size_t technical_bin = 0u; technical_bin < node.user_bins.size(); ++technical_bin)
+        {
+            if (size_t const user_bin = node.user_bins[technical_bin]; user_bin != detail::hibf_layout::merged_bin)
+                result_buffer[user_bin] += counts[technical_bin];
+            else if (node.children[technical_bin] != node_idx && counts[technical_bin] > 0u)
+                count(node.children[technical_bin], values);
+        }
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    counting_agent_type() = default; //!< Defaulted.
+    counting_agent_type(counting_agent_type const &) = default; //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type const &) = default; //!< Defaulted.
+    counting_agent_type(counting_agent_type &&) = default; //!< Defaulted.
+    counting_agent_type & operator=(counting_agent_type &&) = default; //!< Defaulted.
+    ~counting_agent_type() = default; //!< Defaulted.
+
+    /*!\brief Construct a counting_agent_type for an existing seqan3::hierarchical_interleaved_bloom_filter.
+     * \private
+     * \param hibf The seqan3::hierarchical_interleaved_bloom_filter.
+     */
+    explicit counting_agent_type(hibf_t const & hibf) :
+        hibf_ptr(std::addressof(hibf)),
+        result_buffer(hibf.user_bin_count())
+    {
+        agents.reserve(hibf.ibfs.size());
+        for (auto const & ibf : hibf.ibfs)
+            agents.push_back(ibf.template counting_agent<value_t>());
+    }
+    //!\}
+
+    //!\brief Stores the result of bulk_count().
+    counting_vector<value_t> result_buffer;
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Counts the occurrences in each user bin for all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::forward_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * The values are counted in the top-level IBF. The child IBF of a merged bin is queried with all values if the
+     * merged bin has at least one hit; since a child only stores a subset of the values of its merged bin, the other
+     * children cannot contain any of the values.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::hierarchical_interleaved_bloom_filter::counting_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] counting_vector<value_t> const & bulk_count(value_range_t && values) & noexcept
+    {
+        assert(hibf_ptr != nullptr);
+        assert(result_buffer.size() == hibf_ptr->user_bin_count());
+
+        static_assert(std::ranges::forward_range<value_range_t>, "The values must model forward_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        std::ranges::fill(result_buffer, 0);
+
+        if (!agents.empty())
+            count(0u, values);
+
+        return result_buffer;
+    }
+
+    // `bulk_count` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] counting_vector<value_t> const & bulk_count(value_range_t && values) && noexcept = delete;
+    //!\}
+};
+
+} // namespace seqan3
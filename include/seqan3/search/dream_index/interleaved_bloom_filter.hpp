@@ -13,15 +13,229 @@
 #pragma once
 
 #include <seqan3/std/algorithm>
+#include <array>
 #include <seqan3/std/bit>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <sdsl/bit_vectors.hpp>
 
 #include <seqan3/core/concept/cereal.hpp>
 #include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/search/dream_index/detail/block_compressed_bitvector.hpp>
+#include <seqan3/search/dream_index/detail/bloom_filter_file.hpp>
+#include <seqan3/search/dream_index/threshold.hpp>
+#include <seqan3/utility/parallel/detail/parallel_for_chunks.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the bitwise AND of `row_count` rows of `words` 64-bit integers each and stores it in `result`.
+ * \ingroup search_dream_index
+ * \tparam simd_t The simd type used for processing the rows; must model seqan3::simd::simd_concept with
+ *                `uint64_t` as scalar type.
+ * \param[in]  rows      Pointers to the first word of each row.
+ * \param[in]  row_count The number of rows to combine; must be at least 1 and at most `rows.size()`.
+ * \param[in]  words     The number of words per row.
+ * \param[out] result    The memory to store the `words` many result words to.
+ *
+ * \details
+ *
+ * The rows are combined in chunks of `seqan3::simd_traits<simd_t>::length` words with unaligned vector loads; the
+ * remaining words are combined one by one. The width of the vectors is chosen at compile time, i.e. with the default
+ * simd type, 512 bit registers are used if AVX-512 is available, 256 bit with AVX2 and 128 bit with SSE4.
+ */
+template <simd::simd_concept simd_t, size_t max_rows>
+//!\cond
+    requires std::same_as<typename simd_traits<simd_t>::scalar_type, uint64_t>
+//!\endcond
+inline void bitwise_and_rows(std::array<uint64_t const *, max_rows> const & rows,
+                             size_t const row_count,
+                             size_t const words,
+                             uint64_t * const result) noexcept
+{
+    constexpr size_t simd_length = simd_traits<simd_t>::length;
+
+    assert(row_count > 0 && row_count <= max_rows);
+
+    size_t word = 0;
+    for (; word + simd_length <= words; word += simd_length)
+    {
+        simd_t tmp = simd::load<simd_t>(rows[0] + word);
+        for (size_t row = 1; row < row_count; ++row)
+            tmp &= simd::load<simd_t>(rows[row] + word);
+
+        simd::store(result + word, tmp);
+    }
+
+    for (; word < words; ++word)
+    {
+        uint64_t tmp = rows[0][word];
+        for (size_t row = 1; row < row_count; ++row)
+            tmp &= rows[row][word];
+
+        result[word] = tmp;
+    }
+}
+
+/*!\brief Adds the bitwise AND of `row_count` rows to a vertical counter stored as bit-planes.
+ * \ingroup search_dream_index
+ * \tparam simd_t The simd type used for processing the rows; must model seqan3::simd::simd_concept with
+ *                `uint64_t` as scalar type.
+ * \param[in]      rows        Pointers to the first word of each row.
+ * \param[in]      row_count   The number of rows to combine; must be at least 1 and at most `rows.size()`.
+ * \param[in]      words       The number of words per row.
+ * \param[in, out] planes      `plane_count` consecutive bit-planes of `words` words each.
+ * \param[in]      plane_count The number of bit-planes the sum can carry into.
+ *
+ * \details
+ *
+ * Bit `i` of word `w` in plane `j` is the `j`-th bit of the counter of bit `i` of word `w` of the rows. The AND of
+ * the rows is added to all 64 counters of a word at once with a ripple-carry adder, i.e. `plane_count` AND/XOR
+ * operations per word instead of one increment per set bit. The caller must ensure that no counter overflows, e.g.
+ * by only passing the planes that the current number of additions can reach.
+ */
+template <simd::simd_concept simd_t, size_t max_rows>
+//!\cond
+    requires std::same_as<typename simd_traits<simd_t>::scalar_type, uint64_t>
+//!\endcond
+inline void add_bitwise_and_to_bit_planes(std::array<uint64_t const *, max_rows> const & rows,
+                                          size_t const row_count,
+                                          size_t const words,
+                                          uint64_t * const planes,
+                                          size_t const plane_count) noexcept
+{
+    constexpr size_t simd_length = simd_traits<simd_t>::length;
+
+    assert(row_count > 0 && row_count <= max_rows);
+
+    size_t word = 0;
+    for (; word + simd_length <= words; word += simd_length)
+    {
+        simd_t carry = simd::load<simd_t>(rows[0] + word);
+        for (size_t row = 1; row < row_count; ++row)
+            carry &= simd::load<simd_t>(rows[row] + word);
+
+        for (size_t plane = 0; plane < plane_count; ++plane)
+        {
+            uint64_t * const plane_ptr = planes + plane * words + word;
+            simd_t bits = simd::load<simd_t>(plane_ptr);
+            simd_t const next_carry = bits & carry;
+            bits ^= carry;
+            simd::store(plane_ptr, bits);
+            carry = next_carry;
+        }
+    }
+
+    for (; word < words; ++word)
+    {
+        uint64_t carry = rows[0][word];
+        for (size_t row = 1; row < row_count; ++row)
+            carry &= rows[row][word];
+
+        for (size_t plane = 0; plane < plane_count && carry != 0u; ++plane)
+        {
+            uint64_t const next_carry = planes[plane * words + word] & carry;
+            planes[plane * words + word] ^= carry;
+            carry = next_carry;
+        }
+    }
+}
+
+/*!\brief ORs `length` bits of `source` starting at bit `source_bit` into `target` starting at bit `target_bit`.
+ * \ingroup search_dream_index
+ * \param[in]     source     The words to read.
+ * \param[in]     source_bit The first bit to read.
+ * \param[in,out] target     The words to write.
+ * \param[in]     target_bit The first bit to write.
+ * \param[in]     length     The number of bits.
+ *
+ * \details
+ *
+ * The bits are ORed in pieces of up to 64 bits. Bits that are already set in `target` stay set, hence ORing into a
+ * zeroed range copies the bits.
+ */
+inline void or_bits(uint64_t const * const source,
+                    size_t source_bit,
+                    uint64_t * const target,
+                    size_t target_bit,
+                    size_t length) noexcept
+{
+    while (length > 0u)
+    {
+        size_t const piece = std::min<size_t>(length, 64u);
+        size_t const source_offset = source_bit & 63u;
+        size_t const target_offset = target_bit & 63u;
+
+        uint64_t bits = source[source_bit >> 6] >> source_offset;
+        if (source_offset != 0u && source_offset + piece > 64u)
+            bits |= source[(source_bit >> 6) + 1u] << (64u - source_offset);
+        if (piece < 64u)
+            bits &= (1ULL << piece) - 1u;
+
+        target[target_bit >> 6] |= bits << target_offset;
+        if (target_offset != 0u && target_offset + piece > 64u)
+            target[(target_bit >> 6) + 1u] |= bits >> (64u - target_offset);
+
+        source_bit += piece;
+        target_bit += piece;
+        length -= piece;
+    }
+}
+
+/*!\brief ORs the bins of `row_count` rows of one Interleaved Bloom Filter into the bins starting at `first_bin` of
+ *        the same rows of another Interleaved Bloom Filter.
+ * \ingroup search_dream_index
+ * \param[in]     source           The words of the first row to read.
+ * \param[in]     source_bin_words The number of words per row of `source`.
+ * \param[in]     source_bins      The number of bins of `source`.
+ * \param[in,out] target           The words of the first row to write.
+ * \param[in]     target_bin_words The number of words per row of `target`.
+ * \param[in]     first_bin        The bin of `target` that bin `0` of `source` is ORed into.
+ * \param[in]     row_count        The number of rows.
+ *
+ * \details
+ *
+ * If the bins of both rows are aligned, the rows are ORed word by word. Otherwise, seqan3::detail::or_bits shifts
+ * the bins into place.
+ */
+inline void or_rows(uint64_t const * const source,
+                    size_t const source_bin_words,
+                    size_t const source_bins,
+                    uint64_t * const target,
+                    size_t const target_bin_words,
+                    size_t const first_bin,
+                    size_t const row_count) noexcept
+{
+    if (first_bin == 0u && source_bin_words == target_bin_words)
+    {
+        for (size_t word = 0; word < row_count * source_bin_words; ++word)
+            target[word] |= source[word];
+        return;
+    }
+
+    for (size_t row = 0; row < row_count; ++row)
+        or_bits(source + row * source_bin_words, 0u, target + row * target_bin_words, first_bin, source_bins);
+}
+
+} // namespace seqan3::detail
 
 namespace seqan3
 {
+//!\cond
+class interleaved_bloom_filter_builder;
+//!\endcond
+
 //!\brief Determines if the Interleaved Bloom Filter is compressed.
 //!\ingroup search_dream_index
 enum data_layout : bool
@@ -30,6 +244,14 @@ enum data_layout : bool
     compressed    //!< The Interleaved Bloom Filter is compressed.
 };
 
+//!\brief Determines how the bins of Interleaved Bloom Filters are combined when they are merged.
+//!\ingroup search_dream_index
+enum class merge_mode : bool
+{
+    unite_bins, //!< Bin `i` of the result contains the values of bin `i` of all filters.
+    append_bins //!< The bins of each filter follow the bins of the previous filters.
+};
+
 //!\brief A strong type that represents the number of bins for the seqan3::interleaved_bloom_filter.
 //!\ingroup search_dream_index
 struct bin_count : public detail::strong_type<size_t, bin_count, detail::strong_type_skill::convert>
@@ -119,6 +341,12 @@ struct bin_index : public detail::strong_type<size_t, bin_index, detail::strong_
  * `seqan3::interleaved_bloom_filter`, in which case the underlying bitvector is compressed.
  * The compressed Interleaved Bloom Filter is immutable, i.e. only querying is supported.
  *
+ * The bitvector is compressed in blocks of 256 bits: a block with fewer than 32 set bits stores the positions of its
+ * set bits in one byte each, all other blocks are stored uncompressed. The compressed Interleaved Bloom Filter is thus
+ * never noticeably larger than the uncompressed one, and considerably smaller if most bins are sparse, e.g. if the bins
+ * differ a lot in size. Queries decode the rows block by block and remain within a small factor of the uncompressed
+ * Interleaved Bloom Filter.
+ *
  * ### Thread safety
  *
  * The Interleaved Bloom Filter promises the basic thread-safety by the STL that all
@@ -127,7 +355,8 @@ struct bin_index : public detail::strong_type<size_t, bin_index, detail::strong_
  *
  * Additionally, concurrent calls to `emplace` are safe iff each thread handles a multiple of wordsize (=64) many bins.
  * For example, calls to `emplace` from multiple threads are safe if `thread_1` accesses bins 0-63, `thread_2` bins
- * 64-127, and so on.
+ * 64-127, and so on. seqan3::interleaved_bloom_filter_builder fills the bins in parallel this way. This does not hold
+ * for the first modification of a filter obtained by seqan3::interleaved_bloom_filter::load, which copies the bitvector.
  */
 template <data_layout data_layout_mode_ = data_layout::uncompressed>
 class interleaved_bloom_filter
@@ -136,12 +365,14 @@ private:
     //!\cond
     template <data_layout data_layout_mode>
     friend class interleaved_bloom_filter;
+
+    friend class seqan3::interleaved_bloom_filter_builder;
     //!\endcond
 
     //!\brief The underlying datatype to use.
     using data_type = std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
                                          sdsl::bit_vector,
-                                         sdsl::sd_vector<>>;
+                                         detail::block_compressed_bitvector>;
 
     //!\brief The number of bins specified by the user.
     size_t bins{};
@@ -157,6 +388,10 @@ private:
     size_t hash_funs{};
     //!\brief The bitvector.
     data_type data{};
+    //!\brief The file the filter was loaded from; shared by all copies of a loaded filter.
+    std::shared_ptr<detail::memory_mapped_file const> mapping{};
+    //!\brief The words of the bitvector in `mapping`, or `nullptr` if the bitvector is stored in `data`.
+    uint64_t const * mapped_words{nullptr};
     //!\brief Precalculated seeds for multiplicative hashing. We use large irrational numbers for a uniform hashing.
     static constexpr std::array<size_t, 5> hash_seeds{13572355802537770549ULL, // 2**64 / (e/2)
                                                       13043817825332782213ULL, // 2**64 / sqrt(2)
@@ -164,6 +399,38 @@ private:
                                                       16499269484942379435ULL, // 2**64 / (sqrt(5)/2)
                                                       4893150838803335377ULL}; // 2**64 / (3*pi/5)
 
+    //!\brief Returns the words of the uncompressed bitvector, either from `data` or from the mapped file.
+    uint64_t const * words() const noexcept
+    {
+        return mapped_words != nullptr ? mapped_words : data.data();
+    }
+
+    //!\brief Copies the mapped bitvector into `data`, such that the filter does not refer to the file anymore.
+    void copy_mapped_words()
+    {
+        if (mapped_words == nullptr)
+            return;
+
+        data = sdsl::bit_vector(technical_bins * bin_size_);
+        std::memcpy(data.data(), mapped_words, (data.size() >> 6) * sizeof(uint64_t));
+        mapped_words = nullptr;
+        mapping.reset();
+    }
+
+    //!\brief Returns the header of the file written by store().
+    detail::bloom_filter_file_header file_header() const noexcept
+    {
+        detail::bloom_filter_file_header header{};
+        header.is_interleaved = true;
+        header.is_compressed = data_layout_mode_ == data_layout::compressed;
+        header.bins = bins;
+        header.technical_bins = technical_bins;
+        header.bin_size = bin_size_;
+        header.hash_shift = hash_shift;
+        header.hash_funs = hash_funs;
+        return header;
+    }
+
     /*!\brief Perturbs a value and fits it into the vector.
      * \param h The value to process.
      * \param seed The seed to use.
@@ -187,15 +454,140 @@ private:
         return h;
     }
 
+    /*!\brief Moves each row of `bin_words` words to its position in a layout with `new_bin_words` words per row.
+     * \param[in] new_bin_words The new number of words per row.
+     * \param[in] thread_count  The maximal number of threads to use.
+     *
+     * \details
+     *
+     * The rows are moved in place, i.e. `data` must be large enough for both layouts. Shrinking rows are moved front to
+     * back, growing rows back to front, and the words that grown rows gain are set to `0`. Rows are moved concurrently
+     * in waves: all targets of a wave lie before (shrinking) or behind (growing) all sources that are not yet moved.
+     * The number of rows per wave grows geometrically, hence a few waves move almost all rows.
+     */
+    void move_rows(size_t const new_bin_words, size_t const thread_count)
+    {
+        assert(mapped_words == nullptr);
+        assert(new_bin_words != bin_words);
+
+        uint64_t * const words = data.data();
+        size_t const copied_words = std::min(bin_words, new_bin_words);
+        size_t const chunk_rows = std::max<size_t>(1u, (1u << 16) / std::max(bin_words, new_bin_words));
+
+        // The threads are spawned once for all waves.
+        detail::chunk_thread_pool pool{std::min(thread_count, (bin_size_ + chunk_rows - 1u) / chunk_rows)};
+
+        auto move_wave = [&] (size_t const wave_begin, size_t const wave_end)
+        {
+            pool.for_each_chunk(wave_end - wave_begin, chunk_rows, [&] (size_t const begin, size_t const end)
+            {
+                for (size_t row = wave_begin + begin; row < wave_begin + end; ++row)
+                {
+                    uint64_t * const target = words + row * new_bin_words;
+                    std::memmove(target, words + row * bin_words, copied_words * sizeof(uint64_t));
+                    std::fill(target + copied_words, target + new_bin_words, 0u);
+                }
+            });
+        };
+
+        if (new_bin_words < bin_words)
+        {
+            // The targets of rows [begin, end) lie before the source of row `begin` iff end * new <= begin * old.
+            for (size_t begin = 1u, end{}; begin < bin_size_; begin = end)
+            {
+                end = std::clamp(begin * bin_words / new_bin_words, begin + 1u, bin_size_);
+                move_wave(begin, end);
+            }
+        }
+        else
+        {
+            // The targets of rows [begin, end) lie behind the source of row `end - 1` iff begin * new >= end * old.
+            for (size_t end = bin_size_, begin{}; end > 0u; end = begin)
+            {
+                begin = std::min((end * bin_words + new_bin_words - 1u) / new_bin_words, end - 1u);
+                move_wave(begin, end);
+            }
+        }
+    }
+
+    /*!\brief Keeps only the bins `kept_bins`, which become the bins `0, 1, ...`, and shrinks the rows accordingly.
+     * \param[in] kept_bins    The bins to keep in ascending order; must not be empty.
+     * \param[in] thread_count The maximal number of threads to use.
+     *
+     * \details
+     *
+     * First, each row is compacted within its own words, which is independent for all rows. Consecutive kept bins
+     * are copied together in pieces of 64 bits. Afterwards, the rows are moved to the new, narrower layout.
+     */
+    void compact_bins(std::vector<size_t> const & kept_bins, size_t const thread_count)
+    {
+        assert(mapped_words == nullptr);
+        assert(!kept_bins.empty() && std::ranges::is_sorted(kept_bins));
+
+        if (kept_bins.size() == bins)
+            return;
+
+        // Runs of consecutive kept bins as (first bin, number of bins).
+        std::vector<std::pair<size_t, size_t>> runs{};
+        for (size_t const bin : kept_bins)
+        {
+            if (!runs.empty() && runs.back().first + runs.back().second == bin)
+                ++runs.back().second;
+            else
+                runs.emplace_back(bin, 1u);
+        }
+
+        size_t const new_bin_words = (kept_bins.size() + 63u) >> 6;
+        uint64_t * const words = data.data();
+
+        detail::parallel_for_chunks(bin_size_,
+                                    std::max<size_t>(1u, (1u << 16) / bin_words),
+                                    thread_count,
+                                    [&] (size_t const begin, size_t const end)
+        {
+            std::vector<uint64_t> compacted(new_bin_words);
+            for (size_t row = begin; row < end; ++row)
+            {
+                std::ranges::fill(compacted, 0u);
+                uint64_t * const row_words = words + row * bin_words;
+
+                size_t target_bin{};
+                for (auto const & [first_bin, length] : runs)
+                {
+                    detail::or_bits(row_words, first_bin, compacted.data(), target_bin, length);
+                    target_bin += length;
+                }
+
+                std::ranges::copy(compacted, row_words);
+            }
+        });
+
+        if (new_bin_words != bin_words)
+        {
+            move_rows(new_bin_words, thread_count);
+            data.resize(bin_size_ * (new_bin_words << 6));
+        }
+
+        bins = kept_bins.size();
+        bin_words = new_bin_words;
+        technical_bins = new_bin_words << 6;
+    }
+
 public:
     //!\brief Indicates whether the Interleaved Bloom Filter is compressed.
     static constexpr data_layout data_layout_mode = data_layout_mode_;
 
+    //!\brief The value seqan3::interleaved_bloom_filter::remove_bins assigns to removed bins.
+    static constexpr size_t removed_bin{std::numeric_limits<size_t>::max()};
+
     class membership_agent_type; // documented upon definition below
 
     template <std::integral value_t>
     class counting_agent_type; // documented upon definition below
 
+    template <typename threshold_t, std::integral value_t>
+    class classification_agent_type; // documented upon definition below
+
     /*!\name Constructors, destructor and assignment
      * \{
      */
@@ -262,7 +654,7 @@ public:
         std::tie(bins, technical_bins, bin_size_, hash_shift, bin_words, hash_funs) =
             std::tie(ibf.bins, ibf.technical_bins, ibf.bin_size_, ibf.hash_shift, ibf.bin_words, ibf.hash_funs);
 
-        data = sdsl::sd_vector<>{ibf.data};
+        data = data_type{ibf.words(), ibf.bit_size()};
     }
     //!\}
 
@@ -281,12 +673,13 @@ public:
      *
      * \include test/snippet/search/dream_index/interleaved_bloom_filter_emplace.cpp
      */
-    void emplace(size_t const value, bin_index const bin) noexcept
+    void emplace(size_t const value, bin_index const bin)
     //!\cond
         requires (data_layout_mode == data_layout::uncompressed)
     //!\endcond
     {
         assert(bin.get() < bins);
+        copy_mapped_words();
         for (size_t i = 0; i < hash_funs; ++i)
         {
             size_t idx = hash_and_fit(value, hash_seeds[i]);
@@ -307,12 +700,13 @@ public:
      *
      * \include test/snippet/search/dream_index/interleaved_bloom_filter_clear.cpp
      */
-    void clear(bin_index const bin) noexcept
+    void clear(bin_index const bin)
     //!\cond
         requires (data_layout_mode == data_layout::uncompressed)
     //!\endcond
     {
         assert(bin.get() < bins);
+        copy_mapped_words();
         for (size_t idx = bin.get(), i = 0; i < bin_size_; idx += technical_bins, ++i)
             data[idx] = 0;
     }
@@ -334,7 +728,7 @@ public:
     //!\cond
         requires (data_layout_mode == data_layout::uncompressed)
     //!\endcond
-    void clear(rng_t && bin_range) noexcept
+    void clear(rng_t && bin_range)
     {
         static_assert(std::ranges::forward_range<rng_t>, "The range of bins to clear must model a forward_range.");
         static_assert(std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<rng_t>>, bin_index>,
@@ -343,6 +737,7 @@ public:
         for (auto && bin : bin_range)
             assert(bin.get() < bins);
 #endif // NDEBUG
+        copy_mapped_words();
 
         for (size_t offset = 0, i = 0; i < bin_size_; offset += technical_bins, ++i)
             for (auto && bin : bin_range)
@@ -350,7 +745,8 @@ public:
     }
 
     /*!\brief Increases the number of bins stored in the Interleaved Bloom Filter.
-     * \param[in] new_bins_ The new number of bins.
+     * \param[in] new_bins_    The new number of bins.
+     * \param[in] thread_count The maximal number of threads to use. Default 1.
      * \throws std::invalid_argument If passed number of bins is smaller than current number of bins.
      *
      * \attention This function is only available for **uncompressed** Interleaved Bloom Filters.
@@ -368,11 +764,17 @@ public:
      * If you want to add more bins while keeping the size constant, you need to rebuild the
      * `seqan3::interleaved_bloom_filter`.
      *
+     * The rows are moved within the enlarged bitvector by up to `thread_count` threads. Enlarging the bitvector
+     * reallocates it: unless the memory allocator can extend the allocation in place, the old and the new bitvector
+     * are held at the same time while the old one is copied, i.e. the peak memory usage is the old plus the new size,
+     * up to three times the old size when the `bin_words` double. The bitvector of a filter obtained by
+     * seqan3::interleaved_bloom_filter::load is copied directly into the enlarged bitvector.
+     *
      * ### Example
      *
      * \include test/snippet/search/dream_index/interleaved_bloom_filter_increase_bin_number_to.cpp
      */
-    void increase_bin_number_to(bin_count const new_bins_)
+    void increase_bin_number_to(bin_count const new_bins_, size_t const thread_count = 1u)
     //!\cond
         requires (data_layout_mode == data_layout::uncompressed)
     //!\endcond
@@ -391,27 +793,189 @@ public:
             return;
 
         size_t new_technical_bins = new_bin_words << 6;
-        size_t new_bits = bin_size_ * new_technical_bins;
 
-        size_t idx_{new_bits}, idx{data.size()};
-        size_t delta = new_technical_bins - technical_bins + 64;
+        if (mapped_words != nullptr) // Copy a loaded filter directly into the enlarged bitvector.
+        {
+            data_type enlarged(bin_size_ * new_technical_bins);
+            std::memcpy(enlarged.data(), mapped_words, bin_size_ * bin_words * sizeof(uint64_t));
+            data = std::move(enlarged);
+            mapped_words = nullptr;
+            mapping.reset();
+        }
+        else
+        {
+            data.resize(bin_size_ * new_technical_bins);
+        }
+
+        move_rows(new_bin_words, thread_count);
+
+        bin_words = new_bin_words;
+        technical_bins = new_technical_bins;
+    }
+
+    /*!\brief Decreases the number of bins stored in the Interleaved Bloom Filter by removing the last bins.
+     * \param[in] new_bins_    The new number of bins.
+     * \param[in] thread_count The maximal number of threads to use. Default 1.
+     * \throws std::invalid_argument If passed number of bins is 0 or greater than the current number of bins.
+     *
+     * \attention This function is only available for **uncompressed** Interleaved Bloom Filters.
+     * \attention This function invalidates all agents constructed for this Interleaved Bloom Filter.
+     *
+     * \details
+     *
+     * The bins `[new_bins, bin_count())` and their content are removed. If fewer 64-bit words are needed to represent
+     * the remaining bins, the `bin_words` and hence the size of the Interleaved Bloom Filter shrink, e.g. decreasing
+     * the bins from 73 to 40 halves the size. The rows are compacted in place by up to `thread_count` threads.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/interleaved_bloom_filter_remove_bins.cpp
+     */
+    void decrease_bin_number_to(bin_count const new_bins_, size_t const thread_count = 1u)
+    //!\cond
+        requires (data_layout_mode == data_layout::uncompressed)
+    //!\endcond
+    {
+        size_t const new_bins = new_bins_.get();
+
+        if (new_bins > bins)
+            throw std::invalid_argument{"The number of new bins must be <= the current number of bins."};
+        if (new_bins == 0u)
+            throw std::invalid_argument{"The number of bins must be > 0."};
+
+        copy_mapped_words();
 
-        data.resize(new_bits);
+        std::vector<size_t> kept_bins(new_bins);
+        std::iota(kept_bins.begin(), kept_bins.end(), size_t{0u});
+        compact_bins(kept_bins, thread_count);
+    }
 
-        for (size_t i = idx_, j = idx; j > 0; i -= new_technical_bins, j -= technical_bins)
+    /*!\brief Removes bins from the Interleaved Bloom Filter and renumbers the remaining bins.
+     * \tparam rng_t The type of the range. Must model std::ranges::forward_range and the reference type must be
+     *               seqan3::bin_index.
+     * \param[in] bin_range    The bins to remove; may contain duplicates.
+     * \param[in] thread_count The maximal number of threads to use. Default 1.
+     * \returns The new index of each old bin, or seqan3::interleaved_bloom_filter::removed_bin for removed bins.
+     * \throws std::invalid_argument If a bin index is out of range or all bins would be removed.
+     *
+     * \attention This function is only available for **uncompressed** Interleaved Bloom Filters.
+     * \attention This function invalidates all agents constructed for this Interleaved Bloom Filter.
+     *
+     * \details
+     *
+     * The remaining bins keep their order and are renumbered consecutively, i.e. the gaps of the removed bins are
+     * closed. Afterwards, the `bin_words` shrink like in seqan3::interleaved_bloom_filter::decrease_bin_number_to.
+     * The hash functions do not depend on the number of bins, hence the remaining bins stay valid.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/interleaved_bloom_filter_remove_bins.cpp
+     */
+    template <typename rng_t>
+    //!\cond
+        requires (data_layout_mode == data_layout::uncompressed)
+    //!\endcond
+    std::vector<size_t> remove_bins(rng_t && bin_range, size_t const thread_count = 1u)
+    {
+        static_assert(std::ranges::forward_range<rng_t>, "The range of bins to remove must model a forward_range.");
+        static_assert(std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<rng_t>>, bin_index>,
+                      "The reference type of the range to remove must be seqan3::bin_index.");
+
+        std::vector<size_t> new_index(bins, size_t{0u});
+        for (auto && bin : bin_range)
         {
-            size_t stop = i - new_technical_bins;
+            if (bin.get() >= bins)
+                throw std::invalid_argument{"The bin " + std::to_string(bin.get()) + " does not exist."};
+            new_index[bin.get()] = removed_bin;
+        }
 
-            for (size_t ii = i - delta, jj = j - 64; stop && ii >= stop; ii -= 64, jj -= 64)
+        std::vector<size_t> kept_bins{};
+        for (size_t bin = 0; bin < bins; ++bin)
+        {
+            if (new_index[bin] != removed_bin)
             {
-                uint64_t old = data.get_int(jj);
-                data.set_int(jj, 0);
-                data.set_int(ii, old);
+                new_index[bin] = kept_bins.size();
+                kept_bins.push_back(bin);
             }
         }
 
-        bin_words = new_bin_words;
-        technical_bins = new_technical_bins;
+        if (kept_bins.empty())
+            throw std::invalid_argument{"At least one bin must remain."};
+
+        copy_mapped_words();
+        compact_bins(kept_bins, thread_count);
+
+        return new_index;
+    }
+
+    /*!\brief Merges another Interleaved Bloom Filter into this one.
+     * \param[in] other        The Interleaved Bloom Filter to merge into this one.
+     * \param[in] mode         Whether the bins are united or appended, see seqan3::merge_mode.
+     * \param[in] thread_count The maximal number of threads to use. Default 1.
+     * \throws std::invalid_argument If the filters differ in their bin size or number of hash functions, or, for
+     *                               seqan3::merge_mode::unite_bins, in their number of bins.
+     *
+     * \attention This function is only available for **uncompressed** Interleaved Bloom Filters.
+     * \attention Appending bins invalidates all agents constructed for this Interleaved Bloom Filter.
+     *
+     * \details
+     *
+     * The hash functions only depend on the bin size and the number of hash functions. Hence, filters with the same
+     * parameters that were built independently, e.g. on different machines, can be merged without reinserting values:
+     *
+     *   * seqan3::merge_mode::unite_bins: Each bin contains the values of the same bin of both filters, e.g. if the
+     *     sequences of each bin were split into partitions.
+     *   * seqan3::merge_mode::append_bins: The bins of `other` follow the bins of this filter, i.e. bin `i` of `other`
+     *     becomes bin `bin_count() + i`, e.g. if each filter covers a different range of bins.
+     *
+     * The rows are merged by up to `thread_count` threads. To merge filters stored in files without loading them, see
+     * seqan3::merge_interleaved_bloom_filter_files.
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/interleaved_bloom_filter_merge.cpp
+     */
+    void merge(interleaved_bloom_filter const & other, merge_mode const mode, size_t const thread_count = 1u)
+    //!\cond
+        requires (data_layout_mode == data_layout::uncompressed)
+    //!\endcond
+    {
+        if (bin_size_ != other.bin_size_ || hash_funs != other.hash_funs)
+            throw std::invalid_argument{"Only Interleaved Bloom Filters with the same bin size and number of hash "
+                                        "functions can be merged."};
+        if (mode == merge_mode::unite_bins && bins != other.bins)
+            throw std::invalid_argument{"Uniting bins requires Interleaved Bloom Filters with the same number of "
+                                        "bins."};
+
+        if (this == &other)
+        {
+            interleaved_bloom_filter const copy{other};
+            merge(copy, mode, thread_count);
+            return;
+        }
+
+        copy_mapped_words();
+
+        size_t const first_bin = mode == merge_mode::unite_bins ? 0u : bins;
+        if (mode == merge_mode::append_bins)
+            increase_bin_number_to(seqan3::bin_count{bins + other.bins}, thread_count);
+
+        uint64_t const * const source = other.words();
+        uint64_t * const target = data.data();
+
+        detail::parallel_for_chunks(bin_size_,
+                                    std::max<size_t>(1u, (1u << 16) / bin_words),
+                                    thread_count,
+                                    [&] (size_t const begin, size_t const end)
+        {
+            detail::or_rows(source + begin * other.bin_words,
+                            other.bin_words,
+                            other.bins,
+                            target + begin * bin_words,
+                            bin_words,
+                            first_bin,
+                            end - begin);
+        });
     }
     //!\}
 
@@ -450,6 +1014,33 @@ public:
     {
         return counting_agent_type<value_t>{*this};
     }
+
+    /*!\brief Returns a seqan3::interleaved_bloom_filter::classification_agent_type to be used for determining the bins
+     *        that contain at least a threshold of values.
+     * \tparam value_t     The type of the counters. Default uint16_t.
+     * \tparam threshold_t The type of the threshold model; must model std::regular_invocable with `size_t` and return
+     *                     a type convertible to `size_t`.
+     * \param[in] threshold The threshold model, e.g. seqan3::kmer_lemma_threshold. It is called with the number of
+     *                      values of a query and returns the minimal number of values a bin must contain.
+     * \attention Calling seqan3::interleaved_bloom_filter::increase_bin_number_to invalidates all
+     * `seqan3::interleaved_bloom_filter::classification_agent_type`s constructed for this Interleaved Bloom Filter.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/search/dream_index/classification_agent.cpp
+     * \sa seqan3::interleaved_bloom_filter::classification_agent_type::bulk_classify
+     */
+    template <typename value_t = uint16_t, typename threshold_t>
+    //!\cond
+        requires std::regular_invocable<threshold_t const &, size_t> &&
+                 std::convertible_to<std::invoke_result_t<threshold_t const &, size_t>, size_t>
+    //!\endcond
+    classification_agent_type<threshold_t, value_t> classification_agent(threshold_t threshold) const
+    {
+        return classification_agent_type<threshold_t, value_t>{*this, std::move(threshold)};
+    }
     //!\}
 
     /*!\name Capacity
@@ -484,7 +1075,7 @@ public:
      */
     size_t bit_size() const noexcept
     {
-        return data.size();
+        return technical_bins * bin_size_;
     }
     //!\}
 
@@ -498,10 +1089,18 @@ public:
      */
     friend bool operator==(interleaved_bloom_filter const & lhs, interleaved_bloom_filter const & rhs) noexcept
     {
-        return std::tie(lhs.bins, lhs.technical_bins, lhs.bin_size_, lhs.hash_shift, lhs.bin_words, lhs.hash_funs,
-                        lhs.data) ==
-               std::tie(rhs.bins, rhs.technical_bins, rhs.bin_size_, rhs.hash_shift, rhs.bin_words, rhs.hash_funs,
-                        rhs.data);
+        if (std::tie(lhs.bins, lhs.technical_bins, lhs.bin_size_, lhs.hash_shift, lhs.bin_words, lhs.hash_funs) !=
+            std::tie(rhs.bins, rhs.technical_bins, rhs.bin_size_, rhs.hash_shift, rhs.bin_words, rhs.hash_funs))
+            return false;
+
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            // The bit size is a multiple of 64.
+            if (lhs.mapped_words != nullptr || rhs.mapped_words != nullptr)
+                return std::equal(lhs.words(), lhs.words() + (lhs.bit_size() >> 6), rhs.words());
+        }
+
+        return lhs.data == rhs.data;
     }
 
     /*!\brief Test for inequality.
@@ -521,6 +1120,9 @@ public:
     /*!\brief Provides direct, unsafe access to the underlying data structure.
      * \returns A reference to an SDSL bitvector.
      *
+     * \attention The bitvector of an Interleaved Bloom Filter that was loaded with
+     *            seqan3::interleaved_bloom_filter::load is not stored in the returned data structure.
+     *
      * \details
      *
      * \noapi{The exact representation of the data is implementation defined.}
@@ -537,6 +1139,106 @@ public:
     }
     //!\}
 
+    /*!\name Storage
+     * \{
+     */
+    /*!\brief Stores the Interleaved Bloom Filter in a binary file that can be loaded with
+     *        seqan3::interleaved_bloom_filter::load.
+     * \param[in] path The file to write.
+     * \throws std::filesystem::filesystem_error if the file cannot be written.
+     *
+     * \details
+     *
+     * The file consists of a small header and the bitvector. The bitvector of an uncompressed Interleaved Bloom Filter
+     * is stored as raw 64-bit words that are aligned to a page.
+     * In contrast to \ref serialisation "cereal", no additional library is needed to store and load the filter.
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the Interleaved Bloom Filter.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    void store(std::filesystem::path const & path) const
+    {
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            if (mapped_words != nullptr)
+            {
+                interleaved_bloom_filter tmp{*this};
+                tmp.copy_mapped_words();
+                detail::store_bloom_filter_file(path, file_header(), tmp.data);
+                return;
+            }
+        }
+
+        detail::store_bloom_filter_file(path, file_header(), data);
+    }
+
+    /*!\brief Loads an Interleaved Bloom Filter that was stored with seqan3::interleaved_bloom_filter::store.
+     * \param[in] path The file to read.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened.
+     * \throws std::runtime_error if the file does not contain a seqan3 Bloom Filter, is truncated or is corrupted.
+     * \throws std::logic_error if the stored filter does not match the data layout of this filter.
+     *
+     * \details
+     *
+     * The file is mapped into memory as a shared, read-only mapping. An uncompressed Interleaved Bloom Filter is
+     * queried directly on the mapping, i.e. the bitvector is not copied and pages are only read from disk when a query
+     * accesses them. All processes that load the same file share one copy of it in the page cache of the operating
+     * system. Copies of the loaded Interleaved Bloom Filter share the mapping as well.
+     *
+     * Functions that modify the loaded uncompressed Interleaved Bloom Filter, e.g.
+     * seqan3::interleaved_bloom_filter::emplace, seqan3::interleaved_bloom_filter::clear and
+     * seqan3::interleaved_bloom_filter::increase_bin_number_to, as well as \ref serialisation "cereal" copy the
+     * bitvector into memory first. Hence, the first modification of a loaded filter must not run concurrently with
+     * other accesses. The file must not be modified while it is mapped.
+     *
+     * The bitvector of a compressed Interleaved Bloom Filter is copied from the mapping into memory.
+     *
+     * ### Complexity
+     *
+     * Constant for an uncompressed Interleaved Bloom Filter, linear in the size of the filter otherwise.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee.
+     */
+    void load(std::filesystem::path const & path)
+    {
+        detail::mapped_bloom_filter_file file = detail::map_bloom_filter_file(path, file_header());
+        detail::bloom_filter_file_header const & header = file.header;
+
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            data = data_type{};
+            mapped_words = reinterpret_cast<uint64_t const *>(file.payload());
+            mapping = std::move(file.file);
+        }
+        else
+        {
+            detail::memory_mapped_streambuf buffer{file.payload(), header.payload_bytes};
+            std::istream in{&buffer};
+            data_type loaded{};
+            loaded.load(in);
+
+            if (loaded.size() != header.bin_size * header.technical_bins)
+                throw std::runtime_error{"The file " + path.string() + " is corrupted."};
+
+            data = std::move(loaded);
+        }
+
+        bins = header.bins;
+        technical_bins = header.technical_bins;
+        bin_size_ = header.bin_size;
+        hash_shift = header.hash_shift;
+        bin_words = header.technical_bins >> 6;
+        hash_funs = header.hash_funs;
+    }
+    //!\}
+
     /*!\cond DEV
      * \brief Serialisation support function.
      * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
@@ -547,6 +1249,9 @@ public:
     template <cereal_archive archive_t>
     void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
     {
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+            copy_mapped_words();
+
         archive(bins);
         archive(technical_bins);
         archive(bin_size_);
@@ -634,17 +1339,31 @@ public:
         for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
             bloom_filter_indices[i] = ibf_ptr->hash_and_fit(value, bloom_filter_indices[i]);
 
-        for (size_t batch = 0; batch < ibf_ptr->bin_words; ++batch)
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            // The rows start at multiples of 64 bits and can be combined word-wise with vector instructions.
+            std::array<uint64_t const *, 5> rows;
+            for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+            {
+                assert(bloom_filter_indices[i] < ibf_ptr->bit_size());
+                rows[i] = ibf_ptr->words() + (bloom_filter_indices[i] >> 6);
+            }
+
+            detail::bitwise_and_rows<simd::simd_type_t<uint64_t>>(rows,
+                                                                  ibf_ptr->hash_funs,
+                                                                  ibf_ptr->bin_words,
+                                                                  result_buffer.data.data());
+        }
+        else
         {
-           size_t tmp{-1ULL};
-           for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
-           {
-               assert(bloom_filter_indices[i] < ibf_ptr->data.size());
-               tmp &= ibf_ptr->data.get_int(bloom_filter_indices[i]);
-               bloom_filter_indices[i] += 64;
-           }
-
-           result_buffer.data.set_int(batch << 6, tmp);
+            // The rows are decoded block-wise directly into the result.
+            uint64_t * result = result_buffer.data.data();
+            ibf_ptr->data.decode_words(bloom_filter_indices[0] >> 6, ibf_ptr->bin_words, result);
+            for (size_t i = 1; i < ibf_ptr->hash_funs; ++i)
+            {
+                assert(bloom_filter_indices[i] < ibf_ptr->bit_size());
+                ibf_ptr->data.and_words(bloom_filter_indices[i] >> 6, ibf_ptr->bin_words, result);
+            }
         }
 
         return result_buffer;
@@ -912,6 +1631,59 @@ private:
     //!\brief Store a seqan3::interleaved_bloom_filter::membership_agent to call `bulk_contains`.
     membership_agent_type membership_agent;
 
+    //!\brief The number of bit-planes of the vertical counters; they count up to `2^plane_count - 1` values.
+    static constexpr size_t plane_count{8u};
+    //!\brief The number of values whose rows are prefetched before they are counted.
+    static constexpr size_t prefetch_distance{4u};
+
+    //!\brief Spreads the bits of a byte to the lowest bit of the bytes of a 64-bit integer.
+    static constexpr std::array<uint64_t, 256> spread_byte = [] ()
+    {
+        std::array<uint64_t, 256> table{};
+        for (size_t byte = 0; byte < 256u; ++byte)
+            for (size_t bit = 0; bit < 8u; ++bit)
+                table[byte] |= static_cast<uint64_t>((byte >> bit) & 1u) << (bit * 8u);
+        return table;
+    }();
+
+    //!\brief The vertical counters: `plane_count` bit-planes of `bin_words` words each.
+    std::vector<uint64_t> bit_planes{};
+
+    /*!\brief Adds the vertical counters to `result_buffer` and resets them.
+     *
+     * \details
+     *
+     * The bit-planes of 8 bins are transposed with a lookup table into a 64-bit integer holding one 8-bit counter per
+     * bin, i.e. one table lookup and shift per plane instead of one operation per bit and plane.
+     */
+    void flush_bit_planes() noexcept
+    {
+        size_t const words = ibf_ptr->bin_words;
+        size_t const bins = result_buffer.size();
+
+        for (size_t word = 0; word < words; ++word)
+        {
+            uint64_t any{};
+            for (size_t plane = 0; plane < plane_count; ++plane)
+                any |= bit_planes[plane * words + word];
+
+            if (any == 0u)
+                continue;
+
+            for (size_t group = 0; group < 8u; ++group)
+            {
+                uint64_t counters{};
+                for (size_t plane = 0; plane < plane_count; ++plane)
+                    counters += spread_byte[(bit_planes[plane * words + word] >> (group * 8u)) & 0xFFu] << plane;
+
+                for (size_t bin = (word << 6) + group * 8u; counters != 0u && bin < bins; ++bin, counters >>= 8)
+                    result_buffer[bin] += static_cast<value_t>(counters & 0xFFu);
+            }
+        }
+
+        std::ranges::fill(bit_planes, 0u);
+    }
+
 public:
     /*!\name Constructors, destructor and assignment
      * \{
@@ -928,7 +1700,10 @@ public:
      * \param ibf The seqan3::interleaved_bloom_filter.
      */
     explicit counting_agent_type(ibf_t const & ibf) :
-        ibf_ptr(std::addressof(ibf)), membership_agent(ibf), result_buffer(ibf.bin_count())
+        ibf_ptr(std::addressof(ibf)),
+        membership_agent(ibf),
+        bit_planes(plane_count * ibf.bin_words),
+        result_buffer(ibf.bin_count())
     {}
     //!\}
 
@@ -948,6 +1723,11 @@ public:
      *
      * \details
      *
+     * For the uncompressed seqan3::interleaved_bloom_filter, the values are processed as a batch: the rows of the
+     * next values are prefetched while the current value is counted, and the hits are accumulated in bit-sliced
+     * counters that are added to the result every 255 values. The result is the same as adding up the results of
+     * seqan3::interleaved_bloom_filter::membership_agent_type::bulk_contains.
+     *
      * ### Example
      *
      * \include test/snippet/search/dream_index/counting_agent.cpp
@@ -969,8 +1749,63 @@ public:
 
         std::ranges::fill(result_buffer, 0);
 
-        for (auto && value : values)
-            result_buffer += membership_agent.bulk_contains(value);
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            assert(bit_planes.size() == plane_count * ibf_ptr->bin_words);
+
+            using rows_t = std::array<uint64_t const *, 5>;
+            std::array<rows_t, prefetch_distance> pending{};
+            size_t pending_begin{0u};
+            size_t pending_size{0u};
+            size_t block_size{0u}; // The number of values added to the bit-planes since the last flush.
+
+            auto count_pending = [&] ()
+            {
+                ++block_size;
+                detail::add_bitwise_and_to_bit_planes<simd::simd_type_t<uint64_t>>(pending[pending_begin],
+                                                                                   ibf_ptr->hash_funs,
+                                                                                   ibf_ptr->bin_words,
+                                                                                   bit_planes.data(),
+                                                                                   std::bit_width(block_size));
+                pending_begin = (pending_begin + 1u) % prefetch_distance;
+                --pending_size;
+
+                if (block_size == (1u << plane_count) - 1u)
+                {
+                    flush_bit_planes();
+                    block_size = 0u;
+                }
+            };
+
+            for (auto && value : values)
+            {
+                if (pending_size == prefetch_distance)
+                    count_pending();
+
+                rows_t & rows = pending[(pending_begin + pending_size) % prefetch_distance];
+                for (size_t i = 0; i < ibf_ptr->hash_funs; ++i)
+                {
+                    size_t const idx = ibf_ptr->hash_and_fit(value, ibf_ptr->hash_seeds[i]);
+                    assert(idx < ibf_ptr->bit_size());
+                    rows[i] = ibf_ptr->words() + (idx >> 6);
+#if defined(__GNUC__)
+                    __builtin_prefetch(rows[i]);
+#endif // defined(__GNUC__)
+                }
+                ++pending_size;
+            }
+
+            while (pending_size > 0u)
+                count_pending();
+
+            if (block_size > 0u)
+                flush_bit_planes();
+        }
+        else
+        {
+            for (auto && value : values)
+                result_buffer += membership_agent.bulk_contains(value);
+        }
 
         return result_buffer;
     }
@@ -983,4 +1818,180 @@ public:
 
 };
 
+/*!\brief Determines the bins of the seqan3::interleaved_bloom_filter that contain at least a threshold of the values
+ *        of a query.
+ * \tparam threshold_t The type of the threshold model.
+ * \tparam value_t     The type of the counters; must model std::integral.
+ * \attention Calling seqan3::interleaved_bloom_filter::increase_bin_number_to invalidates the
+ *            classification_agent_type.
+ *
+ * \details
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/classification_agent.cpp
+ */
+template <data_layout data_layout_mode>
+template <typename threshold_t, std::integral value_t>
+class interleaved_bloom_filter<data_layout_mode>::classification_agent_type
+{
+private:
+    //!\brief The type of the augmented seqan3::interleaved_bloom_filter.
+    using ibf_t = interleaved_bloom_filter<data_layout_mode>;
+
+    //!\brief A pointer to the augmented seqan3::interleaved_bloom_filter.
+    ibf_t const * ibf_ptr{nullptr};
+
+    //!\brief The threshold model.
+    threshold_t threshold{};
+
+    //!\brief Counts the values that can not decide any bin.
+    counting_agent_type<value_t> counting_agent;
+
+    //!\brief Determines the membership of the remaining values.
+    membership_agent_type membership_agent;
+
+    //!\brief The bins that are neither known to reach nor known to miss the threshold, one bit per bin.
+    std::vector<uint64_t> undecided{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    classification_agent_type() = default; //!< Defaulted.
+    classification_agent_type(classification_agent_type const &) = default; //!< Defaulted.
+    classification_agent_type & operator=(classification_agent_type const &) = default; //!< Defaulted.
+    classification_agent_type(classification_agent_type &&) = default; //!< Defaulted.
+    classification_agent_type & operator=(classification_agent_type &&) = default; //!< Defaulted.
+    ~classification_agent_type() = default; //!< Defaulted.
+
+    /*!\brief Construct a classification_agent_type for an existing seqan3::interleaved_bloom_filter.
+     * \private
+     * \param ibf        The seqan3::interleaved_bloom_filter.
+     * \param threshold_ The threshold model.
+     */
+    classification_agent_type(ibf_t const & ibf, threshold_t threshold_) :
+        ibf_ptr(std::addressof(ibf)),
+        threshold(std::move(threshold_)),
+        counting_agent(ibf),
+        membership_agent(ibf),
+        undecided(ibf.bin_words)
+    {}
+    //!\}
+
+    //!\brief Stores the result of bulk_classify().
+    std::vector<size_t> result_buffer{};
+
+    /*!\name Classification
+     * \{
+     */
+    /*!\brief Determines the bins that contain at least `threshold(n)` of the `n` values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::forward_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     * \returns The indices of the bins that reach the threshold in increasing order.
+     *
+     * \attention The result of this function must always be bound via reference, e.g. `auto &`, to prevent copying.
+     * \attention Sequential calls to this function invalidate the previously returned reference.
+     *
+     * \details
+     *
+     * The result is the same as selecting the bins whose count of
+     * seqan3::interleaved_bloom_filter::counting_agent_type::bulk_count is at least `t = threshold(n)`.
+     *
+     * As long as at least `t` values are left, every bin can still reach the threshold. These first `n - t` values are
+     * counted in a batch with seqan3::interleaved_bloom_filter::counting_agent_type::bulk_count. For each of the last
+     * `t` values, only the undecided bins are updated: a bin is decided once its count reaches `t` or once the
+     * remaining values do not suffice to reach `t`. The query stops as soon as all bins are decided, e.g. for a query
+     * that does not occur in the Interleaved Bloom Filter shortly after the first `n - t` values.
+     *
+     * ### Exceptions
+     *
+     * Basic exception guarantee. Growing the result may throw std::bad_alloc, and the threshold may throw.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are not thread safe, please create a
+     * seqan3::interleaved_bloom_filter::classification_agent_type for each thread.
+     */
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<size_t> const & bulk_classify(value_range_t && values) &
+    {
+        assert(ibf_ptr != nullptr);
+
+        static_assert(std::ranges::forward_range<value_range_t>, "The values must model forward_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        result_buffer.clear();
+
+        size_t const bins = ibf_ptr->bin_count();
+        size_t const value_count = std::ranges::distance(values);
+        size_t const min_count = threshold(value_count);
+
+        if (min_count > value_count)
+            return result_buffer;
+
+        // The first values can not decide any bin.
+        auto it = std::ranges::begin(values);
+        auto const undecided_end = std::ranges::next(it, value_count - min_count);
+        counting_vector<value_t> & counts = counting_agent.result_buffer;
+        (void) counting_agent.bulk_count(std::ranges::subrange{it, undecided_end});
+        it = undecided_end;
+
+        std::ranges::fill(undecided, 0u);
+        size_t undecided_words{0u};
+        for (size_t bin = 0; bin < bins; ++bin)
+        {
+            if (static_cast<size_t>(counts[bin]) >= min_count)
+                result_buffer.push_back(bin);
+            else
+                undecided[bin >> 6] |= 1ULL << (bin & 63u);
+        }
+
+        for (uint64_t const word : undecided)
+            undecided_words += word != 0u;
+
+        // A bin is undecided iff `min_count - remaining <= count < min_count`.
+        for (size_t remaining = min_count; remaining > 0u && undecided_words > 0u; ++it)
+        {
+            --remaining;
+            uint64_t const * hits = membership_agent.bulk_contains(*it).raw_data().data();
+
+            for (size_t word = 0; word < undecided.size(); ++word)
+            {
+                uint64_t open = undecided[word];
+                if (open == 0u)
+                    continue;
+
+                uint64_t const hit = hits[word];
+                for (uint64_t bits = open; bits != 0u; bits &= bits - 1u)
+                {
+                    size_t const offset = std::countr_zero(bits);
+                    size_t const bin = (word << 6) + offset;
+                    size_t const count = counts[bin] += (hit >> offset) & 1u;
+
+                    if (count >= min_count)
+                        result_buffer.push_back(bin);
+
+                    if (count >= min_count || count + remaining < min_count)
+                        open &= ~(1ULL << offset);
+                }
+
+                undecided[word] = open;
+                undecided_words -= open == 0u;
+            }
+        }
+
+        std::ranges::sort(result_buffer);
+        return result_buffer;
+    }
+
+    // `bulk_classify` cannot be called on a temporary, since the object the returned reference points to
+    // is immediately destroyed.
+    template <std::ranges::range value_range_t>
+    [[nodiscard]] std::vector<size_t> const & bulk_classify(value_range_t && values) && = delete;
+    //!\}
+};
+
 } // namespace seqan3
@@ -0,0 +1,221 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::interleaved_bloom_filter_builder.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/search/views/minimiser_hash.hpp>
+#include <seqan3/utility/parallel/detail/parallel_for_chunks.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Fills the bins of a seqan3::interleaved_bloom_filter with the minimisers of the given sequences in parallel.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * The builder takes a std::ranges::random_access_range with one element per bin. Each element is a range of
+ * sequences, whose hash values are computed with seqan3::views::minimiser_hash using the shape, window size and seed
+ * of the builder, and inserted into the respective bin.
+ *
+ * The element of a bin is accessed only by the thread that fills the bin. Hence, the input can be a lazy view, e.g.
+ * a std::views::transform over a list of files that opens the files of a bin when it is accessed.
+ *
+ * ### Thread safety
+ *
+ * Concurrent calls to seqan3::interleaved_bloom_filter::emplace are safe iff each thread handles a multiple of
+ * wordsize (=64) many bins. The builder therefore splits the bins into chunks of 64 consecutive bins. Whenever a
+ * thread has finished a chunk, it takes the next chunk that has not been started by any thread. This way, threads that
+ * fill small bins take over the remaining chunks of threads that fill large bins. At most
+ * \f$\lceil bin\_count / 64 \rceil\f$ threads are used.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/interleaved_bloom_filter_builder.cpp
+ */
+class interleaved_bloom_filter_builder
+{
+private:
+    //!\brief The number of bins that share one word of a row of the Interleaved Bloom Filter.
+    static constexpr size_t chunk_size{64u};
+
+    //!\brief The shape used for hashing.
+    seqan3::shape shape_{};
+    //!\brief The window size used for computing minimisers.
+    seqan3::window_size window_size_{};
+    //!\brief The seed used for computing minimisers.
+    seqan3::seed seed_{0x8F3F73B5CF1C9ADE};
+    //!\brief The number of threads.
+    size_t thread_count_{1u};
+
+    //!\brief Inserts the minimisers of all sequences of `bins[bin_idx]` into bin `bin_idx` of `ibf`.
+    template <typename bins_t>
+    void fill_bin(interleaved_bloom_filter<data_layout::uncompressed> & ibf, bins_t & bins, size_t const bin_idx) const
+    {
+        for (auto && sequence : bins[bin_idx])
+            for (uint64_t const hash : sequence | views::minimiser_hash(shape_, window_size_, seed_))
+                ibf.emplace(hash, bin_index{bin_idx});
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    interleaved_bloom_filter_builder() = default; //!< Defaulted.
+    interleaved_bloom_filter_builder(interleaved_bloom_filter_builder const &) = default; //!< Defaulted.
+    interleaved_bloom_filter_builder(interleaved_bloom_filter_builder &&) = default; //!< Defaulted.
+    interleaved_bloom_filter_builder & operator=(interleaved_bloom_filter_builder const &) = default; //!< Defaulted.
+    interleaved_bloom_filter_builder & operator=(interleaved_bloom_filter_builder &&) = default; //!< Defaulted.
+    ~interleaved_bloom_filter_builder() = default; //!< Defaulted.
+
+    /*!\brief Construct a builder that uses the given parameters for seqan3::views::minimiser_hash.
+     * \param[in] shape        The seqan3::shape to use for hashing.
+     * \param[in] window_size  The window size to use.
+     * \param[in] seed         The seed to use.
+     * \param[in] thread_count The number of threads to use. Must be at least 1.
+     * \throws std::invalid_argument if the size of the shape is greater than the `window_size` or `thread_count` is 0.
+     */
+    interleaved_bloom_filter_builder(seqan3::shape const & shape,
+                                     seqan3::window_size const window_size,
+                                     seqan3::seed const seed,
+                                     size_t const thread_count = 1u) :
+        shape_{shape}, window_size_{window_size}, seed_{seed}, thread_count_{thread_count}
+    {
+        if (shape_.size() > window_size_.get())
+            throw std::invalid_argument{"The size of the shape cannot be greater than the window size."};
+
+        if (thread_count_ == 0u)
+            throw std::invalid_argument{"The number of threads must be at least 1."};
+    }
+
+    /*!\brief Construct a builder that uses the given parameters and the default seed for seqan3::views::minimiser_hash.
+     * \param[in] shape        The seqan3::shape to use for hashing.
+     * \param[in] window_size  The window size to use.
+     * \param[in] thread_count The number of threads to use. Must be at least 1.
+     * \throws std::invalid_argument if the size of the shape is greater than the `window_size` or `thread_count` is 0.
+     */
+    interleaved_bloom_filter_builder(seqan3::shape const & shape,
+                                     seqan3::window_size const window_size,
+                                     size_t const thread_count = 1u) :
+        interleaved_bloom_filter_builder{shape, window_size, seqan3::seed{0x8F3F73B5CF1C9ADE}, thread_count}
+    {}
+    //!\}
+
+    /*!\brief Inserts the minimisers of the sequences of each bin into the given Interleaved Bloom Filter.
+     * \tparam bins_t The type of the per-bin input; must model std::ranges::random_access_range and
+     *                std::ranges::sized_range. Its reference type must model std::ranges::input_range over ranges
+     *                that model std::ranges::forward_range over a seqan3::semialphabet.
+     * \param[in,out] ibf  The seqan3::interleaved_bloom_filter to fill.
+     * \param[in]     bins The sequences of each bin; `bins[i]` is inserted into bin `i`.
+     * \throws std::invalid_argument if `bins` has more elements than `ibf` has bins.
+     *
+     * \details
+     *
+     * Exceptions thrown while filling a bin are rethrown after all threads have finished.
+     *
+     * ### Complexity
+     *
+     * Linear in the total length of the sequences, divided by the number of threads.
+     *
+     * ### Thread safety
+     *
+     * `ibf` must not be accessed by other threads during the call.
+     */
+    template <std::ranges::random_access_range bins_t>
+    //!\cond
+        requires std::ranges::sized_range<bins_t> &&
+                 std::ranges::input_range<std::ranges::range_reference_t<bins_t>> &&
+                 std::ranges::forward_range<std::ranges::range_reference_t<std::ranges::range_reference_t<bins_t>>> &&
+                 semialphabet<std::ranges::range_reference_t<std::ranges::range_reference_t<
+                                                             std::ranges::range_reference_t<bins_t>>>>
+    //!\endcond
+    void insert(interleaved_bloom_filter<data_layout::uncompressed> & ibf, bins_t && bins) const
+    {
+        size_t const bin_count = std::ranges::size(bins);
+
+        if (bin_count > ibf.bin_count())
+            throw std::invalid_argument{"The number of inputs must not exceed the number of bins."};
+
+        // A loaded filter is copied into memory before the threads emplace into it.
+        ibf.copy_mapped_words();
+
+        detail::parallel_for_chunks(bin_count, chunk_size, thread_count_, [&] (size_t const begin, size_t const end)
+        {
+            for (size_t bin_idx = begin; bin_idx < end; ++bin_idx)
+                fill_bin(ibf, bins, bin_idx);
+        });
+    }
+
+    /*!\brief Constructs an Interleaved Bloom Filter with one bin per element of `bins` and fills it.
+     * \tparam bins_t The type of the per-bin input; see seqan3::interleaved_bloom_filter_builder::insert.
+     * \param[in] bins      The sequences of each bin; `bins[i]` is inserted into bin `i`.
+     * \param[in] size      The seqan3::bin_size of the Interleaved Bloom Filter.
+     * \param[in] funs      The seqan3::hash_function_count of the Interleaved Bloom Filter.
+     * \returns The filled seqan3::interleaved_bloom_filter.
+     * \throws std::logic_error if the parameters are not valid for a seqan3::interleaved_bloom_filter.
+     *
+     * \details
+     *
+     * The result is identical to an Interleaved Bloom Filter that was filled by calling
+     * seqan3::interleaved_bloom_filter::emplace for every minimiser of every bin in a single thread.
+     */
+    template <std::ranges::random_access_range bins_t>
+    //!\cond
+        requires std::ranges::sized_range<bins_t> &&
+                 std::ranges::input_range<std::ranges::range_reference_t<bins_t>> &&
+                 std::ranges::forward_range<std::ranges::range_reference_t<std::ranges::range_reference_t<bins_t>>> &&
+                 semialphabet<std::ranges::range_reference_t<std::ranges::range_reference_t<
+                                                             std::ranges::range_reference_t<bins_t>>>>
+    //!\endcond
+    interleaved_bloom_filter<data_layout::uncompressed> build(bins_t && bins,
+                                                              bin_size const size,
+                                                              hash_function_count const funs = hash_function_count{2u})
+        const
+    {
+        interleaved_bloom_filter ibf{bin_count{std::ranges::size(bins)}, size, funs};
+        insert(ibf, bins);
+        return ibf;
+    }
+
+    //!\brief Returns the shape used for hashing.
+    seqan3::shape const & shape() const noexcept
+    {
+        return shape_;
+    }
+
+    //!\brief Returns the window size used for computing minimisers.
+    seqan3::window_size window_size() const noexcept
+    {
+        return window_size_;
+    }
+
+    //!\brief Returns the seed used for computing minimisers.
+    seqan3::seed seed() const noexcept
+    {
+        return seed_;
+    }
+
+    //!\brief Returns the number of threads.
+    size_t thread_count() const noexcept
+    {
+        return thread_count_;
+    }
+};
+
+} // namespace seqan3
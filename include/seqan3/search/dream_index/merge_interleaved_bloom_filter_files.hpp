@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::merge_interleaved_bloom_filter_files.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include <seqan3/search/dream_index/detail/bloom_filter_file.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/utility/parallel/detail/parallel_for_chunks.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Merges uncompressed Interleaved Bloom Filters stored in files into a new file without loading them.
+ * \ingroup search_dream_index
+ * \param[in] input_paths  The files written by seqan3::interleaved_bloom_filter::store; must not be empty.
+ * \param[in] output_path  The file to write; must not be one of the input files.
+ * \param[in] mode         Whether the bins are united or appended, see seqan3::merge_mode.
+ * \param[in] thread_count The maximal number of threads to use. Default 1.
+ * \throws std::invalid_argument If no input is given, the output is an input, or the filters differ in their bin size
+ *                               or number of hash functions, or, for seqan3::merge_mode::unite_bins, in their number
+ *                               of bins.
+ * \throws std::filesystem::filesystem_error If a file cannot be opened or written.
+ * \throws std::runtime_error or std::logic_error If an input does not contain an uncompressed Interleaved Bloom Filter,
+ *                                                see seqan3::interleaved_bloom_filter::load.
+ *
+ * \details
+ *
+ * The result is the same as loading the first filter and calling seqan3::interleaved_bloom_filter::merge with each of
+ * the other filters in order, followed by seqan3::interleaved_bloom_filter::store. Instead, the inputs are mapped into
+ * memory and read once from front to back, and the output is written in batches of rows. Hence, only one batch of
+ * about 8 MiB of the output is held in memory, and the operating system can drop pages of the inputs that were
+ * read. The rows of a batch are merged by up to `thread_count` threads, which are spawned once for all
+ * batches.
+ *
+ * On platforms without `mmap`, the inputs are read into memory.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/dream_index/merge_interleaved_bloom_filter_files.cpp
+ */
+inline void merge_interleaved_bloom_filter_files(std::vector<std::filesystem::path> const & input_paths,
+                                                 std::filesystem::path const & output_path,
+                                                 merge_mode const mode,
+                                                 size_t const thread_count = 1u)
+{
+    if (input_paths.empty())
+        throw std::invalid_argument{"At least one Interleaved Bloom Filter must be given."};
+
+    detail::bloom_filter_file_header expected{};
+    expected.is_interleaved = true;
+
+    std::vector<detail::mapped_bloom_filter_file> inputs{};
+    std::vector<size_t> first_bins{};
+    size_t bins{};
+
+    for (std::filesystem::path const & path : input_paths)
+    {
+        if (std::filesystem::exists(output_path) && std::filesystem::equivalent(path, output_path))
+            throw std::invalid_argument{"The output file " + output_path.string() + " must not be an input file."};
+
+        detail::mapped_bloom_filter_file & input = inputs.emplace_back(detail::map_bloom_filter_file(path, expected));
+        detail::bloom_filter_file_header const & header = input.header;
+        detail::bloom_filter_file_header const & first = inputs.front().header;
+
+        if (header.bin_size != first.bin_size || header.hash_funs != first.hash_funs)
+            throw std::invalid_argument{"Only Interleaved Bloom Filters with the same bin size and number of hash "
+                                        "functions can be merged."};
+        if (mode == merge_mode::unite_bins && header.bins != first.bins)
+            throw std::invalid_argument{"Uniting bins requires Interleaved Bloom Filters with the same number of "
+                                        "bins."};
+
+        first_bins.push_back(mode == merge_mode::unite_bins ? 0u : bins);
+        bins = mode == merge_mode::unite_bins ? header.bins : bins + header.bins;
+        input.file->will_read_sequentially();
+    }
+
+    detail::bloom_filter_file_header header{};
+    header.is_interleaved = true;
+    header.bins = bins;
+    header.technical_bins = ((bins + 63u) >> 6) << 6;
+    header.bin_size = inputs.front().header.bin_size;
+    header.hash_shift = inputs.front().header.hash_shift;
+    header.hash_funs = inputs.front().header.hash_funs;
+
+    size_t const bin_words = header.technical_bins >> 6;
+    size_t const rows = header.bin_size;
+    size_t const batch_rows = std::max<size_t>(1u, (size_t{1u} << 20) / bin_words);
+    size_t const chunk_rows = std::max<size_t>(1u, (size_t{1u} << 16) / bin_words);
+
+    detail::write_bloom_filter_file(output_path, header, [&] (std::ostream & out) -> uint64_t
+    {
+        std::vector<uint64_t> batch{};
+        size_t const chunks_per_batch = (std::min(batch_rows, rows) + chunk_rows - 1u) / chunk_rows;
+        detail::chunk_thread_pool pool{std::min(thread_count, chunks_per_batch)};
+
+        for (size_t batch_begin = 0; batch_begin < rows; batch_begin += batch_rows)
+        {
+            size_t const batch_size = std::min(batch_rows, rows - batch_begin);
+            batch.assign(batch_size * bin_words, 0u);
+
+            pool.for_each_chunk(batch_size, chunk_rows, [&] (size_t const begin, size_t const end)
+            {
+                for (size_t i = 0; i < inputs.size(); ++i)
+                {
+                    size_t const input_bin_words = inputs[i].header.technical_bins >> 6;
+                    uint64_t const * const words = reinterpret_cast<uint64_t const *>(inputs[i].payload());
+
+                    detail::or_rows(words + (batch_begin + begin) * input_bin_words,
+                                    input_bin_words,
+                                    inputs[i].header.bins,
+                                    batch.data() + begin * bin_words,
+                                    bin_words,
+                                    first_bins[i],
+                                    end - begin);
+                }
+            });
+
+            out.write(reinterpret_cast<char const *>(batch.data()), batch.size() * sizeof(uint64_t));
+        }
+
+        return rows * bin_words * sizeof(uint64_t);
+    });
+}
+
+} // namespace seqan3
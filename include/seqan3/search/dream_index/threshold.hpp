@@ -0,0 +1,68 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::kmer_lemma_threshold and seqan3::relative_threshold.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A threshold model for seqan3::interleaved_bloom_filter::classification_agent_type based on the k-mer lemma.
+ * \ingroup search_dream_index
+ *
+ * \details
+ *
+ * A query of length \f$n\f$ with \f$e\f$ errors shares at least \f$n - k + 1 - e \cdot k\f$ of its k-mers with the
+ * reference. For a gapped seqan3::shape, \f$k\f$ is the size of the shape, i.e. its span. Called with the number of
+ * k-mers of the query, the model returns `0` if the lemma does not give a positive threshold, i.e. every bin
+ * qualifies.
+ *
+ * The k-mer lemma does not hold for minimisers. Use a threshold that was computed for the used minimiser parameters
+ * instead, e.g. a seqan3::relative_threshold or a lookup table wrapped in a lambda.
+ */
+struct kmer_lemma_threshold
+{
+    //!\brief The size of the k-mers (the span of the shape).
+    size_t kmer_size{};
+    //!\brief The number of errors.
+    size_t errors{};
+
+    //!\brief Returns the threshold for a query with `value_count` k-mers.
+    constexpr size_t operator()(size_t const value_count) const noexcept
+    {
+        size_t const destroyed = kmer_size * errors;
+        return value_count > destroyed ? value_count - destroyed : 0u;
+    }
+};
+
+/*!\brief A threshold model for seqan3::interleaved_bloom_filter::classification_agent_type that requires a fixed
+ *        fraction of the values of the query to be contained in a bin.
+ * \ingroup search_dream_index
+ */
+struct relative_threshold
+{
+    //!\brief The fraction of the values of the query; must be in `[0, 1]`.
+    double fraction{};
+
+    //!\brief Returns the threshold for a query with `value_count` values, i.e. `ceil(fraction * value_count)`.
+    size_t operator()(size_t const value_count) const noexcept
+    {
+        assert(fraction >= 0.0 && fraction <= 1.0);
+        return static_cast<size_t>(std::ceil(fraction * value_count));
+    }
+};
+
+} // namespace seqan3
@@ -49,4 +49,5 @@
 #include <seqan3/search/fm_index/bi_fm_index_cursor.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_options.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
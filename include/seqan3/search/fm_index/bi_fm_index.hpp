@@ -13,6 +13,7 @@
 #pragma once
 
 #include <filesystem>
+#include <future>
 #include <seqan3/std/ranges>
 #include <utility>
 
@@ -66,8 +67,15 @@ private:
     //!\brief The type of the underlying SDSL index for the original text.
     using sdsl_index_type = sdsl_index_type_;
 
-    //!\brief The type of the underlying SDSL index for the reversed text.
-    using rev_sdsl_index_type = sdsl::csa_wt<sdsl_wt_index_type::wavelet_tree_type, // Wavelet tree type
+    /*!\brief The type of the underlying SDSL index for the reversed text.
+     *
+     * \details
+     *
+     * It uses the same rank data structure as the index of the original text, e.g. an EPR dictionary for
+     * seqan3::sdsl_epr_index_type, but samples neither the suffix array nor the inverse suffix array since they are
+     * only needed to locate occurrences in the original text.
+     */
+    using rev_sdsl_index_type = sdsl::csa_wt<typename sdsl_index_type::wavelet_tree_type, // Wavelet tree type
                                              10'000'000, // Sampling rate of the suffix array
                                              10'000'000, // Sampling rate of the inverse suffix array
                                              sdsl::sa_order_sa_sampling<>, // Text or SA based sampling for SA
@@ -95,6 +103,9 @@ private:
     //!\brief Underlying FM index for the reversed text.
     rev_fm_index_type rev_fm;
 
+    //!\brief The precomputed suffix array intervals of short words in both indices.
+    detail::fm_index_lookup_table lookup_table;
+
     /*!\brief Constructs the index given a range.
      *        The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
@@ -115,18 +126,47 @@ private:
      * No guarantee. \if DEV \todo Ensure strong exception guarantee. \endif
      */
     template <std::ranges::range text_t>
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options = {})
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
 
-        fwd_fm = fm_index_type{text};
-        rev_fm = rev_fm_index_type{text};
+        // The lookup table stores the intervals of both indices and is computed once both are constructed.
+        fm_index_construction_options index_options{options};
+        index_options.lookup_table_depth = 0u;
+
+        if (options.thread_count <= 1u)
+        {
+            fwd_fm = fm_index_type{text, index_options};
+            rev_fm = rev_fm_index_type{text, index_options};
+        }
+        else
+        {
+            // Both indices are independent of each other and are built concurrently, sharing the resources equally.
+            index_options.thread_count = (options.thread_count + 1u) / 2u;
+            index_options.memory_limit = options.memory_limit / 2u;
+
+            auto rev_fm_task = std::async(std::launch::async, [&] ()
+            {
+                return rev_fm_index_type{text, index_options};
+            });
+            fwd_fm = fm_index_type{text, index_options};
+            rev_fm = rev_fm_task.get();
+        }
+
+        // The cursors answer short queries from the lookup table, hence the table of a previous construction must
+        // not be used while the new one is computed.
+        lookup_table = detail::fm_index_lookup_table{};
+        if (options.lookup_table_depth > 0u)
+            lookup_table = detail::fm_index_lookup_table{cursor(), options.lookup_table_depth, options.thread_count};
     }
 
 public:
     //!\brief Indicates whether index is built over a collection.
     static constexpr text_layout text_layout_mode = text_layout_mode_;
 
+    //!\brief Every `sa_sampling_rate`-th entry of the suffix array of the original text is stored in the index.
+    static constexpr size_t sa_sampling_rate = fm_index_type::sa_sampling_rate;
+
     /*!\name Text types
      * \{
      */
@@ -172,6 +212,28 @@ public:
     {
         construct(std::forward<text_t>(text));
     }
+
+    /*!\brief Constructor that immediately constructs the index given a range and construction options.
+     *        The range cannot be empty.
+     * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
+     * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options, e.g. the number of threads and a memory limit.
+     *
+     * \details
+     *
+     * Apart from the optional lookup table, the resulting index is identical to the one constructed without options.
+     * If more than one thread is given, the
+     * indices of the original and the reversed text are constructed concurrently.
+     *
+     * ### Complexity
+     *
+     * \if DEV \todo \endif At least linear.
+     */
+    template <std::ranges::range text_t>
+    bi_fm_index(text_t && text, fm_index_construction_options const & options)
+    {
+        construct(std::forward<text_t>(text), options);
+    }
     //!\}
 
     /*!\brief Returns the length of the indexed text including sentinel characters.
@@ -206,6 +268,42 @@ public:
         return size() == 0;
     }
 
+    /*!\brief Returns the number of bytes the index occupies in memory.
+     * \returns The size of the indices of the original and the reversed text and of the lookup table in bytes.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of underlying data structures.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_t size_in_bytes() const noexcept
+    {
+        return fwd_fm.size_in_bytes() + rev_fm.size_in_bytes() + lookup_table.size_in_bytes();
+    }
+
+    /*!\brief Returns the expected number of LF steps to locate a single occurrence.
+     * \returns `sa_sampling_rate - 1`, i.e. `0` if the complete suffix array is stored.
+     *
+     * \details
+     *
+     * Occurrences are located in the index of the original text. See seqan3::fm_index::expected_locate_steps.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    static constexpr double expected_locate_steps() noexcept
+    {
+        return fm_index_type::expected_locate_steps();
+    }
+
     /*!\brief Compares two indices.
      * \returns `true` if the indices are equal, false otherwise.
      *
@@ -286,6 +384,7 @@ public:
     {
         archive(fwd_fm);
         archive(rev_fm);
+        archive(lookup_table);
     }
     //!\endcond
 };
@@ -296,6 +395,11 @@ public:
 //!\brief Deduces the dimensions of the text.
 template <std::ranges::range text_t>
 bi_fm_index(text_t &&) -> bi_fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
+
+//!\brief Deduces the dimensions of the text.
+template <std::ranges::range text_t>
+bi_fm_index(text_t &&, fm_index_construction_options const &)
+    -> bi_fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
 //!\}
 
 } // namespace seqan3
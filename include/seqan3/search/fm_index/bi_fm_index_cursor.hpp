@@ -21,6 +21,8 @@
 #include <seqan3/alphabet/adaptation/uint.hpp>
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_lookup_table.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_prefetch.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
 #include <seqan3/utility/views/slice.hpp>
@@ -127,6 +129,9 @@ private:
     //!\brief Depth of the node in the suffix tree, i.e. length of the searched query.
     size_type depth{}; // equal for both cursors. only stored once
 
+    //!\brief Code of the query in the lookup table of the index. Only valid while is_in_lookup_table(query_length()).
+    size_t lookup_code{};
+
     // supports assertions to check whether cycle_back() resp. cycle_front() is called on the same direction as the last
     // extend_right([...]) resp. extend_left([...])
 #ifndef NDEBUG
@@ -135,6 +140,8 @@ private:
     bool fwd_cursor_last_used = false;
 #endif
 
+    friend class detail::fm_index_lookup_table;
+
     //!\brief Helper function to recompute text positions since the indexed text is reversed.
     size_type offset() const noexcept
     {
@@ -142,6 +149,34 @@ private:
         return index->size() - query_length() - 1; // since the string is reversed during construction
     }
 
+    //!\brief Whether the queries of the given length (`> 0`) are looked up in the lookup table of the index.
+    bool is_in_lookup_table(size_type const length) const noexcept
+    {
+        return length <= index->lookup_table.depth();
+    }
+
+    /*!\brief Moves the cursor to the query of the given length and code if it occurs in the text.
+     * \param[in] length The length of the query.
+     * \param[in] code The code of the query.
+     * \param[in] rank The rank of the character the query was extended or cycled with.
+     * \details The parent interval is not changed.
+     */
+    bool lookup(size_type const length, size_t const code, size_t const rank) noexcept
+    {
+        detail::fm_index_lookup_table_entry const entry = index->lookup_table.at(length, code);
+        if (entry.count == 0)
+            return false;
+
+        fwd_lb = entry.lb;
+        fwd_rb = entry.lb + entry.count - 1;
+        rev_lb = entry.rev_lb;
+        rev_rb = entry.rev_lb + entry.count - 1;
+        _last_char = rank + 1;
+        depth = length;
+        lookup_code = code;
+        return true;
+    }
+
     //!\brief Optimized bidirectional search without alphabet mapping
     template <typename csa_t>
     //!\cond
@@ -336,6 +371,20 @@ public:
 
         size_type new_parent_lb = fwd_lb, new_parent_rb = fwd_rb;
 
+        if (is_in_lookup_table(depth + 1))
+        {
+            for (size_t rank = 0; rank + 1 < sigma; ++rank)
+            {
+                if (lookup(depth + 1, index->lookup_table.append(lookup_code, rank), rank))
+                {
+                    parent_lb = new_parent_lb;
+                    parent_rb = new_parent_rb;
+                    return true;
+                }
+            }
+            return false;
+        }
+
         sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
         while (c < sigma &&
                !bidirectional_search(index->fwd_fm.index, index->fwd_fm.index.comp2char[c],
@@ -384,6 +433,20 @@ public:
 
         size_type new_parent_lb = rev_lb, new_parent_rb = rev_rb;
 
+        if (is_in_lookup_table(depth + 1))
+        {
+            for (size_t rank = 0; rank + 1 < sigma; ++rank)
+            {
+                if (lookup(depth + 1, index->lookup_table.prepend(depth, lookup_code, rank), rank))
+                {
+                    parent_lb = new_parent_lb;
+                    parent_rb = new_parent_rb;
+                    return true;
+                }
+            }
+            return false;
+        }
+
         sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
         while (c < sigma &&
                !bidirectional_search(index->rev_fm.index, index->rev_fm.index.comp2char[c],
@@ -436,6 +499,17 @@ public:
 
         size_type new_parent_lb = fwd_lb, new_parent_rb = fwd_rb;
 
+        if (is_in_lookup_table(depth + 1))
+        {
+            size_t const rank = seqan3::to_rank(static_cast<index_alphabet_type>(c));
+            if (!lookup(depth + 1, index->lookup_table.append(lookup_code, rank), rank))
+                return false;
+
+            parent_lb = new_parent_lb;
+            parent_rb = new_parent_rb;
+            return true;
+        }
+
         auto c_char = seqan3::to_rank(static_cast<index_alphabet_type>(c)) + 1;
         if (bidirectional_search(index->fwd_fm.index, c_char, fwd_lb, fwd_rb, rev_lb, rev_rb))
         {
@@ -491,6 +565,17 @@ public:
 
         size_type new_parent_lb = rev_lb, new_parent_rb = rev_rb;
 
+        if (is_in_lookup_table(depth + 1))
+        {
+            size_t const rank = seqan3::to_rank(static_cast<index_alphabet_type>(c));
+            if (!lookup(depth + 1, index->lookup_table.prepend(depth, lookup_code, rank), rank))
+                return false;
+
+            parent_lb = new_parent_lb;
+            parent_rb = new_parent_rb;
+            return true;
+        }
+
         auto c_char = seqan3::to_rank(static_cast<index_alphabet_type>(c)) + 1;
         if (bidirectional_search(index->rev_fm.index, c_char, rev_lb, rev_rb, fwd_lb, fwd_rb))
         {
@@ -523,6 +608,10 @@ public:
      * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
      * state before calling this method.
      *
+     * If the index was constructed with a seqan3::fm_index_construction_options::lookup_table_depth of \f$k > 0\f$,
+     * the characters up to the \f$k\f$-th character of the query are looked up in constant time instead of performing
+     * one backward search step each.
+     *
      * ### Complexity
      *
      * \f$|seq| * O(T_{BACKWARD\_SEARCH})\f$
@@ -551,8 +640,38 @@ public:
         size_type new_parent_lb = parent_lb, new_parent_rb = parent_rb;
         sdsl_char_type c = _last_char;
         size_t len{0};
+        size_t new_lookup_code = lookup_code;
 
-        for (auto it = first; it != last; ++len, ++it)
+        auto it = first;
+        detail::fm_index_lookup_table const & lookup_table = index->lookup_table;
+        if (is_in_lookup_table(depth + 1) && it != last)
+        {
+            auto const [prefix_length, code] =
+                lookup_table.template encode<index_alphabet_type>(it, last, depth, lookup_code);
+            detail::fm_index_lookup_table_entry const entry = lookup_table.at(prefix_length, code);
+            if (entry.count == 0)
+                return false;
+
+            new_parent_lb = _fwd_lb; // the current node is the parent if only one character was looked up
+            new_parent_rb = _fwd_rb;
+            if (prefix_length > depth + 1)
+            {
+                detail::fm_index_lookup_table_entry const parent =
+                    lookup_table.at(prefix_length - 1, lookup_table.drop_last(code));
+                new_parent_lb = parent.lb;
+                new_parent_rb = parent.lb + parent.count - 1;
+            }
+
+            _fwd_lb = entry.lb;
+            _fwd_rb = entry.lb + entry.count - 1;
+            _rev_lb = entry.rev_lb;
+            _rev_rb = entry.rev_lb + entry.count - 1;
+            c = lookup_table.last_rank(code) + 1;
+            len = prefix_length - depth;
+            new_lookup_code = code;
+        }
+
+        for (; it != last; ++len, ++it)
         {
             // The rank cannot exceed 255 for single text and 254 for text collections as they are reserved as sentinels
             // for the indexed text.
@@ -577,6 +696,7 @@ public:
 
         _last_char = c;
         depth += len;
+        lookup_code = new_lookup_code;
 
         return true;
     }
@@ -589,6 +709,10 @@ public:
      * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
      * state before calling this method.
      *
+     * If the index was constructed with a seqan3::fm_index_construction_options::lookup_table_depth of \f$k > 0\f$,
+     * the characters up to the \f$k\f$-th last character of the query are looked up in constant time instead of
+     * performing one backward search step each.
+     *
      * Example:
      *
      * \include test/snippet/search/bi_fm_index_cursor_extend_left_seq.cpp
@@ -623,8 +747,39 @@ public:
         size_type new_parent_lb = parent_lb, new_parent_rb = parent_rb;
         sdsl_char_type c = _last_char;
         size_t len{0};
+        size_t new_lookup_code = lookup_code;
 
-        for (auto it = first; it != last; ++len, ++it)
+        auto it = first;
+        detail::fm_index_lookup_table const & lookup_table = index->lookup_table;
+        if (is_in_lookup_table(depth + 1) && it != last)
+        {
+            // The suffix of seq is prepended to the query, its first character is the last one extended to the left.
+            auto const [suffix_length, code] =
+                lookup_table.template encode_reversed<index_alphabet_type>(it, last, depth, lookup_code);
+            detail::fm_index_lookup_table_entry const entry = lookup_table.at(suffix_length, code);
+            if (entry.count == 0)
+                return false;
+
+            new_parent_lb = _rev_lb; // the current node is the parent if only one character was looked up
+            new_parent_rb = _rev_rb;
+            if (suffix_length > depth + 1)
+            {
+                detail::fm_index_lookup_table_entry const parent =
+                    lookup_table.at(suffix_length - 1, lookup_table.drop_first(suffix_length, code));
+                new_parent_lb = parent.rev_lb;
+                new_parent_rb = parent.rev_lb + parent.count - 1;
+            }
+
+            _fwd_lb = entry.lb;
+            _fwd_rb = entry.lb + entry.count - 1;
+            _rev_lb = entry.rev_lb;
+            _rev_rb = entry.rev_lb + entry.count - 1;
+            c = lookup_table.first_rank(suffix_length, code) + 1;
+            len = suffix_length - depth;
+            new_lookup_code = code;
+        }
+
+        for (; it != last; ++len, ++it)
         {
             // The rank cannot exceed 255 for single text and 254 for text collections as they are reserved as sentinels
             // for the indexed text.
@@ -648,10 +803,68 @@ public:
         parent_rb = new_parent_rb;
         _last_char = c;
         depth += len;
+        lookup_code = new_lookup_code;
 
         return true;
     }
 
+    /*!\brief Hints the processor to load the first memory that the next extend_right(char) call accesses.
+     *
+     * \details
+     *
+     * This does not change the cursor. Issuing the hint and doing other work, e.g. extending the cursors of other
+     * queries, before calling extend_right(char) hides the latency of that memory access behind that work.
+     * seqan3::search does this for exact searches when configured with seqan3::search_cfg::batch.
+     *
+     * The words of the bit vector of the wavelet tree root and the blocks of its rank support at both interval bounds
+     * are prefetched, see seqan3::detail::fm_index_prefetch_rank. For EPR dictionaries, this is all memory of the
+     * next step. The deeper levels of the wavelet tree are loaded by extend_right(char) itself. Nothing is prefetched
+     * if the next step is looked up in the lookup table.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    void prefetch_extend_right() const noexcept
+    {
+        assert(index != nullptr);
+
+        if (is_in_lookup_table(depth + 1)) // extend_right(char) does not access the rank support
+            return;
+
+        detail::fm_index_prefetch_rank(index->fwd_fm.index, fwd_lb);
+        detail::fm_index_prefetch_rank(index->fwd_fm.index, fwd_rb + 1);
+    }
+
+    /*!\brief Hints the processor to load the first memory that the next extend_left(char) call accesses.
+     *
+     * \details
+     *
+     * See prefetch_extend_right().
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    void prefetch_extend_left() const noexcept
+    {
+        assert(index != nullptr);
+
+        if (is_in_lookup_table(depth + 1)) // extend_left(char) does not access the rank support
+            return;
+
+        detail::fm_index_prefetch_rank(index->rev_fm.index, rev_lb);
+        detail::fm_index_prefetch_rank(index->rev_fm.index, rev_rb + 1);
+    }
+
     /*!\brief Tries to replace the rightmost character of the query by the next lexicographically larger character such
      *        that the query is found in the text.
      *        \if DEV
@@ -687,6 +900,15 @@ public:
 
         assert(index != nullptr && query_length() > 0);
 
+        if (is_in_lookup_table(depth))
+        {
+            size_t const parent_code = index->lookup_table.drop_last(lookup_code);
+            for (size_t rank = index->lookup_table.last_rank(lookup_code) + 1; rank + 1 < sigma; ++rank)
+                if (lookup(depth, index->lookup_table.append(parent_code, rank), rank))
+                    return true;
+            return false;
+        }
+
         sdsl_char_type c = _last_char + 1;
 
         while (c < sigma &&
@@ -740,6 +962,15 @@ public:
 
         assert(index != nullptr && query_length() > 0);
 
+        if (is_in_lookup_table(depth))
+        {
+            size_t const parent_code = index->lookup_table.drop_first(depth, lookup_code);
+            for (size_t rank = index->lookup_table.first_rank(depth, lookup_code) + 1; rank + 1 < sigma; ++rank)
+                if (lookup(depth, index->lookup_table.prepend(depth - 1, parent_code, rank), rank))
+                    return true;
+            return false;
+        }
+
         sdsl_char_type c = _last_char + 1;
         while (c < sigma &&
                !bidirectional_search_cycle(index->rev_fm.index, index->rev_fm.index.comp2char[c],
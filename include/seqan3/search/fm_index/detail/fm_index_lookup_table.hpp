@@ -0,0 +1,361 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ * \brief Provides seqan3::detail::fm_index_lookup_table.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <cassert>
+#include <concepts>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sdsl/int_vector.hpp>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_options.hpp>
+#include <seqan3/utility/parallel/detail/parallel_for_chunks.hpp>
+
+namespace seqan3
+{
+//!\cond
+template <typename index_t>
+class fm_index_cursor;
+
+template <typename index_t>
+class bi_fm_index_cursor;
+//!\endcond
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+/*!\brief The suffix array intervals of a single word stored in the seqan3::detail::fm_index_lookup_table.
+ * \ingroup search_fm_index
+ */
+struct fm_index_lookup_table_entry
+{
+    //!\brief The left bound (inclusive) of the suffix array interval.
+    size_t lb;
+    //!\brief The size of the suffix array interval, i.e. `0` if the word does not occur in the text.
+    size_t count;
+    //!\brief The left bound (inclusive) of the suffix array interval in the index of the reversed text.
+    size_t rev_lb;
+};
+
+/*!\brief Stores the suffix array intervals of all words up to a fixed length.
+ * \ingroup search_fm_index
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * A search in an FM index starts at the root and performs one backward search step per character. The first steps
+ * are the same for all queries sharing a prefix. This table stores the result of the first `depth` steps for every
+ * word \f$w\f$ with \f$|w| \leq depth\f$, i.e. the suffix array interval of the cursor after `extend_right(w)` on the
+ * root, such that the cursors can jump directly to depth \f$|w|\f$. For bidirectional indices, the left bound of the
+ * interval in the index of the reversed text is stored as well; its size equals the size of the forward interval.
+ * The cursors keep the code of their query while it is not longer than `depth` and answer every extension, including
+ * the single character steps of backtracking searches, from the table.
+ *
+ * A word \f$w_0 \ldots w_{d-1}\f$ is identified by its depth \f$d\f$ and its code
+ * \f$\sum_{i=0}^{d-1} rank(w_i) \cdot \sigma^{d-1-i}\f$. All words of the same depth are stored consecutively.
+ * The intervals are stored bit-compressed, i.e. with \f$\lceil \log_2(n+1) \rceil\f$ bits for a text of length
+ * \f$n\f$, and the table occupies about \f$\frac{\sigma^{depth+1}}{\sigma-1} \cdot 2 \lceil \log_2(n+1) \rceil\f$ bits
+ * (three values per word for bidirectional indices).
+ */
+class fm_index_lookup_table
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    fm_index_lookup_table() = default;                                          //!< Defaulted.
+    fm_index_lookup_table(fm_index_lookup_table const &) = default;             //!< Defaulted.
+    fm_index_lookup_table & operator=(fm_index_lookup_table const &) = default; //!< Defaulted.
+    fm_index_lookup_table(fm_index_lookup_table &&) = default;                  //!< Defaulted.
+    fm_index_lookup_table & operator=(fm_index_lookup_table &&) = default;      //!< Defaulted.
+    ~fm_index_lookup_table() = default;                                         //!< Defaulted.
+
+    /*!\brief Computes the suffix array intervals of all words up to length `depth`.
+     * \tparam cursor_t The type of the cursor; must be a seqan3::fm_index_cursor or a seqan3::bi_fm_index_cursor.
+     * \param[in] root A cursor pointing to the root of the index.
+     * \param[in] depth The maximal length of the words to store.
+     * \param[in] thread_count The number of threads to use.
+     * \throws std::invalid_argument if the number of words exceeds the addressable memory.
+     *
+     * \details
+     *
+     * The table is filled level by level. Each word is computed from the interval of its prefix stored in the
+     * previous level with a single backward search step, i.e. no suffix array interval is computed twice.
+     * The words of one level are distributed among `thread_count` threads.
+     */
+    template <typename cursor_t>
+    fm_index_lookup_table(cursor_t const & root, size_t const depth, size_t const thread_count) :
+        depth_{depth},
+        sigma_{alphabet_size<typename cursor_t::index_type::alphabet_type>}
+    {
+        using alphabet_type = typename cursor_t::index_type::alphabet_type;
+        // The largest ranks of alphabets with 256 characters are reserved as sentinels and never occur in the text.
+        constexpr size_t rank_limit = (cursor_t::index_type::text_layout_mode == text_layout::single) ? 255u : 254u;
+
+        compute_level_offsets();
+
+        fm_index_lookup_table_entry const root_entry = entry_of(root);
+        uint8_t const width = sdsl::bits::hi(root_entry.count) + 1;
+        lbs = sdsl::int_vector<>(level_offsets.back(), 0u, width);
+        counts = sdsl::int_vector<>(level_offsets.back(), 0u, width);
+        if constexpr (!std::same_as<cursor_t, fm_index_cursor<typename cursor_t::index_type>>)
+            rev_lbs = sdsl::int_vector<>(level_offsets.back(), 0u, width);
+
+        // Each level starts at a multiple of 64 entries and the chunks are multiples of 64 entries.
+        // Hence, no two threads write into the same word of the bit-compressed vectors.
+        size_t constexpr chunk_size{size_t{1u} << 12};
+        chunk_thread_pool pool{std::min<size_t>(thread_count, (words_of_depth(depth_) + chunk_size - 1u) / chunk_size)};
+
+        for (size_t level = 1u; level <= depth_; ++level)
+        {
+            pool.for_each_chunk(words_of_depth(level), chunk_size, [&] (size_t const begin, size_t const end)
+            {
+                for (size_t code = begin; code < end; ++code)
+                {
+                    fm_index_lookup_table_entry const parent = (level == 1u) ? root_entry
+                                                                             : at(level - 1u, drop_last(code));
+                    if (parent.count == 0u || last_rank(code) >= rank_limit)
+                        continue;
+
+                    cursor_t cursor{root};
+                    assign(cursor, parent, level - 1u);
+                    if (cursor.extend_right(assign_rank_to(last_rank(code), alphabet_type{})))
+                        store(level, code, entry_of(cursor));
+                }
+            });
+        }
+    }
+    //!\}
+
+    //!\brief Returns the maximal length of the stored words; `0` if the table is empty.
+    size_t depth() const noexcept
+    {
+        return depth_;
+    }
+
+    //!\brief Whether no words are stored.
+    bool empty() const noexcept
+    {
+        return depth_ == 0u;
+    }
+
+    /*!\brief Returns the intervals of the word with the given depth and code.
+     * \param[in] depth The length of the word; must be in `[1, depth()]`.
+     * \param[in] code The code of the word.
+     */
+    fm_index_lookup_table_entry at(size_t const depth, size_t const code) const noexcept
+    {
+        assert(depth > 0u && depth <= depth_);
+        assert(code < words_of_depth(depth));
+
+        size_t const i = level_offsets[depth - 1u] + code;
+        return {lbs[i], counts[i], rev_lbs.empty() ? 0u : static_cast<size_t>(rev_lbs[i])};
+    }
+
+    /*!\brief Appends the characters of `[it, last)` to a word until it has depth() characters and advances `it` past
+     *        them.
+     * \tparam alphabet_t The alphabet of the index.
+     * \param[in,out] it The first character to append.
+     * \param[in] last The end of the sequence.
+     * \param[in] length The length of the word to append to; must not exceed depth().
+     * \param[in] code The code of the word to append to.
+     * \returns The length and the code of the extended word.
+     */
+    template <typename alphabet_t, typename iterator_t, typename sentinel_t>
+    std::pair<size_t, size_t> encode(iterator_t & it,
+                                     sentinel_t const & last,
+                                     size_t length = 0u,
+                                     size_t code = 0u) const
+    {
+        assert(length <= depth_);
+
+        for (; length < depth_ && it != last; ++length, ++it)
+            code = append(code, seqan3::to_rank(static_cast<alphabet_t>(*it)));
+
+        return {length, code};
+    }
+
+    /*!\brief Prepends the characters of a sequence to a word until it has depth() characters, given a reverse iterator
+     *        `it` on the sequence.
+     * \copydetails encode
+     */
+    template <typename alphabet_t, typename iterator_t, typename sentinel_t>
+    std::pair<size_t, size_t> encode_reversed(iterator_t & it,
+                                              sentinel_t const & last,
+                                              size_t length = 0u,
+                                              size_t code = 0u) const
+    {
+        assert(length <= depth_);
+
+        for (size_t power = words_of_depth(length); length < depth_ && it != last; ++length, ++it, power *= sigma_)
+            code += seqan3::to_rank(static_cast<alphabet_t>(*it)) * power;
+
+        return {length, code};
+    }
+
+    //!\brief Returns the code of the word with the given code followed by the character with the given rank.
+    size_t append(size_t const code, size_t const rank) const noexcept
+    {
+        return code * sigma_ + rank;
+    }
+
+    //!\brief Returns the code of the character with the given rank followed by the word with the given length and code.
+    size_t prepend(size_t const length, size_t const code, size_t const rank) const noexcept
+    {
+        return rank * words_of_depth(length) + code;
+    }
+
+    //!\brief Returns the code of the word with the given code without its last character.
+    size_t drop_last(size_t const code) const noexcept
+    {
+        return code / sigma_;
+    }
+
+    //!\brief Returns the rank of the last character of the word with the given code.
+    size_t last_rank(size_t const code) const noexcept
+    {
+        return code % sigma_;
+    }
+
+    //!\brief Returns the code of the word with the given length and code without its first character.
+    size_t drop_first(size_t const length, size_t const code) const noexcept
+    {
+        return code % words_of_depth(length - 1u);
+    }
+
+    //!\brief Returns the rank of the first character of the word with the given length and code.
+    size_t first_rank(size_t const length, size_t const code) const noexcept
+    {
+        return code / words_of_depth(length - 1u);
+    }
+
+    //!\brief Returns the number of words of the given length, i.e. \f$\sigma^{depth}\f$.
+    size_t words_of_depth(size_t const depth) const noexcept
+    {
+        size_t words{1u};
+        for (size_t i = 0u; i < depth; ++i)
+            words *= sigma_;
+        return words;
+    }
+
+    //!\brief Returns the number of bytes the table occupies in memory.
+    size_t size_in_bytes() const noexcept
+    {
+        return sdsl::size_in_bytes(lbs) + sdsl::size_in_bytes(counts) + sdsl::size_in_bytes(rev_lbs);
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(depth_);
+        archive(sigma_);
+        archive(lbs);
+        archive(counts);
+        archive(rev_lbs);
+        compute_level_offsets();
+    }
+    //!\endcond
+
+private:
+    //!\brief The maximal length of the stored words.
+    size_t depth_{0u};
+    //!\brief The alphabet size of the index.
+    size_t sigma_{0u};
+    //!\brief The first entry of each level, the last element is the total number of entries.
+    std::vector<size_t> level_offsets{0u};
+    //!\brief The left bounds of the suffix array intervals.
+    sdsl::int_vector<> lbs{};
+    //!\brief The sizes of the suffix array intervals.
+    sdsl::int_vector<> counts{};
+    //!\brief The left bounds of the suffix array intervals in the index of the reversed text (bidirectional only).
+    sdsl::int_vector<> rev_lbs{};
+
+    //!\brief Computes the first entry of each level; each level starts at a multiple of 64.
+    void compute_level_offsets()
+    {
+        level_offsets.assign(1u, 0u);
+        for (size_t level = 1u, words = 1u; level <= depth_; ++level)
+        {
+            if (words > (std::numeric_limits<size_t>::max() - 63u - level_offsets.back()) / sigma_)
+                throw std::invalid_argument{"The lookup table of depth " + std::to_string(depth_) + " is too large "
+                                            "for an alphabet of size " + std::to_string(sigma_) + "."};
+
+            words *= sigma_;
+            level_offsets.push_back((level_offsets.back() + words + 63u) / 64u * 64u);
+        }
+    }
+
+    //!\brief Stores the intervals `entry` of the word with the given depth and code.
+    void store(size_t const depth, size_t const code, fm_index_lookup_table_entry const & entry) noexcept
+    {
+        size_t const i = level_offsets[depth - 1u] + code;
+        lbs[i] = entry.lb;
+        counts[i] = entry.count;
+        if (!rev_lbs.empty())
+            rev_lbs[i] = entry.rev_lb;
+    }
+
+    //!\brief Returns the intervals of the node the unidirectional cursor points to.
+    template <typename index_t>
+    static fm_index_lookup_table_entry entry_of(fm_index_cursor<index_t> const & cursor) noexcept
+    {
+        return {cursor.node.lb, cursor.node.rb + 1u - cursor.node.lb, 0u};
+    }
+
+    //!\brief Returns the intervals of the node the bidirectional cursor points to.
+    template <typename index_t>
+    static fm_index_lookup_table_entry entry_of(bi_fm_index_cursor<index_t> const & cursor) noexcept
+    {
+        return {cursor.fwd_lb, cursor.fwd_rb + 1u - cursor.fwd_lb, cursor.rev_lb};
+    }
+
+    //!\brief Moves the unidirectional cursor to the node with the given intervals and depth.
+    template <typename index_t>
+    static void assign(fm_index_cursor<index_t> & cursor,
+                       fm_index_lookup_table_entry const & entry,
+                       size_t const depth) noexcept
+    {
+        cursor.node = {entry.lb, entry.lb + entry.count - 1u, depth, 0u};
+    }
+
+    //!\brief Moves the bidirectional cursor to the node with the given intervals and depth.
+    template <typename index_t>
+    static void assign(bi_fm_index_cursor<index_t> & cursor,
+                       fm_index_lookup_table_entry const & entry,
+                       size_t const depth) noexcept
+    {
+        cursor.fwd_lb = entry.lb;
+        cursor.fwd_rb = entry.lb + entry.count - 1u;
+        cursor.rev_lb = entry.rev_lb;
+        cursor.rev_rb = entry.rev_lb + entry.count - 1u;
+        cursor.depth = depth;
+    }
+};
+
+} // namespace seqan3::detail
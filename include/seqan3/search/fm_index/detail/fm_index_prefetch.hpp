@@ -0,0 +1,171 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::fm_index_prefetch_rank.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <seqan3/std/ranges>
+#include <type_traits>
+#include <utility>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief An archive for the cereal save function of an SDSL data structure that passes each member to a callback.
+ * \ingroup search_fm_index
+ * \tparam callback_t The type of the callback; must be invocable with a const reference to every member.
+ *
+ * \details
+ *
+ * The SDSL does not expose the rank supports of its wavelet trees and their blocks, but its cereal save functions
+ * pass them to the archive. Saving into this archive does not serialise anything; it only calls the callback with
+ * the members, unwrapping the name-value pairs of cereal.
+ */
+template <typename callback_t>
+struct sdsl_member_visitor
+{
+    //!\brief The callback that is invoked with every member.
+    callback_t & callback;
+
+    //!\brief Passes every member to the callback.
+    template <typename ...members_t>
+    void operator()(members_t const & ...members)
+    {
+        (visit(members), ...);
+    }
+
+private:
+    //!\brief Passes the member to the callback, unwrapping a cereal::NameValuePair.
+    template <typename member_t>
+    void visit(member_t const & member)
+    {
+        if constexpr (requires { member.value; })
+            visit(member.value);
+        else
+            callback(member);
+    }
+};
+
+/*!\brief Calls `callback` with every member that the cereal save function of `object` would serialise.
+ * \ingroup search_fm_index
+ * \param[in] object The SDSL data structure.
+ * \param[in] callback The callback invoked with a const reference to every member.
+ *
+ * \details
+ *
+ * Does nothing if `object` has no cereal save function, e.g. if the SDSL is used without cereal.
+ */
+template <typename sdsl_t, typename callback_t>
+inline void sdsl_for_each_member(sdsl_t const & object, callback_t && callback)
+{
+    using visitor_t = sdsl_member_visitor<std::remove_reference_t<callback_t>>;
+
+    if constexpr (requires (visitor_t & visitor) { object.CEREAL_SAVE_FUNCTION_NAME(visitor); })
+    {
+        visitor_t visitor{callback};
+        object.CEREAL_SAVE_FUNCTION_NAME(visitor);
+    }
+}
+
+/*!\brief Returns the address of the block of the rank support of `wavelet_tree` that a rank query at `position` of
+ *        its root reads.
+ * \ingroup search_fm_index
+ * \tparam wavelet_tree_t The type of the wavelet tree or EPR dictionary of the SDSL index.
+ * \param[in] wavelet_tree The wavelet tree that will be queried.
+ * \param[in] position The position of the upcoming rank query.
+ * \returns The address of the block or `nullptr` if the rank support cannot be found.
+ *
+ * \details
+ *
+ * The rank support is the member of the wavelet tree that answers `rank(position)` (e.g. `sdsl::rank_support_v` of
+ * the bit vector of a wavelet tree) or `rank(position, symbol)` (e.g. `sdsl::rank_support_int_v` of an EPR
+ * dictionary). Its blocks are the first contiguous range it stores. Both the interleaved super- and block counts of
+ * `sdsl::rank_support_v` and the superblocks of an EPR dictionary have a fixed size per position, hence the block of
+ * `position` is at about the same relative offset in the blocks as `position` in the supported vector. Since the
+ * blocks also cover the end of the vector, the returned address lies in the block of `position` or in the next one.
+ */
+template <typename wavelet_tree_t>
+inline void const * fm_index_rank_block(wavelet_tree_t const & wavelet_tree, size_t const position)
+{
+    void const * block{nullptr};
+    bool found_rank_support{false};
+
+    sdsl_for_each_member(wavelet_tree, [&] (auto const & rank_support)
+    {
+        if constexpr (requires { rank_support.rank(size_t{}); rank_support.size(); } ||
+                      requires { rank_support.rank(size_t{}, uint64_t{}); rank_support.size(); })
+        {
+            if (std::exchange(found_rank_support, true))
+                return;
+
+            size_t const supported_size = rank_support.size();
+            sdsl_for_each_member(rank_support, [&] (auto const & blocks)
+            {
+                if constexpr (requires { std::ranges::data(blocks); std::ranges::size(blocks); })
+                {
+                    if (block != nullptr || supported_size == 0u)
+                        return;
+
+                    size_t byte_size{};
+                    if constexpr (requires { blocks.bit_size(); }) // sdsl::int_vector, whose size may count bits
+                        byte_size = blocks.bit_size() / 8u;
+                    else
+                        byte_size = std::ranges::size(blocks) * sizeof(*std::ranges::data(blocks));
+
+                    // Only a hint, hence the rounding of double does not matter, but the product of the sizes might
+                    // not fit into 64 bits.
+                    size_t const offset = static_cast<double>(byte_size) / supported_size *
+                                          static_cast<double>(position);
+                    if (offset < byte_size)
+                        block = reinterpret_cast<char const *>(std::ranges::data(blocks)) + offset;
+                }
+            });
+        }
+    });
+
+    return block;
+}
+
+/*!\brief Hints the processor to load the memory that a rank query at `position` on the wavelet tree of `csa`
+ *        accesses first.
+ * \ingroup search_fm_index
+ * \tparam sdsl_index_t The type of the SDSL index; must provide a member `wavelet_tree`.
+ * \param[in] csa The SDSL index that will be queried.
+ * \param[in] position The position of the upcoming rank query.
+ *
+ * \details
+ *
+ * Every rank query of the wavelet tree starts with a lookup in the bit vector of its root and its rank support at
+ * the queried position. This function prefetches the machine word of the bit vector containing this position, if
+ * the wavelet tree exposes its bit vector, and the block of the rank support, see
+ * seqan3::detail::fm_index_rank_block. For the EPR dictionary of seqan3::sdsl_epr_index_type, the block is the
+ * superblock holding both the counts and the characters, i.e. all memory of the rank query. The levels below the root
+ * of a wavelet tree depend on the result of the root query and are not prefetched. It never changes the result of any
+ * computation.
+ */
+template <typename sdsl_index_t>
+inline void fm_index_prefetch_rank([[maybe_unused]] sdsl_index_t const & csa,
+                                   [[maybe_unused]] size_t const position) noexcept
+{
+#if defined(__GNUC__)
+    auto const & wavelet_tree = csa.wavelet_tree;
+    if constexpr (requires { wavelet_tree.bv.data(); wavelet_tree.bv.width(); })
+        __builtin_prefetch(wavelet_tree.bv.data() + ((position * wavelet_tree.bv.width()) >> 6));
+
+    if (void const * block = fm_index_rank_block(wavelet_tree, position); block != nullptr)
+        __builtin_prefetch(block);
+#endif // defined(__GNUC__)
+}
+
+} // namespace seqan3::detail
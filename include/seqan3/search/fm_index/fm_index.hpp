@@ -15,14 +15,20 @@
 #include <seqan3/std/algorithm>
 #include <filesystem>
 #include <seqan3/std/ranges>
+#include <shared_mutex>
 
 #include <sdsl/suffix_trees.hpp>
+#include <sdsl/wt_epr.hpp>
 
 #include <seqan3/alphabet/views/to_rank.hpp>
 #include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/io/detail/safe_filesystem_entry.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_lookup_table.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_options.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
+#include <seqan3/utility/parallel/detail/parallel_for_chunks.hpp>
 
 namespace seqan3::detail
 {
@@ -74,6 +80,22 @@ struct fm_index_validator
         static_assert(alphabet_size<range_innermost_value_t<text_t>> <= 256, "The alphabet is too big.");
     }
 };
+
+/*!\brief Guards the global suffix sorter setting of the SDSL, see seqan3::fm_index_construction_options.
+ * \ingroup search_fm_index
+ *
+ * \details
+ *
+ * `sdsl::construct_config::byte_algo_sa` is a global variable that is read by every SDSL construction.
+ * In-memory constructions hold a shared lock, constructions exceeding the memory limit hold a unique lock while
+ * they switch the suffix sorter to the semi-external `sdsl::SE_SAIS`.
+ */
+inline std::shared_mutex & sdsl_construct_config_mutex()
+{
+    static std::shared_mutex mutex{};
+    return mutex;
+}
+
 } // namespace seqan3::detail
 
 namespace seqan3
@@ -81,6 +103,11 @@ namespace seqan3
 
 //!\cond
 // forward declarations
+template <semialphabet alphabet_t,
+          text_layout text_layout_mode_,
+          detail::sdsl_index sdsl_index_type_>
+class bi_fm_index;
+
 template <typename index_t>
 class fm_index_cursor;
 
@@ -139,6 +166,90 @@ using sdsl_wt_index_type =
                  sdsl::isa_sampling<>, // How to sample positons in the inverse suffix array
                  sdsl::plain_byte_alphabet>; // How to represent the alphabet
 
+/*!\brief The FM Index Configuration using a Wavelet Tree and a custom sampling rate of the suffix array.
+ * \ingroup search_fm_index
+ * \tparam sa_sampling_rate Every `sa_sampling_rate`-th entry of the suffix array is stored; must be at least 1.
+ *
+ * \details
+ *
+ * This is the same configuration as seqan3::sdsl_wt_index_type, but the sampling rate of the suffix array can be
+ * chosen. It trades the space of the index for the running time of seqan3::fm_index_cursor::locate:
+ *
+ * * The sampled suffix array needs \f$\frac{n}{SAMPLING\_RATE} \cdot \lceil \log_2 n \rceil\f$ bits, where \f$n\f$
+ *   is the length of the text.
+ * * Locating a single occurrence needs \f$SAMPLING\_RATE - 1\f$ LF steps (each costing \f$T_{BACKWARD\_SEARCH}\f$)
+ *   in expectation.
+ *
+ * seqan3::sdsl_wt_index_type is equivalent to `seqan3::sdsl_wt_sampled_index_type<16>`.
+ * See seqan3::sdsl_full_sa_index_type for an index storing the complete suffix array.
+ *
+ * \include test/snippet/search/fm_index_sa_sampling.cpp
+ */
+template <size_t sa_sampling_rate>
+using sdsl_wt_sampled_index_type = sdsl::csa_wt<sdsl_wt_index_type::wavelet_tree_type,
+                                                sa_sampling_rate,
+                                                10'000'000,
+                                                sdsl::sa_order_sa_sampling<>,
+                                                sdsl::isa_sampling<>,
+                                                sdsl_wt_index_type::alphabet_type>;
+
+/*!\brief The FM Index Configuration using a Wavelet Tree and the complete suffix array.
+ * \ingroup search_fm_index
+ *
+ * \details
+ *
+ * Every entry of the suffix array is stored, hence locating an occurrence does not need any LF step and takes
+ * constant time. In exchange, the suffix array needs \f$n \cdot \lceil \log_2 n \rceil\f$ bits, where \f$n\f$ is
+ * the length of the text. This is useful for locate-heavy workloads, e.g. when searching highly repetitive queries.
+ */
+using sdsl_full_sa_index_type = sdsl_wt_sampled_index_type<1>;
+
+//!\cond
+namespace detail
+{
+//!\brief Provides the EPR dictionary for the given alphabet as member type `type`.
+template <semialphabet alphabet_t>
+struct sdsl_epr_dictionary
+{
+    static_assert(alphabet_size<alphabet_t> <= 16,
+                  "The EPR dictionary only supports alphabets with an alphabet size of at most 16.");
+
+    // One additional symbol each for the sentinel and for the delimiter of text collections.
+    using type = sdsl::wt_epr<alphabet_size<alphabet_t> + 2>;
+};
+} // namespace detail
+//!\endcond
+
+/*!\brief The FM Index Configuration using an EPR dictionary for small alphabets.
+ * \ingroup search_fm_index
+ * \tparam alphabet_t       The alphabet type of the index; seqan3::alphabet_size must be at most 16.
+ * \tparam sa_sampling_rate Every `sa_sampling_rate`-th entry of the suffix array is stored; must be at least 1.
+ *
+ * \details
+ *
+ * Instead of a wavelet tree, the Burrows-Wheeler transform is stored in an EPR dictionary (enhanced prefixsum rank
+ * dictionary). The characters of a block are stored interleaved with the occurrence counts of all characters up to
+ * that block. Hence, a rank query for any character needs a single cache line access instead of one per level of
+ * the wavelet tree, which speeds up every step of the backward search and thus seqan3::search.
+ * The EPR dictionary needs more space than the wavelet tree, which is why it is only available for small alphabets,
+ * e.g. seqan3::dna4 or seqan3::dna5.
+ *
+ * The index type is a drop-in replacement for seqan3::default_sdsl_index_type, i.e. all cursors and seqan3::search
+ * work as before. It is not selected automatically for small alphabets, because that would change the size and the
+ * serialisation of existing indices. Pass it as `sdsl_index_type` to opt in:
+ *
+ * \include test/snippet/search/fm_index_epr.cpp
+ *
+ * \f$T_{BACKWARD\_SEARCH}: O(1)\f$
+ */
+template <semialphabet alphabet_t, size_t sa_sampling_rate = 16>
+using sdsl_epr_index_type = sdsl::csa_wt<typename detail::sdsl_epr_dictionary<alphabet_t>::type,
+                                         sa_sampling_rate,
+                                         10'000'000,
+                                         sdsl::sa_order_sa_sampling<>,
+                                         sdsl::isa_sampling<>,
+                                         sdsl::plain_byte_alphabet>;
+
 /*!\brief The default FM Index Configuration.
  * \ingroup search_fm_index
  * \attention The default might be changed in a future release. If you rely on a stable API and on-disk-format,
@@ -183,6 +294,13 @@ using default_sdsl_index_type = sdsl_wt_index_type;
  * \todo Link to SDSL documentation or write our own once SDSL3 documentation is available somewhere....
  *
  * \endif
+ *
+ * ### Choosing the sampling rate of the suffix array
+ *
+ * The space of the index and the running time of seqan3::fm_index_cursor::locate depend on the sampling rate of the
+ * suffix array. It can be chosen via seqan3::sdsl_wt_sampled_index_type or seqan3::sdsl_full_sa_index_type.
+ * The resulting size of the index and the expected number of LF steps per located occurrence are reported by
+ * seqan3::fm_index::size_in_bytes and seqan3::fm_index::expected_locate_steps.
  */
 template <semialphabet alphabet_t,
           text_layout text_layout_mode_,
@@ -214,6 +332,8 @@ private:
     sdsl::select_support_sd<1> text_begin_ss;
     //!\brief Rank support for text_begin.
     sdsl::rank_support_sd<1> text_begin_rs;
+    //!\brief The precomputed suffix array intervals of short words, see seqan3::fm_index_construction_options.
+    detail::fm_index_lookup_table lookup_table;
 
     //!\brief Eagerly convert sequence into ranks, shift by one and copy them into output_it.
     template <typename output_it_t, typename sequence_t>
@@ -239,6 +359,66 @@ private:
         }).out;
     }
 
+    /*!\brief Constructs the underlying SDSL index from the prepared text.
+     * \param[in,out] tmp_text The shifted ranks of the (reversed) text. Is cleared if constructed on disk.
+     * \param[in] options The construction options.
+     *
+     * \details
+     *
+     * If the in-memory construction exceeds seqan3::fm_index_construction_options::memory_limit, the text is stored in
+     * seqan3::fm_index_construction_options::tmp_directory and the SDSL stores all intermediate data structures there
+     * instead of its in-memory file system. The suffix array is then computed by the semi-external `sdsl::SE_SAIS`
+     * which streams it to disk. Both ways result in the same index.
+     *
+     * The suffix sorter is a global setting of the SDSL, see seqan3::detail::sdsl_construct_config_mutex, hence
+     * constructions exceeding the memory limit do not run concurrently with any other construction.
+     */
+    void construct_sdsl_index(sdsl::int_vector<8> & tmp_text, fm_index_construction_options const & options)
+    {
+        if (options.fits_in_memory(tmp_text.size()))
+        {
+            std::shared_lock lock{detail::sdsl_construct_config_mutex()};
+            sdsl::construct_im(index, tmp_text, 0);
+            return;
+        }
+
+        std::filesystem::path const tmp_directory = options.tmp_directory_or_default();
+        std::string const id = "seqan3_fm_index_" + sdsl::util::to_string(sdsl::util::pid()) + "_" +
+                               sdsl::util::to_string(sdsl::util::id());
+        std::filesystem::path const text_file = tmp_directory / (id + "_text.sdsl");
+        detail::safe_filesystem_entry text_file_guard{text_file}; // removes the text file even if construction throws
+
+        if (!sdsl::store_to_file(tmp_text, text_file.string()))
+            throw std::filesystem::filesystem_error{"Could not write the text for the on-disk index "
+                                                    "construction.", text_file,
+                                                    std::make_error_code(std::errc::io_error)};
+        sdsl::util::clear(tmp_text); // the text is loaded again when needed
+
+        // Restores the in-memory suffix sorter even if construction throws.
+        struct semi_external_suffix_sorter
+        {
+            sdsl::byte_sa_algo_type const previous{sdsl::construct_config::byte_algo_sa};
+
+            semi_external_suffix_sorter() { sdsl::construct_config::byte_algo_sa = sdsl::SE_SAIS; }
+            ~semi_external_suffix_sorter() { sdsl::construct_config::byte_algo_sa = previous; }
+        };
+
+        std::unique_lock lock{detail::sdsl_construct_config_mutex()};
+        semi_external_suffix_sorter sorter{};
+        sdsl::cache_config config{true, tmp_directory.string(), id};
+        sdsl::construct(index, text_file.string(), config, 0);
+    }
+
+    //!\brief Precomputes the lookup table if seqan3::fm_index_construction_options::lookup_table_depth is not 0.
+    void construct_lookup_table(fm_index_construction_options const & options)
+    {
+        // The cursors answer short queries from the lookup table, hence the table of a previous construction must
+        // not be used while the new one is computed.
+        lookup_table = detail::fm_index_lookup_table{};
+        if (options.lookup_table_depth > 0u)
+            lookup_table = detail::fm_index_lookup_table{cursor(), options.lookup_table_depth, options.thread_count};
+    }
+
     /*!\brief Constructs the index given a range.
               The range cannot be an rvalue (i.e. a temporary object) and has to be non-empty.
      * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
@@ -262,21 +442,37 @@ private:
     //!\cond
         requires (text_layout_mode_ == text_layout::single)
     //!\endcond
-    void construct(text_t && text)
+    void construct(text_t && text, fm_index_construction_options const & options = {})
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
 
         // TODO:
         // * check what happens in sdsl when constructed twice!
-        // * choose between in-memory/external and construction algorithms
         // * sdsl construction currently only works for int_vector, std::string and char *, not ranges in general
         // uint8_t largest_char = 0;
         sdsl::int_vector<8> tmp_text(std::ranges::distance(text));
 
         // copy ranks into tmp_text
-        copy_sequence_ranks_shifted_by_one(std::ranges::begin(tmp_text), text | std::views::reverse);
+        auto reverse_text = text | std::views::reverse;
+        if constexpr (std::ranges::random_access_range<decltype(reverse_text)>)
+        {
+            // Chunks of 64 KiB, s.t. no two threads write into the same cache line of tmp_text.
+            detail::parallel_for_chunks(tmp_text.size(),
+                                        size_t{1u} << 16,
+                                        options.thread_count,
+                                        [&reverse_text, &tmp_text] (size_t const begin, size_t const end)
+            {
+                copy_sequence_ranks_shifted_by_one(std::ranges::begin(tmp_text) + begin,
+                                                   reverse_text | views::slice(begin, end));
+            });
+        }
+        else
+        {
+            copy_sequence_ranks_shifted_by_one(std::ranges::begin(tmp_text), reverse_text);
+        }
 
-        sdsl::construct_im(index, tmp_text, 0);
+        construct_sdsl_index(tmp_text, options);
+        construct_lookup_table(options);
 
         // TODO: would be nice but doesn't work since it's private and the public member references are const
         // index.m_C.resize(largest_char);
@@ -289,7 +485,7 @@ private:
     //!\cond
         requires (text_layout_mode_ == text_layout::collection)
     //!\endcond
-    void construct(text_t && text, bool reverse = false)
+    void construct(text_t && text, fm_index_construction_options const & options = {}, bool reverse = false)
     {
         detail::fm_index_validator::validate<alphabet_t, text_layout_mode_>(text);
 
@@ -349,7 +545,31 @@ private:
         };
 
         // copy ranks into tmp_text
-        copy_join_with(std::ranges::begin(tmp_text), text);
+        if constexpr (std::ranges::random_access_range<text_t>)
+        {
+            // Every text is copied to its final position, followed by a delimiter unless it is the last one.
+            size_t const thread_count = std::max<size_t>(options.thread_count, 1u);
+            detail::parallel_for_chunks(number_of_texts,
+                                        (number_of_texts + thread_count - 1u) / thread_count,
+                                        thread_count,
+                                        [&] (size_t const begin, size_t const end)
+            {
+                auto output_it = std::ranges::begin(tmp_text) + text_begin_ss.select(begin + 1);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    output_it = copy_sequence_ranks_shifted_by_one(output_it, text[i]);
+                    if (i + 1 < number_of_texts)
+                    {
+                        *output_it = delimiter;
+                        ++output_it;
+                    }
+                }
+            });
+        }
+        else
+        {
+            copy_join_with(std::ranges::begin(tmp_text), text);
+        }
 
         if (!reverse)
         {
@@ -375,13 +595,17 @@ private:
             }
         }
 
-        sdsl::construct_im(index, tmp_text, 0);
+        construct_sdsl_index(tmp_text, options);
+        construct_lookup_table(options);
     }
 
 public:
     //!\brief Indicates whether index is built over a collection.
     static constexpr text_layout text_layout_mode = text_layout_mode_;
 
+    //!\brief Every `sa_sampling_rate`-th entry of the suffix array is stored in the index.
+    static constexpr size_t sa_sampling_rate = sdsl_index_type::sa_sample_dens;
+
     /*!\name Member types
      * \{
      */
@@ -409,7 +633,8 @@ public:
 
     //!\brief When copy constructing, also update internal data structures.
     fm_index(fm_index const & rhs) :
-        index{rhs.index}, text_begin{rhs.text_begin}, text_begin_ss{rhs.text_begin_ss}, text_begin_rs{rhs.text_begin_rs}
+        index{rhs.index}, text_begin{rhs.text_begin}, text_begin_ss{rhs.text_begin_ss}, text_begin_rs{rhs.text_begin_rs},
+        lookup_table{rhs.lookup_table}
     {
         text_begin_ss.set_vector(&text_begin);
         text_begin_rs.set_vector(&text_begin);
@@ -418,7 +643,7 @@ public:
     //!\brief When move constructing, also update internal data structures.
     fm_index(fm_index && rhs) :
         index{std::move(rhs.index)}, text_begin{std::move(rhs.text_begin)},text_begin_ss{std::move(rhs.text_begin_ss)},
-        text_begin_rs{std::move(rhs.text_begin_rs)}
+        text_begin_rs{std::move(rhs.text_begin_rs)}, lookup_table{std::move(rhs.lookup_table)}
     {
         text_begin_ss.set_vector(&text_begin);
         text_begin_rs.set_vector(&text_begin);
@@ -431,6 +656,7 @@ public:
         text_begin = std::move(rhs.text_begin);
         text_begin_ss = std::move(rhs.text_begin_ss);
         text_begin_rs = std::move(rhs.text_begin_rs);
+        lookup_table = std::move(rhs.lookup_table);
 
         text_begin_ss.set_vector(&text_begin);
         text_begin_rs.set_vector(&text_begin);
@@ -453,6 +679,26 @@ public:
     {
         construct(std::forward<text_t>(text));
     }
+
+    /*!\brief Constructor that immediately constructs the index given a range and construction options.
+     *        The range cannot be empty.
+     * \tparam text_t The type of range to construct from; must model std::ranges::bidirectional_range.
+     * \param[in] text The text to construct from.
+     * \param[in] options The seqan3::fm_index_construction_options, e.g. the number of threads and a memory limit.
+     *
+     * \details
+     *
+     * Apart from the optional lookup table, the resulting index is identical to the one constructed without options.
+     *
+     * ### Complexity
+     *
+     * \if DEV \todo \endif At least linear.
+     */
+    template <std::ranges::bidirectional_range text_t>
+    fm_index(text_t && text, fm_index_construction_options const & options)
+    {
+        construct(std::forward<text_t>(text), options);
+    }
     //!\}
 
     /*!\brief Returns the length of the indexed text including sentinel characters.
@@ -487,6 +733,45 @@ public:
         return size() == 0;
     }
 
+    /*!\brief Returns the number of bytes the index occupies in memory.
+     * \returns The size of all underlying data structures in bytes.
+     *
+     * ### Complexity
+     *
+     * Linear in the number of underlying data structures.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_t size_in_bytes() const noexcept
+    {
+        return sdsl::size_in_bytes(index) + sdsl::size_in_bytes(text_begin) + sdsl::size_in_bytes(text_begin_ss) +
+               sdsl::size_in_bytes(text_begin_rs) + lookup_table.size_in_bytes();
+    }
+
+    /*!\brief Returns the expected number of LF steps to locate a single occurrence.
+     * \returns `sa_sampling_rate - 1`, i.e. `0` if the complete suffix array is stored.
+     *
+     * \details
+     *
+     * The suffix array of the default index is sampled in suffix array order. To locate an occurrence, the LF mapping
+     * is applied until a sampled entry is reached, which happens with a probability of \f$\frac{1}{SAMPLING\_RATE}\f$
+     * per step. See seqan3::sdsl_wt_sampled_index_type for choosing the sampling rate.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    static constexpr double expected_locate_steps() noexcept
+    {
+        return static_cast<double>(sa_sampling_rate - 1u);
+    }
+
     /*!\brief Compares two indices.
      * \returns `true` if the indices are equal, false otherwise.
      *
@@ -555,6 +840,7 @@ public:
         text_begin_ss.set_vector(&text_begin);
         archive(text_begin_rs);
         text_begin_rs.set_vector(&text_begin);
+        archive(lookup_table);
 
         auto sigma = alphabet_size<alphabet_t>;
         archive(sigma);
@@ -585,6 +871,11 @@ public:
 //!\brief Deduces the alphabet and dimensions of the text.
 template <std::ranges::range text_t>
 fm_index(text_t &&) -> fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
+
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+fm_index(text_t &&, fm_index_construction_options const &)
+    -> fm_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
 //!\}
 } // namespace seqan3
 
@@ -612,17 +903,17 @@ class reverse_fm_index : public fm_index<alphabet_t, text_layout_mode, sdsl_inde
 private:
     //!\copydoc seqan3::fm_index::construct()
     template <std::ranges::range text_t>
-    void construct_(text_t && text)
+    void construct_(text_t && text, fm_index_construction_options const & options)
     {
         if constexpr (text_layout_mode == text_layout::single)
         {
             auto reverse_text = text | std::views::reverse;
-            this->construct(reverse_text);
+            this->construct(reverse_text, options);
         }
         else
         {
             auto reverse_text = text | views::deep{std::views::reverse} | std::views::reverse;
-            this->construct(reverse_text, true);
+            this->construct(reverse_text, options, true);
         }
     }
 
@@ -633,7 +924,14 @@ public:
     template <std::ranges::bidirectional_range text_t>
     explicit reverse_fm_index(text_t && text)
     {
-        construct_(std::forward<text_t>(text));
+        construct_(std::forward<text_t>(text), fm_index_construction_options{});
+    }
+
+    //!\copydoc seqan3::fm_index::fm_index(text_t && text, fm_index_construction_options const & options)
+    template <std::ranges::bidirectional_range text_t>
+    reverse_fm_index(text_t && text, fm_index_construction_options const & options)
+    {
+        construct_(std::forward<text_t>(text), options);
     }
 
 };
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \author Christopher Pockrandt <christopher.pockrandt AT fu-berlin.de>
+ * \brief Provides seqan3::fm_index_construction_options.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <limits>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Options that influence how a seqan3::fm_index or seqan3::bi_fm_index is constructed.
+ * \ingroup search_fm_index
+ *
+ * \details
+ *
+ * Except for the lookup table, the options only influence the resources used during construction. An index built
+ * with any combination of the other options is identical to an index built with the default options, in particular
+ * it serialises to the same bytes.
+ *
+ * ### Threads
+ *
+ * With `thread_count > 1`, the conversion of the text into the construction input is split across threads.
+ * The seqan3::bi_fm_index additionally builds the index of the original and of the reversed text concurrently, each
+ * using half of the threads and half of the memory limit.
+ * The suffix array and the Burrows-Wheeler transform of one text are always computed sequentially by the SDSL, which
+ * does not offer a parallel suffix sorter. For a seqan3::fm_index, this step dominates the construction time and
+ * does not become faster with more threads; for a seqan3::bi_fm_index, two threads at most halve it.
+ *
+ * ### Memory limit
+ *
+ * By default, the index is constructed in memory. The in-memory construction needs about
+ * seqan3::fm_index_construction_options::bytes_per_symbol bytes per symbol of the text.
+ * If this exceeds `memory_limit`, the SDSL keeps its intermediate files, i.e. the text, the suffix array and the
+ * Burrows-Wheeler transform, in `tmp_directory` instead of its in-memory file system, and the suffix array is
+ * computed by the semi-external suffix sorter `sdsl::SE_SAIS`, which writes it to disk while sorting. The peak heap
+ * usage is then about the text, the buffers of the sorter and the resulting index instead of 8 bytes per symbol.
+ * The suffix sorter is a global setting of the SDSL; constructions exceeding the memory limit therefore wait for all
+ * other constructions to finish and vice versa.
+ * The intermediate files are removed after the construction.
+ *
+ * ### Lookup table
+ *
+ * With `lookup_table_depth = k > 0`, the suffix array intervals of all words up to length `k` are precomputed and
+ * stored with the index. While the query of a cursor is at most `k` characters long, every extend_right(),
+ * extend_left(), cycle_back() and cycle_front() as well as the extension by a sequence is looked up in the table
+ * instead of performing backward search steps. seqan3::search benefits for all queries: the first `k` characters
+ * of exact and batched searches are looked up as well as the enumeration of errors in the first `k` characters by
+ * backtracking and search schemes. The table is filled using all `thread_count` threads and contains
+ * \f$\sigma + \sigma^2 + \ldots + \sigma^k\f$ entries of two (three for the seqan3::bi_fm_index) bit-compressed
+ * integers each, e.g. about 256 MiB for seqan3::dna4, `k = 12` and a bidirectional index of a human genome.
+ * Unlike the other options, the lookup table is part of the index. It is not considered by `operator==` though.
+ *
+ * \include test/snippet/search/fm_index_lookup_table.cpp
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/fm_index_construction_options.cpp
+ */
+struct fm_index_construction_options
+{
+    /*!\brief The estimated peak memory in bytes per text symbol of the in-memory construction.
+     *
+     * \details
+     *
+     * The SDSL holds the text twice (our copy and the one in its in-memory file system) and sorts the suffixes in an
+     * array of 64-bit integers, i.e. 1 + 1 + 8 bytes per symbol. Texts shorter than \f$2^{31}\f$ only need 32-bit
+     * integers, so the estimate is conservative for them.
+     */
+    static constexpr size_t bytes_per_symbol{10u};
+
+    //!\brief The number of threads to use for the construction. Must be at least 1.
+    size_t thread_count{1u};
+    //!\brief The number of bytes the construction may use before keeping intermediate data on disk.
+    size_t memory_limit{std::numeric_limits<size_t>::max()};
+    /*!\brief The directory to store intermediate files in if the memory limit is exceeded.
+     *        If empty, `std::filesystem::temp_directory_path()` is used.
+     */
+    std::filesystem::path tmp_directory{};
+    //!\brief The length of the words whose suffix array intervals are precomputed; `0` disables the lookup table.
+    size_t lookup_table_depth{0u};
+
+    /*!\brief Whether a text of the given length can be indexed in memory within `memory_limit`.
+     * \param[in] text_size The length of the text to index, including delimiters.
+     * \returns `true` if the index can be constructed in memory, `false` otherwise.
+     */
+    constexpr bool fits_in_memory(size_t const text_size) const noexcept
+    {
+        return text_size <= memory_limit / bytes_per_symbol;
+    }
+
+    //!\brief Returns seqan3::fm_index_construction_options::tmp_directory or the system's temporary directory.
+    std::filesystem::path tmp_directory_or_default() const
+    {
+        return tmp_directory.empty() ? std::filesystem::temp_directory_path() : tmp_directory;
+    }
+};
+
+} // namespace seqan3
@@ -23,6 +23,8 @@
 #include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_lookup_table.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_prefetch.hpp>
 #include <seqan3/utility/views/slice.hpp>
 
 namespace seqan3
@@ -125,10 +127,14 @@ private:
     node_type node{};
     //!\brief Alphabet size of the index without delimiters
     sdsl_sigma_type sigma{};
+    //!\brief Code of the query in the lookup table of the index. Only valid while is_in_lookup_table(query_length()).
+    size_t lookup_code{};
 
     template <typename _index_t>
     friend class bi_fm_index_cursor;
 
+    friend class detail::fm_index_lookup_table;
+
     //!\brief Helper function to recompute text positions since the indexed text is reversed.
     size_type offset() const noexcept
     {
@@ -136,6 +142,27 @@ private:
         return index->index.size() - query_length() - 1; // since the string is reversed during construction
     }
 
+    //!\brief Whether the queries of the given length (`> 0`) are looked up in the lookup table of the index.
+    bool is_in_lookup_table(size_type const length) const noexcept
+    {
+        return length <= index->lookup_table.depth();
+    }
+
+    /*!\brief Moves the cursor to the query of the given length and code if it occurs in the text.
+     * \details The parent interval is not changed.
+     */
+    bool lookup(size_type const length, size_t const code) noexcept
+    {
+        detail::fm_index_lookup_table_entry const entry = index->lookup_table.at(length, code);
+        if (entry.count == 0)
+            return false;
+
+        sdsl_char_type const c = index->lookup_table.last_rank(code) + 1;
+        node = {entry.lb, entry.lb + entry.count - 1, length, c};
+        lookup_code = code;
+        return true;
+    }
+
     //!\brief Optimized backward search without alphabet mapping
     bool backward_search(sdsl_index_type const & csa,
                          sdsl_char_type const c,
@@ -266,8 +293,23 @@ public:
         // store all cursors at once in a private std::array of cursors
         assert(index != nullptr);
 
-        sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
         size_type _lb = node.lb, _rb = node.rb;
+
+        if (is_in_lookup_table(node.depth + 1))
+        {
+            for (size_t rank = 0; rank + 1 < sigma; ++rank)
+            {
+                if (lookup(node.depth + 1, index->lookup_table.append(lookup_code, rank)))
+                {
+                    parent_lb = _lb;
+                    parent_rb = _rb;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        sdsl_char_type c = 1; // NOTE: start with 0 or 1 depending on implicit_sentintel
         while (c < sigma && !backward_search(index->index, index->index.comp2char[c], _lb, _rb))
         {
             ++c;
@@ -310,6 +352,19 @@ public:
 
         size_type _lb = node.lb, _rb = node.rb;
 
+        if (is_in_lookup_table(node.depth + 1))
+        {
+            if (!lookup(node.depth + 1,
+                        index->lookup_table.append(lookup_code, seqan3::to_rank(static_cast<index_alphabet_type>(c)))))
+            {
+                return false;
+            }
+
+            parent_lb = _lb;
+            parent_rb = _rb;
+            return true;
+        }
+
         sdsl_char_type c_char = seqan3::to_rank(static_cast<index_alphabet_type>(c)) + 1;
 
         if (backward_search(index->index, c_char, _lb, _rb))
@@ -340,6 +395,10 @@ public:
      * If extending fails in the middle of the sequence, all previous computations are rewound to restore the cursor's
      * state before calling this method.
      *
+     * If the index was constructed with a seqan3::fm_index_construction_options::lookup_table_depth of \f$k > 0\f$,
+     * the characters up to the \f$k\f$-th character of the query are looked up in constant time instead of performing
+     * one backward search step each.
+     *
      * ### Complexity
      *
      * \f$|seq| * O(T_{BACKWARD\_SEARCH})\f$
@@ -360,10 +419,40 @@ public:
         size_type _lb = node.lb, _rb = node.rb;
         size_type new_parent_lb = parent_lb, new_parent_rb = parent_rb;
 
-        sdsl_char_type c{};
+        sdsl_char_type c = node.last_char; // an empty seq does not change the cursor
         size_t len{0};
+        size_t new_lookup_code = lookup_code;
 
-        for (auto it = std::ranges::begin(seq); it != std::ranges::end(seq); ++len, ++it)
+        auto it = std::ranges::begin(seq);
+        auto const last = std::ranges::end(seq);
+
+        detail::fm_index_lookup_table const & lookup_table = index->lookup_table;
+        if (is_in_lookup_table(node.depth + 1) && it != last)
+        {
+            auto const [prefix_length, code] =
+                lookup_table.template encode<index_alphabet_type>(it, last, node.depth, lookup_code);
+            detail::fm_index_lookup_table_entry const entry = lookup_table.at(prefix_length, code);
+            if (entry.count == 0)
+                return false;
+
+            new_parent_lb = _lb; // the current node is the parent if only one character was looked up
+            new_parent_rb = _rb;
+            if (prefix_length > node.depth + 1)
+            {
+                detail::fm_index_lookup_table_entry const parent =
+                    lookup_table.at(prefix_length - 1, lookup_table.drop_last(code));
+                new_parent_lb = parent.lb;
+                new_parent_rb = parent.lb + parent.count - 1;
+            }
+
+            _lb = entry.lb;
+            _rb = entry.lb + entry.count - 1;
+            c = lookup_table.last_rank(code) + 1;
+            len = prefix_length - node.depth;
+            new_lookup_code = code;
+        }
+
+        for (; it != last; ++len, ++it)
         {
             // The rank cannot exceed 255 for single text and 254 for text collections as they are reserved as sentinels
             // for the indexed text.
@@ -381,9 +470,42 @@ public:
         parent_lb = new_parent_lb;
         parent_rb = new_parent_rb;
         node = {_lb, _rb, len + node.depth, c};
+        lookup_code = new_lookup_code;
         return true;
     }
 
+    /*!\brief Hints the processor to load the first memory that the next extend_right(char) call accesses.
+     *
+     * \details
+     *
+     * This does not change the cursor. Issuing the hint and doing other work, e.g. extending the cursors of other
+     * queries, before calling extend_right(char) hides the latency of that memory access behind that work.
+     * seqan3::search does this for exact searches when configured with seqan3::search_cfg::batch.
+     *
+     * The words of the bit vector of the wavelet tree root and the blocks of its rank support at both interval bounds
+     * are prefetched, see seqan3::detail::fm_index_prefetch_rank. For EPR dictionaries, this is all memory of the
+     * next step. The deeper levels of the wavelet tree are loaded by extend_right(char) itself. Nothing is prefetched
+     * if the next step is looked up in the lookup table.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    void prefetch_extend_right() const noexcept
+    {
+        assert(index != nullptr);
+
+        if (is_in_lookup_table(node.depth + 1)) // extend_right(char) does not access the rank support
+            return;
+
+        detail::fm_index_prefetch_rank(index->index, node.lb);
+        detail::fm_index_prefetch_rank(index->index, node.rb + 1);
+    }
+
     /*!\brief Tries to replace the rightmost character of the query by the next lexicographically larger character such
      *        that the query is found in the text.
      *        \if DEV
@@ -416,6 +538,15 @@ public:
         // parent_lb > parent_rb --> invalid interval
         assert(parent_lb <= parent_rb);
 
+        if (is_in_lookup_table(node.depth))
+        {
+            size_t const parent_code = index->lookup_table.drop_last(lookup_code);
+            for (size_t rank = index->lookup_table.last_rank(lookup_code) + 1; rank + 1 < sigma; ++rank)
+                if (lookup(node.depth, index->lookup_table.append(parent_code, rank)))
+                    return true;
+            return false;
+        }
+
         sdsl_char_type c = node.last_char + 1;
         size_type _lb = parent_lb, _rb = parent_rb;
 
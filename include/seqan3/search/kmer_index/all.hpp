@@ -12,9 +12,7 @@
 
 /*!\defgroup search_kmer_index k-mer Index
  * \ingroup search
- * \brief Implementation of shapes for a k-mer Index.
- *
- * \note The k-mer index is not yet implemented.
+ * \brief Implementation of a k-mer Index and of shapes for k-mers.
  *
  * \details
  *
@@ -26,8 +24,14 @@
  * Usually the query length (k) is small and the underlying text is very large.
  * The parameter k and the position(s) of wildcards must be fixed at index creation with
  * seqan3::ungapped or seqan3::shape.
+ *
+ * The seqan3::kmer_index can be used with seqan3::search. Queries are searched by looking up k-mers of the query and
+ * verifying the candidate positions in the text.
  */
 
 #pragma once
 
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/search/kmer_index/kmer_index_construction_options.hpp>
+#include <seqan3/search/kmer_index/kmer_index_cursor.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
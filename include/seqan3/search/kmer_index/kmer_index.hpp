@@ -0,0 +1,541 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::kmer_index.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <seqan3/std/ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/core/range/type_traits.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/search/fm_index/fm_index_construction_options.hpp>
+#include <seqan3/search/kmer_index/kmer_index_construction_options.hpp>
+#include <seqan3/search/kmer_index/kmer_index_cursor.hpp>
+#include <seqan3/search/kmer_index/shape.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+#include <seqan3/utility/parallel/detail/parallel_for_chunks.hpp>
+
+namespace seqan3::detail
+{
+//!\cond
+template <typename configuration_t, typename index_t, typename ...policies_t>
+class kmer_index_search_algorithm;
+//!\endcond
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief The SeqAn k-mer index.
+ * \ingroup search_kmer_index
+ * \tparam alphabet_t        The alphabet type; must model seqan3::semialphabet.
+ * \tparam text_layout_mode_ Indicates whether this index works on a text collection or a single text.
+ *                           See seqan3::text_layout.
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * The k-mer index stores the occurrences of all k-mers of a text for a seqan3::shape that is chosen at construction.
+ * The k-mers are identified by their hash values as computed by seqan3::views::kmer_hash, i.e. gapped shapes are
+ * supported. The occurrences are stored in a single array, grouped by k-mer and sorted by position within each group
+ * (compressed sparse row layout). The group of a k-mer is found either by direct addressing with its hash value or,
+ * if there are too many possible hash values, by an open addressing hash table that only contains the k-mers of the
+ * text. See seqan3::kmer_index_construction_options.
+ *
+ * The index also stores the text. This allows seqan3::search to find queries with errors by looking up k-mers of the
+ * query and verifying the candidate positions in the text (seed-and-verify), see seqan3::kmer_index::cursor_type.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/kmer_index/kmer_index.cpp
+ */
+template <semialphabet alphabet_t, text_layout text_layout_mode_>
+class kmer_index
+{
+public:
+    //!\brief Indicates whether index is built over a collection.
+    static constexpr text_layout text_layout_mode = text_layout_mode_;
+
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The type of the underlying character of the indexed text.
+    using alphabet_type = alphabet_t;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = size_t;
+    //!\brief The type of the cursor.
+    using cursor_type = kmer_index_cursor<kmer_index>;
+    //!\}
+
+    template <typename index_t>
+    friend class kmer_index_cursor;
+
+    template <typename configuration_t, typename index_t, typename ...policies_t>
+    friend class detail::kmer_index_search_algorithm;
+
+private:
+    //!\brief An entry of the open addressing hash table.
+    struct table_entry
+    {
+        //!\brief The hash value of the k-mer.
+        size_t hash{};
+        //!\brief The id of the group of occurrences of the k-mer, or `no_group` if the entry is not used.
+        size_type group{no_group};
+
+        //!\brief Serialisation support function.
+        template <cereal_archive archive_t>
+        void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+        {
+            archive(hash);
+            archive(group);
+        }
+
+        //!\brief Returns `true` if both entries are equal.
+        friend bool operator==(table_entry const &, table_entry const &) = default;
+    };
+
+    //!\brief Marks an unused entry of the hash table.
+    static constexpr size_type no_group{std::numeric_limits<size_type>::max()};
+
+    //!\brief The shape of the k-mers.
+    seqan3::shape shape_{};
+    //!\brief The concatenation of all texts.
+    std::vector<alphabet_t> text{};
+    //!\brief The begin positions of the texts within `text` followed by the length of `text`.
+    std::vector<size_type> text_begin{0u};
+    //!\brief For each group of occurrences, the begin of the group in `occurrences`, followed by its size.
+    std::vector<size_type> group_begin{0u};
+    //!\brief The positions of all k-mers in `text`, grouped by k-mer.
+    std::vector<size_type> occurrences{};
+    //!\brief The open addressing hash table; empty if the hash value is the id of the group (direct addressing).
+    std::vector<table_entry> table{};
+    //!\brief `64 - log2(table.size())`; the hash table is indexed by the highest bits of a multiplicative hash.
+    uint8_t table_shift{64u};
+
+    /*!\brief Returns the number of possible hash values of the shape, or `0` if it exceeds `limit`.
+     * \param[in] s The shape.
+     * \param[in] limit The maximal number of possible hash values.
+     */
+    static size_t hash_value_count(seqan3::shape const & s, size_t const limit) noexcept
+    {
+        size_t count{1u};
+        for (size_t i = 0; i < s.count(); ++i)
+        {
+            if (count > limit / alphabet_size<alphabet_t>)
+                return 0u;
+            count *= alphabet_size<alphabet_t>;
+        }
+        return count;
+    }
+
+    //!\brief Returns the slot in the hash table at which the search for `hash` starts.
+    size_t table_slot(size_t const hash) const noexcept
+    {
+        return (table_shift == 64u) ? 0u : (hash * 0x9E3779B97F4A7C15ULL) >> table_shift;
+    }
+
+    /*!\brief Inserts `hash` into the hash table if necessary and returns its group id.
+     * \param[in] hash The hash value.
+     * \param[in, out] groups The number of groups; incremented if `hash` was not in the table.
+     */
+    size_type insert(size_t const hash, size_type & groups)
+    {
+        // Keep the load factor at most 1/2.
+        if (2u * (groups + 1u) > table.size())
+        {
+            std::vector<table_entry> old_table(std::max<size_t>(1024u, 2u * table.size()));
+            std::swap(table, old_table);
+            table_shift = 64u - std::countr_zero(table.size());
+
+            for (table_entry const & entry : old_table)
+                if (entry.group != no_group)
+                    find_slot(entry.hash) = entry;
+        }
+
+        table_entry & entry = find_slot(hash);
+        if (entry.group == no_group)
+            entry = table_entry{hash, groups++};
+
+        return entry.group;
+    }
+
+    //!\brief Returns the entry of `hash` or the empty entry at which it would be inserted (linear probing).
+    table_entry & find_slot(size_t const hash) noexcept
+    {
+        size_t const mask = table.size() - 1u;
+        size_t slot = table_slot(hash);
+        while (table[slot].group != no_group && table[slot].hash != hash)
+            slot = (slot + 1u) & mask;
+
+        return table[slot];
+    }
+
+    //!\brief Returns the group id of `hash` or `no_group` if the k-mer does not occur in the text.
+    size_type group_of(size_t const hash) const noexcept
+    {
+        if (table.empty())
+            return (hash + 1u < group_begin.size()) ? hash : no_group;
+
+        size_t const mask = table.size() - 1u;
+        for (size_t slot = table_slot(hash); table[slot].group != no_group; slot = (slot + 1u) & mask)
+        {
+            if (table[slot].hash == hash)
+                return table[slot].group;
+        }
+
+        return no_group;
+    }
+
+    //!\brief Returns the range of `occurrences` that contains the k-mer with the given hash value.
+    std::pair<size_type, size_type> occurrence_range(size_t const hash) const noexcept
+    {
+        size_type const group = group_of(hash);
+        if (group == no_group)
+            return {0u, 0u};
+
+        return {group_begin[group], group_begin[group + 1]};
+    }
+
+    //!\brief Returns the `i`-th occurrence as position in the concatenated text.
+    size_type occurrence(size_type const i) const noexcept
+    {
+        return occurrences[i];
+    }
+
+    //!\brief Converts a position in the concatenated text into a pair of reference id and reference position.
+    std::pair<size_type, size_type> to_reference_position(size_type const position) const noexcept
+    {
+        size_type const reference_id = std::ranges::upper_bound(text_begin, position) - text_begin.begin() - 1;
+        return {reference_id, position - text_begin[reference_id]};
+    }
+
+    /*!\brief Constructs the index.
+     * \param[in] text_collection The texts to index.
+     * \param[in] options The construction options.
+     */
+    template <typename text_collection_t>
+    void construct(text_collection_t && text_collection, kmer_index_construction_options const & options)
+    {
+        if (shape_.count() == 0u || shape_.count() > 64 / std::log2(alphabet_size<alphabet_t>))
+            throw std::invalid_argument{"The chosen shape/alphabet combination is not valid. "
+                                        "The alphabet or shape size must be reduced."};
+
+        text_begin.assign(1u, 0u);
+        for (auto && single_text : text_collection)
+        {
+            for (auto && chr : single_text)
+                text.push_back(chr);
+            text_begin.push_back(text.size());
+        }
+
+        size_t const span = std::ranges::size(shape_);
+
+        // The k-mers of each text start at [text_begin[i], text_begin[i + 1] - span + 1).
+        auto for_each_kmer_range = [&] (size_type const begin, size_type const end, auto && fn)
+        {
+            size_type i = std::ranges::upper_bound(text_begin, begin) - text_begin.begin() - 1;
+            for (; i + 1u < text_begin.size() && text_begin[i] < end; ++i)
+            {
+                if (text_begin[i + 1] - text_begin[i] < span)
+                    continue;
+
+                size_type const kmers_begin = std::max(begin, text_begin[i]);
+                size_type const kmers_end = std::min(end, text_begin[i + 1] - span + 1u);
+                if (kmers_begin < kmers_end)
+                    fn(kmers_begin, kmers_end);
+            }
+        };
+
+        // Compute the hash values of all k-mers in parallel.
+        std::vector<size_t> hashes(text.size());
+        detail::parallel_for_chunks(text.size(),
+                                    size_t{1u} << 16,
+                                    options.thread_count,
+                                    [&] (size_type const begin, size_type const end)
+        {
+            for_each_kmer_range(begin, end, [&] (size_type const kmers_begin, size_type const kmers_end)
+            {
+                std::span<alphabet_t const> const kmers{text.data() + kmers_begin, kmers_end - kmers_begin + span - 1u};
+                std::ranges::copy(kmers | views::kmer_hash(shape_), hashes.begin() + kmers_begin);
+            });
+        });
+
+        // Replace the hash values by the group ids.
+        size_type groups = hash_value_count(shape_, options.direct_addressing_limit);
+        if (groups == 0u)
+        {
+            for_each_kmer_range(0u, text.size(), [&] (size_type const kmers_begin, size_type const kmers_end)
+            {
+                for (size_type position = kmers_begin; position < kmers_end; ++position)
+                    hashes[position] = insert(hashes[position], groups);
+            });
+        }
+
+        // Count the occurrences per group, compute the prefix sums and distribute the occurrences.
+        group_begin.assign(groups + 1u, 0u);
+        for_each_kmer_range(0u, text.size(), [&] (size_type const kmers_begin, size_type const kmers_end)
+        {
+            for (size_type position = kmers_begin; position < kmers_end; ++position)
+                ++group_begin[hashes[position] + 1u];
+        });
+
+        for (size_type group = 0; group < groups; ++group)
+            group_begin[group + 1u] += group_begin[group];
+
+        std::vector<size_type> next{group_begin.begin(), group_begin.end() - 1};
+        occurrences.resize(group_begin.back());
+        for_each_kmer_range(0u, text.size(), [&] (size_type const kmers_begin, size_type const kmers_end)
+        {
+            for (size_type position = kmers_begin; position < kmers_end; ++position)
+                occurrences[next[hashes[position]]++] = position;
+        });
+    }
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_index() = default; //!< Defaulted.
+    kmer_index(kmer_index const &) = default; //!< Defaulted.
+    kmer_index(kmer_index &&) = default; //!< Defaulted.
+    kmer_index & operator=(kmer_index const &) = default; //!< Defaulted.
+    kmer_index & operator=(kmer_index &&) = default; //!< Defaulted.
+    ~kmer_index() = default; //!< Defaulted.
+
+    /*!\brief Constructs the index of all k-mers of the given text.
+     * \tparam text_t The type of range to construct from; must model std::ranges::forward_range.
+     * \param[in] text The text to construct from; a single text or a collection of texts, see
+     *                 seqan3::text_layout.
+     * \param[in] s The shape of the k-mers.
+     * \param[in] options The seqan3::kmer_index_construction_options, e.g. the number of threads.
+     * \throws std::invalid_argument if the hash values of the shape/alphabet combination cannot be represented in
+     *         64 bit or if the shape is empty.
+     *
+     * \details
+     *
+     * The resulting index does not depend on the number of threads.
+     *
+     * ### Complexity
+     *
+     * Expected linear in the length of the text plus the number of groups of occurrences.
+     */
+    template <std::ranges::forward_range text_t>
+    kmer_index(text_t && text, seqan3::shape const & s, kmer_index_construction_options const & options = {}) :
+        shape_{s}
+    {
+        static_assert(range_dimension_v<text_t> == 1u + text_layout_mode,
+                      "The dimensions of the text do not match the text layout of the kmer_index.");
+        static_assert(std::convertible_to<range_innermost_value_t<text_t>, alphabet_t>,
+                      "The alphabet of the text must be convertible to the alphabet of the index.");
+
+        if constexpr (text_layout_mode == text_layout::single)
+            construct(std::views::single(std::views::all(text)), options);
+        else
+            construct(text, options);
+    }
+    //!\}
+
+    /*!\brief Returns the length of the indexed text, i.e. the sum of the lengths of all texts.
+     * \returns The length of the indexed text.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type size() const noexcept
+    {
+        return text.size();
+    }
+
+    /*!\brief Checks whether the index is empty.
+     * \returns `true` if the index is empty, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Returns the shape of the k-mers.
+     * \returns The seqan3::shape the index was constructed with.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    seqan3::shape const & shape() const noexcept
+    {
+        return shape_;
+    }
+
+    /*!\brief Returns whether the occurrences of a k-mer are found by direct addressing with its hash value.
+     * \returns `true` if the index uses direct addressing, `false` if it uses the open addressing hash table.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool uses_direct_addressing() const noexcept
+    {
+        return table.empty();
+    }
+
+    /*!\brief Returns the number of bytes the index occupies in memory.
+     * \returns The size of all underlying data structures in bytes.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_t size_in_bytes() const noexcept
+    {
+        return text.size() * sizeof(alphabet_t) + (text_begin.size() + group_begin.size() + occurrences.size()) *
+               sizeof(size_type) + table.size() * sizeof(table_entry);
+    }
+
+    /*!\brief Compares two indices.
+     * \returns `true` if the indices are equal, false otherwise.
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool operator==(kmer_index const & rhs) const noexcept
+    {
+        return std::tie(shape_, text, text_begin, group_begin, occurrences, table) ==
+               std::tie(rhs.shape_, rhs.text, rhs.text_begin, rhs.group_begin, rhs.occurrences, rhs.table);
+    }
+
+    /*!\brief Compares two indices.
+     * \returns `true` if the indices are unequal, false otherwise.
+     *
+     * ### Complexity
+     *
+     * Linear.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool operator!=(kmer_index const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\brief Returns a seqan3::kmer_index_cursor on the index that can be used for looking up k-mers.
+     * \returns A seqan3::kmer_index_cursor that does not point to any occurrence.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    cursor_type cursor() const noexcept
+    {
+        return {*this};
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(shape_);
+        archive(text);
+        archive(text_begin);
+        archive(group_begin);
+        archive(occurrences);
+        archive(table);
+        archive(table_shift);
+
+        auto sigma = alphabet_size<alphabet_t>;
+        archive(sigma);
+        if (sigma != alphabet_size<alphabet_t>)
+        {
+            throw std::logic_error{"The kmer_index was built over an alphabet of size " + std::to_string(sigma) +
+                                   " but it is being read into a kmer_index with an alphabet of size " +
+                                   std::to_string(alphabet_size<alphabet_t>) + "."};
+        }
+
+        bool tmp = text_layout_mode;
+        archive(tmp);
+        if (tmp != text_layout_mode)
+        {
+            throw std::logic_error{std::string{"The kmer_index was built over a "} +
+                                   (tmp ? "text collection" : "single text") +
+                                   " but it is being read into a kmer_index expecting a " +
+                                   (text_layout_mode ? "text collection." : "single text.")};
+        }
+    }
+    //!\endcond
+};
+
+/*!\name Template argument type deduction guides
+ * \{
+ */
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+kmer_index(text_t &&, shape const &)
+    -> kmer_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
+
+//!\brief Deduces the alphabet and dimensions of the text.
+template <std::ranges::range text_t>
+kmer_index(text_t &&, shape const &, kmer_index_construction_options const &)
+    -> kmer_index<range_innermost_value_t<text_t>, text_layout{range_dimension_v<text_t> != 1}>;
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,49 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::kmer_index_construction_options.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3
+{
+
+/*!\brief Options that influence how a seqan3::kmer_index is constructed.
+ * \ingroup search_kmer_index
+ *
+ * \details
+ *
+ * ### Threads
+ *
+ * With `thread_count > 1`, the hash values of the k-mers of the text are computed by several threads.
+ *
+ * ### Direct addressing
+ *
+ * If the number of possible hash values, i.e. \f$\sigma^{w}\f$ for an alphabet of size \f$\sigma\f$ and a shape with
+ * \f$w\f$ informative positions, does not exceed `direct_addressing_limit`, the occurrences of a k-mer are found by
+ * using its hash value as an index into an array of \f$\sigma^{w} + 1\f$ offsets. Otherwise, only the hash values
+ * that occur in the text are stored in an open addressing hash table. The layout does not change the results.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/kmer_index/kmer_index.cpp
+ */
+struct kmer_index_construction_options
+{
+    //!\brief The number of threads to use for the construction. Must be at least 1.
+    size_t thread_count{1u};
+    //!\brief The maximal number of possible hash values for which direct addressing is used [default: \f$2^{22}\f$].
+    size_t direct_addressing_limit{size_t{1u} << 22};
+};
+
+} // namespace seqan3
@@ -0,0 +1,289 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::kmer_index_cursor.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <seqan3/std/ranges>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+namespace seqan3
+{
+
+/*!\brief The cursor of the seqan3::kmer_index.
+ * \ingroup search_kmer_index
+ * \tparam index_t The type of the underlying index, i.e. a seqan3::kmer_index.
+ * \implements seqan3::cerealisable
+ *
+ * \details
+ *
+ * A cursor points to the occurrences of a k-mer in the indexed text. It is positioned with lookup(), which either
+ * takes a k-mer or its hash value as computed by seqan3::views::kmer_hash with the shape of the index. Like the
+ * cursors of the FM indices, an unsuccessful lookup leaves the cursor unmodified. Default constructed cursors are
+ * invalid and a cursor returned by seqan3::kmer_index::cursor() does not point to any occurrence.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/kmer_index/kmer_index.cpp
+ */
+template <typename index_t>
+class kmer_index_cursor
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief Type of the index.
+    using index_type = index_t;
+    //!\brief Type for representing positions in the indexed text.
+    using size_type = typename index_type::size_type;
+    //!\brief Type for representing the distance between a located position and the stored occurrence.
+    using difference_type = std::ptrdiff_t;
+    //!\}
+
+private:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief The result value type when calling locate, a pair of reference id and reference position.
+    using locate_result_value_type = std::pair<size_type, size_type>;
+    //!\brief The result vector type when calling locate.
+    using locate_result_type = std::vector<locate_result_value_type>;
+    //!\}
+
+    //!\brief Underlying k-mer index.
+    index_type const * index{nullptr};
+    //!\brief The first occurrence of the k-mer in the occurrence array of the index.
+    size_type first{};
+    //!\brief One past the last occurrence of the k-mer in the occurrence array of the index.
+    size_type last{};
+    //!\brief The distance that is subtracted from each occurrence when locating it.
+    difference_type offset{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    kmer_index_cursor() noexcept = default; //!< Default constructor. Accessing member functions leads to undefined behaviour.
+    kmer_index_cursor(kmer_index_cursor const &) noexcept = default; //!< Defaulted.
+    kmer_index_cursor(kmer_index_cursor &&) noexcept = default; //!< Defaulted.
+    kmer_index_cursor & operator=(kmer_index_cursor const &) noexcept = default; //!< Defaulted.
+    kmer_index_cursor & operator=(kmer_index_cursor &&) noexcept = default; //!< Defaulted.
+    ~kmer_index_cursor() = default; //!< Defaulted.
+
+    //!\brief Construct from the given index. The cursor does not point to any occurrence.
+    kmer_index_cursor(index_t const & _index) noexcept : index{&_index}
+    {}
+
+    /*!\cond DEV
+     * \brief Construct a cursor pointing to the occurrences `[first, last)` of the occurrence array of the index.
+     * \param[in] _index  The index.
+     * \param[in] _first  The first occurrence.
+     * \param[in] _last   One past the last occurrence.
+     * \param[in] _offset The distance that is subtracted from each occurrence when locating it.
+     *
+     * \details
+     *
+     * The seed-and-verify search reports verified matches as cursors pointing to the occurrence of the seed, shifted
+     * to the begin position of the match.
+     */
+    kmer_index_cursor(index_t const & _index,
+                      size_type const _first,
+                      size_type const _last,
+                      difference_type const _offset) noexcept :
+        index{&_index}, first{_first}, last{_last}, offset{_offset}
+    {
+        assert(first <= last);
+    }
+    //!\endcond
+    //!\}
+
+    /*!\brief Compares two cursors.
+     * \param[in] rhs Other cursor to compare it to.
+     * \returns `true` if both cursors point to the same occurrences, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool operator==(kmer_index_cursor const & rhs) const noexcept
+    {
+        assert(index != nullptr);
+
+        return std::tie(first, last, offset) == std::tie(rhs.first, rhs.last, rhs.offset);
+    }
+
+    /*!\brief Compares two cursors.
+     * \param[in] rhs Other cursor to compare it to.
+     * \returns `true` if the cursors point to different occurrences, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool operator!=(kmer_index_cursor const & rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    /*!\brief Points the cursor to the occurrences of the k-mer with the given hash value.
+     * \param[in] hash The hash value of the k-mer as computed by seqan3::views::kmer_hash with the shape of the index.
+     * \returns `true` if the k-mer occurs in the text, `false` otherwise.
+     *
+     * ### Complexity
+     *
+     * Constant if the index uses direct addressing; expected constant otherwise.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    bool lookup(size_t const hash) noexcept
+    {
+        assert(index != nullptr);
+
+        auto const [new_first, new_last] = index->occurrence_range(hash);
+        if (new_first == new_last)
+            return false;
+
+        first = new_first;
+        last = new_last;
+        offset = 0;
+        return true;
+    }
+
+    /*!\brief Points the cursor to the occurrences of the given k-mer.
+     * \tparam kmer_t The type of the k-mer; must model std::ranges::forward_range over the index's alphabet.
+     * \param[in] kmer The k-mer; its length must be the size of the shape of the index.
+     * \returns `true` if the k-mer occurs in the text, `false` otherwise or if `kmer` has the wrong length.
+     *
+     * ### Complexity
+     *
+     * Linear in the length of the k-mer.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    template <std::ranges::forward_range kmer_t>
+    //!\cond
+        requires std::convertible_to<std::ranges::range_reference_t<kmer_t>, typename index_t::alphabet_type>
+    //!\endcond
+    bool lookup(kmer_t && kmer) noexcept
+    {
+        assert(index != nullptr);
+
+        if (static_cast<size_t>(std::ranges::distance(kmer)) != std::ranges::size(index->shape()))
+            return false;
+
+        size_t hash{};
+        for (size_t const value : kmer | views::kmer_hash(index->shape()))
+            hash = value;
+
+        return lookup(hash);
+    }
+
+    /*!\brief Counts the number of occurrences of the k-mer in the text.
+     * \returns Number of occurrences of the k-mer in the text.
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    size_type count() const noexcept
+    {
+        assert(index != nullptr);
+
+        return last - first;
+    }
+
+    /*!\brief Locates the occurrences of the k-mer in the text.
+     * \returns Pairs of reference id and position in the reference, sorted by position in the text.
+     *
+     * ### Complexity
+     *
+     * \f$O(count() \cdot \log(number\ of\ references))\f$.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    locate_result_type locate() const
+    {
+        assert(index != nullptr);
+
+        locate_result_type occ{};
+        occ.reserve(count());
+        for (auto && position : lazy_locate())
+            occ.push_back(position);
+
+        return occ;
+    }
+
+    /*!\brief Locates the occurrences of the k-mer in the text on demand, i.e. a std::ranges::view is returned and
+     *        every position is located once it is accessed.
+     * \returns Pairs of reference id and position in the reference, sorted by position in the text.
+     *
+     * ### Complexity
+     *
+     * \f$O(count() \cdot \log(number\ of\ references))\f$.
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    auto lazy_locate() const
+    {
+        assert(index != nullptr);
+
+        return std::views::iota(first, last)
+             | std::views::transform([_index = index, _offset = offset] (size_type const i)
+               {
+                   return _index->to_reference_position(_index->occurrence(i) - _offset);
+               });
+    }
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        archive(first);
+        archive(last);
+        archive(offset);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3
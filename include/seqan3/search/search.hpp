@@ -19,11 +19,13 @@
 #include <seqan3/core/algorithm/detail/algorithm_executor_blocking.hpp>
 #include <seqan3/core/configuration/configuration.hpp>
 #include <seqan3/core/detail/persist_view.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/default_configuration.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
 #include <seqan3/search/configuration/parallel.hpp>
 #include <seqan3/search/detail/search_configurator.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
+#include <seqan3/utility/views/chunk.hpp>
 #include <seqan3/utility/views/convert.hpp>
 #include <seqan3/utility/views/deep.hpp>
 #include <seqan3/utility/views/zip.hpp>
@@ -110,7 +112,24 @@ inline auto search(queries_t && queries,
     detail::search_configuration_validator::validate_query_type<queries_t>();
 
     size_t queries_size = std::ranges::distance(queries);
-    auto indexed_queries = views::zip(std::views::iota(size_t{0}, queries_size), queries);
+    auto indexed_queries = [&] ()
+    {
+        auto zipped_queries = views::zip(std::views::iota(size_t{0}, queries_size), queries);
+
+        // Split the queries into batches that are passed to the algorithm as a whole.
+        if constexpr (decltype(updated_cfg)::template exists<search_cfg::batch>())
+        {
+            size_t const batch_size = get<search_cfg::batch>(updated_cfg).size;
+            if (batch_size == 0u)
+                throw std::invalid_argument{"The size of seqan3::search_cfg::batch must be greater than 0."};
+
+            return zipped_queries | views::chunk(batch_size);
+        }
+        else
+        {
+            return zipped_queries;
+        }
+    }();
 
     using indexed_queries_t = decltype(indexed_queries);
 
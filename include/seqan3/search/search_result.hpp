@@ -23,6 +23,7 @@
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/search/fm_index/bi_fm_index_cursor.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
+#include <seqan3/search/kmer_index/kmer_index_cursor.hpp>
 
 namespace seqan3::detail
 {
@@ -42,7 +43,7 @@ namespace seqan3
  * \see search
  * \tparam query_id_type The type of the query_id; must model std::integral.
  * \tparam cursor_type The type of the cursor; must model seqan3::detail::template_specialisation_of a
- * seqan3::fm_index_cursor or a seqan3::bi_fm_index_cursor
+ * seqan3::fm_index_cursor, a seqan3::bi_fm_index_cursor or a seqan3::kmer_index_cursor
  * \tparam reference_id_type The type of the reference_id; must model std::integral.
  * \tparam reference_begin_position_type The type of the reference_begin_position; must model std::integral.
  *
@@ -74,6 +75,7 @@ template <typename query_id_type,
     requires (std::integral<query_id_type> || std::same_as<query_id_type, detail::empty_type>) &&
              (detail::template_specialisation_of<cursor_type, fm_index_cursor> ||
                      detail::template_specialisation_of<cursor_type, bi_fm_index_cursor> ||
+                     detail::template_specialisation_of<cursor_type, kmer_index_cursor> ||
                      std::same_as<cursor_type, detail::empty_type>) &&
              (std::integral<reference_id_type> || std::same_as<reference_id_type, detail::empty_type>) &&
              (std::integral<reference_begin_position_type> || std::same_as<reference_begin_position_type,
@@ -12,6 +12,15 @@
 
 #pragma once
 
+#include <array>
+#include <seqan3/std/bit>
+#include <cstdint>
+
+// PEXT is microcoded and takes hundreds of cycles on AMD processors before Zen 3.
+#if defined(__BMI2__) && !defined(__znver1) && !defined(__znver2)
+#include <immintrin.h>
+#endif
+
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/alphabet/range/hash.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
@@ -19,6 +28,86 @@
 
 namespace seqan3::detail
 {
+
+/*!\brief Packs the bits of a value that are selected by a fixed mask into the lowest bits, keeping their order.
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * The selected bits are moved to the right in six steps of 1, 2, 4, ..., 32 positions ("compress", Hacker's Delight,
+ * section 7-4). The bits moved by each step only depend on the mask and are computed once by the constructor, hence
+ * the cost does not depend on the mask.
+ *
+ * If BMI2 is enabled at compile time, e.g. by `-mbmi2` or `-march=haswell`, a single `pext` instruction is used
+ * instead, unless the target is an AMD Zen 1 or Zen 2 processor (`-march=znver1`, `-march=znver2`). On those, `pext`
+ * is microcoded and slower than the six steps. Note that a binary built with `-mbmi2` for a generic target also runs
+ * `pext` on Zen 1 and Zen 2; build with the respective `-march` to avoid this.
+ *
+ * The members and the result do not depend on whether `pext` is used, hence translation units that are compiled with
+ * and without BMI2 can be linked together.
+ */
+class bit_extractor
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr bit_extractor() = default; //!< Defaulted.
+    constexpr bit_extractor(bit_extractor const &) = default; //!< Defaulted.
+    constexpr bit_extractor(bit_extractor &&) = default; //!< Defaulted.
+    constexpr bit_extractor & operator=(bit_extractor const &) = default; //!< Defaulted.
+    constexpr bit_extractor & operator=(bit_extractor &&) = default; //!< Defaulted.
+    ~bit_extractor() = default; //!< Defaulted.
+
+    //!\brief Construct from the mask of the bits to extract.
+    constexpr explicit bit_extractor(uint64_t const mask) noexcept : mask_{mask}
+    {
+        uint64_t remaining = mask;
+        uint64_t zeros_to_the_right = ~mask << 1;
+
+        for (size_t step = 0; step < step_masks.size(); ++step)
+        {
+            // Parallel prefix: a bit is set iff an odd number of zeros lies to the right of it.
+            uint64_t odd = zeros_to_the_right ^ (zeros_to_the_right << 1);
+            for (size_t shift = 2; shift < 64u; shift <<= 1)
+                odd ^= odd << shift;
+
+            step_masks[step] = odd & remaining;
+            remaining = (remaining ^ step_masks[step]) | (step_masks[step] >> (size_t{1u} << step));
+            zeros_to_the_right &= ~odd;
+        }
+    }
+    //!\}
+
+    //!\brief Returns the mask of the bits to extract.
+    constexpr uint64_t mask() const noexcept
+    {
+        return mask_;
+    }
+
+    //!\brief Returns the bits of `value` selected by the mask, packed into the lowest bits.
+    uint64_t operator()(uint64_t value) const noexcept
+    {
+#if defined(__BMI2__) && !defined(__znver1) && !defined(__znver2)
+        return _pext_u64(value, mask_);
+#else
+        value &= mask_;
+        for (size_t step = 0; step < step_masks.size(); ++step)
+        {
+            uint64_t const moved = value & step_masks[step];
+            value = (value ^ moved) | (moved >> (size_t{1u} << step));
+        }
+        return value;
+#endif
+    }
+
+private:
+    //!\brief The bits to extract.
+    uint64_t mask_{};
+    //!\brief The bits moved by each step.
+    std::array<uint64_t, 6> step_masks{};
+};
+
 // ---------------------------------------------------------------------------------------------------------------------
 // kmer_hash_view class
 // ---------------------------------------------------------------------------------------------------------------------
@@ -214,6 +303,12 @@ public:
  * To avoid dereferencing the sentinel when iterating, the basic_iterator computes the hash value up until
  * the second to last position and performs the addition of the last position upon
  * access (\ref operator* and \ref operator[]).
+ *
+ * An ungapped seqan3::shape uses a rolling hash. For a gapped seqan3::shape and an alphabet whose size is a power of
+ * two, e.g. seqan3::dna4, the ranks of all positions of the k-mer are packed into one 64-bit word, the packed window.
+ * The window is shifted by one rank per step, and the ranks at the `1`s of the shape are extracted with a bit mask
+ * (seqan3::detail::bit_extractor). Hence, each step costs constant time instead of time linear in the size of the
+ * shape. Gapped shapes over other alphabets recompute the hash value at each position.
  */
 template <std::ranges::view urng_t>
 template <bool const_range>
@@ -264,6 +359,9 @@ public:
     //!\endcond
         : hash_value{std::move(it.hash_value)},
           roll_factor{std::move(it.roll_factor)},
+          packed_window{std::move(it.packed_window)},
+          window_mask{std::move(it.window_mask)},
+          window_extractor{std::move(it.window_extractor)},
           shape_{std::move(it.shape_)},
           text_left{std::move(it.text_left)},
           text_right{std::move(it.text_right)}
@@ -293,6 +391,7 @@ public:
         if (shape_.size() <= std::ranges::distance(text_left, text_right) + 1)
         {
             roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
+            init_packed_window();
             hash_full();
         }
     }
@@ -336,6 +435,7 @@ public:
         if (shape_.size() <= std::ranges::distance(text_left, it_end) + 1)
         {
             roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
+            init_packed_window();
             hash_full();
         }
 
@@ -584,6 +684,18 @@ private:
     //!\brief The factor for the left most position of the hash value.
     size_t roll_factor{0};
 
+    //!\brief The number of bits of a rank in the packed window; only used if the alphabet size is a power of two.
+    static constexpr size_t rank_bits{std::has_single_bit(sigma) ? std::countr_zero(sigma) : 0u};
+
+    //!\brief The ranks of all positions of the k-mer except the last one, the leftmost in the most significant bits.
+    uint64_t packed_window{0};
+
+    //!\brief The bits of the packed window that are occupied by ranks.
+    uint64_t window_mask{0};
+
+    //!\brief Extracts the ranks at the `1`s of the shape from the packed window; its mask is `0` if it is not used.
+    bit_extractor window_extractor{};
+
     //!\brief The shape to use.
     shape shape_;
 
@@ -600,6 +712,10 @@ private:
         {
             hash_roll_forward();
         }
+        else if (window_extractor.mask() != 0u)
+        {
+            hash_roll_forward_packed();
+        }
         else
         {
             std::ranges::advance(text_left,  1);
@@ -632,6 +748,10 @@ private:
         {
             hash_roll_backward();
         }
+        else if (window_extractor.mask() != 0u)
+        {
+            hash_roll_backward_packed();
+        }
         else
         {
             std::ranges::advance(text_left,  -1);
@@ -649,19 +769,75 @@ private:
         hash_full();
     }
 
+    /*!\brief Sets up the masks of the packed window for a gapped shape.
+     *
+     * \details
+     *
+     * The packed window is used iff the shape is gapped and the alphabet size is a power of two. The ranks of all
+     * positions but the last always fit into 64 bits, because `roll_factor` \f$=\sigma^{size - 1}\f$ does.
+     */
+    void init_packed_window() noexcept
+    {
+        size_t const window_size = shape_.size() - 1u;
+
+        if (rank_bits == 0u || shape_.all())
+            return;
+
+        assert(window_size * rank_bits <= 64u);
+
+        window_mask = window_size * rank_bits == 64u ? ~uint64_t{} : (uint64_t{1u} << (window_size * rank_bits)) - 1u;
+
+        uint64_t extract_mask{0};
+        for (size_t i{0}; i < window_size; ++i)
+            if (shape_[i])
+                extract_mask |= ((uint64_t{1u} << rank_bits) - 1u) << ((window_size - 1u - i) * rank_bits);
+
+        window_extractor = bit_extractor{extract_mask};
+    }
+
     //!\brief Calculates a hash value by explicitly looking at each position.
     void hash_full()
     {
         text_right = text_left;
         hash_value = 0;
+        packed_window = 0;
 
         for (size_t i{0}; i < shape_.size() - 1u; ++i)
         {
             hash_value += shape_[i] * to_rank(*text_right);
             hash_value *= shape_[i] ? sigma : 1;
+
+            if constexpr (rank_bits != 0u)
+                packed_window = (packed_window << rank_bits) | to_rank(*text_right);
+
             std::ranges::advance(text_right, 1);
         }
+    }
+
+    //!\brief Calculates the next hash value of a gapped shape via the packed window.
+    void hash_roll_forward_packed()
+    {
+        packed_window = ((packed_window << rank_bits) | to_rank(*text_right)) & window_mask;
+        hash_value = window_extractor(packed_window) << rank_bits;
+
+        std::ranges::advance(text_left,  1);
+        std::ranges::advance(text_right, 1);
+    }
+
+    /*!\brief Calculates the previous hash value of a gapped shape via the packed window.
+     * \attention This function is only available if `it_t` models std::bidirectional_iterator.
+     */
+    void hash_roll_backward_packed()
+        //!\cond
+        requires std::bidirectional_iterator<it_t>
+        //!\endcond
+    {
+        std::ranges::advance(text_left,  -1);
+        std::ranges::advance(text_right, -1);
 
+        packed_window = (packed_window >> rank_bits) |
+                        (static_cast<uint64_t>(to_rank(*text_left)) << ((shape_.size() - 2u) * rank_bits));
+        hash_value = window_extractor(packed_window) << rank_bits;
     }
 
     //!\brief Calculates the next hash value via rolling hash.
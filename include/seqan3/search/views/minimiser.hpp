@@ -13,7 +13,8 @@
 #pragma once
 
 #include <seqan3/std/algorithm>
-#include <deque>
+#include <seqan3/std/bit>
+#include <vector>
 
 #include <seqan3/core/detail/empty_type.hpp>
 #include <seqan3/core/range/detail/adaptor_from_functor.hpp>
@@ -281,10 +282,17 @@ public:
         requires const_range
     //!\endcond
         : minimiser_value{std::move(it.minimiser_value)},
+          minimiser_position{std::move(it.minimiser_position)},
           urng1_iterator{std::move(it.urng1_iterator)},
           urng1_sentinel{std::move(it.urng1_sentinel)},
           urng2_iterator{std::move(it.urng2_iterator)},
-          window_values{std::move(it.window_values)}
+          window_size{std::move(it.window_size)},
+          window_end{std::move(it.window_end)},
+          window_values{std::move(it.window_values)},
+          suffix_minimum_positions{std::move(it.suffix_minimum_positions)},
+          block_end{std::move(it.block_end)},
+          tail_minimum_value{std::move(it.tail_minimum_value)},
+          tail_minimum_position{std::move(it.tail_minimum_position)}
     {}
 
     /*!\brief Construct from begin and end iterators of a given range over std::totally_ordered values, and the number
@@ -308,9 +316,6 @@ public:
         urng1_sentinel{std::move(urng1_sentinel)},
         urng2_iterator{std::move(urng2_iterator)}
     {
-        size_t size = std::ranges::distance(urng1_iterator, urng1_sentinel);
-        window_size = std::min<size_t>(window_size, size);
-
         window_first(window_size);
     }
     //!\}
@@ -324,7 +329,7 @@ public:
     {
         return (lhs.urng1_iterator == rhs.urng1_iterator) &&
                (rhs.urng2_iterator == rhs.urng2_iterator) &&
-               (lhs.window_values.size() == rhs.window_values.size());
+               (lhs.window_size == rhs.window_size);
     }
 
     //!\brief Compare to another basic_iterator.
@@ -395,8 +400,8 @@ private:
     //!\brief The minimiser value.
     value_type minimiser_value{};
 
-    //!\brief The offset relative to the beginning of the window where the minimizer value is found.
-    size_t minimiser_position_offset{};
+    //!\brief The position of the minimiser value, counted from the first value of the range.
+    size_t minimiser_position{};
 
     //!\brief Iterator to the rightmost value of one window.
     urng1_iterator_t urng1_iterator{};
@@ -405,8 +410,63 @@ private:
     //!\brief Iterator to the rightmost value of one window of the second range.
     urng2_iterator_t urng2_iterator{};
 
-    //!\brief Stored values per window. It is necessary to store them, because a shift can remove the current minimiser.
-    std::deque<value_type> window_values{};
+    //!\brief The number of values in one window, at most the number of values in the range.
+    size_t window_size{};
+    //!\brief The position of the rightmost value of the window, counted from the first value of the range.
+    size_t window_end{};
+
+    /*!\brief Stored values per window. It is necessary to store them, because a shift can remove the current minimiser.
+     *
+     * \details
+     *
+     * The values are stored in a ring buffer whose size is a power of two, the value at position `i` is stored at
+     * `i % window_values.size()`.
+     */
+    std::vector<value_type> window_values{};
+
+    /*!\brief For each position `i` of the window at `block_end`, the position of the rightmost minimum of the values
+     *        in `[i, block_end]`.
+     *
+     * \details
+     *
+     * These suffix minima are monotone. They are stored in a ring buffer like `window_values` and are recomputed only
+     * when the window no longer overlaps the window at `block_end`, i.e. at most once per `window_size` values.
+     */
+    std::vector<size_t> suffix_minimum_positions{};
+    //!\brief The position of the rightmost value of the window for which the suffix minima were computed.
+    size_t block_end{};
+    //!\brief The rightmost minimum of the values behind `block_end`.
+    value_type tail_minimum_value{};
+    //!\brief The position of the rightmost minimum of the values behind `block_end`.
+    size_t tail_minimum_position{};
+
+    //!\brief Returns the stored value at `position`, which must lie in the current window.
+    value_type & value_at(size_t const position) noexcept
+    {
+        return window_values[position & (window_values.size() - 1u)];
+    }
+
+    //!\brief Returns the position of the rightmost minimum of `[position, block_end]`.
+    size_t & suffix_minimum_at(size_t const position) noexcept
+    {
+        return suffix_minimum_positions[position & (suffix_minimum_positions.size() - 1u)];
+    }
+
+    //!\brief Computes the suffix minima of the current window, see `suffix_minimum_positions`.
+    void compute_suffix_minima()
+    {
+        size_t const window_begin = window_end + 1u - window_size;
+        size_t minimum_position = window_end;
+
+        for (size_t position = window_end + 1u; position-- > window_begin;)
+        {
+            if (value_at(position) < value_at(minimum_position))
+                minimum_position = position;
+            suffix_minimum_at(position) = minimum_position;
+        }
+
+        block_end = window_end;
+    }
 
     //!\brief Increments iterator by 1.
     void next_unique_minimiser()
@@ -432,27 +492,46 @@ private:
     }
 
     //!\brief Calculates minimisers for the first window.
-    void window_first(size_t const window_size)
+    void window_first(size_t const max_window_size)
     {
-        if (window_size == 0u)
+        if (max_window_size == 0u || urng1_iterator == urng1_sentinel)
             return;
 
-        for (size_t i = 0u; i < window_size - 1u; ++i)
+        window_values.push_back(window_value());
+
+        // The window is shortened to the size of the range, without a second pass to determine the size.
+        while (window_values.size() < max_window_size)
         {
+            urng1_iterator_t next_urng1_iterator = std::ranges::next(urng1_iterator);
+            if (next_urng1_iterator == urng1_sentinel)
+                break;
+
+            urng1_iterator = std::move(next_urng1_iterator);
+            if constexpr (second_range_is_given)
+                ++urng2_iterator;
+
             window_values.push_back(window_value());
-            advance_window();
         }
-        window_values.push_back(window_value());
-        auto minimiser_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
-        minimiser_value = *minimiser_it ;
-        minimiser_position_offset = std::distance(std::begin(window_values), minimiser_it);
+
+        window_size = window_values.size();
+        window_end = window_size - 1u;
+        window_values.resize(std::bit_ceil(window_size));
+        suffix_minimum_positions.resize(window_values.size());
+
+        compute_suffix_minima();
+        minimiser_position = suffix_minimum_at(0u);
+        minimiser_value = value_at(minimiser_position);
     }
 
     /*!\brief Calculates the next minimiser value.
      * \returns True, if new minimiser is found or end is reached. Otherwise returns false.
      * \details
-     * For the following windows, we remove the first window value (is now not in window_values) and add the new
-     * value that results from the window shifting.
+     * For the following windows, we overwrite the first window value (is now not in the window) with the new value
+     * that results from the window shifting.
+     *
+     * If the minimiser leaves the window, the new minimiser is the rightmost minimum of the window. It is either the
+     * stored suffix minimum of the window begin or the minimum of the values behind `block_end`. Hence, each window
+     * takes amortised constant time, independent of the order of the values.
      */
     bool next_minimiser()
     {
@@ -462,25 +541,42 @@ private:
 
         value_type const new_value = window_value();
 
-        window_values.pop_front();
-        window_values.push_back(new_value);
+        ++window_end;
+        value_at(window_end) = new_value;
+
+        if (window_end == block_end + 1u || !(tail_minimum_value < new_value))
+        {
+            tail_minimum_value = new_value;
+            tail_minimum_position = window_end;
+        }
 
-        if (minimiser_position_offset == 0)
+        if (minimiser_position + window_size <= window_end)
         {
-            auto minimiser_it = std::ranges::min_element(window_values, std::less_equal<value_type>{});
-            minimiser_value = *minimiser_it ;
-            minimiser_position_offset = std::distance(std::begin(window_values), minimiser_it);
+            size_t const window_begin = window_end + 1u - window_size;
+
+            if (window_begin > block_end)
+            {
+                compute_suffix_minima();
+                minimiser_position = suffix_minimum_at(window_begin);
+            }
+            else
+            {
+                size_t const suffix_minimum_position = suffix_minimum_at(window_begin);
+                minimiser_position = value_at(suffix_minimum_position) < tail_minimum_value ? suffix_minimum_position
+                                                                                            : tail_minimum_position;
+            }
+
+            minimiser_value = value_at(minimiser_position);
             return true;
         }
 
         if (new_value < minimiser_value)
         {
             minimiser_value = new_value;
-            minimiser_position_offset = window_values.size() - 1;
+            minimiser_position = window_end;
             return true;
         }
 
-        --minimiser_position_offset;
         return false;
     }
 };
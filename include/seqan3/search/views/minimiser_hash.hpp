@@ -12,8 +12,15 @@
 
 #pragma once
 
-#include <seqan3/alphabet/views/complement.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/bit>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include <seqan3/alphabet/nucleotide/concept.hpp>
 #include <seqan3/core/detail/strong_type.hpp>
+#include <seqan3/core/range/type_traits.hpp>
 #include <seqan3/search/views/kmer_hash.hpp>
 #include <seqan3/search/views/minimiser.hpp>
 
@@ -36,6 +43,438 @@ struct window_size : seqan3::detail::strong_type<uint32_t, window_size>
 
 namespace seqan3::detail
 {
+
+// ---------------------------------------------------------------------------------------------------------------------
+// canonical_kmer_hash_view class
+// ---------------------------------------------------------------------------------------------------------------------
+
+/*!\brief The smaller of the k-mer hash values of both strands, computed in a single pass over the forward strand.
+ * \tparam urng_t The type of the underlying range, must model std::ranges::forward_range, the reference type must
+ *                model seqan3::nucleotide_alphabet.
+ * \implements std::ranges::view
+ * \ingroup search_views
+ *
+ * \details
+ *
+ * The value at position `i` is the smaller of the seqan3::views::kmer_hash of the k-mer starting at `i` and the
+ * seqan3::views::kmer_hash of its reverse complement, each XORed with the seed. This is the same as zipping
+ * `urange | views::kmer_hash(shape)` with `urange | views::complement | std::views::reverse | views::kmer_hash(shape)
+ * | std::views::reverse`, but the underlying range is traversed only once and needs not be bidirectional.
+ *
+ * Both hash values are updated in constant time per position:
+ * * If the alphabet size is a power of two, e.g. seqan3::dna4, the ranks of the k-mer and the ranks of its reverse
+ *   complement are packed into one 64-bit word each. The forward window is shifted to the left and the reverse window
+ *   is shifted to the right. For a gapped shape, the ranks at the `1`s of the shape are extracted by a
+ *   seqan3::detail::bit_extractor.
+ * * Otherwise, an ungapped shape uses a rolling hash. The leftmost rank of the reverse complement is removed by
+ *   multiplying with the inverse of the alphabet size modulo \f$2^{64}\f$, which exists for odd alphabet sizes, e.g.
+ *   seqan3::dna5. All other cases recompute both hash values at each position.
+ */
+template <std::ranges::view urng_t>
+class canonical_kmer_hash_view : public std::ranges::view_interface<canonical_kmer_hash_view<urng_t>>
+{
+private:
+    static_assert(std::ranges::forward_range<urng_t>, "The canonical_kmer_hash_view only works on forward_ranges.");
+    static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+                  "The reference type of the underlying range must model seqan3::nucleotide_alphabet.");
+
+    //!\brief The underlying range.
+    urng_t urange{};
+    //!\brief The shape to use.
+    shape shape_{};
+    //!\brief The seed that both hash values are XORed with.
+    uint64_t seed{};
+
+    template <bool const_range>
+    class basic_iterator;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    canonical_kmer_hash_view() = default; //!< Defaulted.
+    canonical_kmer_hash_view(canonical_kmer_hash_view const & rhs) = default; //!< Defaulted.
+    canonical_kmer_hash_view(canonical_kmer_hash_view && rhs) = default; //!< Defaulted.
+    canonical_kmer_hash_view & operator=(canonical_kmer_hash_view const & rhs) = default; //!< Defaulted.
+    canonical_kmer_hash_view & operator=(canonical_kmer_hash_view && rhs) = default; //!< Defaulted.
+    ~canonical_kmer_hash_view() = default; //!< Defaulted.
+
+    /*!\brief Construct from a view, a seqan3::shape and a seed.
+     * \param[in] urange_ The input range to process.
+     * \param[in] s_      The seqan3::shape to use for hashing.
+     * \param[in] seed_   The seed that both hash values are XORed with.
+     * \throws std::invalid_argument if hashes resulting from the shape/alphabet combination cannot be represented in
+     *         `uint64_t`, see seqan3::views::kmer_hash.
+     */
+    canonical_kmer_hash_view(urng_t urange_, shape const & s_, uint64_t const seed_) :
+        urange{std::move(urange_)}, shape_{s_}, seed{seed_}
+    {
+        if (shape_.count() > (64 / std::log2(alphabet_size<std::ranges::range_reference_t<urng_t>>)))
+        {
+            throw std::invalid_argument{"The chosen shape/alphabet combination is not valid. "
+                                        "The alphabet or shape size must be reduced."};
+        }
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first element of the range.
+    basic_iterator<false> begin()
+    {
+        return {std::ranges::begin(urange), std::ranges::end(urange), shape_, seed};
+    }
+
+    //!\copydoc begin()
+    basic_iterator<true> begin() const
+    //!\cond
+        requires const_iterable_range<urng_t>
+    //!\endcond
+    {
+        return {std::ranges::cbegin(urange), std::ranges::cend(urange), shape_, seed};
+    }
+
+    //!\brief Returns a sentinel that compares equal to the iterator behind the last k-mer.
+    std::default_sentinel_t end() const noexcept
+    {
+        return {};
+    }
+    //!\}
+};
+
+//!\brief Iterator for calculating the smaller hash value of both strands.
+template <std::ranges::view urng_t>
+template <bool const_range>
+class canonical_kmer_hash_view<urng_t>::basic_iterator
+{
+private:
+    //!\brief The iterator type of the underlying range.
+    using it_t = maybe_const_iterator_t<const_range, urng_t>;
+    //!\brief The sentinel type of the underlying range.
+    using sentinel_t = maybe_const_sentinel_t<const_range, urng_t>;
+    //!\brief The alphabet type of the underlying range.
+    using alphabet_t = std::iter_value_t<it_t>;
+
+    template <bool>
+    friend class basic_iterator;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Type for distances between iterators.
+    using difference_type = std::iter_difference_t<it_t>;
+    //!\brief Value type of this iterator.
+    using value_type = uint64_t;
+    //!\brief The pointer type.
+    using pointer = void;
+    //!\brief Reference to `value_type`.
+    using reference = value_type;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_category = std::forward_iterator_tag;
+    //!\brief Tag this class as a forward iterator.
+    using iterator_concept = iterator_category;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    basic_iterator() = default; //!< Defaulted.
+    basic_iterator(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator(basic_iterator &&) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator const &) = default; //!< Defaulted.
+    basic_iterator & operator=(basic_iterator &&) = default; //!< Defaulted.
+    ~basic_iterator() = default; //!< Defaulted.
+
+    //!\brief Allow iterator on a const range to be constructible from an iterator over a non-const range.
+    basic_iterator(basic_iterator<!const_range> const & it)
+    //!\cond
+        requires const_range
+    //!\endcond
+        : text_left{it.text_left},
+          text_right{it.text_right},
+          text_end{it.text_end},
+          shape_{it.shape_},
+          seed{it.seed},
+          gapped{it.gapped},
+          roll_factor{it.roll_factor},
+          forward_hash{it.forward_hash},
+          reverse_hash{it.reverse_hash},
+          window_mask{it.window_mask},
+          forward_window{it.forward_window},
+          reverse_window{it.reverse_window},
+          forward_extractor{it.forward_extractor},
+          reverse_extractor{it.reverse_extractor}
+    {}
+
+    /*!\brief Construct from the begin and end of the underlying range, a seqan3::shape and a seed.
+     * \param[in] it_start The begin of the underlying range.
+     * \param[in] it_end   The end of the underlying range.
+     * \param[in] s_       The seqan3::shape to use for hashing.
+     * \param[in] seed_    The seed that both hash values are XORed with.
+     * \throws std::overflow_error if the range is not shorter than the shape and the hash value of the shape does not
+     *                             fit into 64 bits, see seqan3::views::kmer_hash.
+     */
+    basic_iterator(it_t it_start, sentinel_t it_end, shape const & s_, uint64_t const seed_) :
+        text_left{it_start},
+        text_right{std::ranges::next(text_left, s_.size() - 1, it_end)},
+        text_end{std::move(it_end)},
+        shape_{s_},
+        seed{seed_}
+    {
+        if (text_right == text_end)
+            return;
+
+        roll_factor = pow(sigma, static_cast<size_t>(shape_.size() - 1u));
+
+        for (size_t i{0}; i < shape_.size() - 1u; ++i)
+            gapped |= !shape_[i];
+
+        init_packed_windows();
+        hash_full();
+    }
+    //!\}
+
+    //!\name Comparison operators
+    //!\{
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs)
+    {
+        return lhs.text_right == rhs.text_right;
+    }
+
+    //!\brief Compare to another basic_iterator.
+    friend bool operator!=(basic_iterator const & lhs, basic_iterator const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Compare to the sentinel of the canonical_kmer_hash_view.
+    friend bool operator==(basic_iterator const & lhs, std::default_sentinel_t const &)
+    {
+        return lhs.text_right == lhs.text_end;
+    }
+
+    //!\brief Compare to the sentinel of the canonical_kmer_hash_view.
+    friend bool operator==(std::default_sentinel_t const & lhs, basic_iterator const & rhs)
+    {
+        return rhs == lhs;
+    }
+
+    //!\brief Compare to the sentinel of the canonical_kmer_hash_view.
+    friend bool operator!=(std::default_sentinel_t const & lhs, basic_iterator const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    //!\brief Compare to the sentinel of the canonical_kmer_hash_view.
+    friend bool operator!=(basic_iterator const & lhs, std::default_sentinel_t const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    //!\brief Pre-increment.
+    basic_iterator & operator++()
+    {
+        hash_forward();
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    basic_iterator operator++(int)
+    {
+        basic_iterator tmp{*this};
+        hash_forward();
+        return tmp;
+    }
+
+    //!\brief Return the smaller hash value of both strands, each XORed with the seed.
+    value_type operator*() const noexcept
+    {
+        return std::min(forward_hash ^ seed, reverse_hash ^ seed);
+    }
+
+private:
+    //!\brief The alphabet size.
+    static constexpr uint64_t sigma{alphabet_size<alphabet_t>};
+
+    //!\brief The number of bits of a rank in the packed windows; only used if the alphabet size is a power of two.
+    static constexpr size_t rank_bits{std::has_single_bit(sigma) ? std::countr_zero(sigma) : 0u};
+
+    //!\brief The multiplicative inverse of the alphabet size modulo \f$2^{64}\f$; only valid for odd alphabet sizes.
+    static constexpr uint64_t sigma_inverse = [] ()
+    {
+        // Newton's method doubles the number of correct bits per step, starting with three correct bits.
+        uint64_t inverse{sigma};
+        for (size_t i{0}; i < 5u; ++i)
+            inverse *= 2u - sigma * inverse;
+        return inverse;
+    }();
+
+    //!\brief Iterator to the leftmost position of the k-mer.
+    it_t text_left{};
+    //!\brief Iterator to the rightmost position of the k-mer.
+    it_t text_right{};
+    //!\brief The end of the underlying range.
+    sentinel_t text_end{};
+
+    //!\brief The shape to use.
+    shape shape_{};
+    //!\brief The seed that both hash values are XORed with.
+    uint64_t seed{};
+    //!\brief Whether the shape has a `0` before its last position. The last position is always used.
+    bool gapped{};
+
+    //!\brief The factor for the leftmost position of the forward hash value.
+    uint64_t roll_factor{};
+    //!\brief The hash value of the k-mer.
+    uint64_t forward_hash{};
+    //!\brief The hash value of the reverse complement of the k-mer.
+    uint64_t reverse_hash{};
+
+    //!\brief The bits of a packed window that are occupied by ranks; `0` if the packed windows are not used.
+    uint64_t window_mask{};
+    //!\brief The ranks of the k-mer, the leftmost in the most significant bits.
+    uint64_t forward_window{};
+    //!\brief The ranks of the reverse complement of the k-mer, i.e. the complement of the leftmost in the lowest bits.
+    uint64_t reverse_window{};
+    //!\brief Extracts the forward hash value from the forward window.
+    bit_extractor forward_extractor{};
+    //!\brief Extracts the reverse hash value from the reverse window.
+    bit_extractor reverse_extractor{};
+
+    //!\brief Whether the position `i` of the k-mer contributes to the forward hash value.
+    bool selected(size_t const i) const noexcept
+    {
+        return i + 1u == shape_.size() || shape_[i];
+    }
+
+    //!\brief Sets the masks of the packed windows if the alphabet size is a power of two and the k-mer fits.
+    void init_packed_windows() noexcept
+    {
+        size_t const size = shape_.size();
+
+        if (rank_bits == 0u || size * rank_bits > 64u)
+            return;
+
+        window_mask = size * rank_bits == 64u ? ~uint64_t{} : (uint64_t{1u} << (size * rank_bits)) - 1u;
+
+        uint64_t const rank_mask = (uint64_t{1u} << rank_bits) - 1u;
+        uint64_t forward_mask{0};
+        uint64_t reverse_mask{0};
+        for (size_t i{0}; i < size; ++i)
+        {
+            if (selected(i))
+                forward_mask |= rank_mask << ((size - 1u - i) * rank_bits);
+            if (selected(size - 1u - i))
+                reverse_mask |= rank_mask << (i * rank_bits);
+        }
+
+        forward_extractor = bit_extractor{forward_mask};
+        reverse_extractor = bit_extractor{reverse_mask};
+    }
+
+    //!\brief Calculates both hash values by explicitly looking at each position of the k-mer starting at `text_left`.
+    void hash_full()
+    {
+        size_t const size = shape_.size();
+        uint64_t reverse_factor{1u};
+        it_t it{text_left};
+
+        forward_hash = 0u;
+        reverse_hash = 0u;
+        forward_window = 0u;
+        reverse_window = 0u;
+
+        for (size_t i{0}; i < size; ++i)
+        {
+            alphabet_t const symbol = *it;
+            uint64_t const rank = to_rank(symbol);
+            uint64_t const complement_rank = to_rank(complement(symbol));
+
+            if (selected(i))
+                forward_hash = forward_hash * sigma + rank;
+
+            // The reverse complement reads the k-mer from right to left.
+            if (selected(size - 1u - i))
+            {
+                reverse_hash += complement_rank * reverse_factor;
+                reverse_factor *= sigma;
+            }
+
+            if constexpr (rank_bits != 0u)
+            {
+                if (window_mask != 0u)
+                {
+                    forward_window = (forward_window << rank_bits) | rank;
+                    reverse_window |= complement_rank << (i * rank_bits);
+                }
+            }
+
+            if (i + 1u < size)
+                std::ranges::advance(it, 1);
+        }
+
+        text_right = it;
+    }
+
+    //!\brief Moves to the next k-mer and updates both hash values.
+    void hash_forward()
+    {
+        std::ranges::advance(text_right, 1);
+        if (text_right == text_end)
+            return;
+
+        if constexpr (rank_bits != 0u)
+        {
+            if (window_mask != 0u)
+            {
+                alphabet_t const symbol = *text_right;
+                uint64_t const complement_rank = to_rank(complement(symbol));
+
+                forward_window = ((forward_window << rank_bits) | to_rank(symbol)) & window_mask;
+                reverse_window = (reverse_window >> rank_bits) |
+                                 (complement_rank << ((shape_.size() - 1u) * rank_bits));
+                forward_hash = gapped ? forward_extractor(forward_window) : forward_window;
+                reverse_hash = gapped ? reverse_extractor(reverse_window) : reverse_window;
+
+                std::ranges::advance(text_left, 1);
+                return;
+            }
+        }
+
+        if constexpr (sigma % 2u == 1u)
+        {
+            if (!gapped)
+            {
+                alphabet_t const leaving = *text_left;
+                alphabet_t const symbol = *text_right;
+
+                forward_hash = (forward_hash - to_rank(leaving) * roll_factor) * sigma + to_rank(symbol);
+                reverse_hash = (reverse_hash - to_rank(complement(leaving))) * sigma_inverse +
+                               to_rank(complement(symbol)) * roll_factor;
+
+                std::ranges::advance(text_left, 1);
+                return;
+            }
+        }
+
+        std::ranges::advance(text_left, 1);
+        hash_full();
+    }
+};
+
+//!\brief A deduction guide for the view class template.
+template <std::ranges::viewable_range rng_t>
+canonical_kmer_hash_view(rng_t &&, shape const &, uint64_t const) -> canonical_kmer_hash_view<std::views::all_t<rng_t>>;
+
+// ---------------------------------------------------------------------------------------------------------------------
+// minimiser_hash_fn (adaptor definition)
+// ---------------------------------------------------------------------------------------------------------------------
+
 //!\brief seqan3::views::minimiser_hash's range adaptor object type (non-closure).
 //!\ingroup search_views
 struct minimiser_hash_fn
@@ -65,7 +504,7 @@ struct minimiser_hash_fn
 
     /*!\brief Call the view's constructor with the underlying view, a seqan3::shape and a window size as argument.
      * \param[in] urange      The input range to process. Must model std::ranges::viewable_range and the reference type
-     *                        of the range must model seqan3::semialphabet.
+     *                        of the range must model seqan3::nucleotide_alphabet.
      * \param[in] shape       The seqan3::shape to use for hashing.
      * \param[in] window_size The size of the window.
      * \param[in] seed        The seed to use.
@@ -82,24 +521,15 @@ struct minimiser_hash_fn
             "The range parameter to views::minimiser_hash cannot be a temporary of a non-view range.");
         static_assert(std::ranges::forward_range<urng_t>,
             "The range parameter to views::minimiser_hash must model std::ranges::forward_range.");
-        static_assert(semialphabet<std::ranges::range_reference_t<urng_t>>,
-            "The range parameter to views::minimiser_hash must be over elements of seqan3::semialphabet.");
+        static_assert(nucleotide_alphabet<std::ranges::range_reference_t<urng_t>>,
+            "The range parameter to views::minimiser_hash must be over elements of seqan3::nucleotide_alphabet.");
 
         if (shape.size() > window_size.get())
             throw std::invalid_argument{"The size of the shape cannot be greater than the window size."};
 
-        auto forward_strand = std::forward<urng_t>(urange) | seqan3::views::kmer_hash(shape)
-                                                           | std::views::transform([seed] (uint64_t i)
-                                                                                  {return i ^ seed.get();});
+        canonical_kmer_hash_view canonical_hashes{std::forward<urng_t>(urange), shape, seed.get()};
 
-        auto reverse_strand = std::forward<urng_t>(urange) | seqan3::views::complement
-                                                           | std::views::reverse
-                                                           | seqan3::views::kmer_hash(shape)
-                                                           | std::views::transform([seed] (uint64_t i)
-                                                                                  {return i ^ seed.get();})
-                                                           | std::views::reverse;
-
-        return seqan3::detail::minimiser_view(forward_strand, reverse_strand, window_size.get() - shape.size() + 1);
+        return seqan3::detail::minimiser_view(std::move(canonical_hashes), window_size.get() - shape.size() + 1);
     }
 };
 
@@ -149,6 +579,11 @@ namespace seqan3::views
  * order. The user can change the seed to any other value he or she thinks is useful. A seed of 0 is returning the
  * lexicographical order.
  *
+ * ### Performance
+ *
+ * The hash values of the forward and the reverse strand are computed together in a single pass over `urange`, see
+ * seqan3::detail::canonical_kmer_hash_view. Each position and each window take amortised constant time.
+ *
  * \sa seqan3::views::minimiser_view
  *
  * \attention
@@ -173,7 +608,7 @@ namespace seqan3::views
  * | std::ranges::output_range        |                                    | *lost*                           |
  * | seqan3::const_iterable_range     |                                    | *preserved*                      |
  * |                                  |                                    |                                  |
- * | std::ranges::range_reference_t   | seqan3::semialphabet               | std::size_t                      |
+ * | std::ranges::range_reference_t   | seqan3::nucleotide_alphabet        | std::size_t                      |
  *
  * See the \link views views submodule documentation \endlink for detailed descriptions of the view properties.
  *
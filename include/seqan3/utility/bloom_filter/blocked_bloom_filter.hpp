@@ -0,0 +1,681 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::blocked_bloom_filter.
+ */
+
+#pragma once
+
+#include <seqan3/std/algorithm>
+#include <array>
+#include <seqan3/std/bit>
+#include <cstring>
+#include <filesystem>
+#include <seqan3/std/iterator>
+#include <memory>
+#include <seqan3/std/ranges>
+#include <utility>
+#include <vector>
+
+#include <seqan3/core/concept/cereal.hpp>
+#include <seqan3/search/dream_index/detail/block_compressed_bitvector.hpp>
+#include <seqan3/search/dream_index/detail/bloom_filter_file.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/utility/container/aligned_allocator.hpp>
+#include <seqan3/utility/simd/algorithm.hpp>
+#include <seqan3/utility/simd/concept.hpp>
+#include <seqan3/utility/simd/simd.hpp>
+#include <seqan3/utility/simd/simd_traits.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief Returns the word and the bit within the word of the `i`-th hash function of a value in its 512 bit block of
+ *        a seqan3::blocked_bloom_filter.
+ * \ingroup utility_bloom_filter
+ * \param[in] bit_hash The hash value that encodes the positions.
+ * \param[in] i        The index of the hash function; must be smaller than 8.
+ *
+ * \details
+ *
+ * The 3 most significant bits of `bit_hash` select the word of the first hash function, the `i`-th hash function sets
+ * a bit in the `i`-th next word. Hence, the bits of different hash functions lie in different words. The bit within
+ * the word is given by the `i`-th 6 bits following the 3 most significant bits.
+ */
+constexpr std::pair<size_t, size_t> blocked_bloom_filter_position(uint64_t const bit_hash, size_t const i) noexcept
+{
+    assert(i < 8u);
+    return {((bit_hash >> 61) + i) & 7u, (bit_hash >> (55u - 6u * i)) & 63u};
+}
+
+/*!\brief Checks whether the bits of a value are set in a 512 bit block of a seqan3::blocked_bloom_filter.
+ * \ingroup utility_bloom_filter
+ * \tparam simd_t The simd type used for processing the block; must model seqan3::simd::simd_concept with
+ *                `uint64_t` as scalar type.
+ * \param[in] block     The 8 words of the block.
+ * \param[in] bit_hash  The hash value that encodes the bit positions; see
+ *                      seqan3::detail::blocked_bloom_filter_position.
+ * \param[in] bit_count The number of hash functions; must be at most 8.
+ *
+ * \details
+ *
+ * Each word of the block contains the bit of at most one hash function. Therefore, every lane of a simd vector
+ * computes the bit of its word independently with a variable shift, the bit mask of the value is built without a
+ * loop over the hash functions and never leaves the simd registers. The block is tested with a single comparison per
+ * vector. With the default simd type, a block is one vector if AVX-512 is available and two if AVX2 is available.
+ * Simd types of less than 256 bits are not used, because SSE4 has no variable shifts of 64-bit lanes; the words are
+ * tested one by one instead.
+ */
+template <simd::simd_concept simd_t>
+//!\cond
+    requires std::same_as<typename simd_traits<simd_t>::scalar_type, uint64_t>
+//!\endcond
+inline bool block_contains_bits(uint64_t const * const block, uint64_t const bit_hash, size_t const bit_count) noexcept
+{
+    constexpr size_t block_words{8u};
+    constexpr size_t simd_length = simd_traits<simd_t>::length;
+    static_assert(block_words % simd_length == 0u, "The block must consist of whole simd vectors.");
+    assert(bit_count <= block_words);
+
+    if constexpr (simd_traits<simd_t>::max_length < 32u)
+    {
+        for (size_t i = 0; i < bit_count; ++i)
+        {
+            auto const [word, bit] = blocked_bloom_filter_position(bit_hash, i);
+            if (((block[word] >> bit) & 1u) == 0u)
+                return false;
+        }
+
+        return true;
+    }
+    else
+    {
+        simd_t const hash = simd::fill<simd_t>(bit_hash);
+        simd_t const first_word = simd::fill<simd_t>(bit_hash >> 61);
+        simd_t const hash_count = simd::fill<simd_t>(bit_count);
+        simd_t const one = simd::fill<simd_t>(1u);
+
+        simd_t missing = simd::fill<simd_t>(0u);
+        for (size_t word = 0; word < block_words; word += simd_length)
+        {
+            // The index of the hash function that sets a bit in the word of each lane.
+            simd_t const fun = (simd::iota<simd_t>(word) - first_word) & simd::fill<simd_t>(7u);
+            simd_t const shift = simd::fill<simd_t>(55u) - ((fun << 2) + (fun << 1)); // 55 - 6 * fun
+            simd_t const bit = (hash >> shift) & simd::fill<simd_t>(63u);
+            simd_t const mask = (fun < hash_count) ? (one << bit) : simd::fill<simd_t>(0u);
+
+            missing |= mask & ~simd::load<simd_t>(block + word);
+        }
+
+        uint64_t any_missing{};
+        for (size_t i = 0; i < simd_length; ++i)
+            any_missing |= missing[i];
+
+        return any_missing == 0u;
+    }
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief A Bloom Filter that stores all bits of a value in a single cache line.
+ * \tparam data_layout_mode_ Indicates whether the underlying data type is compressed. See seqan3::data_layout.
+ * \implements seqan3::cerealisable
+ * \ingroup utility_bloom_filter
+ *
+ * \details
+ *
+ * ### Blocked Bloom Filter
+ *
+ * The seqan3::bloom_filter sets `h` bits at independent positions of the whole bitvector. Hence, a query for a
+ * contained value accesses `h` cache lines. The blocked Bloom Filter divides the bitvector into blocks of 512 bits,
+ * i.e. 64 bytes or one cache line. A value is first hashed to a block and all of its `h` bits are set within this
+ * block. A query therefore accesses a single cache line, which is tested with one comparison of the block and the
+ * bit mask of the value (see seqan3::detail::block_contains_bits).
+ *
+ * Because the values are not distributed evenly among the blocks, the blocked Bloom Filter has a slightly higher
+ * false positive rate than a seqan3::bloom_filter of the same size. The size is rounded up to a multiple of 512 bits.
+ *
+ * ### Querying
+ *
+ * seqan3::blocked_bloom_filter::contains answers the query for a single value. To query a range of values, call
+ * seqan3::blocked_bloom_filter::bulk_contains or seqan3::blocked_bloom_filter::count. These process the values in
+ * batches: the blocks of all values of a batch are prefetched before the first block is tested, such that the memory
+ * accesses of a batch overlap.
+ *
+ * ### Compression
+ *
+ * The blocked Bloom Filter can be compressed by passing `seqan3::data_layout::compressed` as template argument. The
+ * compressed `seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>` can only be constructed from a
+ * `seqan3::blocked_bloom_filter` and is immutable. A query decodes the block of the value from the compressed
+ * bitvector, see seqan3::interleaved_bloom_filter.
+ *
+ * ### Thread safety
+ *
+ * The blocked Bloom Filter promises the basic thread-safety by the STL that all
+ * calls to `const` member functions are safe from multiple threads (as long as no thread calls
+ * a non-`const` member function at the same time).
+ *
+ * \sa seqan3::bloom_filter
+ */
+template <data_layout data_layout_mode_ = data_layout::uncompressed>
+class blocked_bloom_filter
+{
+private:
+    //!\cond
+    template <data_layout data_layout_mode>
+    friend class blocked_bloom_filter;
+    //!\endcond
+
+    //!\brief The number of bits per block.
+    static constexpr size_t block_bits{512u};
+    //!\brief The number of words per block.
+    static constexpr size_t block_words{block_bits / 64u};
+    //!\brief The number of values whose blocks are prefetched before they are tested.
+    static constexpr size_t batch_size{16u};
+
+    //!\brief The underlying datatype to use. The uncompressed blocks are aligned to cache lines.
+    using data_type = std::conditional_t<data_layout_mode_ == data_layout::uncompressed,
+                                         std::vector<uint64_t, aligned_allocator<uint64_t, block_bits / 8u>>,
+                                         detail::block_compressed_bitvector>;
+
+    //!\brief The number of blocks.
+    size_t block_count{};
+    //!\brief The number of bits to shift the hash value before doing multiplicative hashing.
+    size_t hash_shift{};
+    //!\brief The number of hash functions.
+    size_t hash_funs{};
+    //!\brief The bitvector.
+    data_type data{};
+    //!\brief The file the filter was loaded from; shared by all copies of a loaded filter.
+    std::shared_ptr<detail::memory_mapped_file const> mapping{};
+    //!\brief The words of the bitvector in `mapping`, or `nullptr` if the bitvector is stored in `data`.
+    uint64_t const * mapped_words{nullptr};
+    //!\brief Precalculated seeds for multiplicative hashing of the block and of the bits within the block.
+    static constexpr std::array<size_t, 2> hash_seeds{13572355802537770549ULL, // 2**64 / (e/2)
+                                                      13043817825332782213ULL}; // 2**64 / sqrt(2)
+
+    //!\brief Returns the words of the uncompressed bitvector, either from `data` or from the mapped file.
+    uint64_t const * words() const noexcept
+    {
+        return mapped_words != nullptr ? mapped_words : data.data();
+    }
+
+    //!\brief Copies the mapped bitvector into `data`, such that the filter does not refer to the file anymore.
+    void copy_mapped_words()
+    {
+        if (mapped_words == nullptr)
+            return;
+
+        data.assign(mapped_words, mapped_words + block_count * block_words);
+        mapped_words = nullptr;
+        mapping.reset();
+    }
+
+    //!\brief Returns the header of the file written by store().
+    detail::bloom_filter_file_header file_header() const noexcept
+    {
+        detail::bloom_filter_file_header header{};
+        header.is_interleaved = false;
+        header.is_blocked = true;
+        header.is_compressed = data_layout_mode_ == data_layout::compressed;
+        header.bins = 1u;
+        header.technical_bins = 1u;
+        header.bin_size = block_count * block_bits;
+        header.hash_shift = hash_shift;
+        header.hash_funs = hash_funs;
+        return header;
+    }
+
+    /*!\brief Returns the block of a value.
+     * \param h The value to process.
+     * \returns The index of a block in `[0, block_count)`.
+     * \sa seqan3::bloom_filter
+     */
+    size_t block_of(size_t h) const noexcept
+    {
+        h *= hash_seeds[0];
+        h ^= h >> hash_shift; // XOR and shift higher bits into lower bits
+        h *= 11400714819323198485ULL; // = 2^64 / golden_ration, to expand h to 64 bit range
+#ifdef __SIZEOF_INT128__
+        h = static_cast<uint64_t>((static_cast<__uint128_t>(h) * static_cast<__uint128_t>(block_count)) >> 64);
+#else
+        h %= block_count;
+#endif
+        return h;
+    }
+
+    /*!\brief Returns the hash value that encodes the bit positions of a value within its block.
+     * \param h The value to process.
+     * \returns The hash value; see seqan3::detail::blocked_bloom_filter_position.
+     */
+    static constexpr uint64_t bit_hash_of(uint64_t h) noexcept
+    {
+        h *= hash_seeds[1];
+        h ^= h >> 32u;
+        h *= 11400714819323198485ULL;
+        return h;
+    }
+
+    //!\brief Checks whether the bits encoded by `bit_hash` are set in `block`.
+    bool block_contains(size_t const block, uint64_t const bit_hash) const noexcept
+    {
+        assert(block < block_count);
+
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            return detail::block_contains_bits<simd::simd_type_t<uint64_t>>(words() + block * block_words,
+                                                                            bit_hash,
+                                                                            hash_funs);
+        }
+        else
+        {
+            std::array<uint64_t, block_words> decoded;
+            data.decode_words(block * block_words, block_words, decoded.data());
+            return detail::block_contains_bits<simd::simd_type_t<uint64_t>>(decoded.data(), bit_hash, hash_funs);
+        }
+    }
+
+    /*!\brief Queries the values in batches and calls `on_result` with the result of each value in order.
+     * \param[in] values    The range of values to process.
+     * \param[in] on_result The callback.
+     */
+    template <typename value_range_t, typename on_result_t>
+    void for_each_result(value_range_t && values, on_result_t && on_result) const
+    {
+        std::array<size_t, batch_size> blocks;
+        std::array<uint64_t, batch_size> bit_hashes;
+
+        auto it = std::ranges::begin(values);
+        auto const end = std::ranges::end(values);
+        while (it != end)
+        {
+            size_t pending{0u};
+            for (; pending < batch_size && it != end; ++pending, ++it)
+            {
+                size_t const value = *it;
+                blocks[pending] = block_of(value);
+                bit_hashes[pending] = bit_hash_of(value);
+
+                if constexpr (data_layout_mode == data_layout::uncompressed)
+                {
+#if defined(__GNUC__)
+                    __builtin_prefetch(words() + blocks[pending] * block_words);
+#endif // defined(__GNUC__)
+                }
+            }
+
+            for (size_t i = 0; i < pending; ++i)
+                on_result(block_contains(blocks[i], bit_hashes[i]));
+        }
+    }
+
+public:
+    //!\brief Indicates whether the blocked Bloom Filter is compressed.
+    static constexpr data_layout data_layout_mode = data_layout_mode_;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    blocked_bloom_filter() = default; //!< Defaulted.
+    blocked_bloom_filter(blocked_bloom_filter const &) = default; //!< Defaulted.
+    blocked_bloom_filter & operator=(blocked_bloom_filter const &) = default; //!< Defaulted.
+    blocked_bloom_filter(blocked_bloom_filter &&) = default; //!< Defaulted.
+    blocked_bloom_filter & operator=(blocked_bloom_filter &&) = default; //!< Defaulted.
+    ~blocked_bloom_filter() = default; //!< Defaulted.
+
+    /*!\brief Construct an uncompressed blocked Bloom Filter.
+     * \param size The bit vector size (in bits); rounded up to a multiple of 512.
+     * \param funs The number of hash functions. Default 2. At least 1, at most 5.
+     *
+     * \attention This constructor can only be used to construct **uncompressed** blocked Bloom Filters.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/utility/bloom_filter/blocked_bloom_filter_contains.cpp
+     */
+    blocked_bloom_filter(seqan3::bin_size size,
+                         seqan3::hash_function_count funs = seqan3::hash_function_count{2u})
+    //!\cond
+        requires (data_layout_mode == data_layout::uncompressed)
+    //!\endcond
+    {
+        hash_funs = funs.get();
+
+        if (hash_funs == 0 || hash_funs > 5)
+            throw std::logic_error{"The number of hash functions must be > 0 and <= 5."};
+        if (size.get() == 0)
+            throw std::logic_error{"The size of a bloom filter must be > 0."};
+
+        block_count = (size.get() + block_bits - 1u) / block_bits;
+        hash_shift = std::countl_zero(block_count);
+        data.assign(block_count * block_words, 0u);
+    }
+
+    /*!\brief Construct a compressed blocked Bloom Filter.
+     * \param[in] bf The uncompressed seqan3::blocked_bloom_filter.
+     *
+     * \attention This constructor can only be used to construct **compressed** blocked Bloom Filters.
+     */
+    blocked_bloom_filter(blocked_bloom_filter<data_layout::uncompressed> const & bf)
+    //!\cond
+        requires (data_layout_mode == data_layout::compressed)
+    //!\endcond
+    {
+        std::tie(block_count, hash_shift, hash_funs) = std::tie(bf.block_count, bf.hash_shift, bf.hash_funs);
+        data = data_type{bf.words(), bf.bit_size()};
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Inserts a value into the blocked Bloom Filter.
+     * \param[in] value The raw numeric value to process.
+     *
+     * \attention This function is only available for **uncompressed** blocked Bloom Filters.
+     */
+    void emplace(size_t const value)
+    //!\cond
+        requires (data_layout_mode == data_layout::uncompressed)
+    //!\endcond
+    {
+        copy_mapped_words();
+        uint64_t const bit_hash = bit_hash_of(value);
+        uint64_t * const block = data.data() + block_of(value) * block_words;
+
+        for (size_t i = 0; i < hash_funs; ++i)
+        {
+            auto const [word, bit] = detail::blocked_bloom_filter_position(bit_hash, i);
+            block[word] |= 1ULL << bit;
+        }
+    }
+
+    /*!\brief Remove all values from the blocked Bloom Filter by setting all bits to 0.
+     *
+     * \attention This function is only available for **uncompressed** blocked Bloom Filters.
+     */
+    void reset()
+    //!\cond
+        requires (data_layout_mode == data_layout::uncompressed)
+    //!\endcond
+    {
+        if (mapped_words != nullptr)
+        {
+            data.assign(block_count * block_words, 0u);
+            mapped_words = nullptr;
+            mapping.reset();
+            return;
+        }
+
+        std::ranges::fill(data, 0u);
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    /*!\brief Check whether a value is present in the blocked Bloom Filter.
+     * \param[in] value The raw numeric value to process.
+     *
+     * \details
+     *
+     * ### Example
+     *
+     * \include test/snippet/utility/bloom_filter/blocked_bloom_filter_contains.cpp
+     */
+    bool contains(size_t const value) const noexcept
+    {
+        return block_contains(block_of(value), bit_hash_of(value));
+    }
+
+    /*!\brief Checks whether the values of a range are present in the blocked Bloom Filter.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \tparam output_it_t   The type of the output iterator. Must be incrementable and accept the assignment of a
+     *                       `bool`, e.g. std::vector<bool>::iterator.
+     * \param[in] values The range of values to process.
+     * \param[in] out    The iterator the results are written to, one `bool` per value.
+     * \returns The iterator past the last written result.
+     *
+     * \details
+     *
+     * The blocks of a batch of values are prefetched before they are tested.
+     *
+     * ### Example
+     *
+     * \include test/snippet/utility/bloom_filter/blocked_bloom_filter_bulk_contains.cpp
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are thread safe.
+     */
+    template <std::ranges::range value_range_t, typename output_it_t>
+    output_it_t bulk_contains(value_range_t && values, output_it_t out) const
+    {
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+        static_assert(requires (output_it_t it) { *it = true; ++it; }, "The output iterator must accept bool.");
+
+        for_each_result(values, [&out] (bool const result)
+        {
+            *out = result;
+            ++out;
+        });
+
+        return out;
+    }
+    //!\}
+
+    /*!\name Counting
+     * \{
+     */
+    /*!\brief Counts the occurrences for all values in a range.
+     * \tparam value_range_t The type of the range of values. Must model std::ranges::input_range. The reference type
+     *                       must model std::unsigned_integral.
+     * \param[in] values The range of values to process.
+     *
+     * \details
+     *
+     * See seqan3::blocked_bloom_filter::bulk_contains.
+     *
+     * ### Thread safety
+     *
+     * Concurrent invocations of this function are thread safe.
+     */
+    template <std::ranges::range value_range_t>
+    size_t count(value_range_t && values) const noexcept
+    {
+        static_assert(std::ranges::input_range<value_range_t>, "The values must model input_range.");
+        static_assert(std::unsigned_integral<std::ranges::range_value_t<value_range_t>>,
+                      "An individual value must be an unsigned integral.");
+
+        size_t result = 0;
+        for_each_result(values, [&result] (bool const contained)
+        {
+            result += contained;
+        });
+
+        return result;
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    /*!\brief Returns the number of hash functions used in the blocked Bloom Filter.
+     * \returns The number of hash functions.
+     */
+    size_t hash_function_count() const noexcept
+    {
+        return hash_funs;
+    }
+
+    /*!\brief Returns the size of the underlying bitvector.
+     * \returns The size in bits of the underlying bitvector, a multiple of 512.
+     */
+    size_t bit_size() const noexcept
+    {
+        return block_count * block_bits;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    /*!\brief Test for equality.
+     * \param[in] lhs A `seqan3::blocked_bloom_filter`.
+     * \param[in] rhs `seqan3::blocked_bloom_filter` to compare to.
+     * \returns `true` if equal, `false` otherwise.
+     */
+    friend bool operator==(blocked_bloom_filter const & lhs, blocked_bloom_filter const & rhs) noexcept
+    {
+        if (std::tie(lhs.block_count, lhs.hash_shift, lhs.hash_funs) !=
+            std::tie(rhs.block_count, rhs.hash_shift, rhs.hash_funs))
+            return false;
+
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+            return std::equal(lhs.words(), lhs.words() + lhs.block_count * block_words, rhs.words());
+        else
+            return lhs.data == rhs.data;
+    }
+
+    /*!\brief Test for inequality.
+     * \param[in] lhs A `seqan3::blocked_bloom_filter`.
+     * \param[in] rhs `seqan3::blocked_bloom_filter` to compare to.
+     * \returns `true` if unequal, `false` otherwise.
+     */
+    friend bool operator!=(blocked_bloom_filter const & lhs, blocked_bloom_filter const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+    /*!\name Access
+     * \{
+     */
+    /*!\brief Provides direct, unsafe access to the underlying data structure.
+     * \returns A reference to the underlying bitvector.
+     *
+     * \attention The bitvector of a blocked Bloom Filter that was loaded with seqan3::blocked_bloom_filter::load is
+     *            not stored in the returned data structure.
+     *
+     * \details
+     *
+     * \noapi{The exact representation of the data is implementation defined.}
+     */
+    constexpr data_type & raw_data() noexcept
+    {
+        return data;
+    }
+
+    //!\copydoc raw_data()
+    constexpr data_type const & raw_data() const noexcept
+    {
+        return data;
+    }
+    //!\}
+
+    /*!\name Storage
+     * \{
+     */
+    /*!\brief Stores the blocked Bloom Filter in a binary file that can be loaded with
+     *        seqan3::blocked_bloom_filter::load.
+     * \param[in] path The file to write.
+     * \throws std::filesystem::filesystem_error if the file cannot be written.
+     *
+     * \details
+     *
+     * See seqan3::interleaved_bloom_filter::store.
+     */
+    void store(std::filesystem::path const & path) const
+    {
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            if (mapped_words != nullptr)
+            {
+                blocked_bloom_filter tmp{*this};
+                tmp.copy_mapped_words();
+                detail::store_bloom_filter_file(path, file_header(), tmp.data);
+                return;
+            }
+        }
+
+        detail::store_bloom_filter_file(path, file_header(), data);
+    }
+
+    /*!\brief Loads a blocked Bloom Filter that was stored with seqan3::blocked_bloom_filter::store.
+     * \param[in] path The file to read.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened.
+     * \throws std::runtime_error if the file does not contain a seqan3 Bloom Filter, is truncated or is corrupted.
+     * \throws std::logic_error if the stored filter is no blocked Bloom Filter or does not match the data layout of
+     *         this filter.
+     *
+     * \details
+     *
+     * An uncompressed blocked Bloom Filter is queried directly on the shared, read-only mapping of the file. Modifying
+     * it copies the bitvector into memory first. The mapped blocks are aligned to cache lines. See
+     * seqan3::interleaved_bloom_filter::load for details.
+     */
+    void load(std::filesystem::path const & path)
+    {
+        detail::mapped_bloom_filter_file file = detail::map_bloom_filter_file(path, file_header());
+        detail::bloom_filter_file_header const & header = file.header;
+
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            data = data_type{};
+            mapped_words = reinterpret_cast<uint64_t const *>(file.payload());
+            mapping = std::move(file.file);
+        }
+        else
+        {
+            detail::memory_mapped_streambuf buffer{file.payload(), header.payload_bytes};
+            std::istream in{&buffer};
+            data_type loaded{};
+            loaded.load(in);
+
+            if (loaded.size() != header.bin_size * header.technical_bins)
+                throw std::runtime_error{"The file " + path.string() + " is corrupted."};
+
+            data = std::move(loaded);
+        }
+
+        block_count = header.bin_size / block_bits;
+        hash_shift = header.hash_shift;
+        hash_funs = header.hash_funs;
+    }
+    //!\}
+
+    /*!\cond DEV
+     * \brief Serialisation support function.
+     * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
+     * \param[in] archive The archive being serialised from/to.
+     *
+     * \attention These functions are never called directly, see \ref serialisation for more details.
+     */
+    template <cereal_archive archive_t>
+    void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
+    {
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+            copy_mapped_words();
+
+        archive(block_count);
+        archive(hash_shift);
+        archive(hash_funs);
+        archive(data);
+    }
+    //!\endcond
+};
+
+} // namespace seqan3
@@ -78,6 +78,7 @@ namespace seqan3
  * a non-`const` member function at the same time).
  *
  * \sa seqan3::interleaved_bloom_filter
+ * \sa seqan3::blocked_bloom_filter
  *
  */
 template <data_layout data_layout_mode_ = data_layout::uncompressed>
@@ -102,6 +103,10 @@ private:
     size_t hash_funs{};
     //!\brief The bitvector.
     data_type data{};
+    //!\brief The file the filter was loaded from; shared by all copies of a loaded filter.
+    std::shared_ptr<detail::memory_mapped_file const> mapping{};
+    //!\brief The words of the bitvector in `mapping`, or `nullptr` if the bitvector is stored in `data`.
+    uint64_t const * mapped_words{nullptr};
     //!\brief Precalculated seeds for multiplicative hashing. We use large irrational numbers for a uniform hashing.
     static constexpr std::array<size_t, 5> hash_seeds{13572355802537770549ULL, // 2**64 / (e/2)
                                                       13043817825332782213ULL, // 2**64 / sqrt(2)
@@ -109,6 +114,38 @@ private:
                                                       16499269484942379435ULL, // 2**64 / (sqrt(5)/2)
                                                       4893150838803335377ULL}; // 2**64 / (3*pi/5)
 
+    //!\brief Returns the words of the uncompressed bitvector, either from `data` or from the mapped file.
+    uint64_t const * words() const noexcept
+    {
+        return mapped_words != nullptr ? mapped_words : data.data();
+    }
+
+    //!\brief Copies the mapped bitvector into `data`, such that the filter does not refer to the file anymore.
+    void copy_mapped_words()
+    {
+        if (mapped_words == nullptr)
+            return;
+
+        data = sdsl::bit_vector(size_in_bits);
+        std::memcpy(data.data(), mapped_words, ((size_in_bits + 63u) >> 6) * sizeof(uint64_t));
+        mapped_words = nullptr;
+        mapping.reset();
+    }
+
+    //!\brief Returns the header of the file written by store().
+    detail::bloom_filter_file_header file_header() const noexcept
+    {
+        detail::bloom_filter_file_header header{};
+        header.is_interleaved = false;
+        header.is_compressed = data_layout_mode_ == data_layout::compressed;
+        header.bins = 1u;
+        header.technical_bins = 1u;
+        header.bin_size = size_in_bits;
+        header.hash_shift = hash_shift;
+        header.hash_funs = hash_funs;
+        return header;
+    }
+
     /*!\brief Perturbs a value and fits it into the vector.
      * \param h The value to process.
      * \param seed The seed to use.
@@ -193,7 +230,16 @@ public:
         std::tie(size_in_bits, hash_shift, hash_funs) =
             std::tie(bf.size_in_bits, bf.hash_shift, bf.hash_funs);
 
-        data = sdsl::sd_vector<>{bf.data};
+        if (bf.mapped_words != nullptr)
+        {
+            bloom_filter<data_layout::uncompressed> tmp{bf};
+            tmp.copy_mapped_words();
+            data = sdsl::sd_vector<>{tmp.data};
+        }
+        else
+        {
+            data = sdsl::sd_vector<>{bf.data};
+        }
     }
     //!\}
 
@@ -211,11 +257,12 @@ public:
      *
      * \include test/snippet/utility/bloom_filter/bloom_filter_emplace.cpp
      */
-    void emplace(size_t const value) noexcept
+    void emplace(size_t const value)
     //!\cond
         requires (data_layout_mode == data_layout::uncompressed)
     //!\endcond
     {
+        copy_mapped_words();
         for (size_t i = 0; i < hash_funs; ++i)
         {
             size_t idx = hash_and_fit(value, hash_seeds[i]);
@@ -236,11 +283,19 @@ public:
      *
      * \include test/snippet/utility/bloom_filter/bloom_filter_reset.cpp
      */
-    void reset() noexcept
+    void reset()
     //!\cond
         requires (data_layout_mode == data_layout::uncompressed)
     //!\endcond
     {
+        if (mapped_words != nullptr)
+        {
+            data = data_type(size_in_bits);
+            mapped_words = nullptr;
+            mapping.reset();
+            return;
+        }
+
         sdsl::util::_set_zero_bits(data);
     }
     //!\}
@@ -264,9 +319,18 @@ public:
         for ( size_t i = 0; i < hash_funs; i++ )
         {
             size_t idx = hash_and_fit(value, hash_seeds[i]);
-            assert(idx < data.size());
-            if ( data[idx] == 0 )
-                return false;
+            assert(idx < size_in_bits);
+
+            if constexpr (data_layout_mode == data_layout::uncompressed)
+            {
+                if (((words()[idx >> 6] >> (idx & 63u)) & 1u) == 0u)
+                    return false;
+            }
+            else
+            {
+                if ( data[idx] == 0 )
+                    return false;
+            }
         }
         return true;
     }
@@ -336,8 +400,17 @@ public:
      */
     friend bool operator==(bloom_filter const & lhs, bloom_filter const & rhs) noexcept
     {
-        return std::tie(lhs.size_in_bits, lhs.hash_shift, lhs.hash_funs, lhs.data) ==
-               std::tie(rhs.size_in_bits, rhs.hash_shift, rhs.hash_funs, rhs.data);
+        if (std::tie(lhs.size_in_bits, lhs.hash_shift, lhs.hash_funs) !=
+            std::tie(rhs.size_in_bits, rhs.hash_shift, rhs.hash_funs))
+            return false;
+
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            if (lhs.mapped_words != nullptr || rhs.mapped_words != nullptr)
+                return std::equal(lhs.words(), lhs.words() + ((lhs.size_in_bits + 63u) >> 6), rhs.words());
+        }
+
+        return lhs.data == rhs.data;
     }
 
     /*!\brief Test for inequality.
@@ -357,6 +430,9 @@ public:
     /*!\brief Provides direct, unsafe access to the underlying data structure.
      * \returns A reference to an SDSL bitvector.
      *
+     * \attention The bitvector of a Bloom Filter that was loaded with seqan3::bloom_filter::load is not stored in the
+     *            returned data structure.
+     *
      * \details
      *
      * \noapi{The exact representation of the data is implementation defined.}
@@ -373,6 +449,68 @@ public:
     }
     //!\}
 
+    /*!\name Storage
+     * \{
+     */
+    /*!\brief Stores the Bloom Filter in a binary file that can be loaded with seqan3::bloom_filter::load.
+     * \param[in] path The file to write.
+     * \throws std::filesystem::filesystem_error if the file cannot be written.
+     *
+     * \details
+     *
+     * See seqan3::interleaved_bloom_filter::store.
+     */
+    void store(std::filesystem::path const & path) const
+    {
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            if (mapped_words != nullptr)
+            {
+                bloom_filter tmp{*this};
+                tmp.copy_mapped_words();
+                detail::store_bloom_filter_file(path, file_header(), tmp.data);
+                return;
+            }
+        }
+
+        detail::store_bloom_filter_file(path, file_header(), data);
+    }
+
+    /*!\brief Loads a Bloom Filter that was stored with seqan3::bloom_filter::store.
+     * \param[in] path The file to read.
+     * \throws std::filesystem::filesystem_error if the file cannot be opened.
+     * \throws std::runtime_error if the file does not contain a seqan3 Bloom Filter, is truncated or is corrupted.
+     * \throws std::logic_error if the stored filter does not match the data layout of this filter.
+     *
+     * \details
+     *
+     * An uncompressed Bloom Filter is queried directly on the shared, read-only mapping of the file. Modifying it
+     * copies the bitvector into memory first. See seqan3::interleaved_bloom_filter::load for details.
+     */
+    void load(std::filesystem::path const & path)
+    {
+        detail::mapped_bloom_filter_file file = detail::map_bloom_filter_file(path, file_header());
+        detail::bloom_filter_file_header const & header = file.header;
+
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+        {
+            data = data_type{};
+            mapped_words = reinterpret_cast<uint64_t const *>(file.payload());
+            mapping = std::move(file.file);
+        }
+        else
+        {
+            detail::memory_mapped_streambuf buffer{file.payload(), header.payload_bytes};
+            std::istream in{&buffer};
+            data.load(in);
+        }
+
+        size_in_bits = header.bin_size;
+        hash_shift = header.hash_shift;
+        hash_funs = header.hash_funs;
+    }
+    //!\}
+
     /*!\cond DEV
      * \brief Serialisation support function.
      * \tparam archive_t Type of `archive`; must satisfy seqan3::cereal_archive.
@@ -383,6 +521,9 @@ public:
     template <cereal_archive archive_t>
     void CEREAL_SERIALIZE_FUNCTION_NAME(archive_t & archive)
     {
+        if constexpr (data_layout_mode == data_layout::uncompressed)
+            copy_mapped_words();
+
         archive(size_in_bits);
         archive(hash_shift);
         archive(hash_funs);
@@ -13,5 +13,6 @@
 #pragma once
 
 #include <seqan3/utility/parallel/detail/latch.hpp>
+#include <seqan3/utility/parallel/detail/parallel_for_chunks.hpp>
 #include <seqan3/utility/parallel/detail/reader_writer_manager.hpp>
 #include <seqan3/utility/parallel/detail/spin_delay.hpp>
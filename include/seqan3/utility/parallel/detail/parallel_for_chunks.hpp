@@ -0,0 +1,247 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::chunk_thread_pool and seqan3::detail::parallel_for_chunks.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/platform.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A fixed set of threads that calls a function on the chunks of an interval.
+ * \ingroup utility_parallel
+ *
+ * \details
+ *
+ * The threads are spawned on construction and joined on destruction, such that
+ * seqan3::detail::chunk_thread_pool::for_each_chunk can be called many times without spawning threads. The calling
+ * thread takes part in the work, hence a pool for `thread_count` threads spawns `thread_count - 1` threads.
+ *
+ * \warning Only one thread may call seqan3::detail::chunk_thread_pool::for_each_chunk at a time.
+ */
+class chunk_thread_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \brief Not default constructible nor copyable or movable.
+     * \{
+     */
+    chunk_thread_pool() = delete; //!< Deleted.
+    chunk_thread_pool(chunk_thread_pool const &) = delete; //!< Deleted.
+    chunk_thread_pool(chunk_thread_pool &&) = delete; //!< Deleted.
+    chunk_thread_pool & operator=(chunk_thread_pool const &) = delete; //!< Deleted.
+    chunk_thread_pool & operator=(chunk_thread_pool &&) = delete; //!< Deleted.
+
+    //!\brief Stops and joins the threads.
+    ~chunk_thread_pool()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stop = true;
+        }
+        job_available.notify_all();
+
+        for (std::thread & thread : threads)
+            thread.join();
+    }
+
+    /*!\brief Spawns `thread_count - 1` threads.
+     * \param[in] thread_count The number of threads that work on the chunks, including the calling thread.
+     */
+    explicit chunk_thread_pool(size_t const thread_count)
+    {
+        if (thread_count > 1u)
+            threads.reserve(thread_count - 1u);
+
+        for (size_t i = 1u; i < thread_count; ++i)
+            threads.emplace_back([this] () { work(); });
+    }
+    //!\}
+
+    //!\brief Returns the number of threads that work on the chunks, including the calling thread.
+    size_t thread_count() const noexcept
+    {
+        return threads.size() + 1u;
+    }
+
+    /*!\brief Calls `fn(begin, end)` for consecutive chunks `[begin, end)` of `[0, count)`.
+     * \tparam fn_t The type of the callable; must be invocable with two `size_t`.
+     * \param[in] count      The number of elements.
+     * \param[in] chunk_size The number of elements per chunk; must be at least 1.
+     * \param[in] fn         The function to call for each chunk.
+     *
+     * \details
+     *
+     * All chunks start at a multiple of `chunk_size`. Each thread takes the next chunk that has not been started by
+     * any thread. If there is only a single chunk or thread, `fn(0, count)` is called in the calling thread.
+     * The call returns when all chunks have been processed. If `fn` throws, the remaining chunks are skipped and
+     * the first exception is rethrown.
+     */
+    template <typename fn_t>
+    void for_each_chunk(size_t const count, size_t const chunk_size, fn_t && fn)
+    {
+        assert(chunk_size > 0u);
+
+        size_t const chunks = (count + chunk_size - 1u) / chunk_size;
+
+        if (threads.empty() || chunks <= 1u)
+        {
+            if (count > 0u)
+                fn(size_t{0u}, count);
+            return;
+        }
+
+        {
+            std::lock_guard lock{mutex};
+            job = [] (void * const fn_ptr, size_t const begin, size_t const end)
+            {
+                (*static_cast<std::remove_reference_t<fn_t> *>(fn_ptr))(begin, end);
+            };
+            job_fn = const_cast<void *>(static_cast<void const *>(std::addressof(fn)));
+            job_count = count;
+            job_chunk_size = chunk_size;
+            job_chunks = chunks;
+            next_chunk.store(0u, std::memory_order_relaxed);
+            exception = nullptr;
+            busy_threads = threads.size();
+            ++generation;
+        }
+        job_available.notify_all();
+
+        process_chunks();
+
+        std::unique_lock lock{mutex};
+        job_done.wait(lock, [this] () { return busy_threads == 0u; });
+
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+private:
+    //!\brief Processes chunks of the current job until none is left.
+    void process_chunks()
+    {
+        for (size_t chunk = next_chunk++; chunk < job_chunks; chunk = next_chunk++)
+        {
+            try
+            {
+                job(job_fn, chunk * job_chunk_size, std::min((chunk + 1u) * job_chunk_size, job_count));
+            }
+            catch (...)
+            {
+                next_chunk.store(job_chunks);
+
+                std::lock_guard lock{mutex};
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        }
+    }
+
+    //!\brief The loop of each spawned thread.
+    void work()
+    {
+        size_t seen_generation{0u};
+
+        for (;;)
+        {
+            {
+                std::unique_lock lock{mutex};
+                job_available.wait(lock, [&] () { return stop || generation != seen_generation; });
+
+                if (stop)
+                    return;
+
+                seen_generation = generation;
+            }
+
+            process_chunks();
+
+            bool last{false};
+            {
+                std::lock_guard lock{mutex};
+                last = (--busy_threads == 0u);
+            }
+
+            if (last)
+                job_done.notify_one();
+        }
+    }
+
+    //!\brief The spawned threads.
+    std::vector<std::thread> threads{};
+    //!\brief Guards the job description, the exception and the counters.
+    std::mutex mutex{};
+    //!\brief Signals the spawned threads that a job is available or that they shall stop.
+    std::condition_variable job_available{};
+    //!\brief Signals the calling thread that all spawned threads finished the job.
+    std::condition_variable job_done{};
+
+    //!\brief Calls the type erased function of the current job.
+    void (*job)(void *, size_t, size_t){nullptr};
+    //!\brief The function of the current job.
+    void * job_fn{nullptr};
+    //!\brief The number of elements of the current job.
+    size_t job_count{};
+    //!\brief The chunk size of the current job.
+    size_t job_chunk_size{1u};
+    //!\brief The number of chunks of the current job.
+    size_t job_chunks{};
+    //!\brief The next chunk of the current job that has not been started.
+    std::atomic<size_t> next_chunk{0u};
+    //!\brief The first exception thrown by the current job.
+    std::exception_ptr exception{};
+    //!\brief The number of spawned threads that have not finished the current job.
+    size_t busy_threads{};
+    //!\brief Incremented for each job.
+    size_t generation{};
+    //!\brief Whether the spawned threads shall stop.
+    bool stop{false};
+};
+
+/*!\brief Calls `fn(begin, end)` for consecutive chunks `[begin, end)` of `[0, count)` with up to `thread_count`
+ *        threads.
+ * \ingroup utility_parallel
+ * \tparam fn_t The type of the callable; must be invocable with two `size_t`.
+ * \param[in] count        The number of elements.
+ * \param[in] chunk_size   The number of elements per chunk; must be at least 1.
+ * \param[in] thread_count The maximal number of threads, including the calling thread.
+ * \param[in] fn           The function to call for each chunk.
+ *
+ * \details
+ *
+ * Spawns the threads for this call only; use a seqan3::detail::chunk_thread_pool to process several intervals with
+ * the same threads. See seqan3::detail::chunk_thread_pool::for_each_chunk for the distribution of the chunks and the
+ * handling of exceptions.
+ */
+template <typename fn_t>
+inline void parallel_for_chunks(size_t const count, size_t const chunk_size, size_t const thread_count, fn_t && fn)
+{
+    assert(chunk_size > 0u);
+
+    size_t const chunks = (count + chunk_size - 1u) / chunk_size;
+    chunk_thread_pool pool{std::min(thread_count, chunks)};
+    pool.for_each_chunk(count, chunk_size, fn);
+}
+
+} // namespace seqan3::detail
@@ -0,0 +1,132 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Returns a copy of the sequence with every 20th letter substituted, resembling the verification of a seed hit.
+auto mutate(std::vector<seqan3::dna4> sequence)
+{
+    for (size_t i = 10; i < sequence.size(); i += 20)
+        sequence[i].assign_rank((sequence[i].to_rank() + 1) % 4);
+
+    return sequence;
+}
+
+// Returns a database window of `size + 2 * width` letters and a query of `size` letters that was mutated from the
+// middle of the window.
+auto verification_pair(size_t const size, int32_t const width)
+{
+    auto window = seqan3::test::generate_sequence<seqan3::dna4>(size + 2 * width, 0, 0);
+    auto query = mutate({window.begin() + width, window.begin() + width + size});
+
+    return std::pair{std::move(window), std::move(query)};
+}
+
+auto band(int32_t const width)
+{
+    return seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-width},
+                                              seqan3::align_cfg::upper_diagonal{width}};
+}
+
+constexpr auto semi_global_cfg = seqan3::align_cfg::method_global{
+                                     seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                     seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                     seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                     seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+// ============================================================================
+//  edit_distance; score; dna4; global
+// ============================================================================
+
+template <typename config_t>
+void run_edit_distance(benchmark::State & state,
+                       std::vector<seqan3::dna4> & seq1,
+                       std::vector<seqan3::dna4> & seq2,
+                       config_t const & cfg)
+{
+    int score = 0;
+
+    for (auto _ : state)
+    {
+        for (auto && rng : seqan3::align_pairwise(std::tie(seq1, seq2), cfg))
+            score += rng.score();
+    }
+
+    state.counters["score"] = score;
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+void seqan3_edit_distance_unbanded_dna4(benchmark::State & state)
+{
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(state.range(0), 0, 0);
+    auto seq2 = mutate(seq1);
+
+    run_edit_distance(state, seq1, seq2, seqan3::align_cfg::method_global{} |
+                                         seqan3::align_cfg::edit_scheme |
+                                         seqan3::align_cfg::output_score{});
+}
+
+void seqan3_edit_distance_banded_dna4(benchmark::State & state)
+{
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(state.range(0), 0, 0);
+    auto seq2 = mutate(seq1);
+
+    run_edit_distance(state, seq1, seq2, seqan3::align_cfg::method_global{} |
+                                         seqan3::align_cfg::edit_scheme |
+                                         band(state.range(1)) |
+                                         seqan3::align_cfg::output_score{});
+}
+
+// ============================================================================
+//  edit_distance; score and end position; dna4; semi-global verification
+// ============================================================================
+
+// The query is verified in a window of the database that extends the seed position by the band width on both sides.
+void seqan3_edit_distance_unbanded_verification_dna4(benchmark::State & state)
+{
+    int32_t const width = state.range(1);
+    auto [window, query] = verification_pair(state.range(0), width);
+
+    run_edit_distance(state, window, query, semi_global_cfg |
+                                            seqan3::align_cfg::edit_scheme |
+                                            seqan3::align_cfg::output_score{} |
+                                            seqan3::align_cfg::output_end_position{});
+}
+
+void seqan3_edit_distance_banded_verification_dna4(benchmark::State & state)
+{
+    int32_t const width = state.range(1);
+    auto [window, query] = verification_pair(state.range(0), width);
+
+    run_edit_distance(state, window, query, semi_global_cfg |
+                                            seqan3::align_cfg::edit_scheme |
+                                            seqan3::align_cfg::band_fixed_size{
+                                                seqan3::align_cfg::lower_diagonal{0},
+                                                seqan3::align_cfg::upper_diagonal{2 * width}} |
+                                            seqan3::align_cfg::output_score{} |
+                                            seqan3::align_cfg::output_end_position{});
+}
+
+// ============================================================================
+//  instantiate tests
+// ============================================================================
+
+BENCHMARK(seqan3_edit_distance_unbanded_dna4)->Args({1000, 0})->Args({10000, 0});
+BENCHMARK(seqan3_edit_distance_banded_dna4)->ArgsProduct({{1000, 10000}, {8, 16, 32, 64}});
+BENCHMARK(seqan3_edit_distance_unbanded_verification_dna4)->ArgsProduct({{150, 1000}, {16}});
+BENCHMARK(seqan3_edit_distance_banded_verification_dna4)->ArgsProduct({{150, 1000}, {16}});
+
+BENCHMARK_MAIN();
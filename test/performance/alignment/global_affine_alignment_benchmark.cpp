@@ -37,9 +37,11 @@ constexpr auto affine_cfg = seqan3::align_cfg::method_global{} |
 //  affine; score; dna4; single
 // ============================================================================
 
+// Pairs with a long second sequence are computed with all simd lanes if the score type has 32 bits, see
+// seqan3::detail::pairwise_alignment_algorithm_striped.
 void seqan3_affine_dna4(benchmark::State & state)
 {
-    size_t sequence_length = 500;
+    size_t sequence_length = state.range(0);
     auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
     auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
 
@@ -53,13 +55,13 @@ void seqan3_affine_dna4(benchmark::State & state)
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
 }
 
-BENCHMARK(seqan3_affine_dna4);
+BENCHMARK(seqan3_affine_dna4)->Arg(100)->Arg(500)->Arg(10000);
 
 #ifdef SEQAN3_HAS_SEQAN2
 
 void seqan2_affine_dna4(benchmark::State & state)
 {
-    size_t sequence_length = 500;
+    size_t sequence_length = state.range(0);
     auto seq1 = seqan3::test::generate_sequence_seqan2<seqan::Dna>(sequence_length, 0, 0);
     auto seq2 = seqan3::test::generate_sequence_seqan2<seqan::Dna>(sequence_length, 0, 1);
 
@@ -73,9 +75,34 @@ void seqan2_affine_dna4(benchmark::State & state)
     state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
 }
 
-BENCHMARK(seqan2_affine_dna4);
+BENCHMARK(seqan2_affine_dna4)->Arg(100)->Arg(500)->Arg(10000);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; score; dna4; single; vectorised
+// ============================================================================
+
+// A single sequence pair is computed with all simd lanes.
+void seqan3_affine_dna4_vectorised(benchmark::State & state)
+{
+    size_t sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), affine_cfg |
+                                                        seqan3::align_cfg::output_score{} |
+                                                        seqan3::align_cfg::vectorised{});
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_vectorised)->Arg(100)->Arg(500)->Arg(10000);
+
 // ============================================================================
 //  affine; trace; dna4; single
 // ============================================================================
@@ -121,6 +148,31 @@ void seqan2_affine_dna4_trace(benchmark::State & state)
 BENCHMARK(seqan2_affine_dna4_trace);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; trace in linear memory; dna4; single
+// ============================================================================
+
+void seqan3_affine_dna4_trace_linear_memory(benchmark::State & state)
+{
+    size_t sequence_length = state.range(0);
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 1);
+
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), affine_cfg |
+                                                        seqan3::align_cfg::output_alignment{} |
+                                                        seqan3::align_cfg::linear_memory{} |
+                                                        seqan3::align_cfg::parallel{static_cast<uint32_t>(state.range(1))});
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+BENCHMARK(seqan3_affine_dna4_trace_linear_memory)->ArgsProduct({{500, 10000}, {1, 4}});
+
 // ============================================================================
 //  affine; score; dna4; collection
 // ============================================================================
@@ -7,6 +7,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <array>
+#include <chrono>
+
 #include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/utility/views/to.hpp>
@@ -39,6 +42,18 @@ static void arguments(benchmark::internal::Benchmark* b)
     }
 }
 
+static void bulk_contains_arguments(benchmark::internal::Benchmark* b)
+{
+    // Classification workloads with many bins: each bin has 2^12 bits.
+    for (int32_t bins : {1'024, 8'192, 65'536})
+    {
+        for (int32_t hash_num = 2; hash_num < 4; ++hash_num)
+        {
+            b->Args({bins, 1 << 12, hash_num, 1'000});
+        }
+    }
+}
+
 template <typename ibf_type>
 auto set_up(size_t bins, size_t bits, size_t hash_num, size_t sequence_length)
 {
@@ -53,6 +68,106 @@ auto set_up(size_t bins, size_t bits, size_t hash_num, size_t sequence_length)
     return std::make_tuple(bin_indices, hash_values, ibf);
 }
 
+// The representations of the bitvector that are compared in layout_benchmark.
+enum class row_layout
+{
+    uncompressed,
+    block_compressed,
+    sd_vector
+};
+
+// Combines the rows of a filled Interleaved Bloom Filter whose bins differ in size by a factor of up to 128, as
+// bulk_contains does. `sd_vector` is the representation of the compressed layout up to SeqAn 3.1.
+template <row_layout layout>
+void layout_benchmark(::benchmark::State & state)
+{
+    size_t const bins = state.range(0);
+    size_t const bits = state.range(1);
+    size_t const hash_num = state.range(2);
+    size_t const sequence_length = state.range(3);
+
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins},
+                                         seqan3::bin_size{bits},
+                                         seqan3::hash_function_count{hash_num}};
+    for (size_t bin = 0; bin < bins; ++bin)
+        for (size_t value : seqan3::test::generate_numeric_sequence<size_t>((bits / 2) >> (bin % 8), 0u, -1ULL, bin))
+            ibf.emplace(value, seqan3::bin_index{bin});
+
+    size_t const words = (bins + 63) >> 6;
+    std::vector<std::array<size_t, 5>> rows(sequence_length);
+    for (size_t i = 0; i < hash_num; ++i)
+    {
+        auto row_indices = seqan3::test::generate_numeric_sequence<size_t>(sequence_length, 0u, bits - 1, i);
+        for (size_t j = 0; j < sequence_length; ++j)
+            rows[j][i] = row_indices[j] * words;
+    }
+
+    std::vector<uint64_t> result(words);
+    size_t bytes{};
+
+    if constexpr (layout == row_layout::uncompressed)
+    {
+        uint64_t const * const data = ibf.raw_data().data();
+        bytes = ibf.bit_size() / 8u;
+
+        for (auto _ : state)
+        {
+            for (auto const & row : rows)
+            {
+                std::array<uint64_t const *, 5> pointers;
+                for (size_t i = 0; i < hash_num; ++i)
+                    pointers[i] = data + row[i];
+
+                seqan3::detail::bitwise_and_rows<seqan3::simd::simd_type_t<uint64_t>>(pointers,
+                                                                                      hash_num,
+                                                                                      words,
+                                                                                      result.data());
+                benchmark::DoNotOptimize(result.data());
+            }
+        }
+    }
+    else if constexpr (layout == row_layout::block_compressed)
+    {
+        seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed> const compressed{ibf};
+        auto const & data = compressed.raw_data();
+        bytes = data.size_in_bytes();
+
+        for (auto _ : state)
+        {
+            for (auto const & row : rows)
+            {
+                data.decode_words(row[0], words, result.data());
+                for (size_t i = 1; i < hash_num; ++i)
+                    data.and_words(row[i], words, result.data());
+                benchmark::DoNotOptimize(result.data());
+            }
+        }
+    }
+    else
+    {
+        sdsl::sd_vector<> const data{ibf.raw_data()};
+        bytes = sdsl::size_in_bytes(data);
+
+        for (auto _ : state)
+        {
+            for (auto const & row : rows)
+            {
+                for (size_t batch = 0; batch < words; ++batch)
+                {
+                    uint64_t tmp{-1ULL};
+                    for (size_t i = 0; i < hash_num; ++i)
+                        tmp &= data.get_int((row[i] + batch) << 6);
+                    result[batch] = tmp;
+                }
+                benchmark::DoNotOptimize(result.data());
+            }
+        }
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(sequence_length);
+    state.counters["MiB"] = bytes / 1024.0 / 1024.0;
+}
+
 template <typename ibf_type>
 void emplace_benchmark(::benchmark::State & state)
 {
@@ -135,6 +250,64 @@ void bulk_contains_benchmark(::benchmark::State & state)
     state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
 }
 
+// Compares the vectorised row AND of bulk_contains with a scalar loop over the same rows.
+template <typename simd_t>
+void bitwise_and_rows_benchmark(::benchmark::State & state)
+{
+    size_t const bins = state.range(0);
+    size_t const bits = state.range(1);
+    size_t const hash_num = state.range(2);
+    size_t const sequence_length = state.range(3);
+
+    auto && [ bin_indices, hash_values, ibf ] =
+        set_up<seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>>(bins,
+                                                                                    bits,
+                                                                                    hash_num,
+                                                                                    sequence_length);
+    (void) bin_indices;
+    (void) hash_values;
+
+    size_t const words = (bins + 63) >> 6;
+    uint64_t const * const data = ibf.raw_data().data();
+
+    // The rows that bulk_contains would combine for random values.
+    std::vector<std::array<uint64_t const *, 5>> rows(sequence_length);
+    for (size_t i = 0; i < hash_num; ++i)
+    {
+        auto row_indices = seqan3::test::generate_numeric_sequence<size_t>(sequence_length, 0u, bits - 1, i);
+        for (size_t j = 0; j < sequence_length; ++j)
+            rows[j][i] = data + row_indices[j] * words;
+    }
+
+    std::vector<uint64_t> result(words);
+    auto combine_all = [&] <typename kernel_simd_t> ()
+    {
+        for (auto const & row : rows)
+        {
+            seqan3::detail::bitwise_and_rows<kernel_simd_t>(row, hash_num, words, result.data());
+            benchmark::DoNotOptimize(result.data());
+        }
+    };
+
+    for (auto _ : state)
+        combine_all.template operator()<simd_t>();
+
+    state.counters["hashes/sec"] = hashes_per_second(sequence_length);
+
+    // Report the speedup over the scalar loop.
+    auto seconds = [&] <typename kernel_simd_t> ()
+    {
+        auto const start = std::chrono::steady_clock::now();
+        for (size_t repeat = 0; repeat < 10; ++repeat)
+            combine_all.template operator()<kernel_simd_t>();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    double const scalar_seconds = seconds.template operator()<seqan3::simd::simd_type_t<uint64_t, 1>>();
+    double const simd_seconds = seconds.template operator()<simd_t>();
+    state.counters["speedup"] = scalar_seconds / simd_seconds;
+}
+
 template <typename ibf_type>
 void bulk_count_benchmark(::benchmark::State & state)
 {
@@ -153,6 +326,25 @@ void bulk_count_benchmark(::benchmark::State & state)
     state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
 }
 
+template <typename ibf_type>
+void bulk_classify_benchmark(::benchmark::State & state)
+{
+    auto && [ bin_indices, hash_values, ibf ] = set_up<ibf_type>(state.range(0),
+                                                                 state.range(1),
+                                                                 state.range(2),
+                                                                 state.range(3));
+    (void) bin_indices;
+
+    // Most bins of a classification query miss the threshold and are dismissed early.
+    auto agent = ibf.classification_agent(seqan3::kmer_lemma_threshold{19u, 2u});
+    for (auto _ : state)
+    {
+        [[maybe_unused]] auto & res = agent.bulk_classify(hash_values);
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
 BENCHMARK_TEMPLATE(emplace_benchmark,
                    seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(clear_benchmark,
@@ -164,10 +356,29 @@ BENCHMARK_TEMPLATE(bulk_contains_benchmark,
                    seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(bulk_contains_benchmark,
                    seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_contains_benchmark,
+                   seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(bulk_contains_arguments);
+
+BENCHMARK_TEMPLATE(bitwise_and_rows_benchmark, seqan3::simd::simd_type_t<uint64_t>)->Apply(bulk_contains_arguments);
+BENCHMARK_TEMPLATE(bitwise_and_rows_benchmark,
+                   seqan3::simd::simd_type_t<uint64_t, 1>)->Apply(bulk_contains_arguments);
+
+BENCHMARK_TEMPLATE(layout_benchmark, row_layout::uncompressed)->Apply(bulk_contains_arguments);
+BENCHMARK_TEMPLATE(layout_benchmark, row_layout::block_compressed)->Apply(bulk_contains_arguments);
+BENCHMARK_TEMPLATE(layout_benchmark, row_layout::sd_vector)->Apply(bulk_contains_arguments);
 
 BENCHMARK_TEMPLATE(bulk_count_benchmark,
                    seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(bulk_count_benchmark,
                    seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_count_benchmark,
+                   seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(bulk_contains_arguments);
+
+BENCHMARK_TEMPLATE(bulk_classify_benchmark,
+                   seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_classify_benchmark,
+                   seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_classify_benchmark,
+                   seqan3::interleaved_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(bulk_contains_arguments);
 
 BENCHMARK_MAIN();
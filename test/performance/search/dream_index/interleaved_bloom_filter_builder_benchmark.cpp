@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <thread>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter_builder.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+static void arguments(benchmark::internal::Benchmark* b)
+{
+    size_t const max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1u);
+
+    for (int32_t bins : {1'024, 8'192})
+    {
+        // 0: every bin has the same size; 1: the size of the bins varies by a factor of up to 16.
+        for (int32_t uneven : {0, 1})
+        {
+            for (size_t threads = 1u; threads <= max_threads; threads *= 2u)
+                b->Args({bins, uneven, static_cast<int32_t>(threads)});
+        }
+    }
+}
+
+static auto generate_bins(size_t const bin_count, bool const uneven)
+{
+    std::vector<std::vector<std::vector<seqan3::dna4>>> bins(bin_count);
+
+    for (size_t bin_idx = 0; bin_idx < bin_count; ++bin_idx)
+    {
+        // The large bins are clustered, such that a static partitioning of the bins would be unbalanced.
+        size_t const length = uneven ? ((bin_idx * 16u / bin_count) + 1u) * 1'000u : 8'500u;
+        bins[bin_idx].push_back(seqan3::test::generate_sequence<seqan3::dna4>(length, 0u, bin_idx));
+    }
+
+    return bins;
+}
+
+void build_benchmark(::benchmark::State & state)
+{
+    size_t const bin_count = state.range(0);
+    auto const bins = generate_bins(bin_count, state.range(1));
+
+    size_t total_length{};
+    for (auto const & bin : bins)
+        for (auto const & sequence : bin)
+            total_length += sequence.size();
+
+    seqan3::interleaved_bloom_filter_builder builder{seqan3::ungapped{19u}, seqan3::window_size{23u},
+                                                     static_cast<size_t>(state.range(2))};
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bin_count},
+                                         seqan3::bin_size{1u << 14},
+                                         seqan3::hash_function_count{2u}};
+
+    double sequential_seconds{};
+    {
+        seqan3::interleaved_bloom_filter_builder sequential{builder.shape(), builder.window_size(), 1u};
+        auto start = std::chrono::high_resolution_clock::now();
+        sequential.insert(ibf, bins);
+        auto end = std::chrono::high_resolution_clock::now();
+        sequential_seconds = std::chrono::duration<double>(end - start).count();
+    }
+
+    double parallel_seconds{};
+    for (auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        builder.insert(ibf, bins);
+        auto end = std::chrono::high_resolution_clock::now();
+        parallel_seconds += std::chrono::duration<double>(end - start).count();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+
+    state.counters["symbols/sec"] = benchmark::Counter(total_length,
+                                                       benchmark::Counter::kIsIterationInvariantRate,
+                                                       benchmark::Counter::OneK::kIs1000);
+    // Near-linear scaling means a speedup close to the number of threads.
+    state.counters["speedup"] = sequential_seconds / (parallel_seconds / state.iterations());
+}
+
+BENCHMARK(build_benchmark)->Apply(arguments)->UseManualTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,110 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/search.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Compares the rank data structures of the FM index: the wavelet tree (default) and the EPR dictionary.
+
+#ifndef NDEBUG
+static constexpr size_t text_length{10'000};
+#else
+static constexpr size_t text_length{5'000'000};
+#endif // NDEBUG
+static constexpr size_t number_of_queries{10'000};
+static constexpr size_t query_length{30};
+
+template <typename alphabet_t>
+std::vector<std::vector<alphabet_t>> sample_queries(std::vector<alphabet_t> const & text)
+{
+    std::mt19937_64 engine{42};
+    std::uniform_int_distribution<size_t> position{0, text.size() - query_length};
+
+    std::vector<std::vector<alphabet_t>> queries{};
+    for (size_t i = 0; i < number_of_queries; ++i)
+    {
+        size_t const begin = position(engine);
+        queries.emplace_back(text.begin() + begin, text.begin() + begin + query_length);
+    }
+
+    return queries;
+}
+
+template <typename index_t>
+void extend_right(benchmark::State & state)
+{
+    using alphabet_t = typename index_t::alphabet_type;
+
+    std::vector<alphabet_t> text = seqan3::test::generate_sequence<alphabet_t>(text_length, 0, 0);
+    std::vector<std::vector<alphabet_t>> queries = sample_queries(text);
+    index_t index{text};
+
+    size_t count{};
+    for (auto _ : state)
+    {
+        for (auto const & query : queries)
+        {
+            auto cursor = index.cursor();
+            cursor.extend_right(query);
+            count += cursor.count();
+        }
+    }
+
+    benchmark::DoNotOptimize(count);
+    state.counters["steps/s"] = benchmark::Counter(number_of_queries * query_length,
+                                                   benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <typename index_t>
+void search_one_error(benchmark::State & state)
+{
+    using alphabet_t = typename index_t::alphabet_type;
+
+    std::vector<alphabet_t> text = seqan3::test::generate_sequence<alphabet_t>(text_length, 0, 0);
+    std::vector<std::vector<alphabet_t>> queries = sample_queries(text);
+    queries.resize(number_of_queries / 10);
+    index_t index{text};
+
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}} |
+                                      seqan3::search_cfg::output_query_id{} |
+                                      seqan3::search_cfg::output_index_cursor{};
+
+    size_t count{};
+    for (auto _ : state)
+        count += std::ranges::distance(seqan3::search(queries, index, cfg));
+
+    benchmark::DoNotOptimize(count);
+}
+
+template <typename alphabet_t>
+using wt_fm_index = seqan3::fm_index<alphabet_t, seqan3::text_layout::single>;
+template <typename alphabet_t>
+using epr_fm_index = seqan3::fm_index<alphabet_t, seqan3::text_layout::single, seqan3::sdsl_epr_index_type<alphabet_t>>;
+template <typename alphabet_t>
+using wt_bi_fm_index = seqan3::bi_fm_index<alphabet_t, seqan3::text_layout::single>;
+template <typename alphabet_t>
+using epr_bi_fm_index = seqan3::bi_fm_index<alphabet_t,
+                                            seqan3::text_layout::single,
+                                            seqan3::sdsl_epr_index_type<alphabet_t>>;
+
+BENCHMARK_TEMPLATE(extend_right, wt_fm_index<seqan3::dna4>);
+BENCHMARK_TEMPLATE(extend_right, epr_fm_index<seqan3::dna4>);
+BENCHMARK_TEMPLATE(extend_right, wt_fm_index<seqan3::dna5>);
+BENCHMARK_TEMPLATE(extend_right, epr_fm_index<seqan3::dna5>);
+BENCHMARK_TEMPLATE(extend_right, wt_bi_fm_index<seqan3::dna4>);
+BENCHMARK_TEMPLATE(extend_right, epr_bi_fm_index<seqan3::dna4>);
+
+BENCHMARK_TEMPLATE(search_one_error, wt_bi_fm_index<seqan3::dna4>);
+BENCHMARK_TEMPLATE(search_one_error, epr_bi_fm_index<seqan3::dna4>);
+
+BENCHMARK_MAIN();
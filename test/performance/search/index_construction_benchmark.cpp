@@ -93,6 +93,35 @@ void index_benchmark_seqan3(benchmark::State & state)
     }
 }
 
+static void parallel_arguments(benchmark::internal::Benchmark * b)
+{
+#ifndef NDEBUG
+    int32_t const length{5000};
+#else
+    int32_t const length{max_length};
+#endif  // NDEBUG
+
+    // Only the two directions of the bi_fm_index are built concurrently; the suffix sorting itself is sequential.
+    for (int32_t threads : {1, 2})
+        b->Args({length, 20, threads});
+}
+
+template <typename alphabet_t>
+void index_benchmark_seqan3_parallel(benchmark::State & state)
+{
+    std::vector<std::vector<alphabet_t>> sequence{};
+    for (int32_t i = 0; i < state.range(1); ++i)
+        sequence.push_back(seqan3::test::generate_sequence<alphabet_t>(state.range(0), 0, seed + i));
+
+    seqan3::fm_index_construction_options options{};
+    options.thread_count = state.range(2);
+
+    for (auto _ : state)
+        seqan3::bi_fm_index index{sequence, options};
+
+    state.counters["threads"] = state.range(2);
+}
+
 #if SEQAN3_HAS_SEQAN2
 struct sequence_store_seqan2
 {
@@ -183,6 +212,8 @@ BENCHMARK_TEMPLATE(index_benchmark_seqan3, tag::bi_fm_index, two_dimensional<seq
 BENCHMARK_TEMPLATE(index_benchmark_seqan3, tag::bi_fm_index, one_dimensional<std::string> )->Apply(arguments);
 BENCHMARK_TEMPLATE(index_benchmark_seqan3, tag::bi_fm_index, two_dimensional<std::string> )->Apply(arguments);
 
+BENCHMARK_TEMPLATE(index_benchmark_seqan3_parallel, seqan3::dna4)->Apply(parallel_arguments);
+
 #if SEQAN3_HAS_SEQAN2
 template <typename t>
 using one_dimensional2 = seqan::String<t>;
@@ -9,6 +9,7 @@
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/core/detail/persist_view.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/search/search.hpp>
@@ -29,8 +30,17 @@ struct options
     uint8_t const strata;
     double const stddev{0};
     uint32_t repeats{20};
+    size_t lookup_table_depth{0};
+    size_t batch_size{0}; // 0 searches the reads one after another
 };
 
+seqan3::fm_index_construction_options construction_options(options const & o)
+{
+    seqan3::fm_index_construction_options index_options{};
+    index_options.lookup_table_depth = o.lookup_table_depth;
+    return index_options;
+}
+
 template <seqan3::alphabet alphabet_t>
 void mutate_substitution(std::vector<alphabet_t> & seq, size_t const pos, uint8_t alphabet_rank)
 {
@@ -182,6 +192,35 @@ void unidirectional_search_all_collection(benchmark::State & state, options && o
     benchmark::DoNotOptimize(sum);
 }
 
+//============================================================================
+//  search all reads, optionally in batches
+//============================================================================
+
+template <typename index_t>
+void search_all(benchmark::State & state,
+                std::vector<std::vector<seqan3::dna4>> const & reads,
+                index_t const & index,
+                options const & o)
+{
+    seqan3::configuration cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{o.searched_errors}};
+
+    auto run = [&] (auto const & config)
+    {
+        size_t sum{};
+        for (auto _ : state)
+        {
+            auto results = search(reads, index, config);
+            sum += std::ranges::distance(results);
+        }
+        benchmark::DoNotOptimize(sum);
+    };
+
+    if (o.batch_size == 0)
+        run(cfg);
+    else
+        run(cfg | seqan3::search_cfg::batch{o.batch_size});
+}
+
 //============================================================================
 //  undirectional; trivial_search, single, dna4, all-mapping
 //============================================================================
@@ -193,19 +232,11 @@ void unidirectional_search_all(benchmark::State & state, options && o)
                                                                               o.repeats, 0.5, 0) :
                                     seqan3::test::generate_sequence<seqan3::dna4>(o.sequence_length, 0, 0);
 
-    seqan3::fm_index index{ref};
+    seqan3::fm_index index{ref, construction_options(o)};
     std::vector<std::vector<seqan3::dna4>> reads = generate_reads(ref, o.number_of_reads, o.read_length,
                                                                   o.simulated_errors, o.prob_insertion,
                                                                   o.prob_deletion, o.stddev);
-    seqan3::configuration cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{o.searched_errors}};
-
-    size_t sum{};
-    for (auto _ : state)
-    {
-        auto results = search(reads, index, cfg);
-        sum += std::ranges::distance(results);
-    }
-    benchmark::DoNotOptimize(sum);
+    search_all(state, reads, index, o);
 }
 
 //============================================================================
@@ -219,19 +250,11 @@ void bidirectional_search_all(benchmark::State & state, options && o)
                                                                               o.repeats, 0.5, 0) :
                                     seqan3::test::generate_sequence<seqan3::dna4>(o.sequence_length, 0, 0);
 
-    seqan3::bi_fm_index index{ref};
+    seqan3::bi_fm_index index{ref, construction_options(o)};
     std::vector<std::vector<seqan3::dna4>> reads = generate_reads(ref, o.number_of_reads, o.read_length,
                                                                   o.simulated_errors, o.prob_insertion,
                                                                   o.prob_deletion, o.stddev);
-    seqan3::configuration cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{o.searched_errors}};
-
-    size_t sum{};
-    for (auto _ : state)
-    {
-        auto results = search(reads, index, cfg);
-        sum += std::ranges::distance(results);
-    }
-    benchmark::DoNotOptimize(sum);
+    search_all(state, reads, index, o);
 }
 
 //============================================================================
@@ -328,6 +351,20 @@ BENCHMARK_CAPTURE(unidirectional_search_all, highErrorReadsSearch3Rep,
 BENCHMARK_CAPTURE(unidirectional_search_all, highErrorReadsSearch3Rep,
                   options{big_size, true, 50, 50, 0.30, 0.30, 0, 3, 3, 1.75});
 
+// The same searches with a lookup table that replaces the first 8 backward search steps of each exact block.
+BENCHMARK_CAPTURE(unidirectional_search_all, highErrorReadsSearch0LookupTable,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 0, 0, 1.75, 20, 8});
+BENCHMARK_CAPTURE(unidirectional_search_all, highErrorReadsSearch1LookupTable,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 1, 1, 1.75, 20, 8});
+
+// Exact search of many reads one after another and in batches that interleave the index accesses of the reads.
+BENCHMARK_CAPTURE(unidirectional_search_all, manyReadsSearch0,
+                  options{big_size, false, 10000, 50, 0.18, 0.18, 0, 0, 0, 1.75, 20, 0, 0});
+BENCHMARK_CAPTURE(unidirectional_search_all, manyReadsSearch0Batch16,
+                  options{big_size, false, 10000, 50, 0.18, 0.18, 0, 0, 0, 1.75, 20, 0, 16});
+BENCHMARK_CAPTURE(unidirectional_search_all, manyReadsSearch0Batch64,
+                  options{big_size, false, 10000, 50, 0.18, 0.18, 0, 0, 0, 1.75, 20, 0, 64});
+
 BENCHMARK_CAPTURE(bidirectional_search_all, lowErrorReadsSearch3,
                   options{big_size, false, 50, 50, 0.18, 0.18, 0, 3, 0, 1});
 BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch0,
@@ -349,6 +386,25 @@ BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch3Rep,
 BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch3Rep,
                   options{big_size, true, 50, 50, 0.30, 0.30, 0, 3, 3, 1.75});
 
+BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch0LookupTable,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 0, 0, 1.75, 20, 8});
+BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch1LookupTable,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 1, 1, 1.75, 20, 8});
+BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch2LookupTable,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 2, 2, 1.75, 20, 8});
+BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch3LookupTable,
+                  options{big_size, false, 50, 50, 0.18, 0.18, 0, 3, 3, 1.75, 20, 8});
+
+BENCHMARK_CAPTURE(bidirectional_search_all, manyReadsSearch0,
+                  options{big_size, false, 10000, 50, 0.18, 0.18, 0, 0, 0, 1.75, 20, 0, 0});
+BENCHMARK_CAPTURE(bidirectional_search_all, manyReadsSearch0Batch16,
+                  options{big_size, false, 10000, 50, 0.18, 0.18, 0, 0, 0, 1.75, 20, 0, 16});
+BENCHMARK_CAPTURE(bidirectional_search_all, manyReadsSearch0Batch64,
+                  options{big_size, false, 10000, 50, 0.18, 0.18, 0, 0, 0, 1.75, 20, 0, 64});
+// Batches with errors fall back to searching the reads one after another.
+BENCHMARK_CAPTURE(bidirectional_search_all, manyReadsSearch1Batch16,
+                  options{big_size, false, 10000, 50, 0.18, 0.18, 0, 1, 1, 1.75, 20, 0, 16});
+
 BENCHMARK_CAPTURE(unidirectional_search_stratified, lowErrorReadsSearch3Strata0Rep,
                   options{medium_size, true, 50, 50, 0.18, 0.18, 0, 3, 0, 1});
 BENCHMARK_CAPTURE(unidirectional_search_stratified, lowErrorReadsSearch3Strata1Rep,
@@ -0,0 +1,93 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/detail/search_scheme_algorithm.hpp>
+#include <seqan3/search/detail/search_scheme_generator.hpp>
+#include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+//============================================================================
+//  trivial vs. generated search schemes for many errors
+//============================================================================
+
+enum class scheme_tag
+{
+    trivial,
+    generated
+};
+
+// Substitutes `errors` distinct random positions of substrings of the reference.
+std::vector<std::vector<seqan3::dna4>> generate_reads(std::vector<seqan3::dna4> const & ref,
+                                                      size_t const number_of_reads,
+                                                      size_t const read_length,
+                                                      uint8_t const errors)
+{
+    std::mt19937_64 gen{0};
+    std::uniform_int_distribution<size_t> read_position{0, ref.size() - read_length};
+    std::uniform_int_distribution<size_t> error_position{0, read_length - 1};
+    std::uniform_int_distribution<uint8_t> rank_offset{1, 3};
+
+    std::vector<std::vector<seqan3::dna4>> reads{};
+    for (size_t i = 0; i < number_of_reads; ++i)
+    {
+        size_t const begin = read_position(gen);
+        std::vector<seqan3::dna4> read{ref.begin() + begin, ref.begin() + begin + read_length};
+
+        std::vector<bool> substituted(read_length, false);
+        for (uint8_t e = 0; e < errors;)
+        {
+            size_t const position = error_position(gen);
+            if (substituted[position])
+                continue;
+
+            substituted[position] = true;
+            read[position].assign_rank((seqan3::to_rank(read[position]) + rank_offset(gen)) % 4);
+            ++e;
+        }
+        reads.push_back(std::move(read));
+    }
+
+    return reads;
+}
+
+template <scheme_tag tag>
+void search_scheme(benchmark::State & state)
+{
+    uint8_t const errors = state.range(0);
+    size_t constexpr read_length{100};
+    std::vector<seqan3::dna4> ref = seqan3::test::generate_sequence<seqan3::dna4>(1'000'000, 0, 0);
+    seqan3::bi_fm_index index{ref};
+    std::vector<std::vector<seqan3::dna4>> reads = generate_reads(ref, 20, read_length, errors);
+
+    seqan3::detail::search_scheme_dyn_type const scheme =
+        (tag == scheme_tag::trivial) ? seqan3::detail::search_scheme_dyn_type{{{1}, {0}, {errors}}}
+                                     : seqan3::detail::select_search_scheme(0, errors, read_length, 4, ref.size());
+    seqan3::detail::search_param const error_left{errors, errors, 0, 0};
+
+    size_t hits{};
+    for (auto _ : state)
+    {
+        for (auto & read : reads)
+        {
+            seqan3::detail::search_ss<false>(index, read, error_left, scheme, [&hits] (auto const &) { ++hits; });
+        }
+    }
+    benchmark::DoNotOptimize(hits);
+
+    state.counters["blocks"] = scheme.front().blocks();
+    state.counters["expected_nodes"] = seqan3::detail::search_scheme_cost(scheme, read_length, 4, ref.size());
+}
+
+BENCHMARK_TEMPLATE(search_scheme, scheme_tag::trivial)->Arg(4)->Arg(5);
+BENCHMARK_TEMPLATE(search_scheme, scheme_tag::generated)->Arg(4)->Arg(5)->Arg(6)->Arg(7);
+
+BENCHMARK_MAIN();
@@ -36,12 +36,24 @@ inline seqan3::shape make_gapped_shape(size_t const k)
     return shape;
 }
 
+// A spaced seed of span k with two of three positions, e.g. 11011011 for k = 8.
+inline seqan3::shape make_spaced_seed(size_t const k)
+{
+    seqan3::shape shape{};
+
+    for (size_t i{0}; i < k - 1; ++i)
+        shape.push_back(i % 3 != 2);
+
+    shape.push_back(1u);
+    return shape;
+}
+
 
 static void arguments(benchmark::internal::Benchmark* b)
 {
     for (int32_t sequence_length : {1'000, 50'000, /*1'000'000*/})
     {
-        for (int32_t k : {8, /*16, 24,*/ 30})
+        for (int32_t k : {8, /*16,*/ 24, 30})
         {
             b->Args({sequence_length, k});
         }
@@ -92,6 +104,28 @@ static void seqan_kmer_hash_gapped(benchmark::State & state)
     state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
 }
 
+static void seqan_kmer_hash_spaced_seed(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    size_t k = static_cast<size_t>(state.range(1));
+    assert(k > 0);
+    auto seq = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+
+    size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : seq | seqan3::views::kmer_hash(make_spaced_seed(k)))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    // prevent complete optimisation
+    [[maybe_unused]] volatile auto fin = sum;
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
+}
+
 static void naive_kmer_hash(benchmark::State & state)
 {
     auto sequence_length = state.range(0);
@@ -189,6 +223,7 @@ BENCHMARK(seqan2_kmer_hash_gapped)->Apply(arguments);
 
 BENCHMARK(seqan_kmer_hash_ungapped)->Apply(arguments);
 BENCHMARK(seqan_kmer_hash_gapped)->Apply(arguments);
+BENCHMARK(seqan_kmer_hash_spaced_seed)->Apply(arguments);
 BENCHMARK(naive_kmer_hash)->Apply(arguments);
 
 BENCHMARK_MAIN();
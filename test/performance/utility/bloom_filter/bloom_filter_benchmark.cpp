@@ -7,7 +7,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <vector>
+
 #include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
 
 inline benchmark::Counter hashes_per_second(size_t const count)
@@ -20,26 +23,42 @@ inline benchmark::Counter hashes_per_second(size_t const count)
 static void arguments(benchmark::internal::Benchmark* b)
 {
     // Size of the IBF will be 2^bits bits
-    for (int32_t bits = 15; bits <= 20; bits += 5)
+    for (int32_t bits = 15; bits <= 30; bits += 5)
     {
         // The bits must fit in an int32_t
         if (bits < 32)
         {
-            for (int32_t hash_num = 2; hash_num < 3; ++hash_num)
+            for (int32_t hash_num = 2; hash_num <= 5; hash_num += 3)
             {
                 b->Args({(1LL << bits), hash_num, 1'000});
+                // The queried blocks do not fit into the cache.
+                b->Args({(1LL << bits), hash_num, 1'000'000});
             }
         }
     }
 }
 
+template <typename bf_type>
+constexpr bool is_blocked = false;
+
+template <seqan3::data_layout data_layout_mode>
+constexpr bool is_blocked<seqan3::blocked_bloom_filter<data_layout_mode>> = true;
+
 template <typename bf_type>
 auto set_up(size_t bits, size_t hash_num, size_t sequence_length)
 {
+    using uncompressed_bf_type = std::conditional_t<is_blocked<bf_type>,
+                                                    seqan3::blocked_bloom_filter<>,
+                                                    seqan3::bloom_filter<>>;
+
     auto hash_values = seqan3::test::generate_numeric_sequence<size_t>(sequence_length);
-    seqan3::bloom_filter tmp_bf(seqan3::bin_size{bits},
+    uncompressed_bf_type tmp_bf(seqan3::bin_size{bits},
                                 seqan3::hash_function_count{hash_num});
 
+    // Every other query is contained.
+    for (size_t i = 0; i < hash_values.size(); i += 2)
+        tmp_bf.emplace(hash_values[i]);
+
     bf_type bf{std::move(tmp_bf)};
 
     return std::make_tuple(hash_values, bf);
@@ -106,19 +125,53 @@ void count_benchmark(::benchmark::State & state)
     state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
 }
 
+template <typename bf_type>
+void bulk_contains_benchmark(::benchmark::State & state)
+{
+    auto && [ hash_values, bf ] = set_up<bf_type>(state.range(0),
+                                                  state.range(1),
+                                                  state.range(2));
+
+    std::vector<bool> result(hash_values.size());
+    for (auto _ : state)
+    {
+        bf.bulk_contains(hash_values, result.begin());
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.counters["hashes/sec"] = hashes_per_second(std::ranges::size(hash_values));
+}
+
 BENCHMARK_TEMPLATE(emplace_benchmark,
                    seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(emplace_benchmark,
+                   seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(reset_benchmark,
                    seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(reset_benchmark,
+                   seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 
 BENCHMARK_TEMPLATE(contains_benchmark,
                    seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(contains_benchmark,
                    seqan3::bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(contains_benchmark,
+                   seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(contains_benchmark,
+                   seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
+
+BENCHMARK_TEMPLATE(bulk_contains_benchmark,
+                   seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(bulk_contains_benchmark,
+                   seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
 
 BENCHMARK_TEMPLATE(count_benchmark,
                    seqan3::bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
 BENCHMARK_TEMPLATE(count_benchmark,
                    seqan3::bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(count_benchmark,
+                   seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>)->Apply(arguments);
+BENCHMARK_TEMPLATE(count_benchmark,
+                   seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>)->Apply(arguments);
 
 BENCHMARK_MAIN();
@@ -0,0 +1,10 @@
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
+
+int main()
+{
+    // Always computes the alignment in linear memory.
+    seqan3::align_cfg::linear_memory always_cfg{};
+
+    // Computes the alignment in linear memory if its trace matrix would need more than 1 GiB.
+    seqan3::align_cfg::linear_memory limit_cfg{1ull << 30};
+}
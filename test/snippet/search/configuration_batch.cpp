@@ -0,0 +1,25 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/configuration/batch.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/search.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+    std::vector<std::vector<seqan3::dna4>> queries{"GCTAG"_dna4, "AAGG"_dna4, "TTTT"_dna4};
+
+    seqan3::fm_index index{genome};
+
+    // Search the queries in batches of two queries, interleaving the index accesses of the queries of a batch.
+    seqan3::configuration const cfg = seqan3::search_cfg::batch{2};
+
+    for (auto && result : search(queries, index, cfg))
+        seqan3::debug_stream << result << '\n';
+
+    return 0;
+}
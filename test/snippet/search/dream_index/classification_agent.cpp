@@ -0,0 +1,40 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{8u},
+                                         seqan3::bin_size{8192u},
+                                         seqan3::hash_function_count{2u}};
+
+    auto const sequence1 = "ACTGACTGACTGATC"_dna4;
+    auto const sequence2 = "GTGACTGACTGACTCG"_dna4;
+    auto const sequence3 = "AAAAAAACGATCGACA"_dna4;
+    auto hash_adaptor = seqan3::views::kmer_hash(seqan3::ungapped{5u});
+
+    // Insert all 5-mers of sequence1 into bin 0
+    for (auto && value : sequence1 | hash_adaptor)
+        ibf.emplace(value, seqan3::bin_index{0u});
+
+    // Insert all 5-mers of sequence2 into bin 4
+    for (auto && value : sequence2 | hash_adaptor)
+        ibf.emplace(value, seqan3::bin_index{4u});
+
+    // Insert all 5-mers of sequence3 into bin 7
+    for (auto && value : sequence3 | hash_adaptor)
+        ibf.emplace(value, seqan3::bin_index{7u});
+
+    // A bin must contain all but 5 * 1 of the 5-mers of a query with one error.
+    auto agent = ibf.classification_agent(seqan3::kmer_lemma_threshold{5u, 1u});
+
+    // The 11 5-mers of sequence1 are contained 11 times in bin 0 and 9 times in bin 4.
+    seqan3::debug_stream << agent.bulk_classify(sequence1 | hash_adaptor) << '\n'; // [0,4]
+
+    // A bin must contain at least 90% of the 5-mers of a query.
+    auto agent2 = ibf.classification_agent(seqan3::relative_threshold{0.9});
+    seqan3::debug_stream << agent2.bulk_classify(sequence1 | hash_adaptor) << '\n'; // [0]
+}
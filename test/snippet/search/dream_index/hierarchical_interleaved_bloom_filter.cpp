@@ -0,0 +1,29 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/hierarchical_interleaved_bloom_filter.hpp>
+#include <seqan3/search/views/kmer_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    std::vector<seqan3::dna4_vector> const sequences{"ACTGACTGACTGATCGATCGATCGATCGATCGATCGATGCATGCATGCAT"_dna4,
+                                                     "GTGACTGACTGACTCG"_dna4,
+                                                     "AAAAAAACGATCGACA"_dna4};
+    auto hash_adaptor = seqan3::views::kmer_hash(seqan3::ungapped{5u});
+
+    // One user bin per sequence; the user bins may have very different sizes.
+    std::vector<std::vector<uint64_t>> user_bins{};
+    for (auto const & sequence : sequences)
+    {
+        auto hashes = sequence | hash_adaptor;
+        user_bins.emplace_back(hashes.begin(), hashes.end());
+    }
+
+    // A false positive rate of 1% and 64 technical bins per Interleaved Bloom Filter.
+    seqan3::hierarchical_interleaved_bloom_filter hibf{user_bins, 0.01, seqan3::bin_count{64u}};
+
+    auto agent = hibf.counting_agent();
+    auto const query = "GTGACTGACTGACTCG"_dna4;
+    seqan3::debug_stream << agent.bulk_count(query | hash_adaptor) << '\n'; // [9,12,0]
+}
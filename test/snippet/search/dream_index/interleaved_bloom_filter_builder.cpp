@@ -0,0 +1,23 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter_builder.hpp>
+#include <seqan3/search/views/minimiser_hash.hpp>
+
+using namespace seqan3::literals;
+
+int main()
+{
+    // One range of sequences per bin.
+    std::vector<std::vector<seqan3::dna4_vector>> bins{{"ACTGACTGACTGATC"_dna4},
+                                                        {"GTGACTGACTGACTCG"_dna4, "TTTTTTTTT"_dna4},
+                                                        {"AAAAAAACGATCGACA"_dna4}};
+
+    // Hash with the minimisers of 4-mers in windows of length 8 and use two threads.
+    seqan3::interleaved_bloom_filter_builder builder{seqan3::ungapped{4u}, seqan3::window_size{8u}, 2u};
+    seqan3::interleaved_bloom_filter ibf = builder.build(bins, seqan3::bin_size{8192u});
+
+    auto agent = ibf.counting_agent();
+    auto const query = "ACTGACTGACTGATC"_dna4;
+    auto hash_adaptor = seqan3::views::minimiser_hash(seqan3::ungapped{4u}, seqan3::window_size{8u});
+    seqan3::debug_stream << agent.bulk_count(query | hash_adaptor) << '\n';
+}
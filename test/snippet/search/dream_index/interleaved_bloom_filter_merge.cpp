@@ -0,0 +1,23 @@
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+int main()
+{
+    // Two filters with the same bins, e.g. built from different partitions of the sequences of each bin.
+    seqan3::interleaved_bloom_filter ibf1{seqan3::bin_count{3u}, seqan3::bin_size{8192u}};
+    seqan3::interleaved_bloom_filter ibf2{seqan3::bin_count{3u}, seqan3::bin_size{8192u}};
+    ibf1.emplace(126, seqan3::bin_index{0u});
+    ibf2.emplace(712, seqan3::bin_index{0u});
+    ibf2.emplace(237, seqan3::bin_index{2u});
+
+    ibf1.merge(ibf2, seqan3::merge_mode::unite_bins);
+
+    // The bins of ibf2 are appended, i.e. bin 0 of ibf2 becomes bin 3.
+    ibf1.merge(ibf2, seqan3::merge_mode::append_bins);
+    // Be sure to get the agent after `merge` as appending bins invalidates all agents!
+    auto agent = ibf1.membership_agent();
+
+    seqan3::debug_stream << agent.bulk_contains(126) << '\n'; // prints [1,0,0,0,0,0]
+    seqan3::debug_stream << agent.bulk_contains(712) << '\n'; // prints [1,0,0,1,0,0]
+    seqan3::debug_stream << agent.bulk_contains(237) << '\n'; // prints [0,0,1,0,0,1]
+}
@@ -0,0 +1,26 @@
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+
+int main()
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{73u}, seqan3::bin_size{8192u}};
+    ibf.emplace(126, seqan3::bin_index{0u});
+    ibf.emplace(712, seqan3::bin_index{3u});
+    ibf.emplace(237, seqan3::bin_index{70u});
+
+    // Remove the bins 1 and 2. The bins after them are renumbered, e.g. bin 3 becomes bin 1.
+    std::vector<seqan3::bin_index> const removed{seqan3::bin_index{1u}, seqan3::bin_index{2u}};
+    std::vector<size_t> new_index = ibf.remove_bins(removed);
+    seqan3::debug_stream << new_index[3] << ' ' << new_index[70] << '\n'; // prints 1 68
+
+    // Remove all bins from bin 12 on. 12 bins fit into one 64-bit word, hence the IBF shrinks to half its size.
+    ibf.decrease_bin_number_to(seqan3::bin_count{12u});
+    // Be sure to get the agent after `remove_bins` and `decrease_bin_number_to` as they invalidate all agents!
+    auto agent = ibf.membership_agent();
+
+    seqan3::debug_stream << agent.bulk_contains(126) << '\n'; // prints [1,0,0,0,0,0,0,0,0,0,0,0]
+    seqan3::debug_stream << agent.bulk_contains(712) << '\n'; // prints [0,1,0,0,0,0,0,0,0,0,0,0]
+    seqan3::debug_stream << agent.bulk_contains(237) << '\n'; // prints [0,0,0,0,0,0,0,0,0,0,0,0]
+}
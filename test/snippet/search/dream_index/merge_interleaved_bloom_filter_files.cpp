@@ -0,0 +1,35 @@
+#include <filesystem>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
+#include <seqan3/search/dream_index/merge_interleaved_bloom_filter_files.hpp>
+
+int main()
+{
+    std::filesystem::path const directory = std::filesystem::temp_directory_path();
+
+    // Two filters over different bins, e.g. built on different machines.
+    seqan3::interleaved_bloom_filter ibf1{seqan3::bin_count{2u}, seqan3::bin_size{8192u}};
+    seqan3::interleaved_bloom_filter ibf2{seqan3::bin_count{3u}, seqan3::bin_size{8192u}};
+    ibf1.emplace(126, seqan3::bin_index{1u});
+    ibf2.emplace(712, seqan3::bin_index{2u});
+    ibf1.store(directory / "part1.ibf");
+    ibf2.store(directory / "part2.ibf");
+
+    // The inputs are streamed, i.e. they are never loaded completely.
+    seqan3::merge_interleaved_bloom_filter_files({directory / "part1.ibf", directory / "part2.ibf"},
+                                                 directory / "merged.ibf",
+                                                 seqan3::merge_mode::append_bins,
+                                                 4u /*threads*/);
+
+    seqan3::interleaved_bloom_filter merged{};
+    merged.load(directory / "merged.ibf");
+    auto agent = merged.membership_agent();
+
+    seqan3::debug_stream << agent.bulk_contains(126) << '\n'; // prints [0,1,0,0,0]
+    seqan3::debug_stream << agent.bulk_contains(712) << '\n'; // prints [0,0,0,0,1]
+
+    std::filesystem::remove(directory / "part1.ibf");
+    std::filesystem::remove(directory / "part2.ibf");
+    std::filesystem::remove(directory / "merged.ibf");
+}
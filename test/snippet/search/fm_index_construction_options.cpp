@@ -0,0 +1,22 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+
+    // Build both directions concurrently and keep the intermediate data on disk if more than 1 GiB of memory would be
+    // needed.
+    seqan3::fm_index_construction_options options{};
+    options.thread_count = 2u;
+    options.memory_limit = 1ULL << 30;
+    seqan3::bi_fm_index index{genome, options};
+
+    seqan3::debug_stream << (index == seqan3::bi_fm_index{genome}) << '\n'; // outputs: 1
+    return 0;
+}
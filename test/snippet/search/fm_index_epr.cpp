@@ -0,0 +1,21 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/search/search.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+    seqan3::bi_fm_index<seqan3::dna4,
+                        seqan3::text_layout::single,
+                        seqan3::sdsl_epr_index_type<seqan3::dna4>> index{genome};
+
+    for (auto && result : search("AAGG"_dna4, index))
+        seqan3::debug_stream << result << '\n';
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/search/search.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+
+    // Precompute the suffix array intervals of all words of length up to 4.
+    seqan3::fm_index_construction_options options{};
+    options.lookup_table_depth = 4u;
+    seqan3::bi_fm_index index{genome, options};
+
+    // The first 4 backward search steps of the query are replaced by a single lookup.
+    for (auto && result : search("GCTAG"_dna4, index))
+        seqan3::debug_stream << result << '\n';
+
+    return 0;
+}
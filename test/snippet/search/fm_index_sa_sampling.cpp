@@ -0,0 +1,23 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+
+    // Store every 4th entry of the suffix array.
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_wt_sampled_index_type<4>> index{genome};
+    seqan3::debug_stream << "Expected LF steps per locate: " << index.expected_locate_steps() << '\n'; // 3
+
+    // Store the complete suffix array.
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_full_sa_index_type> full_index{genome};
+    seqan3::debug_stream << "Expected LF steps per locate: " << full_index.expected_locate_steps() << '\n'; // 0
+    seqan3::debug_stream << "Needs more space: " << (full_index.size_in_bytes() > index.size_in_bytes()) << '\n'; // 1
+
+    return 0;
+}
@@ -0,0 +1,37 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/kmer_index/all.hpp>
+#include <seqan3/search/search.hpp>
+
+int main()
+{
+    using namespace seqan3::literals;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+
+    // Index all k-mers of the gapped shape 1101 and use two threads for the construction.
+    seqan3::kmer_index_construction_options options{};
+    options.thread_count = 2u;
+    seqan3::kmer_index index{genome, 0b1101_shape, options};
+
+    auto cur = index.cursor();                                         // create a cursor
+    cur.lookup("GCTA"_dna4);                                           // look up the k-mer "GC-A"
+    seqan3::debug_stream << "Number of hits: " << cur.count() << '\n'; // outputs: 3
+    seqan3::debug_stream << "Positions in the genome: ";
+    for (auto && pos : cur.locate())                                   // outputs: (0,11) (0,15) (0,19)
+        seqan3::debug_stream << pos << ' ';
+    seqan3::debug_stream << '\n';
+
+    // Search with one substitution: the k-mers of the query are looked up and the candidates are verified.
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}} |
+                                      seqan3::search_cfg::max_error_substitution{seqan3::search_cfg::error_count{1}} |
+                                      seqan3::search_cfg::max_error_insertion{seqan3::search_cfg::error_count{0}} |
+                                      seqan3::search_cfg::max_error_deletion{seqan3::search_cfg::error_count{0}};
+
+    for (auto && result : seqan3::search("AAGGCTTGCT"_dna4, index, cfg)) // outputs: reference_pos:8
+        seqan3::debug_stream << result << '\n';
+
+    return 0;
+}
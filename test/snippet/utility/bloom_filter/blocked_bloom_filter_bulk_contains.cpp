@@ -0,0 +1,17 @@
+#include <vector>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
+
+int main()
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{8192u}};
+    bf.emplace(126);
+    bf.emplace(712);
+    bf.emplace(237);
+
+    // Query a range of values; the result of each value is appended to `result`.
+    std::vector<bool> result{};
+    bf.bulk_contains(std::vector<size_t>{712, 126, 4}, std::back_inserter(result));
+    seqan3::debug_stream << result << '\n'; // prints [1,1,0]
+}
@@ -0,0 +1,15 @@
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
+
+int main()
+{
+    // The 1024 bits are divided into two blocks of 512 bits each.
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}, seqan3::hash_function_count{3u}};
+    bf.emplace(126);
+    bf.emplace(712);
+    bf.emplace(237);
+
+    // All three bits of 712 are stored in the same block.
+    bool result = bf.contains(712);
+    seqan3::debug_stream << result << '\n'; // prints 1
+}
@@ -12,6 +12,7 @@
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_debug.hpp>
 #include <seqan3/alignment/configuration/align_config_gap_cost_affine.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
 #include <seqan3/alignment/configuration/align_config_method.hpp>
 #include <seqan3/alignment/configuration/align_config_min_score.hpp>
 #include <seqan3/alignment/configuration/align_config_on_result.hpp>
@@ -41,8 +42,12 @@ using callback_t = decltype(on_result_callback);
 // test type.
 using align_config_and_taboo_types = seqan3::type_list<
     // method configs
-    std::pair<cfg::method_global, seqan3::type_list<cfg::method_global, cfg::method_local>>,
-    std::pair<cfg::method_local, seqan3::type_list<cfg::method_local, cfg::method_global, cfg::min_score>>,
+    std::pair<cfg::method_global, seqan3::type_list<cfg::method_global, cfg::method_local, cfg::method_extension>>,
+    std::pair<cfg::method_local, seqan3::type_list<cfg::method_local, cfg::method_global, cfg::min_score,
+                                                  cfg::linear_memory, cfg::method_extension>>,
+    std::pair<cfg::method_extension, seqan3::type_list<cfg::method_extension, cfg::method_global, cfg::method_local,
+                                                      cfg::band_fixed_size, cfg::detail::debug, cfg::linear_memory,
+                                                      cfg::min_score>>,
     // output configs
     std::pair<cfg::output_sequence1_id, seqan3::type_list<cfg::output_sequence1_id>>,
     std::pair<cfg::output_sequence2_id, seqan3::type_list<cfg::output_sequence2_id>>,
@@ -51,16 +56,19 @@ using align_config_and_taboo_types = seqan3::type_list<
     std::pair<cfg::output_end_position, seqan3::type_list<cfg::output_end_position>>,
     std::pair<cfg::output_alignment, seqan3::type_list<cfg::output_alignment>>,
     // other configs
-    std::pair<cfg::band_fixed_size, seqan3::type_list<cfg::band_fixed_size>>,
-    std::pair<cfg::detail::debug, seqan3::type_list<cfg::detail::debug>>,
+    std::pair<cfg::band_fixed_size, seqan3::type_list<cfg::band_fixed_size, cfg::linear_memory,
+                                                      cfg::method_extension>>,
+    std::pair<cfg::detail::debug, seqan3::type_list<cfg::detail::debug, cfg::linear_memory, cfg::method_extension>>,
     std::pair<cfg::gap_cost_affine, seqan3::type_list<cfg::gap_cost_affine>>,
-    std::pair<cfg::min_score, seqan3::type_list<cfg::min_score, cfg::method_local>>,
+    std::pair<cfg::linear_memory, seqan3::type_list<cfg::linear_memory, cfg::band_fixed_size, cfg::detail::debug,
+                                                    cfg::method_local, cfg::vectorised, cfg::method_extension>>,
+    std::pair<cfg::min_score, seqan3::type_list<cfg::min_score, cfg::method_local, cfg::method_extension>>,
     std::pair<cfg::on_result<callback_t>, seqan3::type_list<cfg::on_result<callback_t>>>,
     std::pair<cfg::parallel, seqan3::type_list<cfg::parallel>>,
     std::pair<cfg::detail::result_type<alignment_result_t>, seqan3::type_list<cfg::detail::result_type<alignment_result_t>>>,
     std::pair<cfg::score_type<int32_t>, seqan3::type_list<cfg::score_type<int32_t>>>,
     std::pair<cfg::scoring_scheme<nt_scheme>, seqan3::type_list<cfg::scoring_scheme<nt_scheme>>>,
-    std::pair<cfg::vectorised, seqan3::type_list<cfg::vectorised>>
+    std::pair<cfg::vectorised, seqan3::type_list<cfg::vectorised, cfg::linear_memory>>
     >;
 
 // The pure list of configuration elements to instantiate the typed test case with.
@@ -85,7 +93,7 @@ public:
     // NOTE: You must update this number if you add a new entity to seqan3::detail::align_config_id.
     // config_count is used to check that the config size is correct.
     // And don't forget to add the new config into the above test fixture (via align_config_and_taboo_types).
-    static constexpr int8_t config_count = 18;
+    static constexpr int8_t config_count = 20;
 };
 
 // Configuration element type list as gtest suitable testing::Types
@@ -0,0 +1,34 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
+#include <seqan3/core/configuration/configuration.hpp>
+
+TEST(align_config_linear_memory, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::align_cfg::linear_memory>));
+}
+
+TEST(align_config_linear_memory, configuration)
+{
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::linear_memory{}};
+        auto linear_memory = std::get<seqan3::align_cfg::linear_memory>(cfg);
+        EXPECT_TRUE((std::is_same_v<decltype(linear_memory.memory_limit), size_t>));
+
+        EXPECT_EQ(std::get<seqan3::align_cfg::linear_memory>(cfg).memory_limit, 0u);
+    }
+
+    {
+        seqan3::configuration cfg{seqan3::align_cfg::linear_memory{1024u}};
+        EXPECT_EQ(std::get<seqan3::align_cfg::linear_memory>(cfg).memory_limit, 1024u);
+    }
+}
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
 #include <type_traits>
 
 #include <seqan3/alignment/configuration/align_config_method.hpp>
@@ -32,3 +33,17 @@ TEST(method_global, access_member_variables)
     EXPECT_TRUE(opt.free_end_gaps_sequence1_trailing);
     EXPECT_TRUE(opt.free_end_gaps_sequence2_trailing);
 }
+
+TEST(method_extension, access_member_variables)
+{
+    seqan3::align_cfg::method_extension opt{}; // default construction
+
+    // defaults to no drop
+    EXPECT_EQ(opt.x_drop, std::numeric_limits<int32_t>::max());
+
+    opt.x_drop = 20;
+    EXPECT_EQ(opt.x_drop, 20);
+
+    seqan3::align_cfg::method_extension opt_drop{seqan3::align_cfg::x_drop{15}};
+    EXPECT_EQ(opt_drop.x_drop, 15);
+}
@@ -0,0 +1,190 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+
+// Pairs of random sequences with similar and with very different sizes.
+template <typename alphabet_t>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> generate_pairs()
+{
+    std::mt19937_64 engine{42u};
+    std::uniform_int_distribution<size_t> rank{0u, seqan3::alphabet_size<alphabet_t> - 1u};
+    std::uniform_int_distribution<size_t> size{1u, 600u};
+    auto random_sequence = [&] (size_t const sequence_size)
+    {
+        std::vector<alphabet_t> sequence(sequence_size);
+        for (auto & letter : sequence)
+            letter.assign_rank(rank(engine));
+        return sequence;
+    };
+
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> pairs{};
+
+    for (size_t sequence1_size : {1u, 2u, 7u, 100u})
+        for (size_t sequence2_size : {1u, 2u, 7u, 100u})
+            pairs.emplace_back(random_sequence(sequence1_size), random_sequence(sequence2_size));
+
+    // Mutated copies produce long gaps that cross the segment borders.
+    for (size_t i = 0; i < 20u; ++i)
+    {
+        std::vector<alphabet_t> sequence1 = random_sequence(size(engine));
+        std::vector<alphabet_t> sequence2 = sequence1;
+        sequence2.erase(sequence2.begin() + sequence2.size() / 3u, sequence2.begin() + sequence2.size() / 2u);
+        sequence2.insert(sequence2.begin() + sequence2.size() / 4u,
+                         sequence1.begin(),
+                         sequence1.begin() + std::min(i, sequence1.size()));
+        pairs.emplace_back(sequence2, sequence1);
+        pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    for (size_t i = 0; i < 40u; ++i)
+    {
+        std::vector<alphabet_t> sequence1 = random_sequence(size(engine));
+        std::vector<alphabet_t> sequence2 = random_sequence(size(engine));
+        pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    return pairs;
+}
+
+// Without vectorisation, scores with less than 32 bits are never computed striped.
+template <typename config_t>
+auto scalar_reference(config_t const & config)
+{
+    if constexpr (config_t::template exists<seqan3::align_cfg::score_type>())
+        return config;
+    else
+        return config | seqan3::align_cfg::score_type<int16_t>{};
+}
+
+// Every pair is aligned on its own, s.t. the vectorised alignment computes a single pair with all simd lanes. The
+// scalar alignment computes the long pairs striped as well, hence both are compared to the scalar algorithm.
+template <typename alphabet_t, typename config_t>
+void expect_same_as_scalar(config_t const & config)
+{
+    auto const output_cfg = seqan3::align_cfg::output_score{} | seqan3::align_cfg::output_end_position{};
+
+    for (auto & [sequence1, sequence2] : generate_pairs<alphabet_t>())
+    {
+        auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                scalar_reference(config | output_cfg)).begin();
+        auto scalar = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config | output_cfg).begin();
+        auto vectorised = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                  config | output_cfg | seqan3::align_cfg::vectorised{}).begin();
+
+        EXPECT_EQ(scalar.score(), expected.score());
+        EXPECT_EQ(scalar.sequence1_end_position(), expected.sequence1_end_position());
+        EXPECT_EQ(scalar.sequence2_end_position(), expected.sequence2_end_position());
+        EXPECT_EQ(vectorised.score(), expected.score());
+        EXPECT_EQ(vectorised.sequence1_end_position(), expected.sequence1_end_position());
+        EXPECT_EQ(vectorised.sequence2_end_position(), expected.sequence2_end_position());
+    }
+}
+
+auto const dna4_cfg = seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                          seqan3::match_score{4}, seqan3::mismatch_score{-5}}} |
+                      seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                         seqan3::align_cfg::extension_score{-1}};
+
+auto const semi_global_cfg = seqan3::align_cfg::method_global{
+                                 seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+auto const overlap_cfg = seqan3::align_cfg::method_global{
+                             seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                             seqan3::align_cfg::free_end_gaps_sequence2_leading{true},
+                             seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                             seqan3::align_cfg::free_end_gaps_sequence2_trailing{true}};
+
+auto const mixed_cfg = seqan3::align_cfg::method_global{
+                           seqan3::align_cfg::free_end_gaps_sequence1_leading{false},
+                           seqan3::align_cfg::free_end_gaps_sequence2_leading{true},
+                           seqan3::align_cfg::free_end_gaps_sequence1_trailing{false},
+                           seqan3::align_cfg::free_end_gaps_sequence2_trailing{true}};
+
+TEST(affine_striped_simd, global)
+{
+    expect_same_as_scalar<seqan3::dna4>(seqan3::align_cfg::method_global{} | dna4_cfg);
+}
+
+TEST(affine_striped_simd, semi_global)
+{
+    expect_same_as_scalar<seqan3::dna4>(semi_global_cfg | dna4_cfg);
+}
+
+TEST(affine_striped_simd, overlap)
+{
+    expect_same_as_scalar<seqan3::dna4>(overlap_cfg | dna4_cfg);
+}
+
+TEST(affine_striped_simd, mixed_free_end_gaps)
+{
+    expect_same_as_scalar<seqan3::dna4>(mixed_cfg | dna4_cfg);
+}
+
+TEST(affine_striped_simd, local)
+{
+    expect_same_as_scalar<seqan3::dna4>(seqan3::align_cfg::method_local{} | dna4_cfg);
+}
+
+TEST(affine_striped_simd, linear_gaps)
+{
+    expect_same_as_scalar<seqan3::dna4>(seqan3::align_cfg::method_global{} |
+                                        seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{}} |
+                                        seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{0},
+                                                                           seqan3::align_cfg::extension_score{-2}});
+}
+
+TEST(affine_striped_simd, score_type)
+{
+    expect_same_as_scalar<seqan3::dna4>(seqan3::align_cfg::method_global{} |
+                                        dna4_cfg |
+                                        seqan3::align_cfg::score_type<int16_t>{});
+    expect_same_as_scalar<seqan3::dna4>(seqan3::align_cfg::method_local{} |
+                                        dna4_cfg |
+                                        seqan3::align_cfg::score_type<int16_t>{});
+}
+
+TEST(affine_striped_simd, aa27)
+{
+    auto const aa27_cfg = seqan3::align_cfg::scoring_scheme{
+                              seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62}} |
+                          seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                             seqan3::align_cfg::extension_score{-1}};
+
+    expect_same_as_scalar<seqan3::aa27>(seqan3::align_cfg::method_global{} | aa27_cfg);
+    expect_same_as_scalar<seqan3::aa27>(seqan3::align_cfg::method_local{} | aa27_cfg);
+}
+
+TEST(affine_striped_simd, score_only)
+{
+    auto pairs = generate_pairs<seqan3::dna4>();
+    auto const config = seqan3::align_cfg::method_global{} | dna4_cfg | seqan3::align_cfg::output_score{};
+
+    for (auto & [sequence1, sequence2] : pairs)
+    {
+        // A collection with a single pair is computed with all simd lanes as well.
+        std::vector single_pair{std::tie(sequence1, sequence2)};
+        auto expected = (*seqan3::align_pairwise(single_pair, scalar_reference(config)).begin()).score();
+        EXPECT_EQ((*seqan3::align_pairwise(single_pair, config | seqan3::align_cfg::vectorised{}).begin()).score(),
+                  expected);
+        EXPECT_EQ((*seqan3::align_pairwise(single_pair, config).begin()).score(), expected);
+    }
+}
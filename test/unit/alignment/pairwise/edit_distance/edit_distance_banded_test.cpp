@@ -0,0 +1,328 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_dna4;
+
+// The best score within the band and the right-most column of the last row with this score.
+template <typename sequence_t>
+std::pair<int, size_t> banded_edit_distance(sequence_t const & database,
+                                            sequence_t const & query,
+                                            int64_t const lower,
+                                            int64_t const upper,
+                                            bool const semi_global)
+{
+    int64_t const columns = database.size();
+    int64_t const rows = query.size();
+    int const inf = std::numeric_limits<int>::max() / 2;
+    std::vector<std::vector<int>> matrix(rows + 1, std::vector<int>(columns + 1, inf));
+
+    for (int64_t j = 0; j <= columns; ++j)
+    {
+        for (int64_t i = 0; i <= rows; ++i)
+        {
+            if (j - i < lower || j - i > upper)
+                continue;
+
+            if (i == 0)
+                matrix[i][j] = semi_global ? 0 : j;
+            else if (j == 0)
+                matrix[i][j] = i;
+            else
+                matrix[i][j] = std::min({matrix[i - 1][j - 1] + (database[j - 1] != query[i - 1]),
+                                         matrix[i - 1][j] + 1,
+                                         matrix[i][j - 1] + 1});
+        }
+    }
+
+    if (!semi_global)
+        return {matrix[rows][columns], columns};
+
+    std::pair<int, size_t> best{inf, 0u};
+    for (int64_t j = 0; j <= columns; ++j)
+        if (matrix[rows][j] <= best.first)
+            best = {matrix[rows][j], j};
+
+    return best;
+}
+
+// Returns the first result of seqan3::align_pairwise.
+template <typename sequences_t, typename config_t>
+auto first_result(sequences_t && sequences, config_t const & config)
+{
+    auto results = seqan3::align_pairwise(std::forward<sequences_t>(sequences), config);
+    return *std::ranges::begin(results);
+}
+
+// Checks that the alignment has the given score and lies within the band.
+template <typename alignment_t>
+void expect_valid_alignment(alignment_t const & alignment,
+                            std::pair<size_t, size_t> const begin,
+                            int const score,
+                            int64_t const lower,
+                            int64_t const upper)
+{
+    auto const & [gapped_database, gapped_query] = alignment;
+    ASSERT_EQ(gapped_database.size(), gapped_query.size());
+
+    int errors{};
+    int64_t column = begin.first;
+    int64_t row = begin.second;
+    for (size_t i = 0; i < gapped_database.size(); ++i)
+    {
+        errors += gapped_database[i] != gapped_query[i];
+        column += gapped_database[i] != seqan3::gap{};
+        row += gapped_query[i] != seqan3::gap{};
+        EXPECT_LE(lower, column - row);
+        EXPECT_GE(upper, column - row);
+    }
+
+    EXPECT_EQ(errors, score);
+}
+
+TEST(edit_distance_banded, same_as_unbanded)
+{
+    seqan3::dna4_vector database = "AACCGGTTAACCGGTT"_dna4;
+    seqan3::dna4_vector query = "ACGTACGTA"_dna4;
+
+    for (bool semi_global : {false, true})
+    {
+        auto const method = seqan3::align_cfg::method_global{
+                                seqan3::align_cfg::free_end_gaps_sequence1_leading{semi_global},
+                                seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                seqan3::align_cfg::free_end_gaps_sequence1_trailing{semi_global},
+                                seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+        auto const unbanded_cfg = method | seqan3::align_cfg::edit_scheme;
+        auto const banded_cfg = unbanded_cfg |
+                                seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-9},
+                                                                   seqan3::align_cfg::upper_diagonal{16}};
+
+        auto unbanded = first_result(std::tie(database, query), unbanded_cfg);
+        auto banded = first_result(std::tie(database, query), banded_cfg);
+
+        EXPECT_EQ(banded.score(), unbanded.score());
+        EXPECT_EQ(banded.sequence1_end_position(), unbanded.sequence1_end_position());
+        EXPECT_EQ(banded.sequence2_end_position(), unbanded.sequence2_end_position());
+        EXPECT_EQ(banded.sequence1_begin_position(), unbanded.sequence1_begin_position());
+        EXPECT_EQ(banded.sequence2_begin_position(), unbanded.sequence2_begin_position());
+        EXPECT_RANGE_EQ(std::get<0>(banded.alignment()) | seqan3::views::to_char,
+                        std::get<0>(unbanded.alignment()) | seqan3::views::to_char);
+        EXPECT_RANGE_EQ(std::get<1>(banded.alignment()) | seqan3::views::to_char,
+                        std::get<1>(unbanded.alignment()) | seqan3::views::to_char);
+    }
+}
+
+TEST(edit_distance_banded, narrow_band)
+{
+    seqan3::dna4_vector database = "ACGTACGTACGTACGT"_dna4;
+    seqan3::dna4_vector query = "ACGTTTTACGTACGTACGT"_dna4;
+
+    // The best alignment deletes "TTT" of the query, which needs the lower diagonal -3.
+    auto const cfg = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+    auto wide = first_result(std::tie(database, query),
+                             cfg | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-3},
+                                                                      seqan3::align_cfg::upper_diagonal{0}});
+    EXPECT_EQ(wide.score(), -3);
+    EXPECT_RANGE_EQ(std::get<0>(wide.alignment()) | seqan3::views::to_char,
+                    std::string{"ACGT---ACGTACGTACGT"});
+    EXPECT_RANGE_EQ(std::get<1>(wide.alignment()) | seqan3::views::to_char,
+                    std::string{"ACGTTTTACGTACGTACGT"});
+
+    // The band must contain the origin.
+    EXPECT_THROW(first_result(std::tie(database, query),
+                              cfg | seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-3},
+                                                                       seqan3::align_cfg::upper_diagonal{-3}}),
+                 seqan3::invalid_alignment_configuration);
+}
+
+TEST(edit_distance_banded, random_sequences)
+{
+    std::mt19937_64 engine{42u};
+    std::uniform_int_distribution<size_t> rank{0u, 3u};
+    auto random_sequence = [&] (size_t const size)
+    {
+        seqan3::dna4_vector sequence(size);
+        for (auto & letter : sequence)
+            letter.assign_rank(rank(engine));
+        return sequence;
+    };
+
+    // Queries up to three machine words and bands that are wider than one machine word.
+    for (size_t query_size : {1u, 7u, 63u, 64u, 65u, 130u, 200u})
+    {
+        for (int64_t database_offset : {-20, -1, 0, 1, 30})
+        {
+            if (static_cast<int64_t>(query_size) + database_offset < 0)
+                continue;
+
+            seqan3::dna4_vector query = random_sequence(query_size);
+            seqan3::dna4_vector database = random_sequence(query_size + database_offset);
+            int64_t const columns = database.size();
+            int64_t const rows = query.size();
+
+            for (auto [lower, upper] : {std::pair<int64_t, int64_t>{-5, 5}, {-70, 3}, {0, 0}, {-1, 100}, {3, 40},
+                                        {-130, 130}, {-rows, columns}})
+            {
+                for (bool semi_global : {false, true})
+                {
+                    bool const valid = upper >= 0 && lower <= columns - rows && upper >= lower &&
+                                       (semi_global || (lower <= 0 && upper >= columns - rows));
+                    if (!valid)
+                        continue;
+
+                    auto const cfg = seqan3::align_cfg::method_global{
+                                         seqan3::align_cfg::free_end_gaps_sequence1_leading{semi_global},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                         seqan3::align_cfg::free_end_gaps_sequence1_trailing{semi_global},
+                                         seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+                                     seqan3::align_cfg::edit_scheme |
+                                     seqan3::align_cfg::band_fixed_size{
+                                         seqan3::align_cfg::lower_diagonal{static_cast<int32_t>(lower)},
+                                         seqan3::align_cfg::upper_diagonal{static_cast<int32_t>(upper)}};
+
+                    SCOPED_TRACE(testing::Message() << "query " << rows << " database " << columns << " band ["
+                                                    << lower << ":" << upper << "] semi " << semi_global);
+
+                    auto [expected_score, expected_end] = banded_edit_distance(database, query, lower, upper,
+                                                                               semi_global);
+
+                    auto score_only = first_result(std::tie(database, query), cfg | seqan3::align_cfg::output_score{});
+                    EXPECT_EQ(score_only.score(), -expected_score);
+
+                    auto result = first_result(std::tie(database, query), cfg);
+                    EXPECT_EQ(result.score(), -expected_score);
+                    EXPECT_EQ(result.sequence1_end_position(), expected_end);
+                    EXPECT_EQ(result.sequence2_end_position(), query.size());
+                    expect_valid_alignment(result.alignment(),
+                                           {result.sequence1_begin_position(), result.sequence2_begin_position()},
+                                           expected_score, lower, upper);
+
+                    if (!semi_global)
+                    {
+                        EXPECT_EQ(result.sequence1_begin_position(), 0u);
+                        EXPECT_EQ(result.sequence2_begin_position(), 0u);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(edit_distance_banded, empty_sequences)
+{
+    seqan3::dna4_vector empty{};
+    seqan3::dna4_vector sequence = "ACGT"_dna4;
+    auto const band = seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-4},
+                                                         seqan3::align_cfg::upper_diagonal{4}};
+    auto const global = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | band;
+    auto const semi_global = seqan3::align_cfg::method_global{
+                                 seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+                             seqan3::align_cfg::edit_scheme | band;
+
+    auto empty_query = first_result(std::tie(sequence, empty), global);
+    EXPECT_EQ(empty_query.score(), -4);
+    EXPECT_EQ(empty_query.sequence1_end_position(), 4u);
+    EXPECT_RANGE_EQ(std::get<1>(empty_query.alignment()) | seqan3::views::to_char, std::string{"----"});
+
+    auto empty_database = first_result(std::tie(empty, sequence), global);
+    EXPECT_EQ(empty_database.score(), -4);
+    EXPECT_RANGE_EQ(std::get<0>(empty_database.alignment()) | seqan3::views::to_char, std::string{"----"});
+
+    auto semi_empty_query = first_result(std::tie(sequence, empty), semi_global);
+    EXPECT_EQ(semi_empty_query.score(), 0);
+    EXPECT_EQ(semi_empty_query.sequence1_end_position(), 4u);
+}
+
+TEST(edit_distance_banded, min_score)
+{
+    seqan3::dna4_vector database = "AACCGGTTAACCGGTT"_dna4;
+    seqan3::dna4_vector query = "AACCGTTAACCGGTTA"_dna4;
+    auto const cfg = seqan3::align_cfg::method_global{} |
+                     seqan3::align_cfg::edit_scheme |
+                     seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{-2},
+                                                        seqan3::align_cfg::upper_diagonal{2}} |
+                     seqan3::align_cfg::output_score{} |
+                     seqan3::align_cfg::output_end_position{};
+
+    auto result = first_result(std::tie(database, query), cfg | seqan3::align_cfg::min_score{-2});
+    EXPECT_EQ(result.score(), -2);
+    EXPECT_EQ(result.sequence1_end_position(), 16u);
+
+    auto invalid = first_result(std::tie(database, query), cfg | seqan3::align_cfg::min_score{-1});
+    EXPECT_EQ(invalid.score(), std::numeric_limits<int32_t>::max());
+}
+
+TEST(edit_distance_banded, invalid_band)
+{
+    seqan3::dna4_vector database = "ACGTACGT"_dna4;
+    seqan3::dna4_vector query = "ACGTAC"_dna4;
+    auto const global = seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme;
+    auto const semi_global = seqan3::align_cfg::method_global{
+                                 seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}} |
+                             seqan3::align_cfg::edit_scheme;
+    auto band = [] (int32_t const lower, int32_t const upper)
+    {
+        return seqan3::align_cfg::band_fixed_size{seqan3::align_cfg::lower_diagonal{lower},
+                                                  seqan3::align_cfg::upper_diagonal{upper}};
+    };
+    auto run = [&] (auto const & cfg)
+    {
+        return first_result(std::tie(database, query), cfg);
+    };
+
+    // The upper diagonal is smaller than the lower diagonal.
+    EXPECT_THROW(run(global | band(1, -1)), seqan3::invalid_alignment_configuration);
+    // The band does not start in the first row.
+    EXPECT_THROW(run(global | band(1, 4)), seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(run(semi_global | band(-4, -1)), seqan3::invalid_alignment_configuration);
+    EXPECT_EQ(run(semi_global | band(1, 4)).score(), -banded_edit_distance(database, query, 1, 4, true).first);
+    // The band does not reach the last cell or the last row.
+    EXPECT_THROW(run(global | band(-1, 1)), seqan3::invalid_alignment_configuration);
+    EXPECT_EQ(run(semi_global | band(-1, 1)).score(), 0);
+    EXPECT_THROW(run(semi_global | band(3, 4)), seqan3::invalid_alignment_configuration);
+
+    // The message only names the violated conditions.
+    auto message = [&] (auto const & cfg) -> std::string
+    {
+        try
+        {
+            run(cfg);
+        }
+        catch (seqan3::invalid_alignment_configuration const & exception)
+        {
+            return exception.what();
+        }
+        return "";
+    };
+
+    std::string const smaller_upper_diagonal = message(semi_global | band(4, 3));
+    EXPECT_NE(smaller_upper_diagonal.find("smaller than the lower diagonal"), std::string::npos);
+    EXPECT_EQ(smaller_upper_diagonal.find("without free gaps"), std::string::npos);
+
+    std::string const no_free_gaps = message(global | band(1, 4));
+    EXPECT_EQ(no_free_gaps.find("smaller than the lower diagonal"), std::string::npos);
+    EXPECT_NE(no_free_gaps.find("without free gaps"), std::string::npos);
+}
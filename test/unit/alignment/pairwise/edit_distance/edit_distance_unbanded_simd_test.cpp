@@ -0,0 +1,152 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+
+using seqan3::operator""_dna4;
+
+// Pairs of random sequences with many different sizes, including empty sequences and queries of several words.
+template <typename alphabet_t = seqan3::dna4>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> generate_pairs()
+{
+    std::mt19937_64 engine{42u};
+    std::uniform_int_distribution<size_t> rank{0u, seqan3::alphabet_size<alphabet_t> - 1u};
+    std::uniform_int_distribution<size_t> size{0u, 200u};
+    auto random_sequence = [&] (size_t const sequence_size)
+    {
+        std::vector<alphabet_t> sequence(sequence_size);
+        for (auto & letter : sequence)
+            letter.assign_rank(rank(engine));
+        return sequence;
+    };
+
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> pairs{};
+
+    for (size_t query_size : {0u, 1u, 63u, 64u, 65u, 128u, 129u})
+        for (size_t database_size : {0u, 1u, 64u, 100u})
+            pairs.emplace_back(random_sequence(database_size), random_sequence(query_size));
+
+    for (size_t i = 0; i < 100u; ++i)
+    {
+        std::vector<alphabet_t> query = random_sequence(size(engine) % 90u);
+        std::vector<alphabet_t> database = random_sequence(size(engine));
+        pairs.emplace_back(std::move(database), std::move(query));
+    }
+
+    return pairs;
+}
+
+template <typename alphabet_t = seqan3::dna4, typename config_t>
+void expect_same_as_scalar(config_t const & config)
+{
+    auto pairs = generate_pairs<alphabet_t>();
+
+    std::vector<std::tuple<size_t, int32_t, size_t, size_t>> expected{};
+    for (auto && result : seqan3::align_pairwise(pairs, config))
+        expected.emplace_back(result.sequence1_id(), result.score(), result.sequence1_end_position(),
+                              result.sequence2_end_position());
+
+    std::vector<std::tuple<size_t, int32_t, size_t, size_t>> actual{};
+    for (auto && result : seqan3::align_pairwise(pairs, config | seqan3::align_cfg::vectorised{}))
+        actual.emplace_back(result.sequence1_id(), result.score(), result.sequence1_end_position(),
+                            result.sequence2_end_position());
+
+    EXPECT_EQ(actual, expected);
+}
+
+auto const output_cfg = seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_end_position{} |
+                        seqan3::align_cfg::output_sequence1_id{};
+
+auto const semi_global_cfg = seqan3::align_cfg::method_global{
+                                 seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+TEST(edit_distance_unbanded_simd, global)
+{
+    expect_same_as_scalar(seqan3::align_cfg::method_global{} | seqan3::align_cfg::edit_scheme | output_cfg);
+}
+
+TEST(edit_distance_unbanded_simd, semi_global)
+{
+    expect_same_as_scalar(semi_global_cfg | seqan3::align_cfg::edit_scheme | output_cfg);
+}
+
+// The bit masks of larger alphabets are gathered instead of selected.
+TEST(edit_distance_unbanded_simd, global_dna15)
+{
+    expect_same_as_scalar<seqan3::dna15>(seqan3::align_cfg::method_global{} |
+                                         seqan3::align_cfg::edit_scheme |
+                                         output_cfg);
+}
+
+TEST(edit_distance_unbanded_simd, semi_global_dna15)
+{
+    expect_same_as_scalar<seqan3::dna15>(semi_global_cfg | seqan3::align_cfg::edit_scheme | output_cfg);
+}
+
+TEST(edit_distance_unbanded_simd, global_min_score)
+{
+    expect_same_as_scalar(seqan3::align_cfg::method_global{} |
+                          seqan3::align_cfg::edit_scheme |
+                          seqan3::align_cfg::min_score{-20} |
+                          output_cfg);
+}
+
+TEST(edit_distance_unbanded_simd, semi_global_min_score)
+{
+    expect_same_as_scalar(semi_global_cfg | seqan3::align_cfg::edit_scheme | seqan3::align_cfg::min_score{-5} |
+                          output_cfg);
+}
+
+TEST(edit_distance_unbanded_simd, score_only)
+{
+    auto pairs = generate_pairs();
+    auto const config = seqan3::align_cfg::method_global{} |
+                        seqan3::align_cfg::edit_scheme |
+                        seqan3::align_cfg::output_score{};
+
+    std::vector<int32_t> expected{};
+    for (auto && result : seqan3::align_pairwise(pairs, config))
+        expected.push_back(result.score());
+
+    std::vector<int32_t> actual{};
+    for (auto && result : seqan3::align_pairwise(pairs, config | seqan3::align_cfg::vectorised{}))
+        actual.push_back(result.score());
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(edit_distance_unbanded_simd, alignment)
+{
+    // The alignment is computed by the scalar edit distance.
+    seqan3::dna4_vector database = "AACCGGTTAACCGGTT"_dna4;
+    seqan3::dna4_vector query = "ACGTACGTA"_dna4;
+    std::vector pairs{std::tie(database, query), std::tie(query, database)};
+
+    auto results = seqan3::align_pairwise(pairs, seqan3::align_cfg::method_global{} |
+                                                 seqan3::align_cfg::edit_scheme |
+                                                 seqan3::align_cfg::vectorised{});
+    auto it = results.begin();
+    EXPECT_EQ((*it).score(), -8);
+    EXPECT_RANGE_EQ(std::get<0>((*it).alignment()) | seqan3::views::to_char, std::string{"AACCGGTTAACCGGTT"});
+    EXPECT_RANGE_EQ(std::get<1>((*it).alignment()) | seqan3::views::to_char, std::string{"A-C-G-T-A-C-G-TA"});
+    ++it;
+    EXPECT_EQ((*it).score(), -8);
+}
@@ -0,0 +1,297 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_score_type.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/views/slice.hpp>
+
+using seqan3::operator""_dna4;
+
+// Pairs of random sequences with similar and with very different sizes, including empty sequences.
+template <typename alphabet_t>
+std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> generate_pairs()
+{
+    std::mt19937_64 engine{42u};
+    std::uniform_int_distribution<size_t> rank{0u, seqan3::alphabet_size<alphabet_t> - 1u};
+    std::uniform_int_distribution<size_t> size{0u, 300u};
+    auto random_sequence = [&] (size_t const sequence_size)
+    {
+        std::vector<alphabet_t> sequence(sequence_size);
+        for (auto & letter : sequence)
+            letter.assign_rank(rank(engine));
+        return sequence;
+    };
+
+    std::vector<std::pair<std::vector<alphabet_t>, std::vector<alphabet_t>>> pairs{};
+
+    for (size_t sequence1_size : {0u, 1u, 2u, 7u, 100u})
+        for (size_t sequence2_size : {0u, 1u, 2u, 7u, 100u})
+            pairs.emplace_back(random_sequence(sequence1_size), random_sequence(sequence2_size));
+
+    // Mutated copies are extended far and with gaps.
+    for (size_t i = 0; i < 20u; ++i)
+    {
+        std::vector<alphabet_t> sequence1 = random_sequence(size(engine));
+        std::vector<alphabet_t> sequence2 = sequence1;
+        sequence2.erase(sequence2.begin() + sequence2.size() / 3u, sequence2.begin() + sequence2.size() / 2u);
+        sequence2.insert(sequence2.begin() + sequence2.size() / 4u,
+                         sequence1.begin(),
+                         sequence1.begin() + std::min(i, sequence1.size()));
+        pairs.emplace_back(sequence2, sequence1);
+        pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    for (size_t i = 0; i < 20u; ++i)
+    {
+        std::vector<alphabet_t> sequence1 = random_sequence(size(engine));
+        std::vector<alphabet_t> sequence2 = random_sequence(size(engine));
+        pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    return pairs;
+}
+
+// Computes the full alignment matrix that begins in the first cell and returns the score and the position of the
+// first best cell in the order of the anti-diagonals.
+template <typename sequence_t, typename scoring_scheme_t>
+std::tuple<int32_t, size_t, size_t> full_extension(sequence_t const & sequence1,
+                                                   sequence_t const & sequence2,
+                                                   scoring_scheme_t const & scoring_scheme)
+{
+    int32_t const minus_infinity = std::numeric_limits<int32_t>::lowest() / 2;
+    size_t const columns = sequence1.size() + 1u;
+    size_t const rows = sequence2.size() + 1u;
+    std::vector<int32_t> optimal(columns * rows, minus_infinity);
+    std::vector<int32_t> horizontal(columns * rows, minus_infinity);
+    std::vector<int32_t> vertical(columns * rows, minus_infinity);
+    auto cell = [&] (size_t const column, size_t const row) { return column * rows + row; };
+
+    optimal[0] = 0;
+    for (size_t column = 0; column < columns; ++column)
+    {
+        for (size_t row = 0; row < rows; ++row)
+        {
+            if (column == 0u && row == 0u)
+                continue;
+
+            if (column > 0u)
+                horizontal[cell(column, row)] = std::max(horizontal[cell(column - 1u, row)] - 1,
+                                                         optimal[cell(column - 1u, row)] - 11);
+            if (row > 0u)
+                vertical[cell(column, row)] = std::max(vertical[cell(column, row - 1u)] - 1,
+                                                       optimal[cell(column, row - 1u)] - 11);
+
+            int32_t best = std::max(horizontal[cell(column, row)], vertical[cell(column, row)]);
+            if (column > 0u && row > 0u)
+                best = std::max<int32_t>(best, optimal[cell(column - 1u, row - 1u)] +
+                                               scoring_scheme.score(sequence1[column - 1u], sequence2[row - 1u]));
+            optimal[cell(column, row)] = best;
+        }
+    }
+
+    std::tuple<int32_t, size_t, size_t> result{0, 0u, 0u};
+    for (size_t diagonal = 1; diagonal < columns + rows - 1u; ++diagonal)
+    {
+        for (size_t column = (diagonal < rows) ? 0u : diagonal - rows + 1u; column < columns && column <= diagonal;
+             ++column)
+        {
+            if (optimal[cell(column, diagonal - column)] > std::get<0>(result))
+                result = {optimal[cell(column, diagonal - column)], column, diagonal - column};
+        }
+    }
+
+    return result;
+}
+
+// Recomputes the score of the alignment with the gap costs used in the tests.
+template <typename alignment_t, typename scoring_scheme_t>
+int32_t alignment_score(alignment_t const & alignment, scoring_scheme_t const & scoring_scheme)
+{
+    auto const & [gapped1, gapped2] = alignment;
+    EXPECT_EQ(std::ranges::size(gapped1), std::ranges::size(gapped2));
+
+    int32_t score = 0;
+    int gap_state = 0; // 0: no gap, 1: gap in the first sequence, 2: gap in the second sequence.
+    for (size_t i = 0; i < std::ranges::size(gapped1); ++i)
+    {
+        bool const is_gap1 = gapped1[i] == seqan3::gap{};
+        bool const is_gap2 = gapped2[i] == seqan3::gap{};
+        EXPECT_FALSE(is_gap1 && is_gap2);
+
+        int const state = is_gap1 ? 1 : (is_gap2 ? 2 : 0);
+        if (state == 0)
+            score += scoring_scheme.score(gapped1[i].template convert_to<0>(), gapped2[i].template convert_to<0>());
+        else
+            score += (state == gap_state) ? -1 : -11;
+
+        gap_state = state;
+    }
+
+    return score;
+}
+
+auto const dna_scheme = seqan3::nucleotide_scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+
+auto const gap_cfg = seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                        seqan3::align_cfg::extension_score{-1}};
+
+auto const output_cfg = seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_end_position{} |
+                        seqan3::align_cfg::output_begin_position{} |
+                        seqan3::align_cfg::output_alignment{} |
+                        seqan3::align_cfg::output_sequence1_id{};
+
+// Without a drop the best cell of the full alignment matrix is found.
+template <typename alphabet_t, typename scoring_scheme_t, typename vectorised_cfg_t>
+void expect_same_as_full_matrix(scoring_scheme_t const & scheme, vectorised_cfg_t const & vectorised_cfg)
+{
+    auto pairs = generate_pairs<alphabet_t>();
+    auto const config = seqan3::align_cfg::method_extension{} |
+                        seqan3::align_cfg::scoring_scheme{scheme} |
+                        gap_cfg |
+                        output_cfg |
+                        vectorised_cfg;
+
+    auto is_letter = [] (auto const & letter) { return letter != seqan3::gap{}; };
+
+    for (auto && result : seqan3::align_pairwise(pairs, config))
+    {
+        auto const & [sequence1, sequence2] = pairs[result.sequence1_id()];
+        auto const [score, end1, end2] = full_extension(sequence1, sequence2, scheme);
+
+        EXPECT_EQ(result.score(), score);
+        EXPECT_EQ(result.sequence1_begin_position(), 0u);
+        EXPECT_EQ(result.sequence2_begin_position(), 0u);
+        EXPECT_EQ(result.sequence1_end_position(), end1);
+        EXPECT_EQ(result.sequence2_end_position(), end2);
+
+        auto const & [gapped1, gapped2] = result.alignment();
+        EXPECT_EQ(alignment_score(result.alignment(), scheme), result.score());
+        EXPECT_RANGE_EQ(gapped1 | std::views::filter(is_letter) | seqan3::views::to_char,
+                        sequence1 | seqan3::views::slice(0u, end1) | seqan3::views::to_char);
+        EXPECT_RANGE_EQ(gapped2 | std::views::filter(is_letter) | seqan3::views::to_char,
+                        sequence2 | seqan3::views::slice(0u, end2) | seqan3::views::to_char);
+    }
+}
+
+// The vectorised algorithm computes the same cells as the scalar algorithm.
+template <typename alphabet_t, typename scoring_scheme_t, typename score_type_cfg_t>
+void expect_same_as_scalar(scoring_scheme_t const & scheme, score_type_cfg_t const & score_type_cfg)
+{
+    auto pairs = generate_pairs<alphabet_t>();
+
+    for (int32_t x_drop : {0, 5, 20, 100})
+    {
+        auto const config = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{x_drop}} |
+                            seqan3::align_cfg::scoring_scheme{scheme} |
+                            gap_cfg |
+                            output_cfg |
+                            score_type_cfg;
+
+        auto scalar_results = seqan3::align_pairwise(pairs, config);
+        auto simd_results = seqan3::align_pairwise(pairs, config | seqan3::align_cfg::vectorised{});
+
+        auto simd_it = simd_results.begin();
+        for (auto && expected : scalar_results)
+        {
+            auto && actual = *simd_it;
+            EXPECT_EQ(actual.sequence1_id(), expected.sequence1_id());
+            EXPECT_EQ(actual.score(), expected.score());
+            EXPECT_EQ(actual.sequence1_end_position(), expected.sequence1_end_position());
+            EXPECT_EQ(actual.sequence2_end_position(), expected.sequence2_end_position());
+            EXPECT_RANGE_EQ(std::get<0>(actual.alignment()) | seqan3::views::to_char,
+                            std::get<0>(expected.alignment()) | seqan3::views::to_char);
+            EXPECT_RANGE_EQ(std::get<1>(actual.alignment()) | seqan3::views::to_char,
+                            std::get<1>(expected.alignment()) | seqan3::views::to_char);
+            EXPECT_EQ(alignment_score(expected.alignment(), scheme), expected.score());
+            ++simd_it;
+        }
+    }
+}
+
+TEST(extension_affine_xdrop, no_drop)
+{
+    expect_same_as_full_matrix<seqan3::dna4>(dna_scheme, seqan3::align_cfg::score_type<int32_t>{});
+}
+
+TEST(extension_affine_xdrop, no_drop_vectorised)
+{
+    expect_same_as_full_matrix<seqan3::dna4>(dna_scheme, seqan3::align_cfg::vectorised{});
+}
+
+TEST(extension_affine_xdrop, drop)
+{
+    // 50 matches, 4 mismatches and 50 matches.
+    seqan3::dna4_vector sequence1(104u, 'A'_dna4);
+    seqan3::dna4_vector sequence2(104u, 'A'_dna4);
+    std::fill(sequence1.begin() + 50, sequence1.begin() + 54, 'C'_dna4);
+    std::fill(sequence2.begin() + 50, sequence2.begin() + 54, 'G'_dna4);
+
+    auto const config = seqan3::align_cfg::scoring_scheme{dna_scheme} | gap_cfg | output_cfg;
+
+    for (auto && vectorised : {false, true})
+    {
+        // The score drops by 20 in the mismatches.
+        auto small_drop = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{10}} | config;
+        auto result = vectorised
+                    ? *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                              small_drop | seqan3::align_cfg::vectorised{}).begin()
+                    : *seqan3::align_pairwise(std::tie(sequence1, sequence2), small_drop).begin();
+        EXPECT_EQ(result.score(), 200);
+        EXPECT_EQ(result.sequence1_end_position(), 50u);
+        EXPECT_EQ(result.sequence2_end_position(), 50u);
+
+        auto large_drop = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{20}} | config;
+        result = vectorised
+               ? *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                         large_drop | seqan3::align_cfg::vectorised{}).begin()
+               : *seqan3::align_pairwise(std::tie(sequence1, sequence2), large_drop).begin();
+        EXPECT_EQ(result.score(), 380);
+        EXPECT_EQ(result.sequence1_end_position(), 104u);
+        EXPECT_EQ(result.sequence2_end_position(), 104u);
+    }
+}
+
+TEST(extension_affine_xdrop, vectorised)
+{
+    expect_same_as_scalar<seqan3::dna4>(dna_scheme, seqan3::align_cfg::score_type<int32_t>{});
+}
+
+TEST(extension_affine_xdrop, vectorised_score_type_int16)
+{
+    expect_same_as_scalar<seqan3::dna4>(dna_scheme, seqan3::align_cfg::score_type<int16_t>{});
+}
+
+TEST(extension_affine_xdrop, vectorised_aa27)
+{
+    expect_same_as_scalar<seqan3::aa27>(seqan3::aminoacid_scoring_scheme{seqan3::aminoacid_similarity_matrix::blosum62},
+                                        seqan3::align_cfg::score_type<int32_t>{});
+}
+
+TEST(extension_affine_xdrop, negative_x_drop)
+{
+    seqan3::dna4_vector sequence{"ACGT"_dna4};
+    auto const config = seqan3::align_cfg::method_extension{seqan3::align_cfg::x_drop{-1}} |
+                        seqan3::align_cfg::scoring_scheme{dna_scheme};
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence, sequence), config),
+                 seqan3::invalid_alignment_configuration);
+}
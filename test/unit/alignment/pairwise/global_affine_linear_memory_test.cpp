@@ -0,0 +1,231 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/std/algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/views/to_char.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/views/slice.hpp>
+
+using seqan3::operator""_dna4;
+
+// Pairs of random sequences with similar and with very different sizes, including empty sequences.
+std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> generate_pairs()
+{
+    std::mt19937_64 engine{42u};
+    std::uniform_int_distribution<size_t> rank{0u, 3u};
+    std::uniform_int_distribution<size_t> size{0u, 400u};
+    auto random_sequence = [&] (size_t const sequence_size)
+    {
+        seqan3::dna4_vector sequence(sequence_size);
+        for (auto & letter : sequence)
+            letter.assign_rank(rank(engine));
+        return sequence;
+    };
+
+    std::vector<std::pair<seqan3::dna4_vector, seqan3::dna4_vector>> pairs{};
+
+    for (size_t sequence1_size : {0u, 1u, 2u, 300u})
+        for (size_t sequence2_size : {0u, 1u, 2u, 300u})
+            pairs.emplace_back(random_sequence(sequence1_size), random_sequence(sequence2_size));
+
+    // Mutated copies produce long gaps that cross the middle columns.
+    for (size_t i = 0; i < 20u; ++i)
+    {
+        seqan3::dna4_vector sequence1 = random_sequence(size(engine));
+        seqan3::dna4_vector sequence2 = sequence1;
+        sequence2.erase(sequence2.begin() + sequence2.size() / 3u, sequence2.begin() + sequence2.size() / 2u);
+        sequence2.insert(sequence2.begin() + sequence2.size() / 4u, 10u, 'A'_dna4);
+        pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    for (size_t i = 0; i < 40u; ++i)
+    {
+        seqan3::dna4_vector sequence1 = random_sequence(size(engine));
+        seqan3::dna4_vector sequence2 = random_sequence(size(engine));
+        pairs.emplace_back(std::move(sequence1), std::move(sequence2));
+    }
+
+    return pairs;
+}
+
+// Recomputes the score of the alignment with the scores used in the tests.
+template <typename alignment_t>
+int32_t alignment_score(alignment_t const & alignment)
+{
+    auto const & [gapped1, gapped2] = alignment;
+    EXPECT_EQ(std::ranges::size(gapped1), std::ranges::size(gapped2));
+
+    int32_t score = 0;
+    int gap_state = 0; // 0: no gap, 1: gap in the first sequence, 2: gap in the second sequence.
+    for (size_t i = 0; i < std::ranges::size(gapped1); ++i)
+    {
+        bool const is_gap1 = gapped1[i] == seqan3::gap{};
+        bool const is_gap2 = gapped2[i] == seqan3::gap{};
+        EXPECT_FALSE(is_gap1 && is_gap2);
+
+        int const state = is_gap1 ? 1 : (is_gap2 ? 2 : 0);
+        if (state == 0)
+            score += (gapped1[i] == gapped2[i]) ? 4 : -5;
+        else
+            score += (state == gap_state) ? -1 : -11;
+
+        gap_state = state;
+    }
+
+    return score;
+}
+
+auto const scoring_cfg = seqan3::align_cfg::scoring_scheme{seqan3::nucleotide_scoring_scheme{
+                             seqan3::match_score{4}, seqan3::mismatch_score{-5}}} |
+                         seqan3::align_cfg::gap_cost_affine{seqan3::align_cfg::open_score{-10},
+                                                            seqan3::align_cfg::extension_score{-1}};
+
+auto const output_cfg = seqan3::align_cfg::output_score{} |
+                        seqan3::align_cfg::output_end_position{} |
+                        seqan3::align_cfg::output_begin_position{} |
+                        seqan3::align_cfg::output_alignment{} |
+                        seqan3::align_cfg::output_sequence1_id{};
+
+template <typename method_t, typename linear_memory_cfg_t>
+void expect_same_as_full_matrix(method_t const & method, linear_memory_cfg_t const & linear_memory_cfg)
+{
+    auto pairs = generate_pairs();
+    auto is_letter = [] (auto const & letter) { return letter != seqan3::gap{}; };
+
+    std::vector<std::tuple<size_t, int32_t, size_t, size_t>> expected{};
+    for (auto && result : seqan3::align_pairwise(pairs, method | scoring_cfg | output_cfg))
+        expected.emplace_back(result.sequence1_id(), result.score(),
+                              result.sequence1_end_position(), result.sequence2_end_position());
+
+    std::vector<std::tuple<size_t, int32_t, size_t, size_t>> actual{};
+    for (auto && result : seqan3::align_pairwise(pairs, method | scoring_cfg | output_cfg | linear_memory_cfg))
+    {
+        actual.emplace_back(result.sequence1_id(), result.score(),
+                            result.sequence1_end_position(), result.sequence2_end_position());
+
+        // Co-optimal alignments and begin positions may differ, but the alignment must have the optimal score and
+        // cover the letters between the begin and the end positions.
+        auto const & [sequence1, sequence2] = pairs[result.sequence1_id()];
+        auto const & [gapped1, gapped2] = result.alignment();
+        EXPECT_EQ(alignment_score(result.alignment()), result.score());
+        EXPECT_RANGE_EQ(gapped1 | std::views::filter(is_letter) | seqan3::views::to_char,
+                        sequence1 | seqan3::views::slice(result.sequence1_begin_position(),
+                                                         result.sequence1_end_position()) | seqan3::views::to_char);
+        EXPECT_RANGE_EQ(gapped2 | std::views::filter(is_letter) | seqan3::views::to_char,
+                        sequence2 | seqan3::views::slice(result.sequence2_begin_position(),
+                                                         result.sequence2_end_position()) | seqan3::views::to_char);
+    }
+
+    // The parallel execution may return the results in any order.
+    std::ranges::sort(actual);
+    EXPECT_EQ(actual, expected);
+}
+
+auto const semi_global_cfg = seqan3::align_cfg::method_global{
+                                 seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_leading{false},
+                                 seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                                 seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+auto const overlap_cfg = seqan3::align_cfg::method_global{
+                             seqan3::align_cfg::free_end_gaps_sequence1_leading{true},
+                             seqan3::align_cfg::free_end_gaps_sequence2_leading{true},
+                             seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                             seqan3::align_cfg::free_end_gaps_sequence2_trailing{true}};
+
+auto const mixed_cfg = seqan3::align_cfg::method_global{
+                           seqan3::align_cfg::free_end_gaps_sequence1_leading{false},
+                           seqan3::align_cfg::free_end_gaps_sequence2_leading{true},
+                           seqan3::align_cfg::free_end_gaps_sequence1_trailing{true},
+                           seqan3::align_cfg::free_end_gaps_sequence2_trailing{false}};
+
+TEST(global_affine_linear_memory, global)
+{
+    expect_same_as_full_matrix(seqan3::align_cfg::method_global{}, seqan3::align_cfg::linear_memory{});
+}
+
+TEST(global_affine_linear_memory, semi_global)
+{
+    expect_same_as_full_matrix(semi_global_cfg, seqan3::align_cfg::linear_memory{});
+}
+
+TEST(global_affine_linear_memory, overlap)
+{
+    expect_same_as_full_matrix(overlap_cfg, seqan3::align_cfg::linear_memory{});
+}
+
+TEST(global_affine_linear_memory, mixed_free_end_gaps)
+{
+    expect_same_as_full_matrix(mixed_cfg, seqan3::align_cfg::linear_memory{});
+}
+
+TEST(global_affine_linear_memory, memory_limit)
+{
+    // Only the large sequence pairs are computed in linear memory.
+    expect_same_as_full_matrix(seqan3::align_cfg::method_global{}, seqan3::align_cfg::linear_memory{50'000u});
+    expect_same_as_full_matrix(overlap_cfg, seqan3::align_cfg::linear_memory{50'000u});
+}
+
+TEST(global_affine_linear_memory, parallel)
+{
+    expect_same_as_full_matrix(seqan3::align_cfg::method_global{},
+                               seqan3::align_cfg::linear_memory{} | seqan3::align_cfg::parallel{4});
+    expect_same_as_full_matrix(semi_global_cfg, seqan3::align_cfg::linear_memory{} | seqan3::align_cfg::parallel{2});
+}
+
+TEST(global_affine_linear_memory, long_sequences)
+{
+    // Large enough to compute the halves concurrently.
+    std::mt19937_64 engine{7u};
+    std::uniform_int_distribution<size_t> rank{0u, 3u};
+    seqan3::dna4_vector sequence1(3000u);
+    for (auto & letter : sequence1)
+        letter.assign_rank(rank(engine));
+
+    seqan3::dna4_vector sequence2 = sequence1;
+    sequence2.erase(sequence2.begin() + 1000u, sequence2.begin() + 1200u);
+    for (size_t i = 5u; i < sequence2.size(); i += 17u)
+        sequence2[i].assign_rank((sequence2[i].to_rank() + 1u) % 4u);
+
+    auto const config = seqan3::align_cfg::method_global{} | scoring_cfg | output_cfg;
+    auto expected = *seqan3::align_pairwise(std::tie(sequence1, sequence2), config).begin();
+    auto actual = *seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                          config |
+                                          seqan3::align_cfg::linear_memory{} |
+                                          seqan3::align_cfg::parallel{4}).begin();
+
+    EXPECT_EQ(actual.score(), expected.score());
+    EXPECT_EQ(alignment_score(actual.alignment()), expected.score());
+}
+
+TEST(global_affine_linear_memory, edit_distance)
+{
+    // The edit distance is computed with the affine algorithm.
+    seqan3::dna4_vector sequence1 = "AACCGGTTAACCGGTT"_dna4;
+    seqan3::dna4_vector sequence2 = "ACGTACGTA"_dna4;
+
+    auto results = seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                          seqan3::align_cfg::method_global{} |
+                                          seqan3::align_cfg::edit_scheme |
+                                          seqan3::align_cfg::output_score{} |
+                                          seqan3::align_cfg::output_alignment{} |
+                                          seqan3::align_cfg::linear_memory{});
+    auto result = *results.begin();
+    EXPECT_EQ(result.score(), -8);
+    EXPECT_RANGE_EQ(std::get<0>(result.alignment()) | seqan3::views::to_char, std::string{"AACCGGTTAACCGGTT"});
+    EXPECT_EQ(std::ranges::size(std::get<1>(result.alignment())), 16u);
+}
@@ -0,0 +1,121 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <string>
+
+#include <seqan3/io/detail/memory_mapped_file.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+TEST(memory_mapped_file, default_construction)
+{
+    seqan3::detail::memory_mapped_file file{};
+    EXPECT_TRUE(file.empty());
+    EXPECT_EQ(file.size(), 0u);
+    EXPECT_EQ(file.data(), nullptr);
+}
+
+TEST(memory_mapped_file, map)
+{
+    seqan3::test::tmp_filename tmp_file{"mapped.txt"};
+    std::string const content{"ACGTACGTACGT\nsome more content"};
+
+    {
+        std::ofstream out{tmp_file.get_path(), std::ios::binary};
+        out << content;
+    }
+
+    seqan3::detail::memory_mapped_file file{tmp_file.get_path()};
+    file.will_need();
+    EXPECT_FALSE(file.empty());
+    ASSERT_EQ(file.size(), content.size());
+    EXPECT_EQ(std::memcmp(file.data(), content.data(), content.size()), 0);
+
+    // move construction and assignment transfer the mapping
+    seqan3::detail::memory_mapped_file moved{std::move(file)};
+    EXPECT_TRUE(file.empty());
+    EXPECT_EQ(moved.size(), content.size());
+
+    seqan3::detail::memory_mapped_file assigned{};
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.size(), content.size());
+    EXPECT_EQ(std::memcmp(assigned.data(), content.data(), content.size()), 0);
+}
+
+TEST(memory_mapped_file, empty_file)
+{
+    seqan3::test::tmp_filename tmp_file{"empty.txt"};
+    {
+        std::ofstream out{tmp_file.get_path(), std::ios::binary};
+    }
+
+    seqan3::detail::memory_mapped_file file{tmp_file.get_path()};
+    EXPECT_TRUE(file.empty());
+}
+
+TEST(memory_mapped_file, file_does_not_exist)
+{
+    seqan3::test::tmp_filename tmp_file{"does_not_exist.txt"};
+    EXPECT_THROW(seqan3::detail::memory_mapped_file{tmp_file.get_path()}, std::filesystem::filesystem_error);
+}
+
+TEST(open_binary_file, error_codes)
+{
+    seqan3::test::tmp_filename tmp_file{"does_not_exist.txt"};
+
+    try
+    {
+        seqan3::detail::open_binary_file<std::ifstream>(tmp_file.get_path());
+        FAIL() << "Expected std::filesystem::filesystem_error.";
+    }
+    catch (std::filesystem::filesystem_error const & error)
+    {
+        EXPECT_EQ(error.code(), std::errc::no_such_file_or_directory);
+    }
+
+    try // the parent directory does not exist
+    {
+        seqan3::detail::open_binary_file<std::ofstream>(tmp_file.get_path() / "file.txt");
+        FAIL() << "Expected std::filesystem::filesystem_error.";
+    }
+    catch (std::filesystem::filesystem_error const & error)
+    {
+        EXPECT_EQ(error.code(), std::errc::no_such_file_or_directory);
+    }
+
+    std::ofstream out = seqan3::detail::open_binary_file<std::ofstream>(tmp_file.get_path());
+    EXPECT_TRUE(out.is_open());
+}
+
+TEST(memory_mapped_streambuf, read_and_seek)
+{
+    std::string const content{"0123456789"};
+    seqan3::detail::memory_mapped_streambuf buffer{reinterpret_cast<std::byte const *>(content.data()),
+                                                   content.size()};
+    std::istream in{&buffer};
+
+    std::string read(4, ' ');
+    in.read(read.data(), 4);
+    EXPECT_EQ(read, "0123");
+    EXPECT_EQ(in.tellg(), 4);
+
+    in.seekg(2, std::ios_base::cur);
+    in.read(read.data(), 4);
+    EXPECT_EQ(read, "6789");
+
+    in.seekg(1);
+    in.read(read.data(), 2);
+    EXPECT_EQ(read.substr(0, 2), "12");
+
+    in.read(read.data(), 20); // read past the end
+    EXPECT_TRUE(in.eof());
+    EXPECT_EQ(in.gcount(), 7);
+}
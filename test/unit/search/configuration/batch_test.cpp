@@ -0,0 +1,49 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/core/configuration/configuration.hpp>
+#include <seqan3/search/configuration/batch.hpp>
+
+TEST(search_config_batch, member_variable)
+{
+    {   // default construction
+        seqan3::search_cfg::batch cfg{};
+        EXPECT_EQ(cfg.size, 16u);
+    }
+
+    {   // construct with value
+        seqan3::search_cfg::batch cfg{64};
+        EXPECT_EQ(cfg.size, 64u);
+    }
+
+    {   // assign value
+        seqan3::search_cfg::batch cfg{};
+        cfg.size = 32;
+        EXPECT_EQ(cfg.size, 32u);
+    }
+}
+
+TEST(search_config_batch, config_element)
+{
+    EXPECT_TRUE((seqan3::detail::config_element<seqan3::search_cfg::batch>));
+}
+
+TEST(search_config_batch, configuration)
+{
+    { // from lvalue.
+        seqan3::search_cfg::batch elem{64};
+        seqan3::configuration cfg{elem};
+        EXPECT_EQ(std::get<seqan3::search_cfg::batch>(cfg).size, 64u);
+    }
+
+    { // from rvalue.
+        seqan3::configuration cfg{seqan3::search_cfg::batch{64}};
+        EXPECT_EQ(std::get<seqan3::search_cfg::batch>(cfg).size, 64u);
+    }
+}
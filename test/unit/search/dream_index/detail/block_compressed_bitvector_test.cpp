@@ -0,0 +1,135 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include <seqan3/search/dream_index/detail/block_compressed_bitvector.hpp>
+
+TEST(block_compressed_bitvector_test, decode)
+{
+    std::mt19937_64 engine{42u};
+
+    // More than one superblock; dense, sparse and empty blocks.
+    std::vector<uint64_t> words(20'000);
+    for (size_t i = 0; i < words.size(); ++i)
+    {
+        switch ((i / 7) % 3)
+        {
+            case 0: words[i] = engine(); break;
+            case 1: words[i] = 1ULL << (engine() % 64); break;
+            default: words[i] = 0u;
+        }
+    }
+
+    seqan3::detail::block_compressed_bitvector const compressed{words.data(), words.size() * 64u};
+    EXPECT_EQ(compressed.size(), words.size() * 64u);
+    EXPECT_LT(compressed.size_in_bytes(), words.size() * sizeof(uint64_t));
+
+    std::vector<uint64_t> decoded(words.size());
+    compressed.decode_words(0u, words.size(), decoded.data());
+    EXPECT_EQ(decoded, words);
+
+    for (size_t repetition = 0; repetition < 100; ++repetition)
+    {
+        size_t const first = engine() % words.size();
+        size_t const count = engine() % (words.size() - first);
+        std::vector<uint64_t> expected(count);
+        std::vector<uint64_t> result(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            result[i] = engine();
+            expected[i] = result[i] & words[first + i];
+        }
+
+        compressed.and_words(first, count, result.data());
+        EXPECT_EQ(result, expected);
+    }
+}
+
+TEST(block_compressed_bitvector_test, sparse)
+{
+    // One set bit per 256 bits needs one byte instead of 32 bytes.
+    std::vector<uint64_t> words(4'096);
+    for (size_t i = 0; i < words.size(); i += 4)
+        words[i] = 1ULL << (i % 64);
+
+    seqan3::detail::block_compressed_bitvector const compressed{words.data(), words.size() * 64u};
+    EXPECT_LT(compressed.size_in_bytes() * 10u, words.size() * sizeof(uint64_t));
+    EXPECT_TRUE(compressed == seqan3::detail::block_compressed_bitvector(words.data(), words.size() * 64u));
+}
+
+TEST(block_compressed_bitvector_test, serialize_and_load)
+{
+    std::vector<uint64_t> words(5'000);
+    for (size_t i = 0; i < words.size(); i += 3)
+        words[i] = (i % 2 == 0) ? 0xF0F0F0F0F0F0F0F0ULL : 1ULL << (i % 64);
+
+    seqan3::detail::block_compressed_bitvector const compressed{words.data(), words.size() * 64u};
+    std::stringstream stream{};
+    uint64_t const written = compressed.serialize(stream);
+    EXPECT_EQ(written, stream.str().size());
+
+    seqan3::detail::block_compressed_bitvector loaded{};
+    loaded.load(stream);
+    EXPECT_TRUE(loaded == compressed);
+
+    std::vector<uint64_t> decoded(words.size());
+    loaded.decode_words(0u, words.size(), decoded.data());
+    EXPECT_EQ(decoded, words);
+}
+
+TEST(block_compressed_bitvector_test, load_corrupted)
+{
+    // 2500 sparse blocks in 2 superblocks.
+    std::vector<uint64_t> words(10'000);
+    for (size_t i = 0; i < words.size(); i += 5)
+        words[i] = 1ULL << (i % 64);
+
+    std::stringstream stream{};
+    seqan3::detail::block_compressed_bitvector{words.data(), words.size() * 64u}.serialize(stream);
+    std::string const valid = stream.str();
+
+    // The stream contains the number of bits, followed by the superblock offsets, the block offsets and the payload,
+    // each prefixed by its size.
+    size_t const superblocks_begin = sizeof(uint64_t);
+    size_t const blocks_begin = superblocks_begin + 3u * sizeof(uint64_t);
+    size_t const first_block = blocks_begin + sizeof(uint64_t);
+
+    auto load = [] (std::string const & data)
+    {
+        std::istringstream in{data};
+        seqan3::detail::block_compressed_bitvector loaded{};
+        loaded.load(in);
+    };
+
+    auto patch = [&] <typename value_t> (size_t const offset, value_t const value)
+    {
+        std::string data = valid;
+        std::memcpy(data.data() + offset, &value, sizeof(value));
+        return data;
+    };
+
+    EXPECT_NO_THROW(load(valid));
+
+    // The stream ends early.
+    EXPECT_THROW(load(valid.substr(0u, valid.size() - 1u)), std::runtime_error);
+    EXPECT_THROW(load(valid.substr(0u, 4u)), std::runtime_error);
+    // The number of superblocks or blocks does not match the number of bits.
+    EXPECT_THROW(load(patch(superblocks_begin, uint64_t{3u})), std::runtime_error);
+    EXPECT_THROW(load(patch(blocks_begin, uint64_t{2'500u})), std::runtime_error);
+    // A superblock starts beyond the payload.
+    EXPECT_THROW(load(patch(superblocks_begin + 2u * sizeof(uint64_t), uint64_t{1u} << 40)), std::runtime_error);
+    // The block offsets are not monotonic, describe a block longer than a raw block or do not start at 0.
+    EXPECT_THROW(load(patch(first_block + 2u * sizeof(uint16_t), uint16_t{0u})), std::runtime_error);
+    EXPECT_THROW(load(patch(first_block + sizeof(uint16_t), uint16_t{40u})), std::runtime_error);
+    EXPECT_THROW(load(patch(first_block, uint16_t{1u})), std::runtime_error);
+}
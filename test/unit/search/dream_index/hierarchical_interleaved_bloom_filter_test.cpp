@@ -0,0 +1,187 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <forward_list>
+#include <list>
+
+#include <seqan3/search/dream_index/hierarchical_interleaved_bloom_filter.hpp>
+#include <seqan3/test/cereal.hpp>
+
+// One user bin with 100 times more values than the others.
+static std::vector<std::vector<uint64_t>> skewed_user_bins()
+{
+    std::vector<std::vector<uint64_t>> user_bins(200);
+    uint64_t value{};
+    for (size_t user_bin = 0; user_bin < user_bins.size(); ++user_bin)
+        for (size_t i = 0; i < (user_bin == 0u ? 20'000u : 200u); ++i)
+            user_bins[user_bin].push_back(value++ * 0x9E3779B97F4A7C15ULL);
+
+    return user_bins;
+}
+
+TEST(hibf_layout_test, split_and_merge)
+{
+    std::vector<size_t> const sizes{10, 1000, 1, 1, 2, 1, 1, 3};
+    seqan3::detail::hibf_layout const layout{sizes, 4u, 0.05, 2u};
+
+    ASSERT_FALSE(layout.nodes.empty());
+    auto const & root = layout.nodes[0];
+    ASSERT_EQ(root.user_bins.size(), 4u);
+
+    // The largest user bin is split, the small ones are merged into child IBFs.
+    EXPECT_GE(std::ranges::count(root.user_bins, 1u), 2);
+    EXPECT_GE(std::ranges::count(root.user_bins, seqan3::detail::hibf_layout::merged_bin), 1);
+
+    // Every user bin is stored exactly once as a whole or as consecutive parts.
+    std::vector<size_t> seen(sizes.size(), 0u);
+    for (size_t node_idx = 0; node_idx < layout.nodes.size(); ++node_idx)
+    {
+        auto const & node = layout.nodes[node_idx];
+        for (size_t technical_bin = 0; technical_bin < node.user_bins.size(); ++technical_bin)
+        {
+            if (node.user_bins[technical_bin] == seqan3::detail::hibf_layout::merged_bin)
+            {
+                // Either a merged bin with a child or an empty technical bin.
+                EXPECT_GE(node.children[technical_bin], node_idx);
+            }
+            else
+            {
+                EXPECT_EQ(node.children[technical_bin], node_idx);
+                if (technical_bin == 0u || node.user_bins[technical_bin - 1u] != node.user_bins[technical_bin])
+                    ++seen[node.user_bins[technical_bin]];
+            }
+        }
+    }
+
+    EXPECT_EQ(seen, std::vector<size_t>(sizes.size(), 1u));
+}
+
+TEST(hibf_layout_test, few_user_bins)
+{
+    seqan3::detail::hibf_layout const layout{std::vector<size_t>{100, 50}, 6u, 0.05, 2u};
+
+    // Splitting the larger user bin reduces the maximal load, even though the parts need a lower false positive rate.
+    ASSERT_EQ(layout.nodes.size(), 1u);
+    auto const & user_bins = layout.nodes[0].user_bins;
+    EXPECT_GE(std::ranges::count(user_bins, 0u), 2);
+    EXPECT_GE(std::ranges::count(user_bins, 1u), 1);
+    EXPECT_LT(layout.nodes[0].max_load, 100u);
+    EXPECT_GE(layout.nodes[0].max_load, 50u);
+}
+
+template <typename hibf_type>
+struct hierarchical_interleaved_bloom_filter_test : public ::testing::Test
+{};
+
+using hibf_types = ::testing::Types<seqan3::hierarchical_interleaved_bloom_filter<seqan3::data_layout::uncompressed>,
+                                    seqan3::hierarchical_interleaved_bloom_filter<seqan3::data_layout::compressed>>;
+
+TYPED_TEST_SUITE(hierarchical_interleaved_bloom_filter_test, hibf_types, );
+
+TYPED_TEST(hierarchical_interleaved_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_destructible_v<TypeParam>);
+
+    std::vector<std::vector<uint64_t>> const user_bins{{1u, 2u}, {3u}};
+    using hibf_t = seqan3::hierarchical_interleaved_bloom_filter<>;
+    EXPECT_THROW((hibf_t{user_bins, 0.0}), std::logic_error);
+    EXPECT_THROW((hibf_t{user_bins, 1.0}), std::logic_error);
+    EXPECT_THROW((hibf_t{user_bins, 0.05, seqan3::bin_count{1u}}), std::logic_error);
+    EXPECT_THROW((hibf_t{user_bins, 0.05, seqan3::bin_count{64u}, seqan3::hash_function_count{6u}}), std::logic_error);
+
+    TypeParam hibf{hibf_t{user_bins}};
+    EXPECT_EQ(hibf.user_bin_count(), 2u);
+    EXPECT_EQ(hibf.ibf_count(), 1u);
+}
+
+TYPED_TEST(hierarchical_interleaved_bloom_filter_test, counting_agent)
+{
+    auto const user_bins = skewed_user_bins();
+    TypeParam hibf{seqan3::hierarchical_interleaved_bloom_filter{user_bins, 0.05}};
+
+    EXPECT_EQ(hibf.user_bin_count(), user_bins.size());
+    EXPECT_GT(hibf.ibf_count(), 1u);
+
+    auto agent = hibf.counting_agent();
+    auto agent2 = hibf.template counting_agent<uint32_t>();
+    for (size_t user_bin = 0; user_bin < user_bins.size(); ++user_bin)
+    {
+        auto & counts = agent.bulk_count(user_bins[user_bin]);
+        ASSERT_EQ(counts.size(), user_bins.size());
+
+        // No false negatives.
+        EXPECT_GE(counts[user_bin], user_bins[user_bin].size());
+
+        // The false positive rate of each user bin is about 5%.
+        size_t false_positives{counts[user_bin] - user_bins[user_bin].size()};
+        for (size_t other = 0; other < user_bins.size(); ++other)
+            if (other != user_bin)
+                false_positives += counts[other];
+
+        EXPECT_LE(false_positives, user_bins.size() * user_bins[user_bin].size() * 3u / 40u);
+
+        EXPECT_TRUE(std::ranges::equal(agent2.bulk_count(user_bins[user_bin]), counts));
+    }
+
+    // Values that were not inserted hit nothing or almost nothing.
+    std::vector<uint64_t> const unknown{1u, 3u, 5u, 7u};
+    auto & counts = agent.bulk_count(unknown);
+    EXPECT_LE(std::accumulate(counts.begin(), counts.end(), size_t{0u}), 4u * user_bins.size() / 10u);
+}
+
+TEST(hierarchical_interleaved_bloom_filter_test, smaller_than_flat_ibf)
+{
+    auto const user_bins = skewed_user_bins();
+    seqan3::hierarchical_interleaved_bloom_filter const hibf{user_bins, 0.05};
+
+    // An Interleaved Bloom Filter with the same false positive rate for the largest bin.
+    seqan3::interleaved_bloom_filter const ibf{seqan3::bin_count{user_bins.size()},
+                                               seqan3::bin_size{static_cast<size_t>(20'000 * 6.2)}};
+
+    EXPECT_LT(hibf.bit_size() * 4u, ibf.bit_size());
+}
+
+TEST(hierarchical_interleaved_bloom_filter_test, forward_range_input)
+{
+    auto const user_bins = skewed_user_bins();
+    seqan3::hierarchical_interleaved_bloom_filter const hibf{user_bins};
+
+    // The user bins are only iterated, duplicates do not change the sizes of the user bins.
+    std::list<std::forward_list<uint64_t>> list_user_bins{};
+    for (auto const & user_bin : user_bins)
+    {
+        auto & list_user_bin = list_user_bins.emplace_back(user_bin.begin(), user_bin.end());
+        list_user_bin.insert_after(list_user_bin.before_begin(), user_bin.begin(), user_bin.end());
+    }
+
+    EXPECT_TRUE(hibf == seqan3::hierarchical_interleaved_bloom_filter{list_user_bins});
+}
+
+TEST(hierarchical_interleaved_bloom_filter_test, compression)
+{
+    auto const user_bins = skewed_user_bins();
+    seqan3::hierarchical_interleaved_bloom_filter const hibf{user_bins};
+    seqan3::hierarchical_interleaved_bloom_filter<seqan3::data_layout::compressed> const compressed{hibf};
+
+    auto agent = hibf.counting_agent();
+    auto compressed_agent = compressed.counting_agent();
+    for (auto const & user_bin : user_bins)
+        EXPECT_TRUE(std::ranges::equal(agent.bulk_count(user_bin), compressed_agent.bulk_count(user_bin)));
+}
+
+TYPED_TEST(hierarchical_interleaved_bloom_filter_test, serialisation)
+{
+    TypeParam hibf{seqan3::hierarchical_interleaved_bloom_filter{skewed_user_bins()}};
+    seqan3::test::do_serialisation(hibf);
+}
@@ -0,0 +1,143 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/dream_index/interleaved_bloom_filter_builder.hpp>
+#include <seqan3/search/views/minimiser_hash.hpp>
+
+using namespace seqan3::literals;
+
+struct interleaved_bloom_filter_builder_test : public ::testing::Test
+{
+    // 200 bins with sequences of very different length, i.e. some chunks of 64 bins take longer than others.
+    std::vector<std::vector<seqan3::dna4_vector>> bins{};
+
+    void SetUp() override
+    {
+        std::vector<seqan3::dna4> const alphabet{'A'_dna4, 'C'_dna4, 'G'_dna4, 'T'_dna4};
+        size_t state{42u};
+        auto next = [&state] () { state = state * 6364136223846793005ULL + 1442695040888963407ULL; return state >> 33; };
+
+        bins.resize(200);
+        for (size_t bin_idx = 0; bin_idx < bins.size(); ++bin_idx)
+        {
+            for (size_t seq = 0; seq < 1 + bin_idx % 3; ++seq)
+            {
+                seqan3::dna4_vector sequence(20 + (bin_idx < 64 ? 500 : 5) * (bin_idx % 7));
+                for (auto & symbol : sequence)
+                    symbol = alphabet[next() % 4];
+                bins[bin_idx].push_back(std::move(sequence));
+            }
+        }
+    }
+
+    // Fills the Interleaved Bloom Filter in a single thread.
+    seqan3::interleaved_bloom_filter<> expected_ibf(seqan3::seed const seed) const
+    {
+        seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins.size()},
+                                             seqan3::bin_size{1024u},
+                                             seqan3::hash_function_count{2u}};
+
+        for (size_t bin_idx = 0; bin_idx < bins.size(); ++bin_idx)
+            for (auto & sequence : bins[bin_idx])
+                for (auto && hash : sequence | seqan3::views::minimiser_hash(seqan3::ungapped{4u},
+                                                                               seqan3::window_size{8u},
+                                                                               seed))
+                    ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+        return ibf;
+    }
+};
+
+TEST_F(interleaved_bloom_filter_builder_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<seqan3::interleaved_bloom_filter_builder>);
+    EXPECT_TRUE(std::is_copy_constructible_v<seqan3::interleaved_bloom_filter_builder>);
+    EXPECT_TRUE(std::is_move_constructible_v<seqan3::interleaved_bloom_filter_builder>);
+    EXPECT_TRUE(std::is_copy_assignable_v<seqan3::interleaved_bloom_filter_builder>);
+    EXPECT_TRUE(std::is_move_assignable_v<seqan3::interleaved_bloom_filter_builder>);
+    EXPECT_TRUE(std::is_destructible_v<seqan3::interleaved_bloom_filter_builder>);
+
+    seqan3::interleaved_bloom_filter_builder builder{seqan3::ungapped{4u}, seqan3::window_size{8u}, 4u};
+    EXPECT_EQ(builder.shape(), seqan3::shape{seqan3::ungapped{4u}});
+    EXPECT_EQ(builder.window_size().get(), 8u);
+    EXPECT_EQ(builder.seed().get(), 0x8F3F73B5CF1C9ADEULL);
+    EXPECT_EQ(builder.thread_count(), 4u);
+
+    EXPECT_THROW((seqan3::interleaved_bloom_filter_builder{seqan3::ungapped{9u}, seqan3::window_size{8u}}),
+                 std::invalid_argument);
+    EXPECT_THROW((seqan3::interleaved_bloom_filter_builder{seqan3::ungapped{4u}, seqan3::window_size{8u}, 0u}),
+                 std::invalid_argument);
+}
+
+TEST_F(interleaved_bloom_filter_builder_test, build)
+{
+    seqan3::interleaved_bloom_filter<> const expected = expected_ibf(seqan3::seed{0x8F3F73B5CF1C9ADE});
+
+    for (size_t thread_count : {1u, 2u, 3u, 8u})
+    {
+        seqan3::interleaved_bloom_filter_builder builder{seqan3::ungapped{4u}, seqan3::window_size{8u}, thread_count};
+        EXPECT_TRUE(builder.build(bins, seqan3::bin_size{1024u}) == expected);
+    }
+}
+
+TEST_F(interleaved_bloom_filter_builder_test, insert)
+{
+    seqan3::interleaved_bloom_filter<> const expected = expected_ibf(seqan3::seed{0u});
+    seqan3::interleaved_bloom_filter_builder builder{seqan3::ungapped{4u},
+                                                     seqan3::window_size{8u},
+                                                     seqan3::seed{0u},
+                                                     3u};
+
+    // The bins are accessed lazily by the thread that fills them.
+    auto lazy_bins = std::views::iota(size_t{0u}, bins.size())
+                   | std::views::transform([this] (size_t const bin_idx) { return std::views::all(bins[bin_idx]); });
+
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins.size()},
+                                         seqan3::bin_size{1024u},
+                                         seqan3::hash_function_count{2u}};
+    builder.insert(ibf, lazy_bins);
+    EXPECT_TRUE(ibf == expected);
+
+    // Fewer inputs than bins only fill the first bins.
+    seqan3::interleaved_bloom_filter ibf2{seqan3::bin_count{bins.size() + 100u},
+                                          seqan3::bin_size{1024u},
+                                          seqan3::hash_function_count{2u}};
+    builder.insert(ibf2, lazy_bins);
+    auto agent = ibf2.membership_agent();
+    auto expected_agent = expected.membership_agent();
+    for (size_t hash : std::views::iota(0u, 256u))
+    {
+        auto & res = agent.bulk_contains(hash);
+        auto & expected_res = expected_agent.bulk_contains(hash);
+        for (size_t bin_idx = 0; bin_idx < bins.size() + 100u; ++bin_idx)
+            EXPECT_EQ(res[bin_idx], bin_idx < bins.size() && expected_res[bin_idx]);
+    }
+
+    // More inputs than bins.
+    seqan3::interleaved_bloom_filter ibf3{seqan3::bin_count{bins.size() - 1u},
+                                          seqan3::bin_size{1024u},
+                                          seqan3::hash_function_count{2u}};
+    EXPECT_THROW(builder.insert(ibf3, bins), std::invalid_argument);
+}
+
+TEST_F(interleaved_bloom_filter_builder_test, exception)
+{
+    seqan3::interleaved_bloom_filter_builder builder{seqan3::ungapped{4u}, seqan3::window_size{8u}, 4u};
+
+    auto throwing_bins = std::views::iota(size_t{0u}, bins.size())
+                       | std::views::transform([this] (size_t const bin_idx)
+                         {
+                             if (bin_idx == 130u)
+                                 throw std::runtime_error{"Cannot read bin."};
+                             return std::views::all(bins[bin_idx]);
+                         });
+
+    EXPECT_THROW(builder.build(throwing_bins, seqan3::bin_size{1024u}), std::runtime_error);
+}
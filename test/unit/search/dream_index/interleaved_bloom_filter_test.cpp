@@ -7,9 +7,12 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 #include <seqan3/search/dream_index/interleaved_bloom_filter.hpp>
 #include <seqan3/test/cereal.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_filename.hpp>
 
 template <typename ibf_type>
 struct interleaved_bloom_filter_test : public ::testing::Test
@@ -137,6 +140,32 @@ TYPED_TEST(interleaved_bloom_filter_test, emplace)
     }
 }
 
+TYPED_TEST(interleaved_bloom_filter_test, bulk_contains_many_bins)
+{
+    // 600 bins occupy 10 words per row, i.e. whole simd vectors and a remainder are combined.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{600u},
+                                         seqan3::bin_size{128u},
+                                         seqan3::hash_function_count{3u}};
+
+    for (size_t bin_idx : std::views::iota(0, 600))
+        for (size_t hash = bin_idx % 7; hash < 64; hash += 7)
+            ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    TypeParam ibf2{ibf};
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed> const reference{ibf};
+
+    auto agent = ibf2.membership_agent();
+    auto reference_agent = reference.membership_agent();
+    for (size_t hash : std::views::iota(0, 64))
+    {
+        auto & res = agent.bulk_contains(hash);
+        EXPECT_RANGE_EQ(res, reference_agent.bulk_contains(hash));
+
+        for (size_t bin_idx = hash % 7; bin_idx < 600; bin_idx += 7) // no false negatives
+            EXPECT_TRUE(res[bin_idx]);
+    }
+}
+
 TYPED_TEST(interleaved_bloom_filter_test, clear)
 {
     // 1. Test uncompressed interleaved_bloom_filter directly because the compressed one is not mutable.
@@ -241,6 +270,83 @@ TYPED_TEST(interleaved_bloom_filter_test, counting_agent)
     EXPECT_RANGE_EQ(agent2.bulk_count(std::views::iota(0u, 128u)), expected);
 }
 
+TYPED_TEST(interleaved_bloom_filter_test, counting_agent_many_values)
+{
+    // 600 bins occupy 10 words per row and more than 255 values overflow the intermediate 8-bit counters.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{600u},
+                                         seqan3::bin_size{1024u},
+                                         seqan3::hash_function_count{2u}};
+
+    for (size_t bin_idx : std::views::iota(0, 600))
+        for (size_t hash = bin_idx % 3; hash < 1000; hash += 1 + bin_idx % 5)
+            ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    TypeParam ibf2{ibf};
+    auto agent = ibf2.counting_agent();
+    auto membership_agent = ibf2.membership_agent();
+
+    std::vector<uint16_t> expected(600, 0);
+    for (size_t hash : std::views::iota(0u, 1000u))
+    {
+        auto & res = membership_agent.bulk_contains(hash);
+        for (size_t bin_idx : std::views::iota(0u, 600u))
+            expected[bin_idx] += res[bin_idx];
+    }
+
+    EXPECT_RANGE_EQ(agent.bulk_count(std::views::iota(0u, 1000u)), expected);
+    // The result of the previous call does not leak into the next one.
+    EXPECT_RANGE_EQ(agent.bulk_count(std::views::iota(0u, 1000u)), expected);
+}
+
+TYPED_TEST(interleaved_bloom_filter_test, classification_agent)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{130u},
+                                         seqan3::bin_size{1024u},
+                                         seqan3::hash_function_count{2u}};
+
+    for (size_t bin_idx : std::views::iota(0, 130))
+        for (size_t hash = bin_idx % 3; hash < 300; hash += 1 + bin_idx % 7)
+            ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    TypeParam ibf2{ibf};
+    auto counting_agent = ibf2.counting_agent();
+
+    auto expected = [&] (auto const & values, size_t const threshold)
+    {
+        std::vector<size_t> result{};
+        auto & counts = counting_agent.bulk_count(values);
+        for (size_t bin_idx = 0; bin_idx < counts.size(); ++bin_idx)
+            if (counts[bin_idx] >= threshold)
+                result.push_back(bin_idx);
+        return result;
+    };
+
+    auto const values = std::views::iota(0u, 300u);
+    for (double fraction : {0.0, 0.1, 0.3, 0.5, 0.9, 1.0})
+    {
+        auto agent = ibf2.classification_agent(seqan3::relative_threshold{fraction});
+        EXPECT_RANGE_EQ(agent.bulk_classify(values), expected(values, seqan3::relative_threshold{fraction}(300u)));
+        // The result of the previous call does not leak into the next one.
+        EXPECT_RANGE_EQ(agent.bulk_classify(values), expected(values, seqan3::relative_threshold{fraction}(300u)));
+    }
+
+    auto const query = std::views::iota(40u, 90u);
+    for (size_t errors : {0u, 1u, 2u, 20u})
+    {
+        seqan3::kmer_lemma_threshold const threshold{2u, errors};
+        auto agent = ibf2.template classification_agent<uint32_t>(threshold);
+        EXPECT_RANGE_EQ(agent.bulk_classify(query), expected(query, threshold(50u)));
+    }
+
+    // A threshold larger than the number of values and values that are contained in no bin.
+    auto agent = ibf2.classification_agent([] (size_t const n) { return n + 1u; });
+    EXPECT_TRUE(agent.bulk_classify(values).empty());
+    auto agent2 = ibf2.classification_agent(seqan3::relative_threshold{0.5});
+    EXPECT_TRUE(agent2.bulk_classify(std::views::iota(1'000u, 1'020u)).empty());
+    // An empty query has the threshold 0, i.e. every bin qualifies.
+    EXPECT_EQ(agent2.bulk_classify(std::vector<size_t>{}).size(), 130u);
+}
+
 // Check special case where there is only one `1` in the bitvector.
 TYPED_TEST(interleaved_bloom_filter_test, counting_no_ub)
 {
@@ -336,6 +442,225 @@ TYPED_TEST(interleaved_bloom_filter_test, increase_bin_number_to)
     }
 }
 
+TYPED_TEST(interleaved_bloom_filter_test, decrease_bin_number_to)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{200u}, seqan3::bin_size{1024u}};
+    for (size_t bin_idx : std::views::iota(0, 200))
+        for (size_t hash = bin_idx; hash < 300; hash += 1 + bin_idx % 5)
+            ibf.emplace(hash, seqan3::bin_index{bin_idx});
+    seqan3::interleaved_bloom_filter const original{ibf};
+
+    // 1. Throw if trying to increase the number of bins or to remove all bins.
+    EXPECT_THROW(ibf.decrease_bin_number_to(seqan3::bin_count{201u}), std::invalid_argument);
+    EXPECT_THROW(ibf.decrease_bin_number_to(seqan3::bin_count{0u}), std::invalid_argument);
+
+    // 2. No change in bin_words implies no change in size.
+    ibf.decrease_bin_number_to(seqan3::bin_count{193u});
+    EXPECT_EQ(ibf.bin_count(), 193u);
+    EXPECT_EQ(ibf.bit_size(), original.bit_size());
+
+    // 3. The remaining bins keep their content and the size shrinks with the bin_words.
+    ibf.decrease_bin_number_to(seqan3::bin_count{70u});
+    EXPECT_EQ(ibf.bin_count(), 70u);
+    EXPECT_EQ(ibf.bit_size(), original.bit_size() / 2u);
+
+    TypeParam tibf{ibf};
+    auto agent = tibf.membership_agent();
+    auto original_agent = original.membership_agent();
+    for (size_t hash : std::views::iota(0u, 400u))
+    {
+        auto const & expected = original_agent.bulk_contains(hash);
+        EXPECT_RANGE_EQ(agent.bulk_contains(hash), expected | std::views::take(70));
+    }
+
+    // 4. Decreasing and increasing again only clears the removed bins.
+    seqan3::interleaved_bloom_filter cleared{original};
+    cleared.clear(std::views::iota(70u, 200u) | std::views::transform([] (size_t bin)
+    {
+        return seqan3::bin_index{bin};
+    }));
+    ibf.increase_bin_number_to(seqan3::bin_count{200u});
+    EXPECT_TRUE(ibf == cleared);
+}
+
+TYPED_TEST(interleaved_bloom_filter_test, remove_bins)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{130u}, seqan3::bin_size{1024u}};
+    for (size_t bin_idx : std::views::iota(0, 130))
+        for (size_t hash = bin_idx; hash < 300; hash += 1 + bin_idx % 5)
+            ibf.emplace(hash, seqan3::bin_index{bin_idx});
+    seqan3::interleaved_bloom_filter const original{ibf};
+
+    // 1. Throw if a bin does not exist or no bin would remain.
+    std::vector<seqan3::bin_index> const invalid{seqan3::bin_index{3u}, seqan3::bin_index{130u}};
+    EXPECT_THROW(ibf.remove_bins(invalid), std::invalid_argument);
+    auto all_bins = std::views::iota(0u, 130u) | std::views::transform([] (size_t bin)
+    {
+        return seqan3::bin_index{bin};
+    });
+    EXPECT_THROW(ibf.remove_bins(all_bins), std::invalid_argument);
+    EXPECT_TRUE(ibf == original);
+
+    // 2. Remove single bins, a range crossing a word boundary and a duplicate.
+    std::vector<seqan3::bin_index> removed{seqan3::bin_index{0u}, seqan3::bin_index{5u}, seqan3::bin_index{129u}};
+    for (size_t bin : std::views::iota(40u, 100u))
+        removed.emplace_back(bin);
+    removed.emplace_back(5u);
+
+    std::vector<size_t> const new_index = ibf.remove_bins(removed);
+    ASSERT_EQ(new_index.size(), 130u);
+    EXPECT_EQ(new_index[0], ibf.removed_bin);
+    EXPECT_EQ(new_index[1], 0u);
+    EXPECT_EQ(new_index[5], ibf.removed_bin);
+    EXPECT_EQ(new_index[6], 4u);
+    EXPECT_EQ(new_index[39], 37u);
+    EXPECT_EQ(new_index[99], ibf.removed_bin);
+    EXPECT_EQ(new_index[100], 38u);
+    EXPECT_EQ(new_index[128], 66u);
+    EXPECT_EQ(new_index[129], ibf.removed_bin);
+
+    EXPECT_EQ(ibf.bin_count(), 67u);
+    EXPECT_EQ(ibf.bit_size(), original.bit_size() / 3u * 2u);
+
+    // 3. The remaining bins keep their content.
+    TypeParam tibf{ibf};
+    auto agent = tibf.membership_agent();
+    auto original_agent = original.membership_agent();
+    for (size_t hash : std::views::iota(0u, 400u))
+    {
+        auto const & result = agent.bulk_contains(hash);
+        auto const & expected = original_agent.bulk_contains(hash);
+        for (size_t bin = 0; bin < 130u; ++bin)
+        {
+            if (new_index[bin] != ibf.removed_bin)
+            {
+                EXPECT_EQ(result[new_index[bin]], expected[bin]);
+            }
+        }
+    }
+}
+
+TYPED_TEST(interleaved_bloom_filter_test, parallel_resize)
+{
+    // Enough rows for several chunks per wave.
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{100u}, seqan3::bin_size{1u << 16}};
+    for (size_t bin_idx : std::views::iota(0, 100))
+        for (size_t hash = bin_idx; hash < 20'000; hash += 1 + bin_idx % 9)
+            ibf.emplace(hash, seqan3::bin_index{bin_idx});
+
+    std::vector<seqan3::bin_index> removed{};
+    for (size_t bin = 0; bin < 100u; bin += 3)
+        removed.emplace_back(bin);
+
+    seqan3::interleaved_bloom_filter sequential{ibf};
+    seqan3::interleaved_bloom_filter parallel{ibf};
+
+    sequential.increase_bin_number_to(seqan3::bin_count{300u});
+    parallel.increase_bin_number_to(seqan3::bin_count{300u}, 4u);
+    EXPECT_TRUE(sequential == parallel);
+
+    EXPECT_RANGE_EQ(sequential.remove_bins(removed), parallel.remove_bins(removed, 4u));
+    EXPECT_TRUE(sequential == parallel);
+
+    sequential.decrease_bin_number_to(seqan3::bin_count{50u});
+    parallel.decrease_bin_number_to(seqan3::bin_count{50u}, 4u);
+    EXPECT_TRUE(sequential == parallel);
+
+    TypeParam tibf{parallel};
+    auto agent = tibf.membership_agent();
+    auto original_agent = ibf.membership_agent();
+    for (size_t hash : std::views::iota(0u, 1000u))
+    {
+        auto const & result = agent.bulk_contains(hash);
+        auto const & expected = original_agent.bulk_contains(hash);
+        for (size_t bin = 0, new_bin = 0; new_bin < 50u; ++bin)
+        {
+            if (bin % 3u != 0u)
+            {
+                EXPECT_EQ(result[new_bin], expected[bin]);
+                ++new_bin;
+            }
+        }
+    }
+}
+
+TYPED_TEST(interleaved_bloom_filter_test, merge)
+{
+    // Values of bin `bin` of the `part`th filter.
+    auto fill = [] (seqan3::interleaved_bloom_filter<> & ibf, size_t const part, size_t const first_bin)
+    {
+        for (size_t bin = 0; bin < 70u; ++bin)
+            for (size_t hash = part * 1000u + bin; hash < part * 1000u + 300u; hash += 1 + bin % 5)
+                ibf.emplace(hash, seqan3::bin_index{first_bin + bin});
+    };
+
+    seqan3::interleaved_bloom_filter ibf1{seqan3::bin_count{70u}, seqan3::bin_size{1024u}};
+    seqan3::interleaved_bloom_filter ibf2{seqan3::bin_count{70u}, seqan3::bin_size{1024u}};
+    fill(ibf1, 0u, 0u);
+    fill(ibf2, 1u, 0u);
+
+    // 1. Throw if the parameters differ.
+    seqan3::interleaved_bloom_filter ibf{ibf1};
+    EXPECT_THROW(ibf.merge(seqan3::interleaved_bloom_filter{seqan3::bin_count{70u}, seqan3::bin_size{2048u}},
+                           seqan3::merge_mode::append_bins),
+                 std::invalid_argument);
+    EXPECT_THROW(ibf.merge(seqan3::interleaved_bloom_filter{seqan3::bin_count{70u},
+                                                            seqan3::bin_size{1024u},
+                                                            seqan3::hash_function_count{3u}},
+                           seqan3::merge_mode::append_bins),
+                 std::invalid_argument);
+    EXPECT_THROW(ibf.merge(seqan3::interleaved_bloom_filter{seqan3::bin_count{71u}, seqan3::bin_size{1024u}},
+                           seqan3::merge_mode::unite_bins),
+                 std::invalid_argument);
+    EXPECT_TRUE(ibf == ibf1);
+
+    // 2. Uniting bins is the same as inserting all values into one filter.
+    seqan3::interleaved_bloom_filter united{seqan3::bin_count{70u}, seqan3::bin_size{1024u}};
+    fill(united, 0u, 0u);
+    fill(united, 1u, 0u);
+
+    ibf.merge(ibf2, seqan3::merge_mode::unite_bins);
+    EXPECT_TRUE(ibf == united);
+
+    // 3. Appending bins is the same as inserting the values of the second filter into the bins after the first.
+    seqan3::interleaved_bloom_filter appended{seqan3::bin_count{140u}, seqan3::bin_size{1024u}};
+    fill(appended, 0u, 0u);
+    fill(appended, 1u, 70u);
+
+    ibf = ibf1;
+    ibf.merge(ibf2, seqan3::merge_mode::append_bins, 4u);
+    EXPECT_EQ(ibf.bin_count(), 140u);
+    EXPECT_TRUE(ibf == appended);
+
+    // 4. Merging a filter with itself.
+    seqan3::interleaved_bloom_filter twice{seqan3::bin_count{140u}, seqan3::bin_size{1024u}};
+    fill(twice, 0u, 0u);
+    fill(twice, 0u, 70u);
+
+    ibf = ibf1;
+    ibf.merge(ibf, seqan3::merge_mode::append_bins);
+    EXPECT_TRUE(ibf == twice);
+
+    // 5. Merging loaded filters.
+    seqan3::test::tmp_filename filename1{"filter1.ibf"};
+    seqan3::test::tmp_filename filename2{"filter2.ibf"};
+    ibf1.store(filename1.get_path());
+    ibf2.store(filename2.get_path());
+
+    seqan3::interleaved_bloom_filter loaded1{};
+    seqan3::interleaved_bloom_filter loaded2{};
+    loaded1.load(filename1.get_path());
+    loaded2.load(filename2.get_path());
+    loaded1.merge(loaded2, seqan3::merge_mode::append_bins, 2u);
+    EXPECT_TRUE(loaded1 == appended);
+
+    TypeParam tibf{loaded1};
+    auto agent = tibf.membership_agent();
+    auto expected_agent = appended.membership_agent();
+    for (size_t hash : std::views::iota(0u, 1500u))
+        EXPECT_RANGE_EQ(agent.bulk_contains(hash), expected_agent.bulk_contains(hash));
+}
+
 TYPED_TEST(interleaved_bloom_filter_test, data_access)
 {
     seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{1024u}, seqan3::bin_size{1024u}};
@@ -349,3 +674,133 @@ TYPED_TEST(interleaved_bloom_filter_test, serialisation)
     seqan3::test::do_serialisation(ibf);
 }
 
+
+TYPED_TEST(interleaved_bloom_filter_test, store_and_load)
+{
+    seqan3::interleaved_bloom_filter tmp{seqan3::bin_count{130u}, seqan3::bin_size{1024u}};
+    for (size_t bin_idx : std::views::iota(0, 130))
+        for (size_t hash = bin_idx; hash < 500; hash += 1 + bin_idx % 7)
+            tmp.emplace(hash, seqan3::bin_index{bin_idx});
+
+    TypeParam ibf{tmp};
+    seqan3::test::tmp_filename filename{"filter.ibf"};
+    ibf.store(filename.get_path());
+
+    TypeParam loaded{};
+    loaded.load(filename.get_path());
+    EXPECT_TRUE(ibf == loaded);
+    EXPECT_EQ(loaded.bin_count(), 130u);
+    EXPECT_EQ(loaded.bit_size(), ibf.bit_size());
+
+    // The loaded filter answers the same queries.
+    auto agent = ibf.counting_agent();
+    auto loaded_agent = loaded.counting_agent();
+    auto membership_agent = ibf.membership_agent();
+    auto loaded_membership_agent = loaded.membership_agent();
+    for (size_t hash : std::views::iota(0u, 600u))
+        EXPECT_RANGE_EQ(loaded_membership_agent.bulk_contains(hash), membership_agent.bulk_contains(hash));
+    EXPECT_RANGE_EQ(loaded_agent.bulk_count(std::views::iota(0u, 600u)), agent.bulk_count(std::views::iota(0u, 600u)));
+
+    // Copies share the loaded filter; storing and serialising a loaded filter writes its bitvector.
+    TypeParam copy{loaded};
+    EXPECT_TRUE(copy == ibf);
+    seqan3::test::tmp_filename filename2{"filter2.ibf"};
+    copy.store(filename2.get_path());
+    TypeParam loaded2{};
+    loaded2.load(filename2.get_path());
+    EXPECT_TRUE(loaded2 == ibf);
+    seqan3::test::do_serialisation(copy);
+
+    // Loading again overwrites the filter.
+    loaded.load(filename.get_path());
+    EXPECT_TRUE(ibf == loaded);
+
+    // A file that does not contain a filter.
+    {
+        std::ofstream out{filename.get_path()};
+        out << "This is not a filter.";
+    }
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+}
+
+TEST(interleaved_bloom_filter_test, load_modify)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{40u}, seqan3::bin_size{1024u}};
+    ibf.emplace(126, seqan3::bin_index{0u});
+    seqan3::test::tmp_filename filename{"filter.ibf"};
+    ibf.store(filename.get_path());
+
+    // A compressed filter can not be loaded from an uncompressed file.
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed> compressed{};
+    EXPECT_THROW(compressed.load(filename.get_path()), std::logic_error);
+
+    // Emplacing and clearing copy the bitvector of a loaded filter; copies keep the mapped bitvector.
+    {
+        seqan3::interleaved_bloom_filter loaded{};
+        loaded.load(filename.get_path());
+        seqan3::interleaved_bloom_filter copy{loaded};
+        loaded.emplace(127, seqan3::bin_index{39u});
+        auto loaded_agent = loaded.membership_agent();
+        auto copy_agent = copy.membership_agent();
+        EXPECT_TRUE(loaded_agent.bulk_contains(127)[39]);
+        EXPECT_FALSE(copy_agent.bulk_contains(127)[39]);
+        EXPECT_TRUE(copy == ibf);
+
+        copy.clear(seqan3::bin_index{0u});
+        copy_agent = copy.membership_agent();
+        EXPECT_FALSE(copy_agent.bulk_contains(126)[0]);
+        seqan3::interleaved_bloom_filter reloaded{};
+        reloaded.load(filename.get_path());
+        EXPECT_TRUE(reloaded == ibf);
+    }
+
+    // Resizing copies the bitvector of a loaded filter.
+    seqan3::interleaved_bloom_filter loaded{};
+    loaded.load(filename.get_path());
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed> from_loaded{loaded};
+    EXPECT_TRUE(from_loaded == seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>{ibf});
+
+    loaded.increase_bin_number_to(seqan3::bin_count{73u});
+    ibf.increase_bin_number_to(seqan3::bin_count{73u});
+    EXPECT_TRUE(loaded == ibf);
+    loaded.emplace(127, seqan3::bin_index{72u});
+    auto agent = loaded.membership_agent();
+    EXPECT_TRUE(agent.bulk_contains(127)[72]);
+}
+
+TEST(interleaved_bloom_filter_test, load_corrupt_header)
+{
+    seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{40u}, seqan3::bin_size{1024u}};
+    seqan3::test::tmp_filename filename{"filter.ibf"};
+
+    // Overwrites the 64 bit header field at the given offset of a valid file.
+    auto store_with_field = [&] (std::streamoff const offset, uint64_t const value)
+    {
+        ibf.store(filename.get_path());
+        std::fstream file{filename.get_path(), std::ios::in | std::ios::out | std::ios::binary};
+        file.seekp(offset);
+        file.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    };
+
+    seqan3::interleaved_bloom_filter loaded{};
+    store_with_field(16, 65u); // bins > technical bins
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(16, 0u); // no bins
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(24, 65u); // technical bins not a multiple of 64
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(24, uint64_t{1u} << 60); // payload size overflows
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(32, 0u); // empty bins
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(32, 2048u); // payload too small
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(48, 0u); // no hash functions
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(48, 6u); // too many hash functions
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+
+    store_with_field(48, 2u); // valid
+    EXPECT_NO_THROW(loaded.load(filename.get_path()));
+    EXPECT_TRUE(loaded == ibf);
+}
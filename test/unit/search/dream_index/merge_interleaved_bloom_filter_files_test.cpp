@@ -0,0 +1,144 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <vector>
+
+#include <seqan3/search/dream_index/merge_interleaved_bloom_filter_files.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+struct merge_interleaved_bloom_filter_files_test : public ::testing::Test
+{
+    seqan3::test::tmp_filename filename1{"filter1.ibf"};
+    seqan3::test::tmp_filename filename2{"filter2.ibf"};
+    seqan3::test::tmp_filename filename3{"filter3.ibf"};
+    seqan3::test::tmp_filename output{"merged.ibf"};
+
+    // Creates a filter with `bins` bins that contains the values of part `part`.
+    static seqan3::interleaved_bloom_filter<> make_ibf(size_t const bins, size_t const part)
+    {
+        seqan3::interleaved_bloom_filter ibf{seqan3::bin_count{bins}, seqan3::bin_size{1u << 15}};
+        fill(ibf, bins, part, 0u);
+        return ibf;
+    }
+
+    // Inserts the values of part `part` into the bins [first_bin, first_bin + bins) of `ibf`.
+    static void fill(seqan3::interleaved_bloom_filter<> & ibf,
+                     size_t const bins,
+                     size_t const part,
+                     size_t const first_bin)
+    {
+        for (size_t bin = 0; bin < bins; ++bin)
+            for (size_t hash = part * 10'000u + bin; hash < part * 10'000u + 3'000u; hash += 1 + bin % 7)
+                ibf.emplace(hash, seqan3::bin_index{first_bin + bin});
+    }
+
+    static seqan3::interleaved_bloom_filter<> load(std::filesystem::path const & path)
+    {
+        seqan3::interleaved_bloom_filter ibf{};
+        ibf.load(path);
+        return ibf;
+    }
+};
+
+TEST_F(merge_interleaved_bloom_filter_files_test, unite_bins)
+{
+    make_ibf(100u, 0u).store(filename1.get_path());
+    make_ibf(100u, 1u).store(filename2.get_path());
+    make_ibf(100u, 2u).store(filename3.get_path());
+
+    seqan3::interleaved_bloom_filter expected{seqan3::bin_count{100u}, seqan3::bin_size{1u << 15}};
+    fill(expected, 100u, 0u, 0u);
+    fill(expected, 100u, 1u, 0u);
+    fill(expected, 100u, 2u, 0u);
+
+    seqan3::merge_interleaved_bloom_filter_files({filename1.get_path(), filename2.get_path(), filename3.get_path()},
+                                                 output.get_path(),
+                                                 seqan3::merge_mode::unite_bins);
+    EXPECT_TRUE(load(output.get_path()) == expected);
+
+    seqan3::merge_interleaved_bloom_filter_files({filename1.get_path(), filename2.get_path(), filename3.get_path()},
+                                                 output.get_path(),
+                                                 seqan3::merge_mode::unite_bins,
+                                                 4u);
+    EXPECT_TRUE(load(output.get_path()) == expected);
+}
+
+TEST_F(merge_interleaved_bloom_filter_files_test, append_bins)
+{
+    make_ibf(60u, 0u).store(filename1.get_path());
+    make_ibf(70u, 1u).store(filename2.get_path());
+    make_ibf(5u, 2u).store(filename3.get_path());
+
+    seqan3::interleaved_bloom_filter expected{seqan3::bin_count{135u}, seqan3::bin_size{1u << 15}};
+    fill(expected, 60u, 0u, 0u);
+    fill(expected, 70u, 1u, 60u);
+    fill(expected, 5u, 2u, 130u);
+
+    seqan3::merge_interleaved_bloom_filter_files({filename1.get_path(), filename2.get_path(), filename3.get_path()},
+                                                 output.get_path(),
+                                                 seqan3::merge_mode::append_bins,
+                                                 3u);
+    seqan3::interleaved_bloom_filter merged{load(output.get_path())};
+    EXPECT_EQ(merged.bin_count(), 135u);
+    EXPECT_TRUE(merged == expected);
+
+    // The same as merging the loaded filters.
+    seqan3::interleaved_bloom_filter ibf{load(filename1.get_path())};
+    ibf.merge(load(filename2.get_path()), seqan3::merge_mode::append_bins);
+    ibf.merge(load(filename3.get_path()), seqan3::merge_mode::append_bins);
+    EXPECT_TRUE(ibf == merged);
+}
+
+TEST_F(merge_interleaved_bloom_filter_files_test, errors)
+{
+    make_ibf(64u, 0u).store(filename1.get_path());
+    make_ibf(65u, 1u).store(filename2.get_path());
+
+    // No input.
+    EXPECT_THROW(seqan3::merge_interleaved_bloom_filter_files({}, output.get_path(), seqan3::merge_mode::unite_bins),
+                 std::invalid_argument);
+
+    // The output is an input.
+    EXPECT_THROW(seqan3::merge_interleaved_bloom_filter_files({filename1.get_path()},
+                                                              filename1.get_path(),
+                                                              seqan3::merge_mode::unite_bins),
+                 std::invalid_argument);
+    EXPECT_TRUE(load(filename1.get_path()) == make_ibf(64u, 0u));
+
+    // Different number of bins.
+    EXPECT_THROW(seqan3::merge_interleaved_bloom_filter_files({filename1.get_path(), filename2.get_path()},
+                                                              output.get_path(),
+                                                              seqan3::merge_mode::unite_bins),
+                 std::invalid_argument);
+
+    // Different bin size.
+    seqan3::interleaved_bloom_filter{seqan3::bin_count{64u}, seqan3::bin_size{1024u}}.store(filename2.get_path());
+    EXPECT_THROW(seqan3::merge_interleaved_bloom_filter_files({filename1.get_path(), filename2.get_path()},
+                                                              output.get_path(),
+                                                              seqan3::merge_mode::append_bins),
+                 std::invalid_argument);
+
+    // A compressed filter.
+    seqan3::interleaved_bloom_filter<seqan3::data_layout::compressed>{make_ibf(64u, 1u)}.store(filename2.get_path());
+    EXPECT_THROW(seqan3::merge_interleaved_bloom_filter_files({filename1.get_path(), filename2.get_path()},
+                                                              output.get_path(),
+                                                              seqan3::merge_mode::append_bins),
+                 std::logic_error);
+
+    // Not a filter.
+    {
+        std::ofstream out{filename2.get_path()};
+        out << "This is not a filter.";
+    }
+    EXPECT_THROW(seqan3::merge_interleaved_bloom_filter_files({filename1.get_path(), filename2.get_path()},
+                                                              output.get_path(),
+                                                              seqan3::merge_mode::append_bins),
+                 std::runtime_error);
+}
@@ -16,3 +16,23 @@ INSTANTIATE_TYPED_TEST_SUITE_P(dna4, fm_index_test, t1, );
 using t2 = std::pair<seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection>,
                      std::vector<seqan3::dna4_vector>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(dna4_collection, fm_index_collection_test, t2, );
+
+TEST(bi_fm_index_test, sa_sampling_rate)
+{
+    using seqan3::operator""_dna4;
+
+    seqan3::dna4_vector text{"ACGTACGTAAACGTTTACGAACGTGGACGTACGTACGTA"_dna4};
+
+    seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single> default_index{text};
+    seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single, seqan3::sdsl_full_sa_index_type> full_index{text};
+
+    EXPECT_EQ(full_index.sa_sampling_rate, 1u);
+    EXPECT_EQ(full_index.expected_locate_steps(), 0.0);
+    EXPECT_LT(default_index.size_in_bytes(), full_index.size_in_bytes());
+
+    auto default_cursor = default_index.cursor();
+    auto full_cursor = full_index.cursor();
+    EXPECT_TRUE(default_cursor.extend_left("CGTA"_dna4));
+    EXPECT_TRUE(full_cursor.extend_left("CGTA"_dna4));
+    EXPECT_EQ(default_cursor.locate(), full_cursor.locate());
+}
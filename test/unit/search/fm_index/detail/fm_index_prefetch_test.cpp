@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_prefetch.hpp>
+
+// The wavelet trees and rank supports below mimic the cereal save functions of the SDSL.
+template <typename value_t>
+struct name_value_pair
+{
+    char const * name;
+    value_t const & value;
+};
+
+// Two 64-bit words of counts per 512 bits, like sdsl::rank_support_v.
+struct bit_rank_support
+{
+    size_t bits{};
+    std::vector<uint64_t> basic_block = std::vector<uint64_t>(2u * (bits / 512u + 1u));
+
+    size_t rank(size_t) const { return 0u; }
+    size_t size() const { return bits; }
+
+    template <typename archive_t>
+    void CEREAL_SAVE_FUNCTION_NAME(archive_t & archive) const
+    {
+        archive(name_value_pair<std::vector<uint64_t>>{"m_basic_block", basic_block});
+    }
+};
+
+struct bit_wavelet_tree
+{
+    size_t size{};
+    std::vector<uint64_t> bv = std::vector<uint64_t>(size / 64u + 1u);
+    bit_rank_support bv_rank{size};
+
+    template <typename archive_t>
+    void CEREAL_SAVE_FUNCTION_NAME(archive_t & archive) const
+    {
+        archive(name_value_pair<size_t>{"m_size", size}, name_value_pair<std::vector<uint64_t>>{"m_bv", bv});
+        archive(name_value_pair<bit_rank_support>{"m_bv_rank", bv_rank});
+    }
+};
+
+// One cache line per 128 characters, like the superblocks of sdsl::rank_support_int_v.
+struct alignas(64) superblock
+{
+    std::array<uint64_t, 8> data{};
+};
+
+struct epr_rank_support
+{
+    size_t text_size{};
+    size_t sigma{4u};
+    std::vector<superblock> superblocks = std::vector<superblock>(text_size / 128u + 1u);
+
+    size_t rank(size_t, uint64_t) const { return 0u; }
+    size_t size() const { return text_size; }
+
+    template <typename archive_t>
+    void CEREAL_SAVE_FUNCTION_NAME(archive_t & archive) const
+    {
+        archive(sigma); // without cereal, the SDSL passes the members without names
+        archive(superblocks);
+    }
+};
+
+struct epr_dictionary
+{
+    epr_rank_support rank_support;
+
+    template <typename archive_t>
+    void CEREAL_SAVE_FUNCTION_NAME(archive_t & archive) const
+    {
+        archive(rank_support);
+    }
+};
+
+struct no_save_wavelet_tree
+{
+    bit_rank_support bv_rank{1000u};
+};
+
+TEST(fm_index_rank_block, bit_rank_support)
+{
+    bit_wavelet_tree wavelet_tree{10'000u};
+    char const * blocks = reinterpret_cast<char const *>(wavelet_tree.bv_rank.basic_block.data());
+
+    for (size_t position : {0u, 511u, 512u, 5'000u, 9'999u})
+    {
+        // Within the block or the next one, since the position is interpolated.
+        std::ptrdiff_t const offset = static_cast<char const *>(seqan3::detail::fm_index_rank_block(wavelet_tree,
+                                                                                                   position)) - blocks;
+        EXPECT_GE(offset, 16 * static_cast<std::ptrdiff_t>(position / 512u)) << position;
+        EXPECT_LT(offset, 16 * static_cast<std::ptrdiff_t>(position / 512u + 2u)) << position;
+    }
+}
+
+TEST(fm_index_rank_block, epr_rank_support)
+{
+    epr_dictionary epr{epr_rank_support{100'000u}};
+    char const * blocks = reinterpret_cast<char const *>(epr.rank_support.superblocks.data());
+
+    for (size_t position : {0u, 127u, 128u, 50'000u, 99'999u})
+    {
+        // Within the superblock or the next one, since the position is interpolated.
+        char const * block = static_cast<char const *>(seqan3::detail::fm_index_rank_block(epr, position));
+        EXPECT_GE(block - blocks, 64 * static_cast<std::ptrdiff_t>(position / 128u)) << position;
+        EXPECT_LT(block - blocks, 64 * static_cast<std::ptrdiff_t>(position / 128u + 2u)) << position;
+    }
+}
+
+TEST(fm_index_rank_block, no_rank_support)
+{
+    EXPECT_EQ(seqan3::detail::fm_index_rank_block(no_save_wavelet_tree{}, 0u), nullptr);
+    EXPECT_EQ(seqan3::detail::fm_index_rank_block(bit_wavelet_tree{0u}, 0u), nullptr); // empty vector
+}
+
+TEST(fm_index_prefetch_rank, sdsl_index)
+{
+    sdsl::int_vector<8> text(1000u);
+    for (size_t i = 0; i < text.size(); ++i)
+        text[i] = 1u + (i * 7u + i / 13u) % 4u;
+
+    seqan3::default_sdsl_index_type csa{};
+    sdsl::construct_im(csa, text, 0);
+
+    // Only a hint; must not access memory outside of the index.
+    for (size_t position = 0; position <= csa.size(); ++position)
+        seqan3::detail::fm_index_prefetch_rank(csa, position);
+}
@@ -13,6 +13,7 @@
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_directory.hpp>
 
 template <typename T>
 class fm_index_collection_test : public ::testing::Test
@@ -144,4 +145,77 @@ TYPED_TEST_P(fm_index_collection_test, serialisation)
     seqan3::test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(fm_index_collection_test, ctr, swap, size, serialisation, empty_text);
+TYPED_TEST_P(fm_index_collection_test, construction_options)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+    using inner_text_type = std::ranges::range_value_t<text_t>;
+
+    text_t text{};
+    for (size_t length : {300u, 0u, 17u, 1000u, 64u, 129u})
+    {
+        inner_text_type inner_text(length);
+        for (size_t i = 0; i < length; ++i)
+            seqan3::assign_rank_to((i * 7 + i / 13 + length) % 4, inner_text[i]);
+        text.push_back(std::move(inner_text));
+    }
+
+    index_t expected{text};
+
+    seqan3::fm_index_construction_options options{};
+    options.thread_count = 4u;
+    EXPECT_EQ(expected, (index_t{text, options}));
+
+    // The memory limit is exceeded, hence the intermediate data is kept on disk.
+    seqan3::test::tmp_directory tmp{};
+    options.memory_limit = 0u;
+    options.tmp_directory = tmp.path();
+    index_t semi_external{text, options};
+    EXPECT_EQ(expected, semi_external);
+    EXPECT_TRUE(tmp.empty()); // intermediate files are removed
+
+    // Make sure rank and select support pointer are correct by using them.
+    auto it0 = expected.cursor();
+    it0.extend_right(inner_text_type(2));
+    auto it1 = semi_external.cursor();
+    it1.extend_right(inner_text_type(2));
+    EXPECT_EQ(it0.locate(), it1.locate());
+}
+
+TYPED_TEST_P(fm_index_collection_test, lookup_table)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+    using inner_text_type = std::ranges::range_value_t<text_t>;
+
+    text_t text{};
+    for (size_t length : {300u, 0u, 17u, 64u})
+    {
+        inner_text_type inner_text(length);
+        for (size_t i = 0; i < length; ++i)
+            seqan3::assign_rank_to((i * 7 + i / 13 + length) % 4, inner_text[i]);
+        text.push_back(std::move(inner_text));
+    }
+
+    index_t without_table{text};
+
+    seqan3::fm_index_construction_options options{};
+    options.lookup_table_depth = 2u;
+    options.thread_count = 2u;
+    index_t fm{text, options};
+    EXPECT_EQ(without_table, fm); // the lookup table is not compared
+    EXPECT_GT(fm.size_in_bytes(), without_table.size_in_bytes());
+    seqan3::test::do_serialisation(fm);
+
+    // Words do not span the delimiters between the texts.
+    for (inner_text_type const & query : text)
+    {
+        auto it0 = without_table.cursor();
+        auto it1 = fm.cursor();
+        EXPECT_EQ(it0.extend_right(query), it1.extend_right(query));
+        EXPECT_EQ(it0.locate(), it1.locate());
+    }
+}
+
+REGISTER_TYPED_TEST_SUITE_P(fm_index_collection_test, ctr, swap, size, serialisation, empty_text,
+                            construction_options, lookup_table);
@@ -19,6 +19,51 @@ INSTANTIATE_TYPED_TEST_SUITE_P(dna4_collection, fm_index_collection_test, t2, );
 TEST(fm_index_test, additional_concepts)
 {
     EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::default_sdsl_index_type>);
+    EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::sdsl_wt_sampled_index_type<4>>);
+    EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::sdsl_full_sa_index_type>);
+    EXPECT_TRUE(seqan3::detail::sdsl_index<seqan3::sdsl_epr_index_type<seqan3::dna4>>);
+}
+
+TEST(fm_index_test, sa_sampling_rate)
+{
+    using seqan3::operator""_dna4;
+
+    std::vector<seqan3::dna4_vector> text{"ACGTACGTAAACGTTTACGAACGT"_dna4, "GGACGTACGTACGTA"_dna4};
+
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection> default_index{text};
+    seqan3::fm_index<seqan3::dna4,
+                     seqan3::text_layout::collection,
+                     seqan3::sdsl_wt_sampled_index_type<3>> sampled_index{text};
+    seqan3::fm_index<seqan3::dna4,
+                     seqan3::text_layout::collection,
+                     seqan3::sdsl_full_sa_index_type> full_index{text};
+
+    EXPECT_EQ(default_index.sa_sampling_rate, 16u);
+    EXPECT_EQ(sampled_index.sa_sampling_rate, 3u);
+    EXPECT_EQ(full_index.sa_sampling_rate, 1u);
+
+    EXPECT_EQ(default_index.expected_locate_steps(), 15.0);
+    EXPECT_EQ(sampled_index.expected_locate_steps(), 2.0);
+    EXPECT_EQ(full_index.expected_locate_steps(), 0.0);
+
+    EXPECT_GT(default_index.size_in_bytes(), 0u);
+    EXPECT_LE(default_index.size_in_bytes(), sampled_index.size_in_bytes());
+    EXPECT_LT(sampled_index.size_in_bytes(), full_index.size_in_bytes());
+
+    // All indices locate the same occurrences.
+    for (auto const & query : {"ACGT"_dna4, "A"_dna4, "GTA"_dna4})
+    {
+        auto default_cursor = default_index.cursor();
+        auto sampled_cursor = sampled_index.cursor();
+        auto full_cursor = full_index.cursor();
+        EXPECT_TRUE(default_cursor.extend_right(query));
+        EXPECT_TRUE(sampled_cursor.extend_right(query));
+        EXPECT_TRUE(full_cursor.extend_right(query));
+
+        auto expected = default_cursor.locate();
+        EXPECT_EQ(expected, sampled_cursor.locate());
+        EXPECT_EQ(expected, full_cursor.locate());
+    }
 }
 
 TEST(fm_index_test, cerealisation_errors)
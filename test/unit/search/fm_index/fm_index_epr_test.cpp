@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna16sam.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream/tuple.hpp>
+#include <seqan3/search/fm_index/bi_fm_index.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/utility/views/slice.hpp>
+#include <seqan3/utility/views/to.hpp>
+
+#include "../helper.hpp"
+
+template <typename alphabet_t>
+class fm_index_epr_test : public ::testing::Test
+{
+public:
+    // Every symbol of the alphabet occurs in the text; the collection additionally contains a delimiter. Hence, the
+    // EPR dictionary has to represent alphabet_size + 2 symbols.
+    std::vector<alphabet_t> text{[] ()
+    {
+        std::vector<alphabet_t> text{};
+        for (size_t rank = 0; rank < seqan3::alphabet_size<alphabet_t>; ++rank)
+            for (size_t repeat = 0; repeat <= rank % 3u; ++repeat)
+                text.push_back(seqan3::assign_rank_to(rank, alphabet_t{}));
+        return text;
+    }()};
+
+    std::vector<std::vector<alphabet_t>> collection{text, text | std::views::reverse | seqan3::views::to<std::vector>};
+};
+
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna15, seqan3::dna16sam>;
+TYPED_TEST_SUITE(fm_index_epr_test, alphabet_types, );
+
+// Compares the occurrences of all infixes of length 1 to 3 of the text found by both indices.
+template <typename index_t, typename epr_index_t, typename text_t>
+void expect_same_occurrences(index_t const & index, epr_index_t const & epr_index, text_t const & text)
+{
+    for (size_t begin = 0; begin < text.size(); ++begin)
+    {
+        for (size_t end = begin + 1; end <= std::min<size_t>(begin + 3, text.size()); ++end)
+        {
+            auto query = text | seqan3::views::slice(begin, end);
+
+            auto cursor = index.cursor();
+            auto epr_cursor = epr_index.cursor();
+            EXPECT_TRUE(cursor.extend_right(query));
+            EXPECT_TRUE(epr_cursor.extend_right(query));
+            EXPECT_RANGE_EQ(seqan3::uniquify(epr_cursor.locate()), seqan3::uniquify(cursor.locate()));
+        }
+    }
+}
+
+TYPED_TEST(fm_index_epr_test, single)
+{
+    using epr_index_type = seqan3::sdsl_epr_index_type<TypeParam>;
+
+    seqan3::fm_index<TypeParam, seqan3::text_layout::single> index{this->text};
+    seqan3::fm_index<TypeParam, seqan3::text_layout::single, epr_index_type> epr_index{this->text};
+    expect_same_occurrences(index, epr_index, this->text);
+
+    seqan3::bi_fm_index<TypeParam, seqan3::text_layout::single> bi_index{this->text};
+    seqan3::bi_fm_index<TypeParam, seqan3::text_layout::single, epr_index_type> epr_bi_index{this->text};
+    expect_same_occurrences(bi_index, epr_bi_index, this->text);
+}
+
+TYPED_TEST(fm_index_epr_test, collection)
+{
+    using epr_index_type = seqan3::sdsl_epr_index_type<TypeParam>;
+
+    seqan3::fm_index<TypeParam, seqan3::text_layout::collection> index{this->collection};
+    seqan3::fm_index<TypeParam, seqan3::text_layout::collection, epr_index_type> epr_index{this->collection};
+    expect_same_occurrences(index, epr_index, this->text);
+
+    seqan3::bi_fm_index<TypeParam, seqan3::text_layout::collection> bi_index{this->collection};
+    seqan3::bi_fm_index<TypeParam, seqan3::text_layout::collection, epr_index_type> epr_bi_index{this->collection};
+    expect_same_occurrences(bi_index, epr_bi_index, this->text);
+}
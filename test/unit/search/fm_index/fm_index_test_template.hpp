@@ -12,6 +12,7 @@
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_directory.hpp>
 
 template <typename T>
 class fm_index_test : public ::testing::Test
@@ -107,4 +108,56 @@ TYPED_TEST_P(fm_index_test, serialisation)
     seqan3::test::do_serialisation(fm);
 }
 
-REGISTER_TYPED_TEST_SUITE_P(fm_index_test, ctr, swap, size, empty_text, serialisation);
+TYPED_TEST_P(fm_index_test, construction_options)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+
+    text_t text(1000);
+    for (size_t i = 0; i < text.size(); ++i)
+        seqan3::assign_rank_to((i * 7 + i / 13) % 4, text[i]);
+
+    index_t expected{text};
+
+    seqan3::fm_index_construction_options options{};
+    options.thread_count = 4u;
+    EXPECT_EQ(expected, (index_t{text, options}));
+
+    // The memory limit is exceeded, hence the intermediate data is kept on disk.
+    seqan3::test::tmp_directory tmp{};
+    options.memory_limit = 0u;
+    options.tmp_directory = tmp.path();
+    EXPECT_EQ(expected, (index_t{text, options}));
+    EXPECT_TRUE(tmp.empty()); // intermediate files are removed
+    EXPECT_EQ(sdsl::construct_config::byte_algo_sa, sdsl::LIBDIVSUFSORT); // the in-memory suffix sorter is restored
+
+    options.thread_count = 1u;
+    EXPECT_EQ(expected, (index_t{text, options}));
+    EXPECT_TRUE(tmp.empty());
+}
+
+TYPED_TEST_P(fm_index_test, lookup_table)
+{
+    using index_t = typename TypeParam::first_type;
+    using text_t = typename TypeParam::second_type;
+
+    text_t text(1000);
+    for (size_t i = 0; i < text.size(); ++i)
+        seqan3::assign_rank_to((i * 7 + i / 13) % 4, text[i]);
+
+    index_t without_table{text};
+
+    seqan3::fm_index_construction_options options{};
+    options.lookup_table_depth = 2u;
+    index_t fm{text, options};
+    EXPECT_EQ(without_table, fm); // the lookup table is not compared
+    EXPECT_GT(fm.size_in_bytes(), without_table.size_in_bytes());
+    seqan3::test::do_serialisation(fm);
+
+    // The number of words exceeds the addressable memory.
+    options.lookup_table_depth = 100u;
+    EXPECT_THROW((index_t{text, options}), std::invalid_argument);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(fm_index_test, ctr, swap, size, empty_text, serialisation, construction_options,
+                            lookup_table);
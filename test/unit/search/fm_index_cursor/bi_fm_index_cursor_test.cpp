@@ -50,3 +50,9 @@ INSTANTIATE_TYPED_TEST_SUITE_P(dna5, bi_fm_index_cursor_test, it_t2, );
 // char
 using it_t3 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<char, seqan3::text_layout::single>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(char, bi_fm_index_cursor_test, it_t3, );
+
+// EPR dictionary
+using it_t4 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna5,
+                                                             seqan3::text_layout::single,
+                                                             seqan3::sdsl_epr_index_type<seqan3::dna5>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(dna5_epr, bi_fm_index_cursor_test, it_t4, );
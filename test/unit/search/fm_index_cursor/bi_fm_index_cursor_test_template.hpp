@@ -195,5 +195,135 @@ TYPED_TEST_P(bi_fm_index_cursor_test, serialisation)
     seqan3::test::do_serialisation(it);
 }
 
+TYPED_TEST_P(bi_fm_index_cursor_test, lookup_table)
+{
+    using index_t = typename TypeParam::index_type;
+    index_t bi_fm{this->text}; // "ACGGTAGGACGTAGC"
+
+    seqan3::fm_index_construction_options options{};
+    options.lookup_table_depth = 3u;
+    index_t bi_fm_lookup{this->text, options};
+    EXPECT_TRUE(bi_fm == bi_fm_lookup);
+
+    // All infixes of "AACGATCGGA", some of them do not occur in the text.
+    for (size_t begin = 0; begin < this->text1.size(); ++begin)
+    {
+        for (size_t end = begin + 1; end <= this->text1.size(); ++end)
+        {
+            auto query = seqan3::views::slice(this->text1, begin, end);
+
+            // Extending to the left looks up the suffix of the query.
+            TypeParam it(bi_fm);
+            TypeParam it_lookup(bi_fm_lookup);
+            EXPECT_EQ(it.extend_left(query), it_lookup.extend_left(query));
+            EXPECT_EQ(it, it_lookup);
+            EXPECT_EQ(seqan3::uniquify(it.locate()), seqan3::uniquify(it_lookup.locate()));
+
+            if (it.query_length() > 0u)
+            {
+                EXPECT_EQ(it.last_rank(), it_lookup.last_rank());
+                EXPECT_EQ(it.cycle_front(), it_lookup.cycle_front());
+                EXPECT_EQ(it, it_lookup);
+                EXPECT_EQ(seqan3::uniquify(it.locate()), seqan3::uniquify(it_lookup.locate()));
+            }
+
+            // Extending to the right looks up the prefix of the query, extending to the left afterwards needs the
+            // interval in the index of the reversed text.
+            it = TypeParam(bi_fm);
+            it_lookup = TypeParam(bi_fm_lookup);
+            EXPECT_EQ(it.extend_right(query), it_lookup.extend_right(query));
+            EXPECT_EQ(it.extend_left(), it_lookup.extend_left());
+            EXPECT_EQ(it, it_lookup);
+            EXPECT_EQ(seqan3::uniquify(it.locate()), seqan3::uniquify(it_lookup.locate()));
+        }
+    }
+}
+
+TYPED_TEST_P(bi_fm_index_cursor_test, lookup_table_backtracking)
+{
+    using index_t = typename TypeParam::index_type;
+    index_t bi_fm{this->text}; // "ACGGTAGGACGTAGC"
+
+    seqan3::fm_index_construction_options options{};
+    options.lookup_table_depth = 2u;
+    index_t bi_fm_lookup{this->text, options};
+
+    // Enumerates the occurrences of all words of length 3, alternately extending to the right and to the left. With
+    // the lookup table, the first two levels are looked up instead of searched.
+    auto enumerate = [] (auto & self, TypeParam it, std::vector<std::vector<std::pair<uint64_t, uint64_t>>> & occurrences) -> void
+    {
+        if (it.query_length() == 3u)
+        {
+            occurrences.push_back(seqan3::uniquify(it.locate()));
+            return;
+        }
+
+        if (it.query_length() % 2u == 0u)
+        {
+            if (!it.extend_right())
+                return;
+
+            do
+            {
+                occurrences.push_back({{it.last_rank(), it.count()}});
+                self(self, it, occurrences);
+            }
+            while (it.cycle_back());
+        }
+        else
+        {
+            if (!it.extend_left())
+                return;
+
+            do
+            {
+                occurrences.push_back({{it.last_rank(), it.count()}});
+                self(self, it, occurrences);
+            }
+            while (it.cycle_front());
+        }
+    };
+
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> expected{};
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> occurrences{};
+    enumerate(enumerate, TypeParam(bi_fm), expected);
+    enumerate(enumerate, TypeParam(bi_fm_lookup), occurrences);
+    EXPECT_EQ(occurrences, expected);
+
+    // Extending character by character in both directions starts with lookups and continues with search steps.
+    for (size_t begin = 0; begin < this->text1.size(); ++begin)
+    {
+        TypeParam it(bi_fm);
+        TypeParam it_lookup(bi_fm_lookup);
+        bool to_the_right{true};
+        for (auto c : seqan3::views::slice(this->text1, begin, this->text1.size()))
+        {
+            if (to_the_right)
+                EXPECT_EQ(it.extend_right(c), it_lookup.extend_right(c));
+            else
+                EXPECT_EQ(it.extend_left(c), it_lookup.extend_left(c));
+
+            EXPECT_EQ(it, it_lookup);
+            to_the_right = !to_the_right;
+        }
+
+        // Extending a cursor inside the table by a range looks up the characters up to the depth of the table.
+        it = TypeParam(bi_fm);
+        it_lookup = TypeParam(bi_fm_lookup);
+        auto query = seqan3::views::slice(this->text1, begin, this->text1.size());
+        EXPECT_EQ(it.extend_left(query | seqan3::views::slice(query.size() - 1, query.size())),
+                  it_lookup.extend_left(query | seqan3::views::slice(query.size() - 1, query.size())));
+        EXPECT_EQ(it.extend_left(query | seqan3::views::slice(0, query.size() - 1)),
+                  it_lookup.extend_left(query | seqan3::views::slice(0, query.size() - 1)));
+        EXPECT_EQ(it, it_lookup);
+        if (it.query_length() > 0u)
+        {
+            EXPECT_EQ(it.cycle_front(), it_lookup.cycle_front());
+            EXPECT_EQ(it, it_lookup);
+        }
+    }
+}
+
 REGISTER_TYPED_TEST_SUITE_P(bi_fm_index_cursor_test, cursor, extend, extend_char, extend_range, extend_and_cycle,
-                            extend_range_and_cycle, to_fwd_cursor, serialisation);
+                            extend_range_and_cycle, to_fwd_cursor, serialisation, lookup_table,
+                            lookup_table_backtracking);
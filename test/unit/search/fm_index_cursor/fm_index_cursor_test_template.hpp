@@ -356,6 +356,112 @@ TYPED_TEST_P(fm_index_cursor_test, serialisation)
     seqan3::test::do_serialisation(it);
 }
 
+TYPED_TEST_P(fm_index_cursor_test, lookup_table)
+{
+    using index_t = typename TypeParam::index_type;
+    index_t fm{this->text2}; // "ACGAACGC"
+
+    for (size_t depth : {1u, 2u, 3u})
+    {
+        seqan3::fm_index_construction_options options{};
+        options.lookup_table_depth = depth;
+        options.thread_count = 2u;
+        index_t fm_lookup{this->text2, options};
+        EXPECT_TRUE(fm == fm_lookup);
+        EXPECT_GT(fm_lookup.size_in_bytes(), fm.size_in_bytes());
+
+        // All infixes of "ACGACG", some of them do not occur in the text.
+        for (size_t begin = 0; begin < this->text1.size(); ++begin)
+        {
+            for (size_t end = begin + 1; end <= this->text1.size(); ++end)
+            {
+                auto query = seqan3::views::slice(this->text1, begin, end);
+                TypeParam it(fm);
+                TypeParam it_lookup(fm_lookup);
+
+                EXPECT_EQ(it.extend_right(query), it_lookup.extend_right(query));
+                EXPECT_EQ(it, it_lookup);
+                EXPECT_EQ(seqan3::uniquify(it.locate()), seqan3::uniquify(it_lookup.locate()));
+
+                if (it.query_length() == 0u)
+                    continue;
+
+                EXPECT_EQ(it.last_rank(), it_lookup.last_rank());
+                EXPECT_EQ(it.cycle_back(), it_lookup.cycle_back());
+                EXPECT_EQ(it, it_lookup);
+            }
+        }
+    }
+}
+
+TYPED_TEST_P(fm_index_cursor_test, lookup_table_backtracking)
+{
+    using index_t = typename TypeParam::index_type;
+    index_t fm{this->text2}; // "ACGAACGC"
+
+    seqan3::fm_index_construction_options options{};
+    options.lookup_table_depth = 2u;
+    index_t fm_lookup{this->text2, options};
+
+    // Enumerates the occurrences of all words of length 3 with extend_right() and cycle_back(). With the lookup table,
+    // the first two levels are looked up instead of searched.
+    auto enumerate = [] (auto & self, TypeParam it, std::vector<std::vector<std::pair<uint64_t, uint64_t>>> & occurrences) -> void
+    {
+        if (it.query_length() == 3u)
+        {
+            occurrences.push_back(seqan3::uniquify(it.locate()));
+            return;
+        }
+
+        if (!it.extend_right())
+            return;
+
+        do
+        {
+            occurrences.push_back({{it.last_rank(), it.count()}});
+            self(self, it, occurrences);
+        }
+        while (it.cycle_back());
+    };
+
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> expected{};
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> occurrences{};
+    enumerate(enumerate, TypeParam(fm), expected);
+    enumerate(enumerate, TypeParam(fm_lookup), occurrences);
+    EXPECT_EQ(occurrences, expected);
+
+    // Extending character by character starts with lookups and continues with backward search steps.
+    for (size_t begin = 0; begin < this->text1.size(); ++begin)
+    {
+        TypeParam it(fm);
+        TypeParam it_lookup(fm_lookup);
+        for (auto c : seqan3::views::slice(this->text1, begin, this->text1.size()))
+        {
+            EXPECT_EQ(it.extend_right(c), it_lookup.extend_right(c));
+            EXPECT_EQ(it, it_lookup);
+        }
+
+        if (begin + 1u == this->text1.size())
+            continue;
+
+        // Extending a cursor inside the table by a range looks up the characters up to the depth of the table.
+        it = TypeParam(fm);
+        it_lookup = TypeParam(fm_lookup);
+        auto query = seqan3::views::slice(this->text1, begin, this->text1.size());
+        EXPECT_EQ(it.extend_right(query | seqan3::views::slice(0, 1)),
+                  it_lookup.extend_right(query | seqan3::views::slice(0, 1)));
+        EXPECT_EQ(it.extend_right(query | seqan3::views::slice(1, query.size())),
+                  it_lookup.extend_right(query | seqan3::views::slice(1, query.size())));
+        EXPECT_EQ(it, it_lookup);
+        if (it.query_length() > 0u)
+        {
+            EXPECT_EQ(it.cycle_back(), it_lookup.cycle_back());
+            EXPECT_EQ(it, it_lookup);
+        }
+    }
+}
+
 REGISTER_TYPED_TEST_SUITE_P(fm_index_cursor_test, ctr, begin, extend_right_range, extend_right_char,
                             extend_right_range_and_cycle, extend_right_char_and_cycle, extend_right_and_cycle, query,
-                            last_rank, incomplete_alphabet, lazy_locate, serialisation);
+                            last_rank, incomplete_alphabet, lazy_locate, serialisation, lookup_table,
+                            lookup_table_backtracking);
@@ -14,6 +14,7 @@
 #include <seqan3/core/debug_stream/debug_stream_type.hpp>
 #include <seqan3/search/fm_index/bi_fm_index_cursor.hpp>
 #include <seqan3/search/fm_index/fm_index_cursor.hpp>
+#include <seqan3/search/kmer_index/kmer_index_cursor.hpp>
 #include <seqan3/utility/views/to.hpp>
 
 namespace seqan3
@@ -32,6 +33,13 @@ inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & s,
     return s << ("bi_fm_index_cursor");
 }
 
+template <typename char_t, typename index_t>
+inline debug_stream_type<char_t> & operator<<(debug_stream_type<char_t> & s,
+                                              seqan3::kmer_index_cursor<index_t> const &)
+{
+    return s << ("kmer_index_cursor");
+}
+
 template <typename result_range_t>
 std::vector<std::ranges::range_value_t<result_range_t>> uniquify(result_range_t && result_range)
 {
@@ -0,0 +1,170 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using seqan3::operator""_dna4;
+using seqan3::operator""_shape;
+
+using single_index_t = seqan3::kmer_index<seqan3::dna4, seqan3::text_layout::single>;
+using collection_index_t = seqan3::kmer_index<seqan3::dna4, seqan3::text_layout::collection>;
+using locate_result_t = std::vector<std::pair<size_t, size_t>>;
+
+seqan3::kmer_index_construction_options hash_table_options()
+{
+    seqan3::kmer_index_construction_options options{};
+    options.direct_addressing_limit = 0u;
+    return options;
+}
+
+TEST(kmer_index_test, ctr)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+
+    single_index_t index{text, seqan3::ungapped{3}};
+    EXPECT_EQ(index.size(), 12u);
+    EXPECT_FALSE(index.empty());
+    EXPECT_TRUE(index.uses_direct_addressing());
+    EXPECT_EQ(index.shape(), seqan3::shape{seqan3::ungapped{3}});
+
+    single_index_t index2{index};
+    EXPECT_EQ(index, index2);
+
+    single_index_t index3{std::move(index2)};
+    EXPECT_EQ(index, index3);
+
+    seqan3::kmer_index deduced{text, seqan3::ungapped{3}};
+    EXPECT_TRUE((std::same_as<decltype(deduced), single_index_t>));
+
+    std::vector<seqan3::dna4_vector> texts{"ACGT"_dna4};
+    seqan3::kmer_index deduced_collection{texts, seqan3::ungapped{3}};
+    EXPECT_TRUE((std::same_as<decltype(deduced_collection), collection_index_t>));
+
+    EXPECT_TRUE(single_index_t{}.empty());
+}
+
+TEST(kmer_index_test, invalid_shape)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+
+    EXPECT_THROW((single_index_t{text, seqan3::ungapped{33}}), std::invalid_argument);
+}
+
+TEST(kmer_index_test, lookup)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+
+    for (auto const & options : {seqan3::kmer_index_construction_options{}, hash_table_options()})
+    {
+        single_index_t index{text, seqan3::ungapped{3}, options};
+        EXPECT_EQ(index.uses_direct_addressing(), options.direct_addressing_limit > 0u);
+
+        auto cursor = index.cursor();
+        EXPECT_EQ(cursor.count(), 0u);
+
+        EXPECT_TRUE(cursor.lookup("CGT"_dna4));
+        EXPECT_EQ(cursor.count(), 3u);
+        EXPECT_EQ(cursor.locate(), (locate_result_t{{0, 1}, {0, 5}, {0, 9}}));
+        EXPECT_TRUE(std::ranges::equal(cursor.lazy_locate(), locate_result_t{{0, 1}, {0, 5}, {0, 9}}));
+
+        // An unsuccessful lookup does not modify the cursor.
+        auto const copy = cursor;
+        EXPECT_FALSE(cursor.lookup("AAA"_dna4));
+        EXPECT_FALSE(cursor.lookup("CG"_dna4));
+        EXPECT_EQ(cursor, copy);
+
+        // Lookup by hash value (ACG = 0 * 16 + 1 * 4 + 2).
+        EXPECT_TRUE(cursor.lookup(size_t{6}));
+        EXPECT_EQ(cursor.locate(), (locate_result_t{{0, 0}, {0, 4}, {0, 8}}));
+        EXPECT_NE(cursor, copy);
+    }
+}
+
+TEST(kmer_index_test, gapped_shape)
+{
+    seqan3::dna4_vector text{"ACGTTCGA"_dna4};
+
+    for (auto const & options : {seqan3::kmer_index_construction_options{}, hash_table_options()})
+    {
+        single_index_t index{text, 0b101_shape, options};
+        auto cursor = index.cursor();
+
+        // The gap position is ignored: A?G matches ACG at position 0 and C?A matches CGA at position 5.
+        EXPECT_TRUE(cursor.lookup("AAG"_dna4));
+        EXPECT_EQ(cursor.locate(), (locate_result_t{{0, 0}}));
+        EXPECT_TRUE(cursor.lookup("CTA"_dna4));
+        EXPECT_EQ(cursor.locate(), (locate_result_t{{0, 5}}));
+        EXPECT_FALSE(cursor.lookup("AAA"_dna4));
+    }
+}
+
+TEST(kmer_index_test, collection)
+{
+    std::vector<seqan3::dna4_vector> texts{"ACGTACGT"_dna4, "AC"_dna4, ""_dna4, "TTACGA"_dna4};
+
+    for (auto const & options : {seqan3::kmer_index_construction_options{}, hash_table_options()})
+    {
+        collection_index_t index{texts, seqan3::ungapped{3}, options};
+        EXPECT_EQ(index.size(), 16u);
+
+        auto cursor = index.cursor();
+        EXPECT_TRUE(cursor.lookup("ACG"_dna4));
+        EXPECT_EQ(cursor.locate(), (locate_result_t{{0, 0}, {0, 4}, {3, 2}}));
+
+        // k-mers do not span two texts.
+        EXPECT_TRUE(cursor.lookup("GTA"_dna4));
+        EXPECT_EQ(cursor.locate(), (locate_result_t{{0, 2}}));
+        EXPECT_FALSE(cursor.lookup("CTT"_dna4));
+        EXPECT_FALSE(cursor.lookup("GTT"_dna4));
+    }
+}
+
+TEST(kmer_index_test, layouts_and_threads)
+{
+    seqan3::dna4_vector text = seqan3::test::generate_sequence<seqan3::dna4>(10'000, 0, 0);
+
+    single_index_t direct{text, seqan3::ungapped{6}};
+    single_index_t hashed{text, seqan3::ungapped{6}, hash_table_options()};
+
+    seqan3::kmer_index_construction_options parallel_options{};
+    parallel_options.thread_count = 4u;
+    EXPECT_EQ(direct, (single_index_t{text, seqan3::ungapped{6}, parallel_options}));
+
+    parallel_options.direct_addressing_limit = 0u;
+    EXPECT_EQ(hashed, (single_index_t{text, seqan3::ungapped{6}, parallel_options}));
+
+    auto direct_cursor = direct.cursor();
+    auto hashed_cursor = hashed.cursor();
+    for (size_t i = 0; i + 6 <= text.size(); i += 97)
+    {
+        auto kmer = text | std::views::drop(i) | std::views::take(6);
+        EXPECT_TRUE(direct_cursor.lookup(kmer));
+        EXPECT_TRUE(hashed_cursor.lookup(kmer));
+        auto const occurrences = direct_cursor.locate();
+        EXPECT_EQ(occurrences, hashed_cursor.locate());
+        EXPECT_TRUE(std::ranges::find(occurrences, std::pair<size_t, size_t>{0, i}) != occurrences.end());
+    }
+}
+
+TEST(kmer_index_test, serialisation)
+{
+    std::vector<seqan3::dna4_vector> texts{"ACGTACGT"_dna4, "TTACGA"_dna4};
+
+    collection_index_t direct{texts, seqan3::ungapped{3}};
+    seqan3::test::do_serialisation(direct);
+
+    collection_index_t hashed{texts, seqan3::ungapped{3}, hash_table_options()};
+    seqan3::test::do_serialisation(hashed);
+}
@@ -60,7 +60,10 @@ public:
 };
 
 using fm_index_types        = ::testing::Types<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::collection>,
-                                               seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection>>;
+                                               seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::collection>,
+                                               seqan3::bi_fm_index<seqan3::dna4,
+                                                                   seqan3::text_layout::collection,
+                                                                   seqan3::sdsl_epr_index_type<seqan3::dna4>>>;
 using fm_index_string_types = ::testing::Types<seqan3::fm_index<char, seqan3::text_layout::collection>,
                                                seqan3::bi_fm_index<char, seqan3::text_layout::collection>>;
 
@@ -0,0 +1,153 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/detail/persist_view.hpp>
+#include <seqan3/search/configuration/batch.hpp>
+#include <seqan3/search/configuration/hit.hpp>
+#include <seqan3/search/configuration/max_error.hpp>
+#include <seqan3/search/configuration/output.hpp>
+#include <seqan3/search/kmer_index/kmer_index.hpp>
+#include <seqan3/search/search.hpp>
+#include <seqan3/test/expect_range_eq.hpp>
+#include "helper.hpp"
+
+using seqan3::operator""_dna4;
+
+auto position = seqan3::detail::persist |
+                std::views::transform([] (auto && res) { return res.reference_begin_position(); });
+auto reference_id = seqan3::detail::persist |
+                    std::views::transform([] (auto && res) { return res.reference_id(); });
+
+using index_t = seqan3::kmer_index<seqan3::dna4, seqan3::text_layout::single>;
+
+seqan3::configuration const substitution_cfg =
+    seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}} |
+    seqan3::search_cfg::max_error_substitution{seqan3::search_cfg::error_count{1}} |
+    seqan3::search_cfg::max_error_insertion{seqan3::search_cfg::error_count{0}} |
+    seqan3::search_cfg::max_error_deletion{seqan3::search_cfg::error_count{0}};
+
+TEST(search_kmer_index_test, error_free)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+    index_t index{text, seqan3::ungapped{3}};
+
+    EXPECT_RANGE_EQ(search("ACGT"_dna4, index) | position, (std::vector{0, 4, 8}));
+    EXPECT_RANGE_EQ(search("ACGTACGTACGT"_dna4, index) | position, (std::vector{0}));
+    EXPECT_RANGE_EQ(search("ACGG"_dna4, index) | position, (std::vector<int>{}));
+
+    // The query is longer than the remaining text.
+    EXPECT_RANGE_EQ(search("ACGTAC"_dna4, index) | position, (std::vector{0, 4}));
+}
+
+TEST(search_kmer_index_test, gapped_shape)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+    index_t index{text, seqan3::bin_literal{0b1101}};
+
+    EXPECT_RANGE_EQ(search("ACGTA"_dna4, index) | position, (std::vector{0, 4}));
+    EXPECT_RANGE_EQ(search("ACTTA"_dna4, index) | position, (std::vector<int>{}));
+    EXPECT_RANGE_EQ(search("ACTTACGT"_dna4, index, substitution_cfg) | position, (std::vector{0, 4}));
+}
+
+TEST(search_kmer_index_test, substitution)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+    index_t index{text, seqan3::ungapped{3}};
+
+    EXPECT_RANGE_EQ(search("ACGTTCGT"_dna4, index, substitution_cfg) | position, (std::vector{0, 4}));
+    EXPECT_RANGE_EQ(search("ACGTTCGA"_dna4, index, substitution_cfg) | position, (std::vector<int>{}));
+}
+
+TEST(search_kmer_index_test, edit_distance)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+    index_t index{text, seqan3::ungapped{3}};
+
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
+
+    // Deletion of the A at position 4 of the text.
+    EXPECT_RANGE_EQ(search("ACGTCGTA"_dna4, index, cfg) | position, (std::vector{0}));
+    EXPECT_RANGE_EQ(search("ACGTCGTA"_dna4, index, substitution_cfg) | position, (std::vector<int>{}));
+
+    // Insertion of a G after position 6 of the text.
+    EXPECT_RANGE_EQ(search("ACGTACGGTA"_dna4, index, cfg) | position, (std::vector{0}));
+
+    // Single error types cannot be restricted with insertions or deletions.
+    seqan3::configuration const invalid_cfg = cfg | seqan3::search_cfg::max_error_deletion{
+                                                        seqan3::search_cfg::error_count{0}} |
+                                                    seqan3::search_cfg::max_error_insertion{
+                                                        seqan3::search_cfg::error_count{1}};
+    EXPECT_THROW(search("ACGTCGTA"_dna4, index, invalid_cfg).begin(), std::invalid_argument);
+}
+
+TEST(search_kmer_index_test, too_short_query)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+    index_t index{text, seqan3::ungapped{3}};
+
+    EXPECT_THROW(search("AC"_dna4, index).begin(), std::invalid_argument);
+    EXPECT_THROW(search("ACGTA"_dna4, index, substitution_cfg).begin(), std::invalid_argument);
+}
+
+TEST(search_kmer_index_test, hit_strategies)
+{
+    seqan3::dna4_vector text{"AAAACCCCAAAACCCGAAAA"_dna4};
+    index_t index{text, seqan3::ungapped{3}};
+
+    EXPECT_RANGE_EQ(search("AAAACCCC"_dna4, index, substitution_cfg | seqan3::search_cfg::hit_all{}) | position,
+                    (std::vector{0, 8}));
+    EXPECT_RANGE_EQ(search("AAAACCCC"_dna4, index, substitution_cfg | seqan3::search_cfg::hit_all_best{}) | position,
+                    (std::vector{0}));
+    EXPECT_RANGE_EQ(search("AAAACCCC"_dna4, index, substitution_cfg | seqan3::search_cfg::hit_single_best{}) | position,
+                    (std::vector{0}));
+    EXPECT_RANGE_EQ(search("AAAACCCC"_dna4, index, substitution_cfg | seqan3::search_cfg::hit_strata{0}) | position,
+                    (std::vector{0}));
+    EXPECT_RANGE_EQ(search("AAAACCCC"_dna4, index, substitution_cfg | seqan3::search_cfg::hit_strata{1}) | position,
+                    (std::vector{0, 8}));
+    EXPECT_RANGE_EQ(search("AAAACCCG"_dna4, index, substitution_cfg | seqan3::search_cfg::hit_all_best{}) | position,
+                    (std::vector{8}));
+}
+
+TEST(search_kmer_index_test, collection)
+{
+    std::vector<seqan3::dna4_vector> texts{"ACGTACGT"_dna4, "AC"_dna4, "TTACGTAA"_dna4};
+    seqan3::kmer_index index{texts, seqan3::ungapped{3}};
+
+    // Matches do not span two texts.
+    EXPECT_RANGE_EQ(search("ACGTA"_dna4, index) | reference_id, (std::vector{0, 2}));
+    EXPECT_RANGE_EQ(search("ACGTA"_dna4, index) | position, (std::vector{0, 2}));
+    EXPECT_RANGE_EQ(search("GTACT"_dna4, index) | position, (std::vector<int>{}));
+    EXPECT_RANGE_EQ(search("GTACTT"_dna4, index, substitution_cfg) | position, (std::vector{2}));
+}
+
+TEST(search_kmer_index_test, batched_queries)
+{
+    seqan3::dna4_vector text{"ACGTACGTACGT"_dna4};
+    index_t index{text, seqan3::ungapped{3}};
+    std::vector<seqan3::dna4_vector> const queries{"ACGTTCGT"_dna4, "ACGGACGG"_dna4, "CGTACGTA"_dna4};
+
+    auto collect = [&] (auto const & cfg)
+    {
+        std::vector<std::ranges::range_value_t<decltype(search(queries, index, cfg))>> results{};
+        for (auto && result : search(queries, index, cfg))
+            results.push_back(result);
+        return results;
+    };
+
+    seqan3::configuration const cfg = substitution_cfg | seqan3::search_cfg::output_query_id{} |
+                                      seqan3::search_cfg::output_index_cursor{};
+    auto const expected = collect(cfg);
+    EXPECT_EQ(expected.size(), 3u);
+
+    for (size_t batch_size : {1u, 2u, 100u})
+        EXPECT_RANGE_EQ(collect(cfg | seqan3::search_cfg::batch{batch_size}), expected);
+}
@@ -142,3 +142,59 @@ TEST(search_scheme_test, error_distribution_disjoint_optimum_search_schemes)
     ret = check_disjoint_search_scheme<0, 3, false>();
     EXPECT_TRUE(ret);
 }
+
+TEST(search_scheme_test, error_distribution_generated_search_schemes)
+{
+    for (uint8_t max_error = 0; max_error <= 6; ++max_error)
+    {
+        for (uint8_t min_error = 0; min_error <= max_error; ++min_error)
+        {
+            for (uint8_t blocks = max_error + 1; blocks <= max_error + 3; ++blocks)
+            {
+                std::vector<std::vector<uint8_t> > expected, actual;
+                seqan3::search_scheme_error_distribution(actual, seqan3::detail::generate_search_scheme(min_error,
+                                                                                                        max_error,
+                                                                                                        blocks));
+                seqan3::search_scheme_error_distribution(expected, seqan3::trivial_search_scheme(min_error,
+                                                                                                 max_error,
+                                                                                                 blocks));
+                std::sort(expected.begin(), expected.end());
+                std::sort(actual.begin(), actual.end());
+                // Covers every error distribution exactly once.
+                EXPECT_EQ(actual, expected);
+            }
+        }
+    }
+}
+
+TEST(search_scheme_test, search_scheme_cost)
+{
+    seqan3::detail::search_scheme_dyn_type const trivial{{{1}, {0}, {4}}};
+    auto const generated = seqan3::detail::generate_search_scheme(0, 4, 5);
+
+    EXPECT_LT(seqan3::detail::search_scheme_cost(generated, 100, 4, 1'000'000),
+              seqan3::detail::search_scheme_cost(trivial, 100, 4, 1'000'000));
+    EXPECT_LT(seqan3::detail::search_scheme_cost(seqan3::detail::optimum_search_scheme<0, 3>, 100, 4, 1'000'000),
+              seqan3::detail::search_scheme_cost(seqan3::detail::search_scheme_dyn_type{{{1}, {0}, {3}}},
+                                                 100, 4, 1'000'000));
+}
+
+TEST(search_scheme_test, select_search_scheme)
+{
+    auto const selected = seqan3::detail::select_search_scheme(0, 5, 100, 4, 1'000'000);
+    EXPECT_GE(selected.front().blocks(), 6u);
+
+    // The overload taking the candidates returns a reference to one of them.
+    auto const candidates = seqan3::detail::search_scheme_candidates(0, 5);
+    ASSERT_EQ(candidates.size(), 4u);
+    auto const & selected_candidate = seqan3::detail::select_search_scheme(candidates, 100, 4, 1'000'000);
+    EXPECT_GE(&selected_candidate, candidates.data());
+    EXPECT_LT(&selected_candidate, candidates.data() + candidates.size());
+    EXPECT_EQ(selected_candidate.size(), selected.size());
+    EXPECT_EQ(selected_candidate.front().blocks(), selected.front().blocks());
+
+    // Too short to split the query into more blocks than errors.
+    auto const trivial = seqan3::detail::select_search_scheme(0, 5, 4, 4, 1'000'000);
+    EXPECT_EQ(trivial.size(), 1u);
+    EXPECT_EQ(trivial.front().blocks(), 1u);
+}
@@ -13,7 +13,9 @@
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/alphabet/quality/phred42.hpp>
 #include <seqan3/alphabet/quality/qualified.hpp>
+#include <seqan3/core/debug_stream/tuple.hpp>
 #include <seqan3/core/detail/persist_view.hpp>
+#include <seqan3/search/configuration/batch.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/max_error.hpp>
 #include <seqan3/search/configuration/on_result.hpp>
@@ -49,7 +51,10 @@ public:
 };
 
 using fm_index_types        = ::testing::Types<seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single>,
-                                               seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single>>;
+                                               seqan3::bi_fm_index<seqan3::dna4, seqan3::text_layout::single>,
+                                               seqan3::bi_fm_index<seqan3::dna4,
+                                                                   seqan3::text_layout::single,
+                                                                   seqan3::sdsl_epr_index_type<seqan3::dna4>>>;
 using fm_index_string_types = ::testing::Types<seqan3::fm_index<char, seqan3::text_layout::single>,
                                                seqan3::bi_fm_index<char, seqan3::text_layout::single>>;
 
@@ -144,6 +149,98 @@ TYPED_TEST(search_test, parallel_queries)
     EXPECT_RANGE_EQ(search(queries, this->index, cfg) | position, std::vector(num_queries, 0));
 }
 
+TYPED_TEST(search_test, lookup_table)
+{
+    seqan3::fm_index_construction_options options{};
+    options.lookup_table_depth = 3u;
+    TypeParam const index_lookup{this->text, options};
+
+    std::vector<std::vector<seqan3::dna4>> const queries{"ACGT"_dna4, "ACGG"_dna4, "TACG"_dna4, "CGTACGTACG"_dna4,
+                                                         "GGGG"_dna4, "T"_dna4, "AC"_dna4, "ACGTACGTACGT"_dna4};
+
+    auto collect = [&] (auto const & index, auto const & cfg)
+    {
+        std::vector<std::pair<size_t, size_t>> results{};
+        for (auto && result : search(queries, index, cfg))
+            results.emplace_back(result.query_id(), result.reference_begin_position());
+        std::ranges::sort(results);
+        return results;
+    };
+
+    // The first characters of exact, backtracking and search scheme searches are looked up in the table.
+    for (uint8_t errors : {0, 1, 2, 3})
+    {
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{errors}};
+        EXPECT_EQ(collect(index_lookup, cfg), collect(this->index, cfg));
+
+        seqan3::configuration const substitutions =
+            cfg | seqan3::search_cfg::max_error_substitution{seqan3::search_cfg::error_count{errors}};
+        EXPECT_EQ(collect(index_lookup, substitutions), collect(this->index, substitutions));
+    }
+
+    seqan3::configuration const batched = seqan3::search_cfg::batch{3};
+    EXPECT_EQ(collect(index_lookup, batched), collect(this->index, batched));
+}
+
+TYPED_TEST(search_test, batched_queries)
+{
+    std::vector<std::vector<seqan3::dna4>> const queries{"ACGT"_dna4, "ACGG"_dna4, "TACG"_dna4, "CGTACGTACG"_dna4,
+                                                         "GGGG"_dna4, "T"_dna4, "ACGTACGTACGT"_dna4};
+
+    auto collect = [&] (auto const & cfg)
+    {
+        std::vector<std::ranges::range_value_t<decltype(search(queries, this->index, cfg))>> results{};
+        for (auto && result : search(queries, this->index, cfg))
+            results.push_back(result);
+        return results;
+    };
+
+    {   // exact search
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{0}};
+        auto const expected = collect(cfg);
+        EXPECT_FALSE(expected.empty());
+
+        for (size_t batch_size : {1u, 3u, 7u, 100u})
+            EXPECT_RANGE_EQ(collect(cfg | seqan3::search_cfg::batch{batch_size}), expected);
+    }
+
+    {   // approximate search is delegated to the single query search
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_count{1}};
+        EXPECT_RANGE_EQ(collect(cfg | seqan3::search_cfg::batch{3}), collect(cfg));
+    }
+
+    {   // report cursors and single best hits
+        seqan3::configuration const cfg = seqan3::search_cfg::output_query_id{} |
+                                          seqan3::search_cfg::output_index_cursor{} |
+                                          seqan3::search_cfg::hit_single_best{};
+        EXPECT_RANGE_EQ(collect(cfg | seqan3::search_cfg::batch{4}), collect(cfg));
+    }
+
+    {   // parallel batches
+        seqan3::configuration const cfg = seqan3::search_cfg::parallel{
+                                              std::min<uint32_t>(2, std::thread::hardware_concurrency())};
+        EXPECT_RANGE_EQ(collect(cfg | seqan3::search_cfg::batch{2}), collect(seqan3::configuration{}));
+    }
+
+    {   // user callback
+        std::vector<size_t> actual_query_ids{};
+        seqan3::configuration const cfg = seqan3::search_cfg::batch{3} |
+                                          seqan3::search_cfg::on_result{[&] (auto && search_result) -> void
+        {
+            actual_query_ids.push_back(search_result.query_id());
+        }};
+
+        search(queries, this->index, cfg);
+        EXPECT_RANGE_EQ(actual_query_ids, search(queries, this->index) | query_id);
+    }
+}
+
+TYPED_TEST(search_test, invalid_batch_configuration)
+{
+    seqan3::configuration const cfg = seqan3::search_cfg::batch{0};
+    EXPECT_THROW(search("ACGT"_dna4, this->index, cfg), std::invalid_argument);
+}
+
 TYPED_TEST(search_test, invalid_error_configuration)
 {
     seqan3::configuration const cfg1 = seqan3::search_cfg::max_error_total{seqan3::search_cfg::error_rate{-0.5}};
@@ -332,3 +332,70 @@ TYPED_TEST(kmer_hash_gapped_test, issue2415)
         EXPECT_RANGE_EQ(gapped, v);
     }
 }
+
+TEST(kmer_hash_gapped_test, bit_extractor)
+{
+    EXPECT_EQ(seqan3::detail::bit_extractor{0u}(0xFFFF'FFFF'FFFF'FFFFULL), 0u);
+    EXPECT_EQ(seqan3::detail::bit_extractor{~0ULL}(0x0123'4567'89AB'CDEFULL), 0x0123'4567'89AB'CDEFULL);
+    EXPECT_EQ(seqan3::detail::bit_extractor{0b1111'0011u}(0b1101'0110u), 0b1101'10u);
+    EXPECT_EQ(seqan3::detail::bit_extractor{0x8000'0000'0000'0001ULL}(0xF000'0000'0000'000FULL), 0b11u);
+
+    // Compare to extracting bit by bit.
+    for (uint64_t const mask : {0x5555'5555'5555'5555ULL, 0x0F0F'00FF'3C3C'8001ULL, 0xFFFF'FFFF'0000'0000ULL})
+    {
+        seqan3::detail::bit_extractor const extractor{mask};
+        for (uint64_t const value : {0x0123'4567'89AB'CDEFULL, 0xFEDC'BA98'7654'3210ULL, 0xAAAA'AAAA'AAAA'AAAAULL})
+        {
+            uint64_t expected{};
+            for (size_t bit = 0, result_bit = 0; bit < 64u; ++bit)
+                if ((mask >> bit) & 1u)
+                    expected |= ((value >> bit) & 1u) << result_bit++;
+
+            EXPECT_EQ(extractor(value), expected);
+        }
+    }
+}
+
+// Gapped shapes of 2-bit alphabets are hashed with a packed window of all positions if they fit into 64 bits.
+TEST(kmer_hash_gapped_test, packed_window)
+{
+    std::vector<seqan3::dna4> text{};
+    for (size_t i = 0; i < 200u; ++i)
+        text.push_back(seqan3::assign_rank_to((i * 7u + i / 5u + i * i) % 4u, seqan3::dna4{}));
+
+    auto naive_hashes = [&text] (seqan3::shape const & shape)
+    {
+        result_t hashes{};
+        for (size_t begin = 0; begin + shape.size() <= text.size(); ++begin)
+        {
+            size_t hash{};
+            for (size_t i = 0; i < shape.size(); ++i)
+                if (shape[i])
+                    hash = hash * 4u + seqan3::to_rank(text[begin + i]);
+            hashes.push_back(hash);
+        }
+        return hashes;
+    };
+
+    // Short shapes and shapes of the maximal span of 32, i.e. a window of 62 bits.
+    for (seqan3::shape const & shape : {0b11_shape,
+                                        0b1101101101_shape,
+                                        seqan3::shape{0b1000'0000'0000'0000'0000'0000'0000'0001_shape},
+                                        seqan3::shape{0b1101'1000'0000'0000'0000'0000'0000'0011_shape}})
+    {
+        result_t const expected = naive_hashes(shape);
+        auto view = text | seqan3::views::kmer_hash(shape);
+
+        EXPECT_RANGE_EQ(view, expected);
+        EXPECT_RANGE_EQ(view | std::views::reverse, expected | std::views::reverse);
+
+        // Jumping and stepping mixed.
+        auto it = view.begin();
+        it += 17;
+        ++it;
+        EXPECT_EQ(*it, expected[18]);
+        --it;
+        --it;
+        EXPECT_EQ(*it, expected[16]);
+    }
+}
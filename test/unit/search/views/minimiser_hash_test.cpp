@@ -5,13 +5,21 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <seqan3/std/algorithm>
 #include <forward_list>
 #include <list>
+#include <vector>
 
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
+#include <seqan3/alphabet/nucleotide/concept.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna16sam.hpp>
+#include <seqan3/alphabet/nucleotide/dna3bs.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/search/views/minimiser_hash.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
 
 #include <gtest/gtest.h>
 
@@ -58,7 +66,9 @@ using underlying_range_types = ::testing::Types<std::vector<seqan3::dna4>,
                                                 seqan3::bitpacked_sequence<seqan3::dna4>,
                                                 seqan3::bitpacked_sequence<seqan3::dna4> const,
                                                 std::list<seqan3::dna4>,
-                                                std::list<seqan3::dna4> const>;
+                                                std::list<seqan3::dna4> const,
+                                                std::forward_list<seqan3::dna4>,
+                                                std::forward_list<seqan3::dna4> const>;
 
 TYPED_TEST_SUITE(minimiser_hash_properties_test, underlying_range_types, );
 class minimiser_hash_test : public ::testing::Test
@@ -122,3 +132,126 @@ TEST_F(minimiser_hash_test, shape_bigger_than_window)
     EXPECT_THROW(text1 | seqan3::views::minimiser_hash(ungapped_shape, seqan3::window_size{3}), std::invalid_argument);
     EXPECT_THROW(text1 | seqan3::views::minimiser_hash(gapped_shape, seqan3::window_size{3}), std::invalid_argument);
 }
+
+TEST_F(minimiser_hash_test, shape_too_long)
+{
+    EXPECT_THROW(text1 | seqan3::views::minimiser_hash(seqan3::ungapped{33}, seqan3::window_size{40}),
+                 std::invalid_argument);
+}
+
+// The minimisers of the k-mer hash values of both strands, computed by brute force.
+template <typename text_t>
+result_t brute_force_minimisers(text_t const & text, seqan3::shape const & shape, size_t const window_size,
+                                uint64_t const seed)
+{
+    using alphabet_t = std::ranges::range_value_t<text_t>;
+    uint64_t const sigma = seqan3::alphabet_size<alphabet_t>;
+
+    auto kmer_hash = [&] (auto const & sequence, size_t const position)
+    {
+        uint64_t hash{0};
+        for (size_t i = 0; i < shape.size(); ++i)
+            if (shape[i])
+                hash = hash * sigma + seqan3::to_rank(sequence[position + i]);
+        return hash;
+    };
+
+    if (text.size() < shape.size())
+        return {};
+
+    std::vector<alphabet_t> reverse_complement{};
+    for (size_t i = text.size(); i-- > 0;)
+        reverse_complement.push_back(seqan3::complement(text[i]));
+
+    // The value of each k-mer is the smaller hash value of both strands.
+    size_t const kmer_count = text.size() - shape.size() + 1;
+    std::vector<uint64_t> values{};
+    for (size_t i = 0; i < kmer_count; ++i)
+        values.push_back(std::min(kmer_hash(text, i) ^ seed,
+                                  kmer_hash(reverse_complement, kmer_count - 1 - i) ^ seed));
+
+    // A minimiser is reported when the previous one leaves the window, or when a smaller value enters the window.
+    // When it leaves, the new minimiser is the rightmost minimum of the window.
+    size_t const kmers_per_window = std::min(window_size - shape.size() + 1, kmer_count);
+    auto rightmost_minimum = [&] (size_t const begin)
+    {
+        size_t minimum = begin;
+        for (size_t i = begin; i < begin + kmers_per_window; ++i)
+            if (values[i] <= values[minimum])
+                minimum = i;
+        return minimum;
+    };
+
+    size_t minimiser = rightmost_minimum(0);
+    result_t result{values[minimiser]};
+    for (size_t begin = 1; begin + kmers_per_window <= kmer_count; ++begin)
+    {
+        size_t const end = begin + kmers_per_window - 1;
+        if (minimiser < begin)
+            minimiser = rightmost_minimum(begin);
+        else if (values[end] < values[minimiser])
+            minimiser = end;
+        else
+            continue;
+
+        result.push_back(values[minimiser]);
+    }
+    return result;
+}
+
+template <typename alphabet_t>
+class minimiser_hash_strands_test : public ::testing::Test {};
+
+using strand_alphabet_types = ::testing::Types<seqan3::dna4,
+                                               seqan3::dna5,
+                                               seqan3::dna15,
+                                               seqan3::dna16sam,
+                                               seqan3::dna3bs>;
+
+TYPED_TEST_SUITE(minimiser_hash_strands_test, strand_alphabet_types, );
+
+TYPED_TEST(minimiser_hash_strands_test, same_as_brute_force)
+{
+    // The longest ungapped shape that seqan3::views::kmer_hash accepts.
+    uint8_t const max_shape_size = 64 / std::log2(seqan3::alphabet_size<TypeParam>);
+
+    std::vector<seqan3::shape> shapes{seqan3::ungapped{1},
+                                      seqan3::ungapped{5},
+                                      seqan3::ungapped{max_shape_size},
+                                      0b1001_shape,
+                                      0b1100111_shape,
+                                      0b110111011_shape,
+                                      seqan3::shape{seqan3::bin_literal{(1ULL << (max_shape_size - 1)) | 0b1011}}};
+
+    std::vector<std::vector<TypeParam>> texts{};
+    for (size_t seed{0}; seed < 4u; ++seed)
+        texts.push_back(seqan3::test::generate_sequence<TypeParam>(200, 199, seed));
+
+    // Repetitive texts have many equal hash values.
+    std::vector<TypeParam> repeat = seqan3::test::generate_sequence<TypeParam>(3, 0, 42);
+    texts.emplace_back();
+    for (size_t i{0}; i < 60u; ++i)
+        texts.back().insert(texts.back().end(), repeat.begin(), repeat.end());
+    texts.emplace_back(100, seqan3::assign_rank_to(0u, TypeParam{}));
+
+    for (seqan3::shape const & shape : shapes)
+    {
+        for (uint32_t const window_size : {shape.size() + 0u, shape.size() + 3u, shape.size() + 20u})
+        {
+            for (uint64_t const seed : {uint64_t{0u}, uint64_t{0x8F3F73B5CF1C9ADE}})
+            {
+                for (std::vector<TypeParam> const & text : texts)
+                {
+                    result_t const expected = brute_force_minimisers(text, shape, window_size, seed);
+                    auto minimisers = seqan3::views::minimiser_hash(shape,
+                                                                    seqan3::window_size{window_size},
+                                                                    seqan3::seed{seed});
+                    EXPECT_RANGE_EQ(expected, text | minimisers);
+
+                    std::forward_list<TypeParam> const forward_text(text.begin(), text.end());
+                    EXPECT_RANGE_EQ(expected, forward_text | minimisers);
+                }
+            }
+        }
+    }
+}
@@ -7,6 +7,8 @@
 
 #include <forward_list>
 #include <list>
+#include <numeric>
+#include <random>
 #include <type_traits>
 
 #include <seqan3/alphabet/container/bitpacked_sequence.hpp>
@@ -286,3 +288,57 @@ TEST_F(minimiser_test, iterator_base)
     EXPECT_EQ(minimiser_it, minimiser.end());
     EXPECT_EQ(minimiser_it.base(), hash_end);
 }
+
+TEST_F(minimiser_test, same_as_rescanning_the_window)
+{
+    // The minimiser is kept until it leaves the window or a smaller value enters it. When it leaves, the new minimiser
+    // is the rightmost minimum of the window.
+    auto rescanning_minimisers = [] (std::vector<size_t> const & values, size_t const window_size)
+    {
+        std::vector<size_t> result{};
+        if (values.empty())
+            return result;
+
+        size_t const size = std::min(window_size, values.size());
+        size_t minimiser_position{};
+        for (size_t window_end = size - 1u; window_end < values.size(); ++window_end)
+        {
+            size_t const window_begin = window_end + 1u - size;
+            if (window_end + 1u == size || minimiser_position < window_begin)
+            {
+                minimiser_position = window_begin;
+                for (size_t i = window_begin; i <= window_end; ++i)
+                    if (values[i] <= values[minimiser_position])
+                        minimiser_position = i;
+                result.push_back(values[minimiser_position]);
+            }
+            else if (values[window_end] < values[minimiser_position])
+            {
+                minimiser_position = window_end;
+                result.push_back(values[minimiser_position]);
+            }
+        }
+        return result;
+    };
+
+    std::mt19937_64 random_engine{42};
+    for (size_t distinct_values : {2u, 5u, 1000u})
+    {
+        for (size_t i = 0; i < 50u; ++i)
+        {
+            std::vector<size_t> values(random_engine() % 200u);
+            for (size_t & value : values)
+                value = random_engine() % distinct_values;
+
+            // Increasing and decreasing values are the worst cases for rescanning and for a monotone queue.
+            if (i % 5u == 0u)
+                std::iota(values.begin(), values.end(), 0u);
+            if (i % 5u == 1u)
+                std::iota(values.rbegin(), values.rend(), 0u);
+
+            for (size_t window_size : {2u, 3u, 7u, 16u, 33u})
+                EXPECT_RANGE_EQ(rescanning_minimisers(values, window_size),
+                                values | seqan3::views::minimiser(window_size));
+        }
+    }
+}
@@ -0,0 +1,279 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <vector>
+
+#include <seqan3/test/cereal.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+#include <seqan3/utility/bloom_filter/blocked_bloom_filter.hpp>
+#include <seqan3/utility/bloom_filter/bloom_filter.hpp>
+
+template <typename bf_type>
+struct blocked_bloom_filter_test : public ::testing::Test
+{
+    static bf_type make_bf(seqan3::bin_size bits)
+    {
+        return bf_type{seqan3::blocked_bloom_filter{bits}};
+    }
+
+    static bf_type make_bf(seqan3::bin_size bits, seqan3::hash_function_count funs)
+    {
+        return bf_type{seqan3::blocked_bloom_filter{bits, funs}};
+    }
+};
+
+using bf_types = ::testing::Types<seqan3::blocked_bloom_filter<seqan3::data_layout::uncompressed>,
+                                  seqan3::blocked_bloom_filter<seqan3::data_layout::compressed>>;
+
+TYPED_TEST_SUITE(blocked_bloom_filter_test, bf_types, );
+
+template <typename simd_t>
+static void test_block_contains_bits()
+{
+    for (uint64_t bit_hash : {0x0123456789ABCDEFULL, 0xFEDCBA9876543210ULL, 0xE000000000000000ULL})
+    {
+        for (size_t bit_count = 1; bit_count <= 8u; ++bit_count)
+        {
+            std::array<uint64_t, 8> block{};
+            EXPECT_FALSE(seqan3::detail::block_contains_bits<simd_t>(block.data(), bit_hash, bit_count));
+
+            for (size_t i = 0; i < bit_count; ++i)
+            {
+                auto const [word, bit] = seqan3::detail::blocked_bloom_filter_position(bit_hash, i);
+                block[word] |= 1ULL << bit;
+            }
+            EXPECT_TRUE(seqan3::detail::block_contains_bits<simd_t>(block.data(), bit_hash, bit_count));
+
+            // Every bit is needed.
+            for (size_t i = 0; i < bit_count; ++i)
+            {
+                auto const [word, bit] = seqan3::detail::blocked_bloom_filter_position(bit_hash, i);
+                std::array<uint64_t, 8> incomplete{block};
+                incomplete[word] ^= 1ULL << bit;
+                EXPECT_FALSE(seqan3::detail::block_contains_bits<simd_t>(incomplete.data(), bit_hash, bit_count));
+            }
+        }
+    }
+}
+
+TEST(block_contains_bits_test, simd_and_scalar)
+{
+    // The bits of different hash functions lie in different words.
+    for (size_t i = 1; i < 8u; ++i)
+        EXPECT_NE(seqan3::detail::blocked_bloom_filter_position(0xE000000000000000ULL, i).first,
+                  seqan3::detail::blocked_bloom_filter_position(0xE000000000000000ULL, 0u).first);
+
+    test_block_contains_bits<seqan3::simd::simd_type_t<uint64_t>>(); // simd test if AVX2 or AVX-512 is available
+    test_block_contains_bits<seqan3::simd::simd_type_t<uint64_t, 1>>(); // word by word
+}
+
+TYPED_TEST(blocked_bloom_filter_test, construction)
+{
+    EXPECT_TRUE(std::is_default_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_constructible_v<TypeParam>);
+    EXPECT_TRUE(std::is_copy_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_move_assignable_v<TypeParam>);
+    EXPECT_TRUE(std::is_destructible_v<TypeParam>);
+
+    // num hash functions defaults to two
+    TypeParam bf1{TestFixture::make_bf(seqan3::bin_size{1024u})};
+    TypeParam bf2{TestFixture::make_bf(seqan3::bin_size{1024u}, seqan3::hash_function_count{2u})};
+    EXPECT_TRUE(bf1 == bf2);
+
+    // bin_size parameter is too small
+    EXPECT_THROW((TestFixture::make_bf(seqan3::bin_size{0u})), std::logic_error);
+    // not enough hash functions
+    EXPECT_THROW((TestFixture::make_bf(seqan3::bin_size{32u}, seqan3::hash_function_count{0u})), std::logic_error);
+    // too many hash functions
+    EXPECT_THROW((TestFixture::make_bf(seqan3::bin_size{32u}, seqan3::hash_function_count{6u})), std::logic_error);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, member_getter)
+{
+    TypeParam t1{TestFixture::make_bf(seqan3::bin_size{1024u})};
+    EXPECT_EQ(t1.bit_size(), 1024u);
+    EXPECT_EQ(t1.hash_function_count(), 2u);
+
+    // The size is rounded up to whole blocks.
+    TypeParam t2{TestFixture::make_bf(seqan3::bin_size{1025u}, seqan3::hash_function_count{3u})};
+    EXPECT_EQ(t2.bit_size(), 1536u);
+    EXPECT_EQ(t2.hash_function_count(), 3u);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, contains)
+{
+    TypeParam bf{TestFixture::make_bf(seqan3::bin_size{1024u})};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        EXPECT_FALSE(bf.contains(hash));
+}
+
+TYPED_TEST(blocked_bloom_filter_test, emplace)
+{
+    // 1. Test uncompressed Bloom Filter directly because the compressed one is not mutable.
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}, seqan3::hash_function_count{5u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        bf.emplace(hash);
+
+    // 2. Construct either the uncompressed or compressed Bloom Filter and test via contains
+    TypeParam bf2{bf};
+    for (size_t hash : std::views::iota(0u, 64u))
+        EXPECT_TRUE(bf2.contains(hash));
+}
+
+TYPED_TEST(blocked_bloom_filter_test, bulk_contains)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1u << 16}, seqan3::hash_function_count{3u}};
+    for (size_t hash = 0; hash < 1000u; hash += 2)
+        bf.emplace(hash);
+
+    TypeParam bf2{bf};
+
+    // More values than fit into one batch.
+    std::vector<bool> result{};
+    bf2.bulk_contains(std::views::iota(0u, 1000u), std::back_inserter(result));
+    ASSERT_EQ(result.size(), 1000u);
+
+    size_t false_positives{};
+    for (size_t hash = 0; hash < 1000u; ++hash)
+    {
+        EXPECT_EQ(result[hash], bf2.contains(hash));
+        if (hash % 2u == 0u)
+            EXPECT_TRUE(result[hash]);
+        else
+            false_positives += result[hash];
+    }
+
+    // 500 values in 128 blocks with 3 hash functions: the false positive rate is far below 5%.
+    EXPECT_LE(false_positives, 25u);
+    EXPECT_EQ(bf2.count(std::views::iota(0u, 1000u)), 500u + false_positives);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, counting)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}, seqan3::hash_function_count{2u}};
+
+    for (size_t hash : std::views::iota(0u, 128u))
+        bf.emplace(hash);
+
+    TypeParam bf2{bf};
+    EXPECT_EQ(bf2.count(std::views::iota(0u, 128u)), 128u);
+    EXPECT_EQ(bf2.count(std::views::iota(22u, 42u)), 20u);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, reset)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}, seqan3::hash_function_count{2u}};
+
+    for (size_t hash : std::views::iota(0u, 64u))
+        bf.emplace(hash);
+
+    bf.reset();
+
+    TypeParam bf2{bf};
+    EXPECT_EQ(bf2.count(std::views::iota(0u, 64u)), 0u);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, data_access)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}};
+    EXPECT_EQ(bf.raw_data().size(), 16u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(bf.raw_data().data()) % 64u, 0u);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, serialisation)
+{
+    seqan3::blocked_bloom_filter tmp{seqan3::bin_size{1024u}};
+    tmp.emplace(42u);
+    TypeParam bf{tmp};
+    seqan3::test::do_serialisation(bf);
+}
+
+TYPED_TEST(blocked_bloom_filter_test, store_and_load)
+{
+    seqan3::blocked_bloom_filter tmp{seqan3::bin_size{1000u}};
+    for (size_t hash = 0; hash < 100; hash += 3)
+        tmp.emplace(hash);
+
+    TypeParam bf{tmp};
+    seqan3::test::tmp_filename filename{"filter.bf"};
+    bf.store(filename.get_path());
+
+    TypeParam loaded{};
+    loaded.load(filename.get_path());
+    EXPECT_TRUE(bf == loaded);
+    EXPECT_EQ(loaded.bit_size(), 1024u);
+    EXPECT_EQ(loaded.count(std::views::iota(0u, 200u)), bf.count(std::views::iota(0u, 200u)));
+    for (size_t hash = 0; hash < 100; hash += 3)
+        EXPECT_TRUE(loaded.contains(hash));
+
+    TypeParam copy{loaded};
+    seqan3::test::do_serialisation(copy);
+
+    // A file that contains an unblocked Bloom Filter.
+    seqan3::bloom_filter<TypeParam::data_layout_mode>{seqan3::bloom_filter{seqan3::bin_size{1024u}}}
+        .store(filename.get_path());
+    EXPECT_THROW(loaded.load(filename.get_path()), std::logic_error);
+
+    // A file that does not contain a filter.
+    {
+        std::ofstream out{filename.get_path()};
+        out << "This is not a filter.";
+    }
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+}
+
+TEST(blocked_bloom_filter_test, load_into_bloom_filter)
+{
+    seqan3::test::tmp_filename filename{"filter.bf"};
+    seqan3::blocked_bloom_filter{seqan3::bin_size{1024u}}.store(filename.get_path());
+
+    seqan3::bloom_filter bf{};
+    EXPECT_THROW(bf.load(filename.get_path()), std::logic_error);
+}
+
+TEST(blocked_bloom_filter_test, load_modify)
+{
+    seqan3::blocked_bloom_filter bf{seqan3::bin_size{1024u}};
+    bf.emplace(3u);
+    seqan3::test::tmp_filename filename{"filter.bf"};
+    bf.store(filename.get_path());
+
+    // Emplacing copies the bitvector of a loaded filter; copies keep the mapped bitvector.
+    seqan3::blocked_bloom_filter loaded{};
+    loaded.load(filename.get_path());
+    seqan3::blocked_bloom_filter copy{loaded};
+    loaded.emplace(42u);
+    EXPECT_TRUE(loaded.contains(3u));
+    EXPECT_TRUE(loaded.contains(42u));
+    EXPECT_TRUE(copy == bf);
+
+    copy.reset();
+    EXPECT_FALSE(copy.contains(3u));
+    EXPECT_EQ(copy.bit_size(), 1024u);
+
+    // Overwrites the 64 bit header field at the given offset of a valid file.
+    auto store_with_field = [&] (std::streamoff const offset, uint64_t const value)
+    {
+        bf.store(filename.get_path());
+        std::fstream file{filename.get_path(), std::ios::in | std::ios::out | std::ios::binary};
+        file.seekp(offset);
+        file.write(reinterpret_cast<char const *>(&value), sizeof(value));
+    };
+
+    store_with_field(32, 1000u); // not a multiple of the block size
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(48, 9u); // too many hash functions
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+    store_with_field(48, 8u);
+    EXPECT_NO_THROW(loaded.load(filename.get_path()));
+}
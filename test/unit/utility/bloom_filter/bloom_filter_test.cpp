@@ -7,8 +7,11 @@
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 #include <seqan3/test/cereal.hpp>
 #include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_filename.hpp>
 #include <seqan3/utility/bloom_filter/bloom_filter.hpp>
 
 template <typename bf_type>
@@ -142,3 +145,66 @@ TYPED_TEST(bloom_filter_test, serialisation)
     TypeParam bf{TestFixture::make_bf(seqan3::bin_size{1024u})};
     seqan3::test::do_serialisation(bf);
 }
+
+TYPED_TEST(bloom_filter_test, store_and_load)
+{
+    seqan3::bloom_filter tmp{seqan3::bin_size{1000u}};
+    for (size_t hash = 0; hash < 100; hash += 3)
+        tmp.emplace(hash);
+
+    TypeParam bf{tmp};
+    seqan3::test::tmp_filename filename{"filter.bf"};
+    bf.store(filename.get_path());
+
+    TypeParam loaded{};
+    loaded.load(filename.get_path());
+    EXPECT_TRUE(bf == loaded);
+    EXPECT_EQ(loaded.bit_size(), 1000u);
+    EXPECT_EQ(loaded.count(std::views::iota(0u, 200u)), bf.count(std::views::iota(0u, 200u)));
+    for (size_t hash = 0; hash < 100; hash += 3)
+        EXPECT_TRUE(loaded.contains(hash));
+
+    TypeParam copy{loaded};
+    seqan3::test::do_serialisation(copy);
+
+    // A file that contains an Interleaved Bloom Filter.
+    seqan3::interleaved_bloom_filter{seqan3::bin_count{1u}, seqan3::bin_size{1000u}}.store(filename.get_path());
+    EXPECT_THROW(loaded.load(filename.get_path()), std::logic_error);
+
+    // A file that does not contain a filter.
+    {
+        std::ofstream out{filename.get_path()};
+        out << "This is not a filter.";
+    }
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+}
+
+TEST(bloom_filter_test, load_modify)
+{
+    seqan3::bloom_filter bf{seqan3::bin_size{1000u}};
+    bf.emplace(3u);
+    seqan3::test::tmp_filename filename{"filter.bf"};
+    bf.store(filename.get_path());
+
+    // Emplacing copies the bitvector of a loaded filter; copies keep the mapped bitvector.
+    seqan3::bloom_filter loaded{};
+    loaded.load(filename.get_path());
+    seqan3::bloom_filter copy{loaded};
+    loaded.emplace(42u);
+    EXPECT_TRUE(loaded.contains(3u));
+    EXPECT_TRUE(loaded.contains(42u));
+    EXPECT_TRUE(copy == bf);
+
+    copy.reset();
+    EXPECT_FALSE(copy.contains(3u));
+    EXPECT_EQ(copy.bit_size(), 1000u);
+
+    // A header with invalid hash function parameters.
+    {
+        std::fstream file{filename.get_path(), std::ios::in | std::ios::out | std::ios::binary};
+        uint64_t const hash_funs{6u};
+        file.seekp(48);
+        file.write(reinterpret_cast<char const *>(&hash_funs), sizeof(hash_funs));
+    }
+    EXPECT_THROW(loaded.load(filename.get_path()), std::runtime_error);
+}
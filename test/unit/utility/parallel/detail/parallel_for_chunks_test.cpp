@@ -0,0 +1,93 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2021, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2021, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <seqan3/utility/parallel/detail/parallel_for_chunks.hpp>
+
+TEST(parallel_for_chunks, covers_every_element_once)
+{
+    for (size_t const thread_count : {0u, 1u, 4u})
+    {
+        std::vector<std::atomic<size_t>> visits(1000);
+        seqan3::detail::parallel_for_chunks(visits.size(), 64u, thread_count, [&] (size_t const begin, size_t const end)
+        {
+            EXPECT_LT(begin, end);
+            EXPECT_EQ(begin % 64u, 0u);
+            for (size_t i = begin; i < end; ++i)
+                ++visits[i];
+        });
+
+        for (auto const & count : visits)
+            EXPECT_EQ(count.load(), 1u);
+    }
+}
+
+TEST(parallel_for_chunks, single_chunk_in_calling_thread)
+{
+    std::thread::id caller{};
+    size_t calls{};
+    seqan3::detail::parallel_for_chunks(10u, 64u, 4u, [&] (size_t const begin, size_t const end)
+    {
+        caller = std::this_thread::get_id();
+        EXPECT_EQ(begin, 0u);
+        EXPECT_EQ(end, 10u);
+        ++calls;
+    });
+
+    EXPECT_EQ(calls, 1u);
+    EXPECT_EQ(caller, std::this_thread::get_id());
+
+    seqan3::detail::parallel_for_chunks(0u, 64u, 4u, [&] (size_t, size_t) { ++calls; });
+    EXPECT_EQ(calls, 1u);
+}
+
+TEST(parallel_for_chunks, rethrows)
+{
+    auto throwing = [] (size_t const begin, size_t)
+    {
+        if (begin == 128u)
+            throw std::runtime_error{"chunk"};
+    };
+
+    EXPECT_THROW(seqan3::detail::parallel_for_chunks(1000u, 64u, 4u, throwing), std::runtime_error);
+}
+
+TEST(chunk_thread_pool, reuse)
+{
+    seqan3::detail::chunk_thread_pool pool{4u};
+    EXPECT_EQ(pool.thread_count(), 4u);
+
+    std::atomic<size_t> sum{};
+    for (size_t job = 0; job < 100u; ++job)
+    {
+        pool.for_each_chunk(job * 10u, 7u, [&] (size_t const begin, size_t const end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                sum += i;
+        });
+    }
+
+    size_t expected{};
+    for (size_t job = 0; job < 100u; ++job)
+        expected += job * 10u * (job * 10u - 1u) / 2u; // 0 + 1 + ... + (job * 10 - 1)
+
+    EXPECT_EQ(sum.load(), expected);
+
+    // The pool can be used after an exception.
+    EXPECT_THROW(pool.for_each_chunk(100u, 1u, [] (size_t, size_t) { throw std::runtime_error{"chunk"}; }),
+                 std::runtime_error);
+
+    std::atomic<size_t> calls{};
+    pool.for_each_chunk(100u, 1u, [&] (size_t, size_t) { ++calls; });
+    EXPECT_EQ(calls.load(), 100u);
+}